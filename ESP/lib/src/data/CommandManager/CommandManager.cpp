@@ -24,15 +24,18 @@ void CommandManager::handleCommands(CommandsPayload commandsPayload) {
     return;
   }
 
+  bool changed = false;
   for (JsonVariant commandData :
        commandsPayload.data["commands"].as<JsonArray>()) {
-    this->handleCommand(commandData);
+    changed |= this->handleCommand(commandData);
   }
 
-  this->deviceConfig->save();
+  // saving restarts the device, queries like ping or profile must not
+  if (changed)
+    this->deviceConfig->save();
 }
 
-void CommandManager::handleCommand(JsonVariant command) {
+bool CommandManager::handleCommand(JsonVariant command) {
   auto command_type = this->getCommandType(command);
 
   switch (command_type) {
@@ -56,7 +59,7 @@ void CommandManager::handleCommand(JsonVariant command) {
                                         0,  // power, should this be zero?
                                         false, false);
 
-      break;
+      return true;
     }
     case CommandType::SET_MDNS: {
       if (!this->hasDataField(command))
@@ -69,13 +72,20 @@ void CommandManager::handleCommand(JsonVariant command) {
       this->deviceConfig->setMDNSConfig(command["data"]["hostname"],
                                         "openiristracker", false);
 
-      break;
+      return true;
     }
     case CommandType::PING: {
-      Serial.println("PONG \n\r");
+      Hal::console().println("PONG \n\r");
+      break;
+    }
+    case CommandType::PROFILE: {
+#ifndef OPENIRIS_HOST
+      profiler.writeText(Hal::console());
+#endif  // OPENIRIS_HOST
       break;
     }
     default:
       break;
   }
+  return false;
 }
\ No newline at end of file
@@ -4,12 +4,17 @@
 #include <ArduinoJson.h>
 #include <unordered_map>
 #include "data/config/project_config.hpp"
+#include "hal/hal.hpp"
+#ifndef OPENIRIS_HOST
+#include "tasks/tasks.hpp"
+#endif  // OPENIRIS_HOST
 
 enum CommandType {
   None,
   PING,
   SET_WIFI,
   SET_MDNS,
+  PROFILE,
 };
 
 struct CommandsPayload {
@@ -22,12 +27,14 @@ class CommandManager {
       {"ping", CommandType::PING},
       {"set_wifi", CommandType::SET_WIFI},
       {"set_mdns", CommandType::SET_MDNS},
+      {"profile", CommandType::PROFILE},
   };
 
   ProjectConfig* deviceConfig;
 
   bool hasDataField(JsonVariant& command);
-  void handleCommand(JsonVariant command);
+  //! true if the command changed the config
+  bool handleCommand(JsonVariant command);
   const CommandType getCommandType(JsonVariant& command);
 
  public:
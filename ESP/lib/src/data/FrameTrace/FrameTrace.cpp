@@ -0,0 +1,153 @@
+#include "FrameTrace.hpp"
+
+FrameTracer frameTracer;
+
+namespace {
+  //! one trace event per gap between two timestamps of a record
+  const char* const stageNames[] = {"capture", "queue", "send", "return"};
+  constexpr uint8_t STAGE_COUNT = sizeof(stageNames) / sizeof(stageNames[0]);
+
+  const char* const TRACE_HEADER =
+      "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["
+      "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+      "\"args\":{\"name\":\"http\"}},"
+      "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,"
+      "\"args\":{\"name\":\"udp\"}}";
+  const char* const TRACE_FOOTER = "]}";
+
+  void* allocate(size_t size) {
+    return psramFound() ? ps_calloc(1, size) : calloc(1, size);
+  }
+}  // namespace
+
+void FrameTracer::begin() {
+  if (this->ring)
+    return;
+
+  size_t capacity =
+      psramFound() ? FRAME_TRACE_CAPACITY : FRAME_TRACE_CAPACITY_DRAM;
+  // the sequence numbers are plain loads and stores, which work in PSRAM too
+  this->ring = static_cast<Slot_t*>(allocate(capacity * sizeof(Slot_t)));
+  if (!this->ring) {
+    log_e("[FrameTrace]: Not enough memory for %u records", (unsigned)capacity);
+    return;
+  }
+  this->capacity = capacity;
+  log_i("[FrameTrace]: Recording the last %u frames", (unsigned)capacity);
+}
+
+void FrameTracer::record(const Record_t& record) {
+  if (!this->capacity)
+    return;
+
+  uint32_t index = this->head.fetch_add(1, std::memory_order_relaxed);
+  Slot_t& slot = this->ring[index % this->capacity];
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.record = record;
+  slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+size_t FrameTracer::snapshot(Record_t* out, size_t max) {
+  if (!this->capacity)
+    return 0;
+
+  uint32_t end = this->head.load(std::memory_order_acquire);
+  uint32_t available = end < this->capacity ? end : this->capacity;
+  if (available > max)
+    available = max;
+
+  size_t copied = 0;
+  for (uint32_t index = end - available; index != end; index++) {
+    Slot_t& slot = this->ring[index % this->capacity];
+    if (slot.sequence.load(std::memory_order_acquire) != index + 1)
+      continue;
+    out[copied] = slot.record;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // a writer got to the slot while it was copied
+    if (slot.sequence.load(std::memory_order_relaxed) != index + 1)
+      continue;
+    copied++;
+  }
+  return copied;
+}
+
+FrameTracer::Export::Export(FrameTracer& tracer) {
+  if (!tracer.capacity)
+    return;
+  this->records =
+      static_cast<Record_t*>(allocate(tracer.capacity * sizeof(Record_t)));
+  if (this->records)
+    this->count = tracer.snapshot(this->records, tracer.capacity);
+}
+
+FrameTracer::Export::~Export() {
+  free(this->records);
+}
+
+bool FrameTracer::Export::next() {
+  this->pendingPosition = 0;
+  this->pendingLength = 0;
+
+  switch (this->phase) {
+    case Phase_Header:
+      this->pendingLength = strlcpy(this->pending, TRACE_HEADER,
+                                    sizeof(this->pending));
+      this->phase = Phase_Records;
+      return true;
+    case Phase_Records:
+      while (this->position < this->count) {
+        const Record_t& record = this->records[this->position];
+        const int64_t times[] = {record.vsync, record.captured,
+                                 record.firstByte, record.lastByte,
+                                 record.returned};
+        uint8_t stage = this->stage;
+        if (++this->stage == STAGE_COUNT) {
+          this->stage = 0;
+          this->position++;
+        }
+
+        // a stage is only known if both ends of it are
+        if (!times[stage] || !times[stage + 1] ||
+            times[stage + 1] < times[stage])
+          continue;
+        int written = snprintf(
+            this->pending, sizeof(this->pending),
+            ",{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":%u,"
+            "\"tid\":%u,\"ts\":%lld,\"dur\":%lld,"
+            "\"args\":{\"frame\":%u,\"size\":%u}}",
+            stageNames[stage], record.transport, record.client,
+            (long long)times[stage],
+            (long long)(times[stage + 1] - times[stage]),
+            (unsigned)record.frame, (unsigned)record.size);
+        this->pendingLength = written < (int)sizeof(this->pending)
+                                  ? written
+                                  : sizeof(this->pending) - 1;
+        return true;
+      }
+      this->phase = Phase_Footer;
+      // fall through
+    case Phase_Footer:
+      this->pendingLength = strlcpy(this->pending, TRACE_FOOTER,
+                                    sizeof(this->pending));
+      this->phase = Phase_Done;
+      return true;
+    default:
+      return false;
+  }
+}
+
+size_t FrameTracer::Export::read(uint8_t* buffer, size_t maxLen) {
+  size_t written = 0;
+  while (written < maxLen) {
+    if (this->pendingPosition == this->pendingLength && !this->next())
+      break;
+    size_t chunk = this->pendingLength - this->pendingPosition;
+    if (chunk > maxLen - written)
+      chunk = maxLen - written;
+    memcpy(buffer + written, this->pending + this->pendingPosition, chunk);
+    this->pendingPosition += chunk;
+    written += chunk;
+  }
+  return written;
+}
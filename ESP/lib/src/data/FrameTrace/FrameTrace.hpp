@@ -0,0 +1,114 @@
+#pragma once
+#ifndef FRAMETRACE_HPP
+#define FRAMETRACE_HPP
+#include <Arduino.h>
+#include <atomic>
+
+//! records kept with PSRAM, about 50KB
+#define FRAME_TRACE_CAPACITY 1024
+//! records kept without PSRAM, the frame buffers need the internal RAM
+#define FRAME_TRACE_CAPACITY_DRAM 64
+
+/**
+ * @brief Where the time goes between the sensor and the socket, frame by frame
+ * @details Every frame delivered to a client leaves one record in a fixed
+ * ring, PSRAM if there is any. Writers claim a slot with a single atomic add
+ * and publish it with a sequence number, seqlock style, so the stream tasks
+ * never wait for a reader or each other. Readers copy the records out and drop
+ * the ones that were overwritten while they copied.
+ *
+ * All timestamps are esp_timer microseconds, the camera driver stamps the
+ * frame buffers with the same clock at VSYNC. Unknown ones are 0.
+ */
+class FrameTracer {
+ public:
+  enum Transport_e : uint8_t {
+    Transport_HTTP = 1,
+    Transport_UDP = 2,
+  };
+
+  struct Record_t {
+    uint32_t frame;
+    uint32_t size;
+    Transport_e transport;
+    uint8_t client;
+    //! fb->timestamp, taken by the driver at VSYNC
+    int64_t vsync;
+    //! esp_camera_fb_get returned
+    int64_t captured;
+    //! the first bytes of the frame were handed to the socket
+    int64_t firstByte;
+    //! the last bytes were, 0 if the send failed
+    int64_t lastByte;
+    //! esp_camera_fb_return
+    int64_t returned;
+  };
+
+  /**
+   * @brief Turns the records into Chrome trace-event JSON, for
+   * ui.perfetto.dev or chrome://tracing
+   * @details Takes a snapshot of the ring when created and is then read in
+   * pieces, so a chunked response never holds more than one event in RAM
+   */
+  class Export {
+   public:
+    explicit Export(FrameTracer& tracer);
+    ~Export();
+    Export(const Export&) = delete;
+    Export& operator=(const Export&) = delete;
+
+    //! copies the next bytes into buffer, 0 once everything has been read
+    size_t read(uint8_t* buffer, size_t maxLen);
+
+   private:
+    //! formats the next event into pending, false when there are none left
+    bool next();
+
+    enum Phase_e : uint8_t {
+      Phase_Header,
+      Phase_Records,
+      Phase_Footer,
+      Phase_Done,
+    };
+
+    Record_t* records = nullptr;
+    size_t count = 0;
+    size_t position = 0;
+    //! the stage of records[position] up next
+    uint8_t stage = 0;
+    Phase_e phase = Phase_Header;
+    char pending[224];
+    size_t pendingLength = 0;
+    size_t pendingPosition = 0;
+  };
+
+  //! allocates the ring, records before this are dropped
+  void begin();
+  //! lock free, safe from any task
+  void record(const Record_t& record);
+  //! next frame number, per tracer not per transport
+  uint32_t nextFrame() {
+    return this->frames.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+ private:
+  struct Slot_t {
+    //! index + 1 of the record it holds, 0 while being written
+    std::atomic<uint32_t> sequence;
+    Record_t record;
+  };
+
+  //! the finished records, oldest first, returns how many were copied
+  size_t snapshot(Record_t* out, size_t max);
+
+  Slot_t* ring = nullptr;
+  size_t capacity = 0;
+  //! only ever added to, stays in internal RAM where the ESP32 can do
+  //! atomic read-modify-writes
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> frames{0};
+};
+
+extern FrameTracer frameTracer;
+
+#endif  // FRAMETRACE_HPP
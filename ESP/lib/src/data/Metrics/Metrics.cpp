@@ -0,0 +1,200 @@
+#include "Metrics.hpp"
+#include <esp_heap_caps.h>
+
+namespace {
+  std::atomic<Metrics::Metric*> registry{nullptr};
+
+  //! the tasks worth watching, unknown names are skipped
+  const char* const watchedTasks[] = {
+      "loopTask", "async_tcp",   "httpd",     "StreamTask", "HapticTask",
+      "Scheduler", "WiFiMonitor", "esp_timer", "tiT",        "wifi",
+  };
+
+  void writeHeap(Print& out, const char* name, const char* memory, uint32_t caps) {
+    out.printf("%s{memory=\"%s\",kind=\"free\"} %u\n", name, memory,
+               (unsigned)heap_caps_get_free_size(caps));
+    out.printf("%s{memory=\"%s\",kind=\"largest_block\"} %u\n", name, memory,
+               (unsigned)heap_caps_get_largest_free_block(caps));
+    out.printf("%s{memory=\"%s\",kind=\"min_free\"} %u\n", name, memory,
+               (unsigned)heap_caps_get_minimum_free_size(caps));
+  }
+
+  Metrics::Collector heapBytes(
+      "openiris_heap_bytes",
+      "Free heap, largest free block and low water mark",
+      "gauge",
+      [](Print& out, const char* name) {
+        writeHeap(out, name, "internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (psramFound())
+          writeHeap(out, name, "psram", MALLOC_CAP_SPIRAM);
+      });
+
+  Metrics::Collector stackHighWater(
+      "openiris_task_stack_free_min_bytes",
+      "Least stack a task ever had left",
+      "gauge",
+      [](Print& out, const char* name) {
+        for (const char* task : watchedTasks) {
+          TaskHandle_t handle = xTaskGetHandle(task);
+          if (!handle)
+            continue;
+          // stacks are counted in bytes on the ESP32
+          out.printf("%s{task=\"%s\"} %u\n", name, task,
+                     (unsigned)uxTaskGetStackHighWaterMark(handle));
+        }
+      });
+
+  Metrics::Collector uptime("openiris_uptime_seconds",
+                            "Seconds since boot",
+                            "counter",
+                            [](Print& out, const char* name) {
+                              out.printf("%s %u\n", name,
+                                         (unsigned)(millis() / 1000));
+                            });
+
+  void writeScaled(Print& out, uint64_t value, uint32_t scale) {
+    if (scale == 1) {
+      out.printf("%llu", (unsigned long long)value);
+      return;
+    }
+    out.printf("%llu.%06u", (unsigned long long)(value / scale),
+               (unsigned)(value % scale * 1000000 / scale));
+  }
+}  // namespace
+
+namespace Metrics {
+  const uint32_t latencyBoundsUs[10] = {1000,   2000,   5000,   10000,  20000,
+                                        33000,  50000,  100000, 250000, 500000};
+  const uint32_t jpegBoundsBytes[7] = {4096,  8192,  16384, 32768,
+                                       49152, 65536, 131072};
+
+  Metric::Metric(const char* name,
+                 const char* help,
+                 const char* type,
+                 const char* labels)
+      : name(name), help(help), type(type), labels(labels) {
+    // metrics are mostly static objects, but function local ones may come to
+    // life while a scrape walks the list
+    Metric* head = registry.load(std::memory_order_relaxed);
+    do {
+      this->next = head;
+    } while (!registry.compare_exchange_weak(head, this,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+  }
+
+  void Metric::writeSample(Print& out,
+                           const char* suffix,
+                           const char* extraLabel,
+                           uint32_t value) const {
+    out.print(this->name);
+    out.print(suffix);
+    if (this->labels || extraLabel) {
+      out.print('{');
+      if (this->labels)
+        out.print(this->labels);
+      if (this->labels && extraLabel)
+        out.print(',');
+      if (extraLabel)
+        out.print(extraLabel);
+      out.print('}');
+    }
+    out.printf(" %u\n", (unsigned)value);
+  }
+
+  void Counter::write(Print& out) const {
+    this->writeSample(out, "", nullptr,
+                      this->value.load(std::memory_order_relaxed));
+  }
+
+  Histogram::Histogram(const char* name,
+                       const char* help,
+                       const uint32_t* bounds,
+                       size_t bucketCount,
+                       uint32_t scale,
+                       const char* labels)
+      : Metric(name, help, "histogram", labels),
+        bounds(bounds),
+        bucketCount(bucketCount < MAX_BUCKETS ? bucketCount : MAX_BUCKETS),
+        scale(scale) {}
+
+  void Histogram::observe(uint32_t value) {
+    size_t bucket = 0;
+    while (bucket < this->bucketCount && value > this->bounds[bucket])
+      bucket++;
+    this->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t sum =
+        ((uint64_t)this->sumHigh.load(std::memory_order_relaxed) << 32 |
+         this->sumLow.load(std::memory_order_relaxed)) +
+        value;
+    uint32_t seq = this->sumSeq.load(std::memory_order_relaxed);
+    this->sumSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    this->sumLow.store((uint32_t)sum, std::memory_order_relaxed);
+    this->sumHigh.store((uint32_t)(sum >> 32), std::memory_order_relaxed);
+    this->sumSeq.store(seq + 2, std::memory_order_release);
+  }
+
+  uint64_t Histogram::readSum() const {
+    while (true) {
+      uint32_t seq = this->sumSeq.load(std::memory_order_acquire);
+      uint32_t low = this->sumLow.load(std::memory_order_relaxed);
+      uint32_t high = this->sumHigh.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (!(seq & 1) && this->sumSeq.load(std::memory_order_relaxed) == seq)
+        return (uint64_t)high << 32 | low;
+    }
+  }
+
+  void Histogram::write(Print& out) const {
+    char le[32];
+    uint32_t cumulative = 0;
+    for (size_t i = 0; i <= this->bucketCount; i++) {
+      cumulative += this->buckets[i].load(std::memory_order_relaxed);
+      if (i == this->bucketCount) {
+        strcpy(le, "le=\"+Inf\"");
+      } else if (this->scale == 1) {
+        snprintf(le, sizeof(le), "le=\"%u\"", (unsigned)this->bounds[i]);
+      } else {
+        snprintf(le, sizeof(le), "le=\"%u.%06u\"",
+                 (unsigned)(this->bounds[i] / this->scale),
+                 (unsigned)((uint64_t)(this->bounds[i] % this->scale) *
+                            1000000 / this->scale));
+      }
+      this->writeSample(out, "_bucket", le, cumulative);
+    }
+
+    out.print(this->name);
+    out.print("_sum");
+    if (this->labels)
+      out.printf("{%s}", this->labels);
+    out.print(' ');
+    writeScaled(out, this->readSum(), this->scale);
+    out.print('\n');
+    this->writeSample(out, "_count", nullptr, cumulative);
+  }
+
+  void write(Print& out) {
+    Metric* head = registry.load(std::memory_order_acquire);
+    for (Metric* metric = head; metric; metric = metric->next) {
+      // every name gets its HELP and TYPE once, at its first appearance
+      bool seen = false;
+      for (Metric* other = head; other != metric; other = other->next) {
+        if (!strcmp(other->name, metric->name)) {
+          seen = true;
+          break;
+        }
+      }
+      if (seen)
+        continue;
+
+      out.printf("# HELP %s %s\n", metric->name, metric->help);
+      out.printf("# TYPE %s %s\n", metric->name, metric->type);
+      for (Metric* series = metric; series; series = series->next) {
+        if (!strcmp(series->name, metric->name))
+          series->write(out);
+      }
+    }
+  }
+}  // namespace Metrics
@@ -0,0 +1,125 @@
+#pragma once
+#ifndef METRICS_HPP
+#define METRICS_HPP
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * @brief Counters and histograms for the whole pipeline, exposed in the
+ * Prometheus text format
+ * @details Every metric is a static object next to the code it measures and
+ * links itself into a global list when it's constructed. Updating one is a
+ * few relaxed atomic operations, so the stream and capture paths never take a
+ * lock for it. Values that are only interesting at the time of a scrape, like
+ * the heap or the task stacks, are Collectors that read them on demand.
+ *
+ * Counters are 32 bit, which rate() takes a wrap of as a counter reset.
+ * Histogram sums are 64 bit, 4G microseconds of stage latency would wrap
+ * within a session and throw the averages off. The ESP32 has no lock-free 64
+ * bit atomics, so the sum is two 32 bit halves behind a sequence counter:
+ * every histogram is observed from one task only, and a scrape that catches
+ * it halfway through an update reads again.
+ */
+namespace Metrics {
+  class Metric {
+   public:
+    Metric(const char* name,
+           const char* help,
+           const char* type,
+           const char* labels);
+
+    //! write the sample lines, the HELP and TYPE lines are taken care of
+    virtual void write(Print& out) const = 0;
+
+    const char* const name;
+    const char* const help;
+    const char* const type;
+    //! e.g. transport="http", nullptr for none
+    const char* const labels;
+    Metric* next = nullptr;
+
+   protected:
+    void writeSample(Print& out,
+                     const char* suffix,
+                     const char* extraLabel,
+                     uint32_t value) const;
+  };
+
+  class Counter : public Metric {
+   public:
+    Counter(const char* name, const char* help, const char* labels = nullptr)
+        : Metric(name, help, "counter", labels) {}
+
+    void add(uint32_t amount = 1) {
+      this->value.fetch_add(amount, std::memory_order_relaxed);
+    }
+    void write(Print& out) const override;
+
+   private:
+    std::atomic<uint32_t> value{0};
+  };
+
+  /**
+   * @brief Counts observations into fixed buckets
+   * @details Bounds are inclusive upper bounds in the unit the values are
+   * observed in. With scale > 1 they are printed divided by it, which turns
+   * microseconds into the seconds Prometheus expects.
+   */
+  class Histogram : public Metric {
+   public:
+    static constexpr size_t MAX_BUCKETS = 12;
+
+    Histogram(const char* name,
+              const char* help,
+              const uint32_t* bounds,
+              size_t bucketCount,
+              uint32_t scale = 1,
+              const char* labels = nullptr);
+
+    //! only ever from the one task that owns the stage
+    void observe(uint32_t value);
+    void write(Print& out) const override;
+
+   private:
+    const uint32_t* bounds;
+    const size_t bucketCount;
+    const uint32_t scale;
+    //! per bucket, not cumulative, the last one is +Inf
+    std::atomic<uint32_t> buckets[MAX_BUCKETS + 1] = {};
+    //! odd while observe() is updating the sum
+    std::atomic<uint32_t> sumSeq{0};
+    std::atomic<uint32_t> sumLow{0};
+    std::atomic<uint32_t> sumHigh{0};
+
+    uint64_t readSum() const;
+  };
+
+  /**
+   * @brief Writes its samples on every scrape
+   */
+  class Collector : public Metric {
+   public:
+    using Collect = void (*)(Print& out, const char* name);
+
+    Collector(const char* name,
+              const char* help,
+              const char* type,
+              Collect collect)
+        : Metric(name, help, type, nullptr), collect(collect) {}
+
+    void write(Print& out) const override { this->collect(out, this->name); }
+
+   private:
+    Collect collect;
+  };
+
+  //! microsecond buckets for the pipeline stages, 1ms to 500ms
+  extern const uint32_t latencyBoundsUs[10];
+  //! byte buckets for JPEG frames, 4KB to 128KB
+  extern const uint32_t jpegBoundsBytes[7];
+
+  //! write every registered metric, grouped by name
+  void write(Print& out);
+}  // namespace Metrics
+
+#endif  // METRICS_HPP
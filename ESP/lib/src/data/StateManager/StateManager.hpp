@@ -1,6 +1,8 @@
 #ifndef STATEMANAGER_HPP
 #define STATEMANAGER_HPP
+#ifndef OPENIRIS_HOST
 #include <Arduino.h>
+#endif  // OPENIRIS_HOST
 
 /*
  * StateManager
@@ -28,7 +30,9 @@ struct DeviceStates {
     networksConfigUpdated,
     apConfigUpdated,
     wifiTxPowerUpdated,
-    cameraConfigUpdated
+    cameraConfigUpdated,
+    irEmitterConfigUpdated,
+    hapticsConfigUpdated
   };
 
   enum WiFiState_e {
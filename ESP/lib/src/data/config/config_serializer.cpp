@@ -0,0 +1,419 @@
+#include "config_serializer.hpp"
+#include "sensor.h"
+
+namespace {
+  //! longest strings the config accepts, not counting the terminator
+  constexpr size_t MAX_SSID_LENGTH = 32;
+  constexpr size_t MAX_PASSWORD_LENGTH = 64;
+  constexpr size_t MAX_HOSTNAME_LENGTH = 63;
+  constexpr size_t MAX_HAPTIC_NAME_LENGTH = 15;
+  //! setWifiConfig only ever stores this many networks
+  constexpr size_t MAX_NETWORKS = 3;
+
+  /**
+   * @brief Minimal JSON writer that keeps track of where commas go
+   */
+  class JsonWriter {
+   public:
+    explicit JsonWriter(Print& out) : out(out) {}
+
+    void beginObject(const char* name = nullptr) { this->open(name, '{'); }
+    void endObject() { this->close('}'); }
+    void beginArray(const char* name) { this->open(name, '['); }
+    void endArray() { this->close(']'); }
+
+    void field(const char* name, const std::string& value) {
+      this->key(name);
+      this->string(value.c_str());
+    }
+    void field(const char* name, long value) {
+      this->key(name);
+      this->out.print(value);
+    }
+    void field(const char* name, bool value) {
+      this->key(name);
+      this->out.print(value ? "true" : "false");
+    }
+
+   private:
+    void separate() {
+      if (this->hasItems & (1u << this->depth))
+        this->out.print(',');
+      this->hasItems |= 1u << this->depth;
+    }
+
+    void key(const char* name) {
+      this->separate();
+      if (!name)
+        return;
+      this->string(name);
+      this->out.print(':');
+    }
+
+    void open(const char* name, char bracket) {
+      this->key(name);
+      this->out.print(bracket);
+      this->depth++;
+      this->hasItems &= ~(1u << this->depth);
+    }
+
+    void close(char bracket) {
+      this->depth--;
+      this->out.print(bracket);
+    }
+
+    void string(const char* value) {
+      this->out.print('"');
+      for (; *value; value++) {
+        char c = *value;
+        if (c == '"' || c == '\\') {
+          this->out.print('\\');
+          this->out.print(c);
+        } else if ((uint8_t)c < 0x20) {
+          char escaped[7];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          this->out.print(escaped);
+        } else {
+          this->out.print(c);
+        }
+      }
+      this->out.print('"');
+    }
+
+    Print& out;
+    uint8_t depth = 0;
+    //! bit n is set once the container at depth n has an item
+    uint32_t hasItems = 0;
+  };
+
+  /**
+   * @brief Swallows whatever is printed to it and keeps an FNV-1a hash of it
+   */
+  class HashPrint : public Print {
+   public:
+    size_t write(uint8_t c) override {
+      this->hash = (this->hash ^ c) * 16777619u;
+      return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+      for (size_t i = 0; i < size; i++)
+        this->write(buffer[i]);
+      return size;
+    }
+    uint32_t hash = 2166136261u;
+  };
+
+  /**
+   * @brief Validates the fields of one JSON object into config values
+   * @details Absent fields are skipped, the first invalid one is recorded in
+   * the error and every check after it is a no-op
+   */
+  class Reader {
+   public:
+    Reader(JsonObjectConst object,
+           const char* section,
+           ConfigSerializer::Error_t& error)
+        : object(object), section(section), error(error) {}
+
+    template <typename T>
+    void number(const char* name, long min, long max, T& out) {
+      JsonVariantConst value = this->object[name];
+      if (!this->ok || value.isNull())
+        return;
+      if (!value.is<long>())
+        return this->fail(name, "not_a_number");
+      long number = value.as<long>();
+      if (number < min || number > max)
+        return this->fail(name, "out_of_range");
+      out = (T)number;
+    }
+
+    void boolean(const char* name, bool& out) {
+      JsonVariantConst value = this->object[name];
+      if (!this->ok || value.isNull())
+        return;
+      if (!value.is<bool>())
+        return this->fail(name, "not_a_bool");
+      out = value.as<bool>();
+    }
+
+    void text(const char* name, size_t maxLength, std::string& out) {
+      JsonVariantConst value = this->object[name];
+      if (!this->ok || value.isNull())
+        return;
+      if (!value.is<const char*>())
+        return this->fail(name, "not_a_string");
+      const char* text = value.as<const char*>();
+      if (strlen(text) > maxLength)
+        return this->fail(name, "too_long");
+      out.assign(text);
+    }
+
+    void require(const char* name) {
+      if (this->ok && this->object[name].isNull())
+        this->fail(name, "missing");
+    }
+
+    void fail(const char* name, const char* reason) {
+      this->ok = false;
+      this->error = {this->section, name, reason};
+    }
+
+    bool ok = true;
+
+   private:
+    JsonObjectConst object;
+    const char* section;
+    ConfigSerializer::Error_t& error;
+  };
+
+  bool readObject(JsonObjectConst root,
+                  const char* section,
+                  JsonObjectConst& object,
+                  ConfigSerializer::Error_t& error) {
+    JsonVariantConst value = root[section];
+    if (value.isNull())
+      return false;
+    if (!value.is<JsonObjectConst>()) {
+      error = {section, nullptr, "not_an_object"};
+      return false;
+    }
+    object = value.as<JsonObjectConst>();
+    return true;
+  }
+
+  bool readArray(JsonObjectConst root,
+                 const char* section,
+                 size_t maxSize,
+                 JsonArrayConst& array,
+                 ConfigSerializer::Error_t& error) {
+    JsonVariantConst value = root[section];
+    if (value.isNull())
+      return false;
+    if (!value.is<JsonArrayConst>()) {
+      error = {section, nullptr, "not_an_array"};
+      return false;
+    }
+    array = value.as<JsonArrayConst>();
+    if (array.size() > maxSize) {
+      error = {section, nullptr, "too_many"};
+      return false;
+    }
+    return true;
+  }
+}  // namespace
+
+void ConfigSerializer::write(ProjectConfig::TrackerConfig_t& config,
+                             Print& out) {
+  JsonWriter json(out);
+  json.beginObject();
+
+  json.beginObject("device_config");
+  json.field("OTALogin", config.device.OTALogin);
+  json.field("OTAPassword", config.device.OTAPassword);
+  json.field("OTAPort", (long)config.device.OTAPort);
+  json.endObject();
+
+  json.beginObject("camera_config");
+  json.field("vflip", (long)config.camera.vflip);
+  json.field("framesize", (long)config.camera.framesize);
+  json.field("href", (long)config.camera.href);
+  json.field("quality", (long)config.camera.quality);
+  json.field("brightness", (long)config.camera.brightness);
+  json.endObject();
+
+  json.beginArray("wifi_config");
+  for (auto& network : config.networks) {
+    json.beginObject();
+    json.field("name", network.name);
+    json.field("ssid", network.ssid);
+    json.field("password", network.password);
+    json.field("channel", (long)network.channel);
+    json.field("power", (long)network.power);
+    json.field("adhoc", network.adhoc);
+    json.endObject();
+  }
+  json.endArray();
+
+  json.beginObject("mdns_config");
+  json.field("hostname", config.mdns.hostname);
+  json.field("service", config.mdns.service);
+  json.endObject();
+
+  json.beginObject("ap_wifi_config");
+  json.field("ssid", config.ap_network.ssid);
+  json.field("password", config.ap_network.password);
+  json.field("channel", (long)config.ap_network.channel);
+  json.field("adhoc", config.ap_network.adhoc);
+  json.endObject();
+
+  json.beginObject("wifi_tx_power");
+  json.field("power", (long)config.txpower.power);
+  json.endObject();
+
+  json.beginObject("ir_emitter_config");
+  json.field("mode", (long)config.irEmitter.mode);
+  json.field("intensity", (long)config.irEmitter.intensity);
+  json.field("duty", (long)config.irEmitter.duty);
+  json.endObject();
+
+  json.beginArray("haptics_config");
+  for (auto& channel : config.haptics) {
+    json.beginObject();
+    json.field("pin", (long)channel.pin);
+    json.field("name", channel.name);
+    json.field("frequency", (long)channel.frequency);
+    json.field("resolution", (long)channel.resolution);
+    json.field("curve", (long)channel.curve);
+    json.endObject();
+  }
+  json.endArray();
+
+  json.endObject();
+}
+
+void ConfigSerializer::etag(ProjectConfig::TrackerConfig_t& config,
+                            char* out,
+                            size_t len) {
+  HashPrint hash;
+  write(config, hash);
+  snprintf(out, len, "\"%08x\"", hash.hash);
+}
+
+bool ConfigSerializer::read(JsonVariantConst doc,
+                            ProjectConfig::TrackerConfig_t& staged,
+                            uint32_t& sections,
+                            Error_t& error) {
+  sections = 0;
+  error = {};
+  if (!doc.is<JsonObjectConst>()) {
+    error.reason = "not_an_object";
+    return false;
+  }
+  JsonObjectConst root = doc.as<JsonObjectConst>();
+  JsonObjectConst object;
+  JsonArrayConst array;
+
+  if (readObject(root, "device_config", object, error)) {
+    Reader reader(object, "device_config", error);
+    reader.text("OTALogin", MAX_PASSWORD_LENGTH, staged.device.OTALogin);
+    reader.text("OTAPassword", MAX_PASSWORD_LENGTH, staged.device.OTAPassword);
+    reader.number("OTAPort", 1, 65535, staged.device.OTAPort);
+    if (!reader.ok)
+      return false;
+    sections |= sectionBit(ConfigState_e::deviceConfigUpdated);
+  }
+
+  if (readObject(root, "camera_config", object, error)) {
+    Reader reader(object, "camera_config", error);
+    reader.number("vflip", 0, 1, staged.camera.vflip);
+    reader.number("framesize", 0, FRAMESIZE_INVALID - 1,
+                  staged.camera.framesize);
+    reader.number("href", 0, 1, staged.camera.href);
+    reader.number("quality", 0, 63, staged.camera.quality);
+    reader.number("brightness", 0, 30, staged.camera.brightness);
+    if (!reader.ok)
+      return false;
+    sections |= sectionBit(ConfigState_e::cameraConfigUpdated);
+  }
+
+  if (readArray(root, "wifi_config", MAX_NETWORKS, array, error)) {
+    std::vector<ProjectConfig::WiFiConfig_t> networks;
+    for (JsonVariantConst item : array) {
+      if (!item.is<JsonObjectConst>()) {
+        error = {"wifi_config", nullptr, "not_an_object"};
+        return false;
+      }
+      std::string name, ssid, password;
+      uint8_t channel = 0;
+      uint8_t power = 0;
+
+      Reader reader(item.as<JsonObjectConst>(), "wifi_config", error);
+      reader.require("name");
+      reader.require("ssid");
+      reader.text("name", MAX_SSID_LENGTH, name);
+      reader.text("ssid", MAX_SSID_LENGTH, ssid);
+      reader.text("password", MAX_PASSWORD_LENGTH, password);
+      reader.number("channel", 0, 13, channel);
+      reader.number("power", 0, 84, power);
+      if (!reader.ok)
+        return false;
+      // the stored networks are always the ones to connect to
+      networks.emplace_back(name, ssid, password, channel, power, false);
+    }
+    staged.networks = std::move(networks);
+    sections |= sectionBit(ConfigState_e::networksConfigUpdated);
+  }
+
+  if (readObject(root, "mdns_config", object, error)) {
+    Reader reader(object, "mdns_config", error);
+    reader.text("hostname", MAX_HOSTNAME_LENGTH, staged.mdns.hostname);
+    reader.text("service", MAX_HOSTNAME_LENGTH, staged.mdns.service);
+    if (!reader.ok)
+      return false;
+    // mDNS hostnames are case insensitive, we always store them lower case
+    for (char& c : staged.mdns.hostname)
+      c = tolower(c);
+    sections |= sectionBit(ConfigState_e::mdnsConfigUpdated);
+  }
+
+  if (readObject(root, "ap_wifi_config", object, error)) {
+    Reader reader(object, "ap_wifi_config", error);
+    reader.text("ssid", MAX_SSID_LENGTH, staged.ap_network.ssid);
+    reader.text("password", MAX_PASSWORD_LENGTH, staged.ap_network.password);
+    reader.number("channel", 0, 13, staged.ap_network.channel);
+    reader.boolean("adhoc", staged.ap_network.adhoc);
+    if (!reader.ok)
+      return false;
+    sections |= sectionBit(ConfigState_e::apConfigUpdated);
+  }
+
+  if (readObject(root, "wifi_tx_power", object, error)) {
+    Reader reader(object, "wifi_tx_power", error);
+    reader.number("power", 0, 84, staged.txpower.power);
+    if (!reader.ok)
+      return false;
+    sections |= sectionBit(ConfigState_e::wifiTxPowerUpdated);
+  }
+
+  if (readObject(root, "ir_emitter_config", object, error)) {
+    Reader reader(object, "ir_emitter_config", error);
+    reader.number("mode", 0, 1, staged.irEmitter.mode);
+    reader.number("intensity", 0, 100, staged.irEmitter.intensity);
+    reader.number("duty", 1, 100, staged.irEmitter.duty);
+    if (!reader.ok)
+      return false;
+    sections |= sectionBit(ConfigState_e::irEmitterConfigUpdated);
+  }
+
+  if (readArray(root, "haptics_config", ProjectConfig::maxHapticChannels, array,
+                error)) {
+    std::vector<ProjectConfig::HapticChannelConfig_t> haptics;
+    for (JsonVariantConst item : array) {
+      if (!item.is<JsonObjectConst>()) {
+        error = {"haptics_config", nullptr, "not_an_object"};
+        return false;
+      }
+      ProjectConfig::HapticChannelConfig_t channel(
+          -1, "none", 20000, 10, ProjectConfig::HapticCurve_Linear);
+
+      Reader reader(item.as<JsonObjectConst>(), "haptics_config", error);
+      reader.require("pin");
+      reader.number("pin", -1, 48, channel.pin);
+      reader.text("name", MAX_HAPTIC_NAME_LENGTH, channel.name);
+      reader.number("frequency", 1, 40000000, channel.frequency);
+      reader.number("resolution", 1, 20, channel.resolution);
+      reader.number("curve", 0, ProjectConfig::HapticCurve_SquareRoot,
+                    channel.curve);
+      if (!reader.ok)
+        return false;
+      haptics.push_back(std::move(channel));
+    }
+    staged.haptics = std::move(haptics);
+    sections |= sectionBit(ConfigState_e::hapticsConfigUpdated);
+  }
+
+  // a section of the wrong type doesn't stop the others from being read, but
+  // still fails the whole document
+  return error.reason == nullptr;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef CONFIG_SERIALIZER_HPP
+#define CONFIG_SERIALIZER_HPP
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "project_config.hpp"
+
+/**
+ * @brief Reads and writes the whole tracker config as one JSON document
+ * @details Writing goes straight to a Print, so the document never has to
+ * exist as a whole in memory. Reading validates a full or partial document
+ * into a staged copy of the config, nothing is applied until every field has
+ * been checked.
+ */
+namespace ConfigSerializer {
+  struct Error_t {
+    const char* section = nullptr;
+    const char* field = nullptr;
+    const char* reason = nullptr;
+  };
+
+  //! bit n is set when the section notified as ConfigState_e n was written
+  inline uint32_t sectionBit(ConfigState_e section) {
+    return 1u << section;
+  }
+
+  void write(ProjectConfig::TrackerConfig_t& config, Print& out);
+
+  /**
+   * @brief A strong validator for the current config, quoted as HTTP wants it
+   * @details Hashes the exact bytes write() would produce, without buffering
+   * them
+   */
+  void etag(ProjectConfig::TrackerConfig_t& config, char* out, size_t len);
+
+  /**
+   * @brief Merge doc into staged, sections and fields that are not in doc are
+   * left untouched, arrays replace the whole list
+   * @param sections gets the sectionBit() of every section doc contained
+   * @return false if anything in doc is invalid, error says what
+   */
+  bool read(JsonVariantConst doc,
+            ProjectConfig::TrackerConfig_t& staged,
+            uint32_t& sections,
+            Error_t& error);
+}  // namespace ConfigSerializer
+
+#endif  // CONFIG_SERIALIZER_HPP
@@ -1,5 +1,7 @@
 #include "project_config.hpp"
+#ifndef OPENIRIS_HOST
 #include "sensor.h"
+#endif  // OPENIRIS_HOST
 
 ProjectConfig::ProjectConfig(const std::string& name,
                              const std::string& mdnsName)
@@ -58,6 +60,22 @@ void ProjectConfig::initConfig() {
       .quality = 7,
       .brightness = 2,
   };
+
+  this->config.irEmitter = {
+      .mode = 0,
+      .intensity = 100,
+      .duty = 100,
+  };
+
+  // the layout the haptic engine used to have hardcoded, 20kHz keeps the
+  // motors out of the audible range
+  this->config.haptics.clear();
+  this->config.haptics.emplace_back(2, "RightEar", 20000, 10,
+                                    HapticCurve_Linear);
+  this->config.haptics.emplace_back(3, "LeftEar", 20000, 10,
+                                    HapticCurve_Linear);
+  this->config.haptics.emplace_back(4, "None1", 20000, 10, HapticCurve_Linear);
+  this->config.haptics.emplace_back(5, "None2", 20000, 10, HapticCurve_Linear);
 }
 
 void ProjectConfig::save() {
@@ -67,9 +85,11 @@ void ProjectConfig::save() {
   cameraConfigSave();
   wifiConfigSave();
   wifiTxPowerConfigSave();
+  irEmitterConfigSave();
+  hapticsConfigSave();
   end();  // we call end() here to close the connection to the NVS partition, we
-          // only do this because we call ESP.restart() next.
-  OpenIrisTasks::ScheduleRestart(2000);
+          // only do this because we restart next.
+  Hal::restart(2000);
 }
 
 void ProjectConfig::wifiConfigSave() {
@@ -135,6 +155,30 @@ void ProjectConfig::cameraConfigSave() {
   putInt("brightness", this->config.camera.brightness);
 }
 
+void ProjectConfig::irEmitterConfigSave() {
+  /* IR Emitter Config */
+  putInt("irMode", this->config.irEmitter.mode);
+  putInt("irIntensity", this->config.irEmitter.intensity);
+  putInt("irDuty", this->config.irEmitter.duty);
+}
+
+void ProjectConfig::hapticsConfigSave() {
+  /* Haptics Config */
+  putInt("hapticCount", this->config.haptics.size());
+
+  for (size_t i = 0; i < this->config.haptics.size(); i++) {
+    char buffer[2];
+    std::string iter_str = Helpers::itoa(i, buffer, 10);
+    const HapticChannelConfig_t& channel = this->config.haptics[i];
+
+    putInt(("hPin" + iter_str).c_str(), channel.pin);
+    putString(("hName" + iter_str).c_str(), channel.name.c_str());
+    putUInt(("hFreq" + iter_str).c_str(), channel.frequency);
+    putUInt(("hRes" + iter_str).c_str(), channel.resolution);
+    putUInt(("hCurve" + iter_str).c_str(), channel.curve);
+  }
+}
+
 bool ProjectConfig::reset() {
   log_w("Resetting project config");
   return clear();
@@ -205,6 +249,30 @@ void ProjectConfig::load() {
   this->config.camera.quality = getInt("quality", 7);
   this->config.camera.brightness = getInt("brightness", 10);
 
+  /* IR Emitter Config */
+  this->config.irEmitter.mode = getInt("irMode", 0);
+  this->config.irEmitter.intensity = getInt("irIntensity", 100);
+  this->config.irEmitter.duty = getInt("irDuty", 100);
+
+  /* Haptics Config */
+  // keep the defaults from initConfig() until a layout has been stored
+  if (isKey("hapticCount")) {
+    int hapticCount =
+        std::min<int>(getInt("hapticCount", 0), maxHapticChannels);
+    this->config.haptics.clear();
+    for (int i = 0; i < hapticCount; i++) {
+      char buffer[2];
+      std::string iter_str = Helpers::itoa(i, buffer, 10);
+
+      this->config.haptics.emplace_back(
+          getInt(("hPin" + iter_str).c_str(), -1),
+          getString(("hName" + iter_str).c_str(), "none").c_str(),
+          getUInt(("hFreq" + iter_str).c_str(), 20000),
+          getUInt(("hRes" + iter_str).c_str(), 10),
+          getUInt(("hCurve" + iter_str).c_str(), HapticCurve_Linear));
+    }
+  }
+
   this->_already_loaded = true;
   this->notifyAll(ConfigState_e::configLoaded);
 }
@@ -295,7 +363,7 @@ void ProjectConfig::setWifiConfig(const std::string& networkName,
   }
 
   if (size < 3 && size > 0) {
-    Serial.println("We're adding a new network");
+    log_i("[Project Config]: Adding a new network");
     // we don't have that network yet, we can add it as we still have some
     // space we're using emplace_back as push_back will create a copy of it,
     // we want to avoid that
@@ -305,7 +373,7 @@ void ProjectConfig::setWifiConfig(const std::string& networkName,
 
   // we're allowing to store up to three additional networks
   if (size == 0) {
-    Serial.println("No networks, We're adding a new network");
+    log_i("[Project Config]: No networks, adding a new network");
     this->config.networks.emplace_back(networkName, ssid, password, channel,
                                        power, false);
   }
@@ -322,7 +390,7 @@ void ProjectConfig::deleteWifiConfig(const std::string& networkName,
                                      bool shouldNotify) {
   size_t size = this->config.networks.size();
   if (size == 0) {
-    Serial.println("No networks, nothing to delete");
+    log_i("[Project Config]: No networks, nothing to delete");
   }
 
   for (auto it = this->config.networks.begin();
@@ -350,6 +418,65 @@ void ProjectConfig::setWiFiTxPower(uint8_t power, bool shouldNotify) {
     this->notifyAll(ConfigState_e::wifiTxPowerUpdated);
 }
 
+void ProjectConfig::setIREmitterConfig(uint8_t mode,
+                                       uint8_t intensity,
+                                       uint8_t duty,
+                                       bool shouldNotify) {
+  log_d("Updating IR emitter config");
+  this->config.irEmitter.mode = mode;
+  this->config.irEmitter.intensity = std::min<uint8_t>(intensity, 100);
+  this->config.irEmitter.duty =
+      std::max<uint8_t>(std::min<uint8_t>(duty, 100), 1);
+
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::irEmitterConfigUpdated);
+}
+
+/**
+ * @brief Update the haptic channel at index, or append a new one when index is
+ * one past the last channel
+ * @return false if index is out of range or there's no room for another channel
+ */
+bool ProjectConfig::setHapticChannelConfig(uint8_t index,
+                                           int8_t pin,
+                                           const std::string& name,
+                                           uint32_t frequency,
+                                           uint8_t resolution,
+                                           uint8_t curve,
+                                           bool shouldNotify) {
+  log_d("Updating haptic channel %u", index);
+  auto& haptics = this->config.haptics;
+  if (index > haptics.size() || index >= maxHapticChannels)
+    return false;
+
+  curve = std::min<uint8_t>(curve, HapticCurve_SquareRoot);
+  if (index == haptics.size()) {
+    haptics.emplace_back(pin, name, frequency, resolution, curve);
+  } else {
+    haptics[index].pin = pin;
+    haptics[index].name.assign(name);
+    haptics[index].frequency = frequency;
+    haptics[index].resolution = resolution;
+    haptics[index].curve = curve;
+  }
+
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::hapticsConfigUpdated);
+  return true;
+}
+
+void ProjectConfig::deleteHapticChannelConfig(uint8_t index,
+                                              bool shouldNotify) {
+  if (index >= this->config.haptics.size())
+    return;
+
+  log_d("Deleting haptic channel %u", index);
+  this->config.haptics.erase(this->config.haptics.begin() + index);
+
+  if (shouldNotify)
+    this->notifyAll(ConfigState_e::hapticsConfigUpdated);
+}
+
 void ProjectConfig::setAPWifiConfig(const std::string& ssid,
                                     const std::string& password,
                                     uint8_t channel,
@@ -370,6 +497,44 @@ void ProjectConfig::setAPWifiConfig(const std::string& ssid,
   }
 }
 
+/**
+ * @brief Replace the config with a staged copy in one go
+ * @details Every section is assigned and stored before anyone gets notified,
+ * so observers never see a half applied config
+ * @param sections the ConfigSerializer::sectionBit() of every section that
+ * should be stored and notified
+ */
+void ProjectConfig::commitTrackerConfig(const TrackerConfig_t& staged,
+                                        uint32_t sections) {
+  log_d("Committing tracker config");
+  this->config = staged;
+
+  auto touched = [sections](ConfigState_e section) {
+    return sections & (1u << section);
+  };
+
+  if (touched(ConfigState_e::deviceConfigUpdated))
+    this->deviceConfigSave();
+  if (touched(ConfigState_e::mdnsConfigUpdated))
+    this->mdnsConfigSave();
+  if (touched(ConfigState_e::networksConfigUpdated) ||
+      touched(ConfigState_e::apConfigUpdated))
+    this->wifiConfigSave();
+  if (touched(ConfigState_e::wifiTxPowerUpdated))
+    this->wifiTxPowerConfigSave();
+  if (touched(ConfigState_e::cameraConfigUpdated))
+    this->cameraConfigSave();
+  if (touched(ConfigState_e::irEmitterConfigUpdated))
+    this->irEmitterConfigSave();
+  if (touched(ConfigState_e::hapticsConfigUpdated))
+    this->hapticsConfigSave();
+
+  for (uint8_t section = 0; section < 32; section++) {
+    if (touched((ConfigState_e)section))
+      this->notifyAll((ConfigState_e)section);
+  }
+}
+
 std::string ProjectConfig::DeviceConfig_t::toRepresentation() {
   std::string json = Helpers::format_string(
       "\"device_config\": {\"OTALogin\": \"%s\", \"OTAPassword\": \"%s\", "
@@ -419,6 +584,23 @@ std::string ProjectConfig::WiFiTxPower_t::toRepresentation() {
   return json;
 }
 
+std::string ProjectConfig::IREmitterConfig_t::toRepresentation() {
+  std::string json = Helpers::format_string(
+      "\"ir_emitter_config\": {\"mode\": %u, \"intensity\": %u, "
+      "\"duty\": %u}",
+      this->mode, this->intensity, this->duty);
+  return json;
+}
+
+std::string ProjectConfig::HapticChannelConfig_t::toRepresentation() {
+  std::string json = Helpers::format_string(
+      "{\"pin\": %d, \"name\": \"%s\", \"frequency\": %u, "
+      "\"resolution\": %u, \"curve\": %u}",
+      this->pin, this->name.c_str(), this->frequency, this->resolution,
+      this->curve);
+  return json;
+}
+
 //**********************************************************************************************************************
 //*
 //!                                                Get Methods
@@ -443,3 +625,13 @@ ProjectConfig::MDNSConfig_t& ProjectConfig::getMDNSConfig() {
 ProjectConfig::WiFiTxPower_t& ProjectConfig::getWiFiTxPowerConfig() {
   return this->config.txpower;
 }
+ProjectConfig::TrackerConfig_t& ProjectConfig::getTrackerConfig() {
+  return this->config;
+}
+ProjectConfig::IREmitterConfig_t& ProjectConfig::getIREmitterConfig() {
+  return this->config.irEmitter;
+}
+std::vector<ProjectConfig::HapticChannelConfig_t>&
+ProjectConfig::getHapticsConfig() {
+  return this->config.haptics;
+}
@@ -1,8 +1,6 @@
 #pragma once
 #ifndef PROJECT_CONFIG_HPP
 #define PROJECT_CONFIG_HPP
-#include <Arduino.h>
-#include <Preferences.h>
 #include <algorithm>
 #include <string>
 #include <vector>
@@ -10,10 +8,13 @@
 #include "data/StateManager/StateManager.hpp"
 #include "data/utilities/Observer.hpp"
 #include "data/utilities/helpers.hpp"
+#include "hal/hal.hpp"
+#ifndef OPENIRIS_HOST
 #include "data/utilities/network_utilities.hpp"
 #include "tasks/tasks.hpp"
+#endif  // OPENIRIS_HOST
 
-class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
+class ProjectConfig : public Hal::Storage, public ISubject<ConfigState_e> {
  public:
   ProjectConfig(const std::string& name = std::string(),
                 const std::string& mdnsName = std::string());
@@ -25,6 +26,8 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
   void deviceConfigSave();
   void mdnsConfigSave();
   void wifiTxPowerConfigSave();
+  void irEmitterConfigSave();
+  void hapticsConfigSave();
   bool reset();
   void initConfig();
 
@@ -88,6 +91,51 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
     std::string toRepresentation();
   };
 
+  struct IREmitterConfig_t {
+    //! 0 - constant, 1 - strobed in sync with the sensor VSYNC
+    uint8_t mode;
+    //! PWM duty while the emitter is lit, 0 to 100 percent
+    uint8_t intensity;
+    //! share of the frame period the emitter is lit for when strobing, 1 to
+    //! 100 percent
+    uint8_t duty;
+    std::string toRepresentation();
+  };
+
+  //! how a requested motor strength maps onto the PWM duty
+  enum HapticCurve_e : uint8_t {
+    HapticCurve_Linear,
+    //! finer steps at low strengths, where the motor is most noticeable
+    HapticCurve_Quadratic,
+    //! spins the motor up quickly and flattens out towards full strength
+    HapticCurve_SquareRoot,
+  };
+
+  struct HapticChannelConfig_t {
+    //! Constructor for HapticChannelConfig_t - allows us to use emplace_back
+    HapticChannelConfig_t(int8_t pin,
+                          const std::string& name,
+                          uint32_t frequency,
+                          uint8_t resolution,
+                          uint8_t curve)
+        : pin(pin),
+          name(name),
+          frequency(frequency),
+          resolution(resolution),
+          curve(curve) {}
+    int8_t pin;
+    std::string name;
+    //! PWM frequency in Hz
+    uint32_t frequency;
+    //! PWM bit depth
+    uint8_t resolution;
+    //! one of HapticCurve_e
+    uint8_t curve;
+    std::string toRepresentation();
+  };
+
+  static constexpr uint8_t maxHapticChannels = 8;
+
   struct TrackerConfig_t {
     DeviceConfig_t device;
     CameraConfig_t camera;
@@ -95,6 +143,8 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
     AP_WiFiConfig_t ap_network;
     MDNSConfig_t mdns;
     WiFiTxPower_t txpower;
+    IREmitterConfig_t irEmitter;
+    std::vector<HapticChannelConfig_t> haptics;
   };
 
   DeviceConfig_t& getDeviceConfig();
@@ -103,6 +153,9 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
   AP_WiFiConfig_t& getAPWifiConfig();
   MDNSConfig_t& getMDNSConfig();
   WiFiTxPower_t& getWiFiTxPowerConfig();
+  TrackerConfig_t& getTrackerConfig();
+  IREmitterConfig_t& getIREmitterConfig();
+  std::vector<HapticChannelConfig_t>& getHapticsConfig();
 
   void setDeviceConfig(const std::string& OTALogin,
                        const std::string& OTAPassword,
@@ -130,6 +183,19 @@ class ProjectConfig : public Preferences, public ISubject<ConfigState_e> {
                        bool adhoc,
                        bool shouldNotify);
   void setWiFiTxPower(uint8_t power, bool shouldNotify);
+  void setIREmitterConfig(uint8_t mode,
+                          uint8_t intensity,
+                          uint8_t duty,
+                          bool shouldNotify);
+  bool setHapticChannelConfig(uint8_t index,
+                              int8_t pin,
+                              const std::string& name,
+                              uint32_t frequency,
+                              uint8_t resolution,
+                              uint8_t curve,
+                              bool shouldNotify);
+  void deleteHapticChannelConfig(uint8_t index, bool shouldNotify);
+  void commitTrackerConfig(const TrackerConfig_t& staged, uint32_t sections);
 
   void deleteWifiConfig(const std::string& networkName, bool shouldNotify);
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include "hal/hal.hpp"
 
 template <typename EnumT>
 class IObserver {
@@ -0,0 +1,236 @@
+#pragma once
+#ifndef HAL_HPP
+#define HAL_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef OPENIRIS_HOST
+#include "hal/host/hostHal.hpp"
+#else
+#include <Arduino.h>
+#include <Preferences.h>
+#include <Update.h>
+#include <WiFiUdp.h>
+#include <esp_timer.h>
+#include <mbedtls/md.h>
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#include <esp32s3/rom/miniz.h>
+#elif CONFIG_IDF_TARGET_ESP32S2
+#include <esp32s2/rom/miniz.h>
+#else
+#include <esp32/rom/miniz.h>
+#endif
+#endif  // OPENIRIS_HOST
+
+/**
+ * @brief The few things the portable modules need from the chip
+ * @details Modules that go through these instead of the Arduino core or
+ * ESP-IDF directly also build for the host, see the native environment in
+ * ini/native.ini. On the ESP32 every call is a thin wrapper, halEsp32.cpp,
+ * on the host they are simulated, hal/host, with hooks to drive the clock and
+ * look at what was written.
+ */
+namespace Hal {
+  //! microseconds since boot, esp_timer on the ESP32
+  int64_t micros();
+
+  //! restart the device in delayMs, returns right away
+  void restart(uint32_t delayMs);
+  //! restart the device now, only returns on the host
+  void restartNow();
+
+  //! where replies to the serial console go
+  Print& console();
+
+  /* GPIO and PWM */
+  void pinOutput(uint8_t pin);
+  void pinWrite(uint8_t pin, bool level);
+  //! false if the channel could not be set up
+  bool pwmAttach(uint8_t pin,
+                 uint8_t channel,
+                 uint32_t frequency,
+                 uint8_t resolution);
+  void pwmWrite(uint8_t channel, uint32_t duty);
+
+  /**
+   * @brief Calls back once, some time from now
+   * @details The callback runs from the timer task, never from an ISR
+   */
+  class Timer {
+   public:
+    using Callback = void (*)(void* arg);
+
+    ~Timer();
+    bool begin(Callback callback, void* arg, const char* name);
+    /**
+     * @brief Like begin(), but the callback runs from a task of its own
+     * @details For callbacks that take long enough to hold up the other
+     * timers. A callback that was due before stop() may still run.
+     */
+    bool beginTask(Callback callback,
+                   void* arg,
+                   const char* name,
+                   uint32_t stackSize,
+                   uint8_t priority);
+    //! (re)arm the timer, a pending expiry is replaced
+    void startOnce(uint64_t delayUs);
+    void stop();
+
+   private:
+#ifdef OPENIRIS_HOST
+    friend struct Host::TimerAccess;
+    Callback callback = nullptr;
+    void* arg = nullptr;
+    int64_t dueUs = -1;
+#else
+    static void wakeTask(void* arg);
+    static void runTask(void* arg);
+
+    esp_timer_handle_t handle = nullptr;
+    //! only with beginTask()
+    TaskHandle_t task = nullptr;
+    Callback callback = nullptr;
+    void* arg = nullptr;
+#endif  // OPENIRIS_HOST
+  };
+
+  /* NVS */
+#ifdef OPENIRIS_HOST
+  using Storage = Host::Storage;
+#else
+  using Storage = Preferences;
+#endif  // OPENIRIS_HOST
+
+  /* Camera */
+  struct Frame_t {
+    const uint8_t* data;
+    size_t len;
+    //! when the sensor started the frame, same clock as micros()
+    int64_t timestampUs;
+    //! the driver's buffer, hand it back with cameraRelease
+    void* handle;
+  };
+  //! false if no frame could be captured
+  bool cameraAcquire(Frame_t& frame);
+  void cameraRelease(Frame_t& frame);
+  //! make every frame this many blank lines longer, false if the sensor can't
+  bool cameraSetExtraLines(uint16_t lines);
+
+  /* JPEG */
+  /**
+   * @brief Decode only the brightness of a JPEG, scaled down
+   * @param scaleShift the image comes out 1 << scaleShift times smaller, 0 to
+   * 3, the larger the quicker
+   * @param out width * height bytes, rows back to back
+   * @return false if it isn't a JPEG the decoder knows or doesn't fit
+   */
+  bool jpegToLuma(const uint8_t* jpeg,
+                  size_t len,
+                  uint8_t scaleShift,
+                  uint8_t* out,
+                  size_t capacity,
+                  uint16_t& width,
+                  uint16_t& height);
+
+  /* OTA */
+  //! start writing an image of unknown size, command is U_FLASH or U_SPIFFS
+  bool otaBegin(int command);
+  bool otaWrite(const uint8_t* data, size_t len);
+  //! mark the written image as the one to boot
+  bool otaEnd();
+  void otaAbort();
+
+  /* Hashes */
+  //! MD5 or SHA-256 of data fed in pieces, mbedtls on the ESP32
+  class Digest {
+   public:
+    enum Algorithm_e : uint8_t {
+      Digest_Md5,
+      Digest_Sha256,
+    };
+
+    static constexpr size_t size(Algorithm_e algorithm) {
+      return algorithm == Digest_Md5 ? 16 : 32;
+    }
+
+    ~Digest();
+    //! false if there's no memory for it
+    bool begin(Algorithm_e algorithm);
+    void add(const uint8_t* data, size_t len);
+    //! size() bytes, begin() again for the next one
+    void finish(uint8_t* digest);
+
+   private:
+    void release();
+
+#ifdef OPENIRIS_HOST
+    //! OpenSSL's EVP_MD_CTX
+    void* context = nullptr;
+#else
+    mbedtls_md_context_t context;
+    bool started = false;
+#endif  // OPENIRIS_HOST
+  };
+
+  /* Inflate */
+  /**
+   * @brief Inflates a raw deflate stream fed in pieces
+   * @details The ROM inflater on the ESP32, RAM use stays at its state plus
+   * the 32KB window no matter how long the stream is
+   */
+  class Inflater {
+   public:
+    //! takes the inflated bytes as they come, false to give up
+    using Output = bool (*)(void* arg, const uint8_t* data, size_t len);
+
+    enum Status_e : uint8_t {
+      Inflate_NeedsInput,
+      //! the stream ended, whatever follows it is left unconsumed
+      Inflate_Done,
+      //! corrupt data, or output gave up
+      Inflate_Failed,
+    };
+
+    ~Inflater();
+    //! false if there's no memory for it
+    bool begin();
+    Status_e inflate(const uint8_t* data,
+                     size_t len,
+                     size_t& consumed,
+                     Output output,
+                     void* arg);
+    void end();
+
+   private:
+#ifdef OPENIRIS_HOST
+    //! zlib's z_stream
+    void* stream = nullptr;
+#else
+    tinfl_decompressor* inflater = nullptr;
+    //! the sliding window the inflater writes its output into
+    uint8_t* window = nullptr;
+    size_t windowPosition = 0;
+#endif  // OPENIRIS_HOST
+  };
+
+  /* Sockets */
+  class DatagramSocket {
+   public:
+    bool begin(uint16_t localPort);
+    //! send header and payload as a single datagram
+    bool send(const char* host,
+              uint16_t port,
+              const uint8_t* header,
+              size_t headerLen,
+              const uint8_t* payload,
+              size_t payloadLen);
+
+#ifndef OPENIRIS_HOST
+   private:
+    WiFiUDP udp;
+#endif  // OPENIRIS_HOST
+  };
+}  // namespace Hal
+
+#endif  // HAL_HPP
@@ -0,0 +1,395 @@
+#ifndef OPENIRIS_HOST
+#include "hal.hpp"
+#include <esp_camera.h>
+#include <esp_jpg_decode.h>
+#include <algorithm>
+#include "tasks/tasks.hpp"
+
+#ifdef SIM_ENABLED
+#include "syntheticCamera.hpp"
+#if __has_include("simClip.h")
+// generated by tools/simclip.py from the JPEGs in sim/clip/
+#include "simClip.h"
+#endif
+
+#ifndef SIM_CAMERA_FPS
+#define SIM_CAMERA_FPS 60
+#endif
+//! 0 none, 1 uniform, 2 stalls, see SyntheticCamera::Jitter_e
+#ifndef SIM_CAMERA_JITTER
+#define SIM_CAMERA_JITTER 1
+#endif
+#ifndef SIM_CAMERA_JITTER_US
+#define SIM_CAMERA_JITTER_US 2000
+#endif
+//! what a 240x240 IR frame usually comes out at
+#ifndef SIM_CAMERA_FRAME_BYTES
+#define SIM_CAMERA_FRAME_BYTES 9000
+#endif
+//! the drawn eye blinks this often, 0 never
+#ifndef SIM_CAMERA_BLINK_MS
+#define SIM_CAMERA_BLINK_MS 0
+#endif
+
+namespace {
+  Hal::SyntheticCamera& simCamera() {
+    static Hal::SyntheticCamera camera([] {
+      Hal::SyntheticCamera::Config_t config = {
+          240,
+          240,
+          SIM_CAMERA_FPS,
+          static_cast<Hal::SyntheticCamera::Jitter_e>(SIM_CAMERA_JITTER),
+          SIM_CAMERA_JITTER_US,
+          SIM_CAMERA_FRAME_BYTES,
+          SIM_CAMERA_FRAME_BYTES / 4,
+          1,
+      };
+      config.blinkEveryMs = SIM_CAMERA_BLINK_MS;
+      return config;
+    }());
+#ifdef SIM_CLIP_COUNT
+    // a recorded clip wins over drawn frames
+    static const bool clipSet = [] {
+      camera.setClip(SIM_CLIP_FRAMES, SIM_CLIP_COUNT);
+      return true;
+    }();
+    (void)clipSet;
+#endif  // SIM_CLIP_COUNT
+    return camera;
+  }
+}  // namespace
+#endif  // SIM_ENABLED
+
+namespace {
+  struct LumaDecode_t {
+    const uint8_t* jpeg;
+    size_t len;
+    uint8_t* out;
+    size_t capacity;
+    uint16_t width;
+    uint16_t height;
+  };
+
+  size_t readJpeg(void* arg, size_t index, uint8_t* buffer, size_t len) {
+    auto* decode = static_cast<LumaDecode_t*>(arg);
+    if (index >= decode->len)
+      return 0;
+    len = std::min(len, decode->len - index);
+    // no buffer means skip
+    if (buffer)
+      memcpy(buffer, decode->jpeg + index, len);
+    return len;
+  }
+
+  bool writeLuma(void* arg,
+                 uint16_t x,
+                 uint16_t y,
+                 uint16_t w,
+                 uint16_t h,
+                 uint8_t* rgb) {
+    auto* decode = static_cast<LumaDecode_t*>(arg);
+    if (!rgb) {
+      // called without pixels before the first block with the whole size,
+      // and once more after the last
+      if (x == 0 && y == 0) {
+        decode->width = w;
+        decode->height = h;
+      }
+      return (size_t)decode->width * decode->height <= decode->capacity;
+    }
+    for (uint16_t row = 0; row < h; row++) {
+      uint8_t* out = decode->out + (size_t)(y + row) * decode->width + x;
+      for (uint16_t column = 0; column < w; column++, rgb += 3)
+        out[column] = (77 * rgb[0] + 150 * rgb[1] + 29 * rgb[2]) >> 8;
+    }
+    return true;
+  }
+}  // namespace
+
+namespace Hal {
+  int64_t micros() {
+    return esp_timer_get_time();
+  }
+
+  void restart(uint32_t delayMs) {
+    OpenIrisTasks::ScheduleRestart(delayMs);
+  }
+
+  void restartNow() {
+    ESP.restart();
+  }
+
+  Print& console() {
+    return Serial;
+  }
+
+  void pinOutput(uint8_t pin) {
+    pinMode(pin, OUTPUT);
+  }
+
+  void pinWrite(uint8_t pin, bool level) {
+    digitalWrite(pin, level);
+  }
+
+  bool pwmAttach(uint8_t pin,
+                 uint8_t channel,
+                 uint32_t frequency,
+                 uint8_t resolution) {
+    // ledcSetup answers with the frequency it could actually set up, 0 if none
+    if (!ledcSetup(channel, frequency, resolution))
+      return false;
+    ledcAttachPin(pin, channel);
+    return true;
+  }
+
+  void pwmWrite(uint8_t channel, uint32_t duty) {
+    ledcWrite(channel, duty);
+  }
+
+  Timer::~Timer() {
+    if (this->handle) {
+      esp_timer_stop(this->handle);
+      esp_timer_delete(this->handle);
+    }
+    if (this->task)
+      vTaskDelete(this->task);
+  }
+
+  bool Timer::begin(Callback callback, void* arg, const char* name) {
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = callback;
+    timerArgs.arg = arg;
+    timerArgs.dispatch_method = ESP_TIMER_TASK;
+    timerArgs.name = name;
+    return esp_timer_create(&timerArgs, &this->handle) == ESP_OK;
+  }
+
+  bool Timer::beginTask(Callback callback,
+                        void* arg,
+                        const char* name,
+                        uint32_t stackSize,
+                        uint8_t priority) {
+    this->callback = callback;
+    this->arg = arg;
+    if (xTaskCreatePinnedToCore(&Timer::runTask, name, stackSize, this,
+                                priority, &this->task,
+                                tskNO_AFFINITY) != pdPASS) {
+      this->task = nullptr;
+      return false;
+    }
+    // the timer task only passes the expiry on
+    return this->begin(&Timer::wakeTask, this, name);
+  }
+
+  void Timer::wakeTask(void* arg) {
+    xTaskNotifyGive(static_cast<Timer*>(arg)->task);
+  }
+
+  void Timer::runTask(void* arg) {
+    auto* self = static_cast<Timer*>(arg);
+    while (true) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      self->callback(self->arg);
+    }
+  }
+
+  void Timer::startOnce(uint64_t delayUs) {
+    // starting a running esp_timer fails, so stop it first
+    esp_timer_stop(this->handle);
+    esp_timer_start_once(this->handle, delayUs);
+  }
+
+  void Timer::stop() {
+    esp_timer_stop(this->handle);
+  }
+
+#ifdef SIM_ENABLED
+  bool cameraAcquire(Frame_t& frame) {
+    // blocks until the frame is due, like the driver waits for the sensor
+    int64_t wait = simCamera().nextFrameUs() - micros();
+    if (wait > 0)
+      vTaskDelay(pdMS_TO_TICKS((wait + 999) / 1000));
+    return simCamera().acquire(frame);
+  }
+
+  void cameraRelease(Frame_t& frame) {
+    simCamera().release(frame);
+  }
+
+  bool cameraSetExtraLines(uint16_t lines) {
+    return simCamera().setExtraLines(lines);
+  }
+#else
+  bool cameraAcquire(Frame_t& frame) {
+    camera_fb_t* fb = esp_camera_fb_get();
+    if (!fb)
+      return false;
+    frame.data = fb->buf;
+    frame.len = fb->len;
+    frame.timestampUs =
+        (int64_t)fb->timestamp.tv_sec * 1000000 + fb->timestamp.tv_usec;
+    frame.handle = fb;
+    return true;
+  }
+
+  void cameraRelease(Frame_t& frame) {
+    esp_camera_fb_return(static_cast<camera_fb_t*>(frame.handle));
+    frame.handle = nullptr;
+  }
+
+  bool cameraSetExtraLines(uint16_t lines) {
+    sensor_t* sensor = esp_camera_sensor_get();
+    if (!sensor || sensor->id.PID != OV2640_PID)
+      return false;
+    // dummy lines, FLL and FLH in the sensor bank, bit 8 of the register
+    // picks the bank
+    return sensor->set_reg(sensor, 0x146, 0xff, lines & 0xff) >= 0 &&
+           sensor->set_reg(sensor, 0x147, 0xff, lines >> 8) >= 0;
+  }
+#endif  // SIM_ENABLED
+
+  bool jpegToLuma(const uint8_t* jpeg,
+                  size_t len,
+                  uint8_t scaleShift,
+                  uint8_t* out,
+                  size_t capacity,
+                  uint16_t& width,
+                  uint16_t& height) {
+    LumaDecode_t decode = {jpeg, len, out, capacity, 0, 0};
+    // TJpgDec, from ROM where the chip has it, hands out RGB blocks
+    if (esp_jpg_decode(len, (jpg_scale_t)std::min<uint8_t>(scaleShift, 3),
+                       &readJpeg, &writeLuma, &decode) != ESP_OK)
+      return false;
+    width = decode.width;
+    height = decode.height;
+    return true;
+  }
+
+  bool otaBegin(int command) {
+    if (Update.begin(UPDATE_SIZE_UNKNOWN, command))
+      return true;
+    Update.printError(Serial);
+    return false;
+  }
+
+  bool otaWrite(const uint8_t* data, size_t len) {
+    if (Update.write(const_cast<uint8_t*>(data), len) == len)
+      return true;
+    Update.printError(Serial);
+    return false;
+  }
+
+  bool otaEnd() {
+    if (Update.end(true))
+      return true;
+    Update.printError(Serial);
+    return false;
+  }
+
+  void otaAbort() {
+    Update.abort();
+  }
+
+  Digest::~Digest() {
+    this->release();
+  }
+
+  bool Digest::begin(Algorithm_e algorithm) {
+    this->release();
+    mbedtls_md_init(&this->context);
+    this->started = true;
+    const mbedtls_md_info_t* info = mbedtls_md_info_from_type(
+        algorithm == Digest_Md5 ? MBEDTLS_MD_MD5 : MBEDTLS_MD_SHA256);
+    return info && mbedtls_md_setup(&this->context, info, 0) == 0 &&
+           mbedtls_md_starts(&this->context) == 0;
+  }
+
+  void Digest::add(const uint8_t* data, size_t len) {
+    mbedtls_md_update(&this->context, data, len);
+  }
+
+  void Digest::finish(uint8_t* digest) {
+    mbedtls_md_finish(&this->context, digest);
+  }
+
+  void Digest::release() {
+    if (this->started)
+      mbedtls_md_free(&this->context);
+    this->started = false;
+  }
+
+  Inflater::~Inflater() {
+    this->end();
+  }
+
+  bool Inflater::begin() {
+    this->end();
+    this->inflater =
+        static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+    this->window = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+    if (!this->inflater || !this->window) {
+      this->end();
+      return false;
+    }
+    tinfl_init(this->inflater);
+    this->windowPosition = 0;
+    return true;
+  }
+
+  Inflater::Status_e Inflater::inflate(const uint8_t* data,
+                                       size_t len,
+                                       size_t& consumed,
+                                       Output output,
+                                       void* arg) {
+    consumed = 0;
+    while (true) {
+      size_t inBytes = len - consumed;
+      size_t outBytes = TINFL_LZ_DICT_SIZE - this->windowPosition;
+      tinfl_status status = tinfl_decompress(
+          this->inflater, data + consumed, &inBytes, this->window,
+          this->window + this->windowPosition, &outBytes,
+          TINFL_FLAG_HAS_MORE_INPUT);
+      consumed += inBytes;
+
+      if (outBytes) {
+        if (!output(arg, this->window + this->windowPosition, outBytes))
+          return Inflate_Failed;
+        this->windowPosition =
+            (this->windowPosition + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+      }
+
+      if (status == TINFL_STATUS_DONE)
+        return Inflate_Done;
+      if (status < TINFL_STATUS_DONE)
+        return Inflate_Failed;
+      if (status == TINFL_STATUS_NEEDS_MORE_INPUT)
+        return Inflate_NeedsInput;
+      // TINFL_STATUS_HAS_MORE_OUTPUT, the window wrapped around
+    }
+  }
+
+  void Inflater::end() {
+    free(this->inflater);
+    this->inflater = nullptr;
+    free(this->window);
+    this->window = nullptr;
+  }
+
+  bool DatagramSocket::begin(uint16_t localPort) {
+    return this->udp.begin(localPort);
+  }
+
+  bool DatagramSocket::send(const char* host,
+                            uint16_t port,
+                            const uint8_t* header,
+                            size_t headerLen,
+                            const uint8_t* payload,
+                            size_t payloadLen) {
+    if (!this->udp.beginPacket(host, port))
+      return false;
+    this->udp.write(header, headerLen);
+    this->udp.write(payload, payloadLen);
+    return this->udp.endPacket();
+  }
+}  // namespace Hal
+#endif  // OPENIRIS_HOST
@@ -0,0 +1,464 @@
+#ifdef OPENIRIS_HOST
+#include "hal/hal.hpp"
+#include "hal/syntheticCamera.hpp"
+#include <setjmp.h>
+#include <algorithm>
+#include <deque>
+// libjpeg, libjpeg-dev or libjpeg-turbo on the machine building the tests
+#include <jpeglib.h>
+// OpenSSL and zlib, libssl-dev and zlib1g-dev
+#include <openssl/evp.h>
+#include <zlib.h>
+
+namespace {
+  struct Pin_t {
+    bool level = false;
+    uint32_t writes = 0;
+  };
+
+  struct QueuedFrame_t {
+    std::vector<uint8_t> data;
+    int64_t timestampUs;
+  };
+
+  //! libjpeg exits the process on errors unless it can jump out
+  struct JpegError_t {
+    jpeg_error_mgr manager;
+    jmp_buf escape;
+  };
+
+  void jpegFailed(j_common_ptr info) {
+    longjmp(reinterpret_cast<JpegError_t*>(info->err)->escape, 1);
+  }
+
+  class ConsolePrint : public Print {
+   public:
+    size_t write(uint8_t c) override {
+      this->output.push_back(static_cast<char>(c));
+      return 1;
+    }
+    std::string output;
+  };
+
+  int64_t now = 0;
+  int64_t restartDelay = -1;
+  int64_t restartedAt = -1;
+  std::map<uint8_t, Pin_t> pins;
+  std::map<uint8_t, uint32_t> pwmDuties;
+  std::map<std::string, std::map<std::string, std::string>> storage;
+  std::vector<Hal::Timer*> timers;
+  std::deque<QueuedFrame_t> queuedFrames;
+  size_t acquiredFrames = 0;
+  Hal::SyntheticCamera* syntheticCamera = nullptr;
+  std::vector<Hal::Host::Datagram_t> sent;
+  Hal::Host::Ota_t otaState;
+  ConsolePrint consolePrint;
+}  // namespace
+
+namespace Hal {
+  namespace Host {
+    struct TimerAccess {
+      static int64_t& due(Timer* timer) { return timer->dueUs; }
+      static void fire(Timer* timer) {
+        timer->dueUs = -1;
+        timer->callback(timer->arg);
+      }
+    };
+
+    void reset() {
+      now = 0;
+      restartDelay = -1;
+      restartedAt = -1;
+      pins.clear();
+      pwmDuties.clear();
+      storage.clear();
+      for (Timer* timer : timers)
+        TimerAccess::due(timer) = -1;
+      queuedFrames.clear();
+      acquiredFrames = 0;
+      syntheticCamera = nullptr;
+      sent.clear();
+      otaState = Ota_t();
+      consolePrint.output.clear();
+    }
+
+    void advance(int64_t us) {
+      int64_t target = now + us;
+      while (true) {
+        // a callback may re-arm its own or any other timer
+        Timer* next = nullptr;
+        for (Timer* timer : timers) {
+          int64_t due = TimerAccess::due(timer);
+          if (due >= 0 && due <= target &&
+              (!next || due < TimerAccess::due(next)))
+            next = timer;
+        }
+        if (!next)
+          break;
+        now = std::max(now, TimerAccess::due(next));
+        TimerAccess::fire(next);
+      }
+      now = target;
+    }
+
+    bool pinLevel(uint8_t pin) {
+      return pins[pin].level;
+    }
+
+    uint32_t pinWrites(uint8_t pin) {
+      return pins[pin].writes;
+    }
+
+    uint32_t pwmDuty(uint8_t channel) {
+      return pwmDuties[channel];
+    }
+
+    void queueFrame(const uint8_t* data, size_t len, int64_t timestampUs) {
+      queuedFrames.push_back({std::vector<uint8_t>(data, data + len),
+                              timestampUs});
+    }
+
+    void attachCamera(SyntheticCamera* camera) {
+      syntheticCamera = camera;
+    }
+
+    size_t framesInUse() {
+      return acquiredFrames;
+    }
+
+    std::vector<Datagram_t>& datagrams() {
+      return sent;
+    }
+
+    Ota_t& ota() {
+      return otaState;
+    }
+
+    std::string& consoleOutput() {
+      return consolePrint.output;
+    }
+
+    int64_t restartRequested() {
+      return restartDelay;
+    }
+
+    int64_t restarted() {
+      return restartedAt;
+    }
+
+    bool Storage::begin(const char* name, bool readOnly) {
+      this->space = &storage[name];
+      this->readOnly = readOnly;
+      return true;
+    }
+
+    void Storage::end() {
+      this->space = nullptr;
+    }
+
+    bool Storage::clear() {
+      if (!this->space || this->readOnly)
+        return false;
+      this->space->clear();
+      return true;
+    }
+
+    bool Storage::remove(const char* key) {
+      if (!this->space || this->readOnly)
+        return false;
+      return this->space->erase(key) > 0;
+    }
+
+    bool Storage::isKey(const char* key) {
+      return this->space && this->space->count(key);
+    }
+
+    size_t Storage::putString(const char* key, const char* value) {
+      if (!this->space || this->readOnly)
+        return 0;
+      (*this->space)[key] = value;
+      return strlen(value);
+    }
+
+    size_t Storage::putInt(const char* key, int32_t value) {
+      return this->putString(key, std::to_string(value).c_str()) ? 4 : 0;
+    }
+
+    size_t Storage::putUInt(const char* key, uint32_t value) {
+      return this->putString(key, std::to_string(value).c_str()) ? 4 : 0;
+    }
+
+    std::string Storage::getString(const char* key, const char* fallback) {
+      if (!this->isKey(key))
+        return fallback;
+      return (*this->space)[key];
+    }
+
+    int32_t Storage::getInt(const char* key, int32_t fallback) {
+      return this->isKey(key) ? std::stol((*this->space)[key]) : fallback;
+    }
+
+    uint32_t Storage::getUInt(const char* key, uint32_t fallback) {
+      return this->isKey(key) ? std::stoul((*this->space)[key]) : fallback;
+    }
+  }  // namespace Host
+
+  int64_t micros() {
+    return now;
+  }
+
+  void restart(uint32_t delayMs) {
+    restartDelay = delayMs;
+  }
+
+  void restartNow() {
+    restartedAt = now;
+  }
+
+  Print& console() {
+    return consolePrint;
+  }
+
+  void pinOutput(uint8_t pin) {
+    pins[pin];
+  }
+
+  void pinWrite(uint8_t pin, bool level) {
+    pins[pin].level = level;
+    pins[pin].writes++;
+  }
+
+  bool pwmAttach(uint8_t /*pin*/,
+                 uint8_t channel,
+                 uint32_t frequency,
+                 uint8_t resolution) {
+    if (!frequency || !resolution || resolution > 20)
+      return false;
+    pwmDuties[channel] = 0;
+    return true;
+  }
+
+  void pwmWrite(uint8_t channel, uint32_t duty) {
+    pwmDuties[channel] = duty;
+  }
+
+  Timer::~Timer() {
+    timers.erase(std::remove(timers.begin(), timers.end(), this), timers.end());
+  }
+
+  bool Timer::begin(Callback callback, void* arg, const char* /*name*/) {
+    this->callback = callback;
+    this->arg = arg;
+    if (std::find(timers.begin(), timers.end(), this) == timers.end())
+      timers.push_back(this);
+    return true;
+  }
+
+  bool Timer::beginTask(Callback callback,
+                        void* arg,
+                        const char* name,
+                        uint32_t /*stackSize*/,
+                        uint8_t /*priority*/) {
+    // there's only the one thread, callbacks run from Host::advance()
+    return this->begin(callback, arg, name);
+  }
+
+  void Timer::startOnce(uint64_t delayUs) {
+    this->dueUs = now + delayUs;
+  }
+
+  void Timer::stop() {
+    this->dueUs = -1;
+  }
+
+  bool cameraAcquire(Frame_t& frame) {
+    if (queuedFrames.empty()) {
+      if (!syntheticCamera)
+        return false;
+      Host::advance(std::max<int64_t>(syntheticCamera->nextFrameUs() - now, 0));
+      if (!syntheticCamera->acquire(frame))
+        return false;
+      acquiredFrames++;
+      return true;
+    }
+    auto* queued = new QueuedFrame_t(std::move(queuedFrames.front()));
+    queuedFrames.pop_front();
+    frame.data = queued->data.data();
+    frame.len = queued->data.size();
+    frame.timestampUs = queued->timestampUs;
+    frame.handle = queued;
+    acquiredFrames++;
+    return true;
+  }
+
+  void cameraRelease(Frame_t& frame) {
+    if (syntheticCamera && syntheticCamera->owns(frame)) {
+      syntheticCamera->release(frame);
+    } else {
+      delete static_cast<QueuedFrame_t*>(frame.handle);
+      frame.handle = nullptr;
+    }
+    acquiredFrames--;
+  }
+
+  bool cameraSetExtraLines(uint16_t lines) {
+    return syntheticCamera && syntheticCamera->setExtraLines(lines);
+  }
+
+  bool jpegToLuma(const uint8_t* jpeg,
+                  size_t len,
+                  uint8_t scaleShift,
+                  uint8_t* out,
+                  size_t capacity,
+                  uint16_t& width,
+                  uint16_t& height) {
+    jpeg_decompress_struct info;
+    JpegError_t error;
+    info.err = jpeg_std_error(&error.manager);
+    error.manager.error_exit = &jpegFailed;
+    if (setjmp(error.escape)) {
+      jpeg_destroy_decompress(&info);
+      return false;
+    }
+    jpeg_create_decompress(&info);
+    jpeg_mem_src(&info, jpeg, len);
+    jpeg_read_header(&info, TRUE);
+    info.out_color_space = JCS_GRAYSCALE;
+    info.scale_num = 1;
+    info.scale_denom = 1 << std::min<uint8_t>(scaleShift, 3);
+    jpeg_start_decompress(&info);
+    bool fits = (size_t)info.output_width * info.output_height <= capacity;
+    if (fits) {
+      while (info.output_scanline < info.output_height) {
+        JSAMPROW row = out + (size_t)info.output_scanline * info.output_width;
+        jpeg_read_scanlines(&info, &row, 1);
+      }
+      width = info.output_width;
+      height = info.output_height;
+    }
+    jpeg_abort_decompress(&info);
+    jpeg_destroy_decompress(&info);
+    return fits;
+  }
+
+  bool otaBegin(int command) {
+    otaState = Host::Ota_t();
+    otaState.command = command;
+    return true;
+  }
+
+  bool otaWrite(const uint8_t* data, size_t len) {
+    if (otaState.command < 0 || otaState.ended || otaState.aborted)
+      return false;
+    otaState.image.insert(otaState.image.end(), data, data + len);
+    return true;
+  }
+
+  bool otaEnd() {
+    if (otaState.command < 0 || otaState.aborted)
+      return false;
+    otaState.ended = true;
+    return true;
+  }
+
+  void otaAbort() {
+    otaState.aborted = true;
+  }
+
+  Digest::~Digest() {
+    this->release();
+  }
+
+  bool Digest::begin(Algorithm_e algorithm) {
+    this->release();
+    auto* context = EVP_MD_CTX_new();
+    this->context = context;
+    return context &&
+           EVP_DigestInit_ex(context,
+                             algorithm == Digest_Md5 ? EVP_md5() : EVP_sha256(),
+                             nullptr);
+  }
+
+  void Digest::add(const uint8_t* data, size_t len) {
+    EVP_DigestUpdate(static_cast<EVP_MD_CTX*>(this->context), data, len);
+  }
+
+  void Digest::finish(uint8_t* digest) {
+    EVP_DigestFinal_ex(static_cast<EVP_MD_CTX*>(this->context), digest,
+                       nullptr);
+  }
+
+  void Digest::release() {
+    EVP_MD_CTX_free(static_cast<EVP_MD_CTX*>(this->context));
+    this->context = nullptr;
+  }
+
+  Inflater::~Inflater() {
+    this->end();
+  }
+
+  bool Inflater::begin() {
+    this->end();
+    auto* stream = new z_stream();
+    // negative window bits, a raw deflate stream without the zlib wrapper
+    if (inflateInit2(stream, -MAX_WBITS) != Z_OK) {
+      delete stream;
+      return false;
+    }
+    this->stream = stream;
+    return true;
+  }
+
+  Inflater::Status_e Inflater::inflate(const uint8_t* data,
+                                       size_t len,
+                                       size_t& consumed,
+                                       Output output,
+                                       void* arg) {
+    auto* stream = static_cast<z_stream*>(this->stream);
+    uint8_t buffer[4096];
+    stream->next_in = const_cast<uint8_t*>(data);
+    stream->avail_in = len;
+    int status;
+    do {
+      stream->next_out = buffer;
+      stream->avail_out = sizeof(buffer);
+      status = ::inflate(stream, Z_NO_FLUSH);
+      size_t produced = sizeof(buffer) - stream->avail_out;
+      if (produced && !output(arg, buffer, produced))
+        return Inflate_Failed;
+    } while (status == Z_OK && (stream->avail_in || !stream->avail_out));
+    consumed = len - stream->avail_in;
+    if (status == Z_STREAM_END)
+      return Inflate_Done;
+    // Z_BUF_ERROR is only no progress, everything was consumed
+    return status == Z_OK || status == Z_BUF_ERROR ? Inflate_NeedsInput
+                                                   : Inflate_Failed;
+  }
+
+  void Inflater::end() {
+    auto* stream = static_cast<z_stream*>(this->stream);
+    if (stream) {
+      inflateEnd(stream);
+      delete stream;
+    }
+    this->stream = nullptr;
+  }
+
+  bool DatagramSocket::begin(uint16_t /*localPort*/) {
+    return true;
+  }
+
+  bool DatagramSocket::send(const char* host,
+                            uint16_t port,
+                            const uint8_t* header,
+                            size_t headerLen,
+                            const uint8_t* payload,
+                            size_t payloadLen) {
+    Host::Datagram_t datagram{host, port, {}};
+    datagram.data.assign(header, header + headerLen);
+    datagram.data.insert(datagram.data.end(), payload, payload + payloadLen);
+    sent.push_back(std::move(datagram));
+    return true;
+  }
+}  // namespace Hal
+#endif  // OPENIRIS_HOST
@@ -0,0 +1,143 @@
+#pragma once
+#ifndef HOSTHAL_HPP
+#define HOSTHAL_HPP
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief What the host build has instead of the Arduino core
+ * @details Only the handful of Arduino pieces the portable modules use, plus
+ * the Host hooks tests drive the simulation with. Nothing here touches real
+ * hardware, the clock only moves when Host::advance() is called.
+ */
+
+#define HAL_HOST_LOG(level, format, ...) \
+  fprintf(stderr, "[" level "] " format "\n", ##__VA_ARGS__)
+#define log_e(format, ...) HAL_HOST_LOG("E", format, ##__VA_ARGS__)
+#define log_w(format, ...) HAL_HOST_LOG("W", format, ##__VA_ARGS__)
+#define log_i(format, ...) HAL_HOST_LOG("I", format, ##__VA_ARGS__)
+#define log_d(format, ...) HAL_HOST_LOG("D", format, ##__VA_ARGS__)
+#define log_v(format, ...) HAL_HOST_LOG("V", format, ##__VA_ARGS__)
+
+//! what Update.h calls the two kinds of OTA image
+#define U_FLASH 0
+#define U_SPIFFS 100
+
+//! the part of Arduino's Print the modules use
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++)
+      this->write(buffer[i]);
+    return size;
+  }
+
+  size_t print(const char* text) {
+    return this->write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+  }
+  size_t print(const std::string& text) { return this->print(text.c_str()); }
+  size_t print(char c) { return this->write(static_cast<uint8_t>(c)); }
+  size_t print(int value) { return this->printf("%d", value); }
+  size_t print(unsigned value) { return this->printf("%u", value); }
+  size_t println(const char* text = "") {
+    return this->print(text) + this->print("\r\n");
+  }
+  size_t printf(const char* format, ...)
+      __attribute__((format(printf, 2, 3))) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0)
+      return 0;
+    return this->write(reinterpret_cast<const uint8_t*>(buffer),
+                       (size_t)len < sizeof(buffer) ? len : sizeof(buffer) - 1);
+  }
+};
+
+namespace Hal {
+  class Timer;
+  class SyntheticCamera;
+
+  namespace Host {
+    struct TimerAccess;
+
+    /**
+     * @brief NVS in memory, same calls as Arduino's Preferences
+     * @details Namespaces outlive the Storage objects, like the flash
+     * partition would, until Host::reset()
+     */
+    class Storage {
+     public:
+      bool begin(const char* name, bool readOnly = false);
+      void end();
+      bool clear();
+      bool remove(const char* key);
+      bool isKey(const char* key);
+
+      size_t putString(const char* key, const char* value);
+      size_t putInt(const char* key, int32_t value);
+      size_t putUInt(const char* key, uint32_t value);
+      std::string getString(const char* key, const char* fallback = "");
+      int32_t getInt(const char* key, int32_t fallback = 0);
+      uint32_t getUInt(const char* key, uint32_t fallback = 0);
+
+     private:
+      std::map<std::string, std::string>* space = nullptr;
+      bool readOnly = false;
+    };
+
+    //! a sent datagram, header and payload joined
+    struct Datagram_t {
+      std::string host;
+      uint16_t port;
+      std::vector<uint8_t> data;
+    };
+
+    //! what the Hal::ota* calls did since reset()
+    struct Ota_t {
+      //! of the last otaBegin(), -1 before one
+      int command = -1;
+      std::vector<uint8_t> image;
+      bool ended = false;
+      bool aborted = false;
+    };
+
+    //! back to boot, clock at 0, no pins, storage, frames, datagrams or OTA
+    void reset();
+    //! move the clock, firing every timer that falls due on the way in order
+    void advance(int64_t us);
+
+    bool pinLevel(uint8_t pin);
+    //! how often the pin was written since reset()
+    uint32_t pinWrites(uint8_t pin);
+    uint32_t pwmDuty(uint8_t channel);
+
+    //! the next cameraAcquire() hands out a copy of data
+    void queueFrame(const uint8_t* data, size_t len, int64_t timestampUs);
+    //! once no frames are queued, cameraAcquire() waits for this camera's
+    //! next frame, moving the clock like advance() does, nullptr to stop
+    void attachCamera(SyntheticCamera* camera);
+    //! frames acquired and not yet released
+    size_t framesInUse();
+
+    std::vector<Datagram_t>& datagrams();
+    Ota_t& ota();
+    //! everything written to Hal::console()
+    std::string& consoleOutput();
+    //! delay of the last Hal::restart(), -1 if none was requested
+    int64_t restartRequested();
+    //! when Hal::restartNow() was last called, -1 if it wasn't
+    int64_t restarted();
+  }  // namespace Host
+}  // namespace Hal
+
+#endif  // HOSTHAL_HPP
@@ -0,0 +1,380 @@
+#include "syntheticCamera.hpp"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+namespace {
+  /**
+   * @brief Only the DC coefficient of every 8x8 block is coded
+   * @details Enough for flat shaded blocks and small enough to draw every
+   * frame, the size real frames have comes from the padding. Quantizing DC
+   * by 8 makes the coded value the block's level minus 128. The chroma blocks
+   * are all 0, gray, they are only there because TJpgDec, what the ESP32
+   * decodes with, takes nothing but YCbCr.
+   */
+  constexpr uint8_t DC_QUANT = 8;
+
+  //! the standard luminance DC table, codes and lengths by category
+  constexpr uint8_t DC_COUNTS[16] = {0, 1, 5, 1, 1, 1, 1, 1,
+                                     1, 0, 0, 0, 0, 0, 0, 0};
+  constexpr uint16_t DC_CODES[12] = {0x000, 0x002, 0x003, 0x004,
+                                     0x005, 0x006, 0x00e, 0x01e,
+                                     0x03e, 0x07e, 0x0fe, 0x1fe};
+  constexpr uint8_t DC_LENGTHS[12] = {2, 3, 3, 3, 3, 3, 4, 5, 6, 7, 8, 9};
+  //! an AC table with nothing but end of block, coded as a single 0 bit
+  constexpr uint8_t AC_COUNTS[16] = {1, 0, 0, 0, 0, 0, 0, 0,
+                                     0, 0, 0, 0, 0, 0, 0, 0};
+
+  //! SOI, EOI and every table, the scan comes on top
+  constexpr size_t HEADERS_SIZE = 2 + 69 + 19 + 33 + 22 + 14 + 2;
+  //! 9 bits of DC code, 8 of value and the end of block, 3 bits for each
+  //! chroma block, twice if every byte got stuffed
+  constexpr size_t MAX_BLOCK_BYTES = 6;
+  constexpr size_t MAX_COMMENT = 65533;
+
+  class BitWriter {
+   public:
+    explicit BitWriter(uint8_t* out) : out(out) {}
+
+    void put(uint32_t code, uint8_t length) {
+      this->bits = (this->bits << length) | (code & ((1u << length) - 1));
+      this->count += length;
+      while (this->count >= 8) {
+        this->count -= 8;
+        this->byte(this->bits >> this->count);
+      }
+    }
+
+    //! pad the last byte with ones, returns the bytes written
+    size_t finish() {
+      if (this->count)
+        this->put(0x7f, 8 - this->count);
+      return this->pos;
+    }
+
+   private:
+    void byte(uint8_t value) {
+      this->out[this->pos++] = value;
+      // a 0xFF in the scan would read as a marker
+      if (value == 0xff)
+        this->out[this->pos++] = 0x00;
+    }
+
+    uint8_t* out;
+    size_t pos = 0;
+    uint32_t bits = 0;
+    uint8_t count = 0;
+  };
+
+  uint8_t* marker(uint8_t* out, uint8_t type, uint16_t length) {
+    out[0] = 0xff;
+    out[1] = type;
+    out[2] = length >> 8;
+    out[3] = length & 0xff;
+    return out + 4;
+  }
+
+  uint8_t* huffmanTable(uint8_t* out,
+                        uint8_t tableClass,
+                        const uint8_t counts[16],
+                        const uint8_t* values,
+                        size_t valueCount) {
+    out = marker(out, 0xc4, 2 + 1 + 16 + valueCount);
+    *out++ = tableClass << 4;
+    memcpy(out, counts, 16);
+    out += 16;
+    memcpy(out, values, valueCount);
+    return out + valueCount;
+  }
+
+  size_t blocks(uint16_t pixels) {
+    return (pixels + 7) / 8;
+  }
+}  // namespace
+
+namespace Hal {
+  SyntheticCamera::SyntheticCamera(const Config_t& config)
+      : config(config), rngState(config.seed ? config.seed : 1) {
+    if (!this->config.fps)
+      this->config.fps = 1;
+    for (auto& slot : this->slots) {
+      slot.buffer = nullptr;
+      slot.inUse = false;
+    }
+    size_t coreBytes = HEADERS_SIZE + blocks(config.width) *
+                                          blocks(config.height) *
+                                          MAX_BLOCK_BYTES;
+    size_t largest = config.frameBytes + config.frameBytesSpread;
+    size_t comments = (largest / MAX_COMMENT + 2) * 4 + 64;
+    this->bufferSize = largest + coreBytes + comments;
+  }
+
+  SyntheticCamera::~SyntheticCamera() {
+    for (auto& slot : this->slots)
+      free(slot.buffer);
+  }
+
+  void SyntheticCamera::setClip(const ClipFrame_t* frames, size_t count) {
+    this->clip = count ? frames : nullptr;
+    this->clipCount = this->clip ? count : 0;
+  }
+
+  int64_t SyntheticCamera::nextFrameUs() const {
+    return this->firstFrameUs < 0 ? Hal::micros() : this->nextDueUs;
+  }
+
+  bool SyntheticCamera::acquire(Frame_t& frame) {
+    Slot_t* slot = nullptr;
+    for (auto& candidate : this->slots) {
+      bool expected = false;
+      if (candidate.inUse.compare_exchange_strong(expected, true)) {
+        slot = &candidate;
+        break;
+      }
+    }
+    if (!slot)
+      return false;
+
+    int64_t now = Hal::micros();
+    if (this->firstFrameUs < 0) {
+      this->firstFrameUs = now;
+      this->nominalUs = now;
+      this->nextDueUs = now;
+    }
+    // whoever reads too slowly misses frames, like with the driver they get
+    // the latest one
+    double period = this->periodUs();
+    if (now - this->nextDueUs >= period) {
+      int64_t behind = (now - this->nextDueUs) / period;
+      this->frameIndex += behind;
+      this->nominalUs += behind * period;
+      this->nextDueUs += behind * period;
+    }
+
+    if (this->clip) {
+      const ClipFrame_t& recorded =
+          this->clip[this->frameIndex % this->clipCount];
+      frame.data = recorded.data;
+      frame.len = recorded.len;
+    } else {
+      if (!slot->buffer)
+        slot->buffer = static_cast<uint8_t*>(malloc(this->bufferSize));
+      if (!slot->buffer) {
+        slot->inUse = false;
+        return false;
+      }
+      int64_t target = this->config.frameBytes;
+      if (this->config.frameBytesSpread)
+        target += (int64_t)(this->random() %
+                            (2 * this->config.frameBytesSpread + 1)) -
+                  this->config.frameBytesSpread;
+      frame.data = slot->buffer;
+      frame.len = this->draw(slot->buffer, this->bufferSize,
+                             std::max<int64_t>(target, 0));
+    }
+    frame.timestampUs = this->nextDueUs;
+    frame.handle = slot;
+
+    this->frameIndex++;
+    this->nominalUs += period;
+    this->nextDueUs = std::max((int64_t)this->nominalUs + this->jitter(),
+                               this->nextDueUs + 1);
+    return true;
+  }
+
+  bool SyntheticCamera::setExtraLines(uint16_t lines) {
+    if (!this->config.lineUs)
+      return false;
+    // the frame already under way keeps its length
+    this->extraLines = lines;
+    return true;
+  }
+
+  double SyntheticCamera::periodUs() const {
+    return 1e6 / this->config.fps / (1 + this->config.clockPpm * 1e-6) +
+           (double)this->extraLines * this->config.lineUs;
+  }
+
+  void SyntheticCamera::release(Frame_t& frame) {
+    static_cast<Slot_t*>(frame.handle)->inUse = false;
+    frame.handle = nullptr;
+  }
+
+  SyntheticCamera::Pupil_t SyntheticCamera::lastPupil() const {
+    int32_t radius = std::min(this->config.width, this->config.height) * 3 / 10;
+    return {this->config.width / 2.0f + this->pupilX,
+            this->config.height / 2.0f + this->pupilY, radius * 0.4f};
+  }
+
+  bool SyntheticCamera::owns(const Frame_t& frame) const {
+    return frame.handle >= &this->slots[0] &&
+           frame.handle < &this->slots[FRAME_BUFFERS];
+  }
+
+  size_t SyntheticCamera::draw(uint8_t* out,
+                               size_t capacity,
+                               uint32_t targetBytes) {
+    float t = (float)this->frameIndex / this->config.fps;
+    int32_t radius = std::min(this->config.width, this->config.height) * 3 / 10;
+    this->pupilX = radius * 0.5f * sinf(t * 0.9f);
+    this->pupilY = radius * 0.3f * sinf(t * 1.3f);
+
+    // the upper lid comes down over the iris and goes up again slower, it
+    // follows the eye
+    this->openness = 1;
+    uint32_t every = std::max(this->config.blinkEveryMs, BLINK_MS);
+    if (this->config.blinkEveryMs) {
+      int32_t ms = (int64_t)this->frameIndex * 1000 / this->config.fps % every -
+                   (every - BLINK_MS);
+      if (ms >= 0 && ms < 80)
+        this->openness = 1 - ms / 80.0f;
+      else if (ms >= 80 && ms < 140)
+        this->openness = 0;
+      else if (ms >= 140)
+        this->openness = (ms - 140) / 160.0f;
+    }
+    this->lidY = this->config.height / 2 + this->pupilY - radius +
+                 (int32_t)((1 - this->openness) * 2 * radius);
+
+    // the image goes to the end of the buffer first, how much padding it
+    // needs is only known once it is encoded
+    size_t coreMax = HEADERS_SIZE - 2 + blocks(this->config.width) *
+                                            blocks(this->config.height) *
+                                            MAX_BLOCK_BYTES;
+    uint8_t* core = out + capacity - coreMax;
+    uint8_t* p = core;
+
+    p = marker(p, 0xdb, 2 + 1 + 64);
+    *p++ = 0x00;
+    memset(p, DC_QUANT, 64);
+    p += 64;
+
+    p = marker(p, 0xc0, 2 + 6 + 3 * 3);
+    *p++ = 8;
+    *p++ = this->config.height >> 8;
+    *p++ = this->config.height & 0xff;
+    *p++ = this->config.width >> 8;
+    *p++ = this->config.width & 0xff;
+    *p++ = 3;  // Y, Cb and Cr
+    for (uint8_t id = 1; id <= 3; id++) {
+      *p++ = id;
+      *p++ = 0x11;  // no subsampling
+      *p++ = 0;     // quantization table
+    }
+
+    static constexpr uint8_t dcValues[12] = {0, 1, 2, 3, 4,  5,
+                                             6, 7, 8, 9, 10, 11};
+    static constexpr uint8_t acValues[1] = {0x00};
+    p = huffmanTable(p, 0, DC_COUNTS, dcValues, sizeof(dcValues));
+    p = huffmanTable(p, 1, AC_COUNTS, acValues, sizeof(acValues));
+
+    p = marker(p, 0xda, 2 + 1 + 2 * 3 + 3);
+    *p++ = 3;
+    for (uint8_t id = 1; id <= 3; id++) {
+      *p++ = id;
+      *p++ = 0x00;  // DC and AC table 0
+    }
+    *p++ = 0;
+    *p++ = 63;
+    *p++ = 0;
+
+    BitWriter scan(p);
+    int16_t previous = 0;
+    for (size_t by = 0; by < blocks(this->config.height); by++) {
+      for (size_t bx = 0; bx < blocks(this->config.width); bx++) {
+        int16_t value = (int16_t)this->eyeLevel(bx * 8 + 4, by * 8 + 4) - 128;
+        int16_t diff = value - previous;
+        previous = value;
+        uint16_t magnitude = diff < 0 ? -diff : diff;
+        uint8_t category = 0;
+        while (magnitude >> category)
+          category++;
+        scan.put(DC_CODES[category], DC_LENGTHS[category]);
+        if (category)
+          scan.put(diff < 0 ? diff + (1 << category) - 1 : diff, category);
+        scan.put(0, 1);  // end of block
+        // Cb and Cr, no difference to the last one and end of block
+        scan.put(DC_CODES[0], DC_LENGTHS[0] + 1);
+        scan.put(DC_CODES[0], DC_LENGTHS[0] + 1);
+      }
+    }
+    p += scan.finish();
+    *p++ = 0xff;
+    *p++ = 0xd9;
+    size_t coreLen = p - core;
+
+    char note[48];
+    int noteLen = snprintf(note, sizeof(note), "OpenIris synthetic frame %u",
+                           (unsigned)this->frameIndex);
+    size_t used = 2 + 4 + noteLen + coreLen;
+    size_t padding = targetBytes > used ? targetBytes - used : 0;
+
+    uint8_t* w = out;
+    *w++ = 0xff;
+    *w++ = 0xd8;
+    // filled with noise, so nothing on the way compresses it
+    while (padding > 4) {
+      size_t chunk = std::min(padding - 4, MAX_COMMENT);
+      w = marker(w, 0xfe, 2 + chunk);
+      for (size_t i = 0; i < chunk; i++)
+        *w++ = this->random();
+      padding -= chunk + 4;
+    }
+    w = marker(w, 0xfe, 2 + noteLen);
+    memcpy(w, note, noteLen);
+    w += noteLen;
+
+    memmove(w, core, coreLen);
+    return (w - out) + coreLen;
+  }
+
+  uint8_t SyntheticCamera::eyeLevel(uint16_t x, uint16_t y) const {
+    int32_t radius = std::min(this->config.width, this->config.height) * 3 / 10;
+    int32_t dx = (int32_t)x - this->config.width / 2 - this->pupilX;
+    int32_t dy = (int32_t)y - this->config.height / 2 - this->pupilY;
+    int32_t distance = dx * dx + dy * dy;
+
+    // lashes along the edge of the lid
+    if ((int32_t)y < this->lidY - 3)
+      return 125;
+    if ((int32_t)y < this->lidY + 3)
+      return 35;
+
+    // the IR LED's reflection, up and left of the pupil
+    int32_t glintX = dx + radius / 4;
+    int32_t glintY = dy + radius / 4;
+    int32_t glint = std::max<int32_t>(4, radius / 8);
+    if (glintX * glintX + glintY * glintY <= glint * glint)
+      return 240;
+    if (distance <= radius * radius * 4 / 25)
+      return 15;  // pupil
+    if (distance <= radius * radius)
+      return 60;  // iris
+    return 110;
+  }
+
+  uint32_t SyntheticCamera::random() {
+    // xorshift32, plenty for noise and jitter
+    uint32_t x = this->rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return this->rngState = x;
+  }
+
+  int64_t SyntheticCamera::jitter() {
+    if (!this->config.jitterUs)
+      return 0;
+    switch (this->config.jitter) {
+      case Jitter_Uniform:
+        return (int64_t)(this->random() % (2 * this->config.jitterUs + 1)) -
+               this->config.jitterUs;
+      case Jitter_Stalls:
+        return this->random() % 16 ? 0 : this->config.jitterUs;
+      default:
+        return 0;
+    }
+  }
+}  // namespace Hal
@@ -0,0 +1,120 @@
+#pragma once
+#ifndef SYNTHETIC_CAMERA_HPP
+#define SYNTHETIC_CAMERA_HPP
+#include <atomic>
+#include "hal/hal.hpp"
+
+namespace Hal {
+  /**
+   * @brief A camera without a sensor, for simulation and host builds
+   * @details Hands out JPEG frames at a fixed rate with a configurable jitter,
+   * either replayed from a recorded clip or drawn: a dark eye whose pupil
+   * wanders around, padded with comment segments to the size real IR frames
+   * have. Frames are real baseline JPEGs, browsers and the trackers decode
+   * them. The random numbers come from the seed only, the same config gives
+   * the same frames at the same times on every run.
+   *
+   * Like the driver, at most FRAME_BUFFERS frames can be out at a time. Only
+   * one task may capture, releasing works from any.
+   */
+  class SyntheticCamera {
+   public:
+    static constexpr size_t FRAME_BUFFERS = 2;
+    //! closing, closed and opening again
+    static constexpr uint32_t BLINK_MS = 300;
+
+    enum Jitter_e {
+      //! every frame exactly on time
+      Jitter_None,
+      //! every frame up to jitterUs early or late
+      Jitter_Uniform,
+      //! on time, but every now and then a frame is jitterUs late, like a
+      //! sensor stalling
+      Jitter_Stalls,
+    };
+
+    struct Config_t {
+      uint16_t width;
+      uint16_t height;
+      uint16_t fps;
+      Jitter_e jitter;
+      uint32_t jitterUs;
+      //! drawn frames are this size, give or take frameBytesSpread
+      uint32_t frameBytes;
+      uint32_t frameBytesSpread;
+      uint32_t seed;
+      //! what one extra line adds to a frame, 0 if frames can't be stretched
+      uint32_t lineUs = 25;
+      //! how much faster the sensor runs than fps says, no two crystals agree
+      int32_t clockPpm = 0;
+      //! the lids close for BLINK_MS every this often, 0 never
+      uint32_t blinkEveryMs = 0;
+    };
+
+    struct ClipFrame_t {
+      const uint8_t* data;
+      uint32_t len;
+    };
+
+    //! frame pixels, the top left corner of the frame is 0, 0
+    struct Pupil_t {
+      float x;
+      float y;
+      float radius;
+    };
+
+    explicit SyntheticCamera(const Config_t& config);
+    ~SyntheticCamera();
+
+    //! replay these JPEGs in a loop instead of drawing frames, must outlive
+    //! the camera, nullptr goes back to drawing
+    void setClip(const ClipFrame_t* frames, size_t count);
+    //! when the next frame is due, Hal::micros() clock
+    int64_t nextFrameUs() const;
+    //! the frame due at nextFrameUs(), false while every buffer is out
+    bool acquire(Frame_t& frame);
+    void release(Frame_t& frame);
+    //! whether the frame came from this camera
+    bool owns(const Frame_t& frame) const;
+    //! where the last drawn frame has its pupil, the truth to check trackers
+    //! against
+    Pupil_t lastPupil() const;
+    //! how far apart the lids of the last drawn frame are, 0 closed to 1 open
+    float lastOpenness() const { return this->openness; }
+    //! stretch every frame from the next one on, false if it can't
+    bool setExtraLines(uint16_t lines);
+
+   private:
+    struct Slot_t {
+      uint8_t* buffer;
+      std::atomic<bool> inUse;
+    };
+
+    size_t draw(uint8_t* out, size_t capacity, uint32_t targetBytes);
+    uint8_t eyeLevel(uint16_t x, uint16_t y) const;
+    uint32_t random();
+    int64_t jitter();
+    double periodUs() const;
+
+    Config_t config;
+    const ClipFrame_t* clip = nullptr;
+    size_t clipCount = 0;
+    Slot_t slots[FRAME_BUFFERS];
+    size_t bufferSize;
+    uint32_t rngState;
+    uint32_t frameIndex = 0;
+    int64_t firstFrameUs = -1;
+    //! when the next frame is due without jitter
+    double nominalUs = 0;
+    int64_t nextDueUs = 0;
+    uint16_t extraLines = 0;
+    //! where the pupil is in the frame being drawn
+    int32_t pupilX = 0;
+    int32_t pupilY = 0;
+    float openness = 1;
+    //! everything above is lid
+    int32_t lidY = 0;
+  };
+}  // namespace Hal
+
+#endif  // SYNTHETIC_CAMERA_HPP
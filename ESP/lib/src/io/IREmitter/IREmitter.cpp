@@ -0,0 +1,299 @@
+#include "IREmitter.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace {
+  //! percent of the emitter constantly on at full drive, -1 before begin()
+  std::atomic<int> averagePower{-1};
+  Metrics::Collector power("openiris_ir_emitter_power_percent",
+                           "Average IR emitter drive",
+                           "gauge",
+                           [](Print& out, const char* name) {
+                             int percent = averagePower.load(
+                                 std::memory_order_relaxed);
+                             if (percent >= 0)
+                               out.printf("%s %d\n", name, percent);
+                           });
+}  // namespace
+
+IREmitter::IREmitter(ProjectConfig& configManager,
+                     CameraHandler& camera,
+                     int8_t pin,
+                     int8_t vsyncPin)
+    : configManager(configManager),
+      camera(camera),
+      pin(pin),
+      vsyncPin(vsyncPin) {}
+
+IREmitter::~IREmitter() {
+  this->disableStrobe();
+  if (this->vsyncReady)
+    pcnt_isr_handler_remove(IR_EMITTER_PCNT_UNIT);
+  if (this->strobeTask)
+    vTaskDelete(this->strobeTask);
+  if (this->strobeTimer)
+    esp_timer_delete(this->strobeTimer);
+}
+
+void IREmitter::begin() {
+  ledcSetup(IR_EMITTER_LEDC_CHANNEL, IR_EMITTER_PWM_FREQ,
+            IR_EMITTER_PWM_RESOLUTION);
+  ledcAttachPin(this->pin, IR_EMITTER_LEDC_CHANNEL);
+  this->write(0);
+
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = &IREmitter::onStrobeEnd;
+  timerArgs.arg = this;
+  timerArgs.dispatch_method = ESP_TIMER_TASK;
+  timerArgs.name = "ir_strobe";
+  if (esp_timer_create(&timerArgs, &this->strobeTimer) != ESP_OK) {
+    log_e("[IR Emitter]: Could not create the strobe timer");
+  }
+
+  this->strobeLock = xSemaphoreCreateMutex();
+  if (this->vsyncPin >= 0 && this->strobeLock &&
+      xTaskCreate(&IREmitter::strobeLoop, "ir_strobe", 2048, this,
+                  IR_EMITTER_TASK_PRIORITY, &this->strobeTask) != pdPASS) {
+    log_e("[IR Emitter]: Could not create the strobe task");
+    this->strobeTask = nullptr;
+  }
+
+  this->applyConfig();
+}
+
+void IREmitter::applyConfig() {
+  ProjectConfig::IREmitterConfig_t& emitterConfig =
+      configManager.getIREmitterConfig();
+
+  bool strobe = emitterConfig.mode == IREmitterMode_e::IREmitter_Strobe &&
+                emitterConfig.duty < 100 && this->vsyncPin >= 0 &&
+                this->strobeTimer && this->strobeTask;
+
+  int drive = emitterConfig.intensity;
+  if (strobe) {
+    drive = this->strobeDrive(emitterConfig.intensity, emitterConfig.duty);
+    if (drive < 0) {
+      log_e(
+          "[IR Emitter]: %u%% of the frame can't make up for %u%% intensity, "
+          "staying constant",
+          emitterConfig.duty, emitterConfig.intensity);
+      strobe = false;
+      drive = emitterConfig.intensity;
+    }
+  }
+
+  log_i("[IR Emitter]: mode: %s, intensity: %u%%, duty: %u%%, drive: %d%%",
+        strobe ? "strobe" : "constant", emitterConfig.intensity,
+        emitterConfig.duty, drive);
+
+  uint32_t duty = map(drive, 0, 100, 0, (1 << IR_EMITTER_PWM_RESOLUTION) - 1);
+  if (strobe) {
+    this->strobeShare = emitterConfig.duty;
+    if (this->enableStrobe(duty)) {
+      averagePower.store(drive * emitterConfig.duty / 100,
+                         std::memory_order_relaxed);
+      return;
+    }
+    duty = map(emitterConfig.intensity, 0, 100, 0,
+               (1 << IR_EMITTER_PWM_RESOLUTION) - 1);
+  }
+
+  this->disableStrobe();
+  this->litDuty = duty;
+  this->write(duty);
+  averagePower.store(emitterConfig.intensity, std::memory_order_relaxed);
+}
+
+/**
+ * @brief The drive that lights the image as brightly as constant light
+ * @details Constant light reaches a row for the usual exposure, a strobe only
+ * for the lit window, which the full frame exposure catches in whole. The
+ * drive makes up for the difference, rounded up. Other sensors than the
+ * OV2640 don't tell us their frame length, they can't be compensated.
+ */
+int IREmitter::strobeDrive(uint8_t intensity, uint8_t share) const {
+  uint32_t frameLines = this->camera.getFrameLines();
+  if (!frameLines)
+    return -1;
+  uint32_t litLines = frameLines * share;
+  uint32_t drive =
+      ((uint32_t)intensity * CAMERA_AEC_LINES * 100 + litLines - 1) / litLines;
+  return drive > 100 ? -1 : (int)drive;
+}
+
+/**
+ * @brief Count rising VSYNC edges on a PCNT unit, with an interrupt on every
+ * single one
+ * @details The unit reads the pin through the GPIO matrix, the camera keeps
+ * receiving the signal and keeps its GPIO interrupt
+ */
+bool IREmitter::setUpVSync() {
+  if (this->vsyncReady)
+    return true;
+
+  pcnt_config_t pcntConfig = {};
+  pcntConfig.pulse_gpio_num = this->vsyncPin;
+  pcntConfig.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+  pcntConfig.channel = PCNT_CHANNEL_0;
+  pcntConfig.unit = IR_EMITTER_PCNT_UNIT;
+  pcntConfig.pos_mode = PCNT_COUNT_INC;
+  pcntConfig.neg_mode = PCNT_COUNT_DIS;
+  pcntConfig.lctrl_mode = PCNT_MODE_KEEP;
+  pcntConfig.hctrl_mode = PCNT_MODE_KEEP;
+  // the counter goes back to 0 as it reaches the limit, an event per edge
+  pcntConfig.counter_h_lim = 1;
+  pcntConfig.counter_l_lim = 0;
+
+  esp_err_t err = pcnt_unit_config(&pcntConfig);
+  if (err == ESP_OK)
+    err = pcnt_event_enable(IR_EMITTER_PCNT_UNIT, PCNT_EVT_H_LIM);
+  if (err == ESP_OK) {
+    // someone else may have installed the service already, that's fine
+    err = pcnt_isr_service_install(0);
+    if (err == ESP_ERR_INVALID_STATE)
+      err = ESP_OK;
+  }
+  if (err == ESP_OK)
+    err = pcnt_isr_handler_add(IR_EMITTER_PCNT_UNIT, &IREmitter::onVSync, this);
+  if (err != ESP_OK) {
+    log_e("[IR Emitter]: Could not count the VSYNC edges: %s",
+          esp_err_to_name(err));
+    return false;
+  }
+
+  pcnt_intr_disable(IR_EMITTER_PCNT_UNIT);
+  this->vsyncReady = true;
+  return true;
+}
+
+bool IREmitter::enableStrobe(uint32_t duty) {
+  if (!this->setUpVSync())
+    return false;
+
+  // the frame length follows the frame size, so this is done every time
+  this->camera.setExposureLines(this->camera.getFrameLines() -
+                                IR_EMITTER_EXPOSURE_MARGIN_LINES);
+  this->litDuty = duty;
+  if (this->strobing)
+    return true;
+
+  portENTER_CRITICAL(&this->vsyncMux);
+  this->lastVSyncUs = 0;
+  this->framePeriodUs = 0;
+  portEXIT_CRITICAL(&this->vsyncMux);
+
+  xSemaphoreTake(this->strobeLock, portMAX_DELAY);
+  this->strobing = true;
+  this->write(0);
+  xSemaphoreGive(this->strobeLock);
+
+  pcnt_counter_pause(IR_EMITTER_PCNT_UNIT);
+  pcnt_counter_clear(IR_EMITTER_PCNT_UNIT);
+  pcnt_intr_enable(IR_EMITTER_PCNT_UNIT);
+  pcnt_counter_resume(IR_EMITTER_PCNT_UNIT);
+  return true;
+}
+
+void IREmitter::disableStrobe() {
+  if (!this->strobing)
+    return;
+
+  pcnt_intr_disable(IR_EMITTER_PCNT_UNIT);
+  pcnt_counter_pause(IR_EMITTER_PCNT_UNIT);
+  // a frame the strobe task is still handling must not light the emitter or
+  // arm the timer after this
+  xSemaphoreTake(this->strobeLock, portMAX_DELAY);
+  this->strobing = false;
+  esp_timer_stop(this->strobeTimer);
+  xSemaphoreGive(this->strobeLock);
+
+  this->camera.setExposureLines(CAMERA_AEC_LINES);
+}
+
+/**
+ * @brief Frame start, note when it was and wake the strobe task
+ * @details Runs in the PCNT interrupt, so only timestamps and arithmetic
+ */
+void IRAM_ATTR IREmitter::onVSync(void* arg) {
+  auto* self = static_cast<IREmitter*>(arg);
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL_ISR(&self->vsyncMux);
+  if (self->lastVSyncUs) {
+    uint32_t period = (uint32_t)(now - self->lastVSyncUs);
+    // smooth it out a bit so a single late edge doesn't cut the window short
+    self->framePeriodUs = self->framePeriodUs
+                              ? (self->framePeriodUs * 7 + period) / 8
+                              : period;
+  }
+  self->lastVSyncUs = now;
+  portEXIT_CRITICAL_ISR(&self->vsyncMux);
+
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(self->strobeTask, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
+
+/**
+ * @brief Light the emitter for every frame and schedule when to turn it off
+ * @details Until two edges have been seen we don't know the frame period, so
+ * the emitter just stays lit for that first frame. The window is measured from
+ * the edge, the time it took to get here is taken off.
+ */
+void IREmitter::strobeLoop(void* arg) {
+  auto* self = static_cast<IREmitter*>(arg);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    portENTER_CRITICAL(&self->vsyncMux);
+    int64_t edgeUs = self->lastVSyncUs;
+    uint32_t periodUs = self->framePeriodUs;
+    portEXIT_CRITICAL(&self->vsyncMux);
+
+    xSemaphoreTake(self->strobeLock, portMAX_DELAY);
+    if (self->strobing) {
+      self->write(self->litDuty);
+      if (periodUs) {
+        int64_t litUntil =
+            edgeUs + (int64_t)periodUs * self->strobeShare / 100;
+        esp_timer_stop(self->strobeTimer);
+        esp_timer_start_once(
+            self->strobeTimer,
+            std::max<int64_t>(litUntil - esp_timer_get_time(), 1));
+      }
+    }
+    xSemaphoreGive(self->strobeLock);
+  }
+}
+
+void IREmitter::onStrobeEnd(void* arg) {
+  auto* self = static_cast<IREmitter*>(arg);
+  xSemaphoreTake(self->strobeLock, portMAX_DELAY);
+  if (self->strobing)
+    self->write(0);
+  xSemaphoreGive(self->strobeLock);
+}
+
+void IREmitter::write(uint32_t duty) const {
+  ledcWrite(IR_EMITTER_LEDC_CHANNEL, duty);
+}
+
+void IREmitter::update(ConfigState_e event) {
+  switch (event) {
+    case ConfigState_e::configLoaded:
+      this->begin();
+      break;
+    case ConfigState_e::irEmitterConfigUpdated:
+    // the camera is attached first and has its new frame size by now
+    case ConfigState_e::cameraConfigUpdated:
+      this->applyConfig();
+      break;
+    default:
+      break;
+  }
+}
+
+std::string IREmitter::getName() {
+  return "IREmitter";
+}
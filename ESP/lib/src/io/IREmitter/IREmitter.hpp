@@ -0,0 +1,103 @@
+#pragma once
+#ifndef IREMITTER_HPP
+#define IREMITTER_HPP
+#include <Arduino.h>
+#include <driver/pcnt.h>
+#include <esp_timer.h>
+#include "data/StateManager/StateManager.hpp"
+#include "data/config/project_config.hpp"
+#include "data/utilities/Observer.hpp"
+#include "io/camera/cameraHandler.hpp"
+
+//! LEDC channel 0 and its timer are taken by the camera XCLK, channel 2 runs
+//! off timer 1
+#define IR_EMITTER_LEDC_CHANNEL 2
+#define IR_EMITTER_PWM_FREQ 20000
+#define IR_EMITTER_PWM_RESOLUTION 8
+//! counts the VSYNC edges, the camera driver keeps the pin's GPIO interrupt
+#define IR_EMITTER_PCNT_UNIT PCNT_UNIT_0
+//! above the camera and stream tasks, it only wakes up once a frame
+#define IR_EMITTER_TASK_PRIORITY 10
+//! the strobe exposure stays this far short of the frame so it never
+//! stretches it
+#define IR_EMITTER_EXPOSURE_MARGIN_LINES 4
+
+enum IREmitterMode_e {
+  IREmitter_Constant,
+  IREmitter_Strobe,
+};
+
+/**
+ * @brief Drives the IR illuminator either constantly or strobed in sync with
+ * the sensor VSYNC
+ * @details In strobe mode every VSYNC edge lights the emitter and an esp_timer
+ * turns it off again once the configured share of the frame period has passed.
+ * The frame period is measured from the VSYNC edges themselves, so it follows
+ * whatever frame rate the sensor is running at.
+ *
+ * The OV2640 has a rolling shutter, every row is exposed for the same number
+ * of lines but each at a different point of the frame. A window that starts
+ * at VSYNC only lights every row alike if the exposure covers the whole
+ * frame, so strobing raises it to the frame length and puts it back after.
+ * The drive is then raised by the ratio of the usual exposure to the lit
+ * window, which keeps the image as bright as with the emitter constantly on.
+ * A window too short for that even at full drive would underexpose, such a
+ * configuration is refused and the emitter stays constant. The margin the
+ * exposure keeps from the frame end and any dummy lines the frame sync adds
+ * go unexposed, rows that read out right after the lit window lose that much
+ * of it. Ambient light is integrated over the longer exposure as well, so the
+ * face stands out less against it than with the emitter constantly on.
+ *
+ * The edges come from a PCNT unit reading the pin through the GPIO matrix. A
+ * GPIO interrupt would replace the camera driver's own handler on that pin,
+ * there can only be one. The ISR only timestamps the edge and wakes the strobe
+ * task, which does the LEDC write and arms the timer, neither is safe in an
+ * ISR.
+ */
+class IREmitter : public IObserver<ConfigState_e> {
+ public:
+  IREmitter(ProjectConfig& configManager,
+            CameraHandler& camera,
+            int8_t pin,
+            int8_t vsyncPin);
+  virtual ~IREmitter();
+  void begin();
+  void update(ConfigState_e event) override;
+  std::string getName() override;
+
+ private:
+  void applyConfig();
+  //! the lit drive that matches constant light at this intensity, -1 if the
+  //! window is too short for it
+  int strobeDrive(uint8_t intensity, uint8_t share) const;
+  //! false if strobing couldn't start, the emitter is left as it was
+  bool enableStrobe(uint32_t duty);
+  void disableStrobe();
+  //! false if the VSYNC edges can't be counted
+  bool setUpVSync();
+  void write(uint32_t duty) const;
+
+  static void onVSync(void* arg);
+  static void strobeLoop(void* arg);
+  static void onStrobeEnd(void* arg);
+
+  ProjectConfig& configManager;
+  CameraHandler& camera;
+  int8_t pin;
+  int8_t vsyncPin;
+  esp_timer_handle_t strobeTimer = nullptr;
+  TaskHandle_t strobeTask = nullptr;
+  //! guards strobing against the strobe task and timer
+  SemaphoreHandle_t strobeLock = nullptr;
+  //! guards the VSYNC timing against the ISR
+  portMUX_TYPE vsyncMux = portMUX_INITIALIZER_UNLOCKED;
+  bool vsyncReady = false;
+  bool strobing = false;
+
+  volatile uint32_t litDuty = 0;
+  volatile uint8_t strobeShare = 100;
+  volatile int64_t lastVSyncUs = 0;
+  volatile uint32_t framePeriodUs = 0;
+};
+
+#endif  // IREMITTER_HPP
@@ -1,36 +1,30 @@
 #ifndef LEDMANAGER_HPP
 #define LEDMANAGER_HPP
-#include <vector>
-#include <Arduino.h>
+#include <atomic>
 #include <data/StateManager/StateManager.hpp>
-#include <unordered_map>
+#include "hal/hal.hpp"
+#include "LEDPattern.hpp"
 
 class LEDManager
 {
 public:
-	LEDManager(byte pin);
+	LEDManager(uint8_t pin);
 	virtual ~LEDManager();
 
 	void begin();
-	void handleLED();
+	void postState(LEDStates_e state);
 	void toggleLED(bool state) const;
 
 private:
-	byte _ledPin;
-	unsigned long nextStateChangeMillis = 0;
-	bool _ledState;
+	static void onTimer(void* arg);
+	void advance();
 
-	struct BlinkPatterns_t
-	{
-		int state;
-		int delayTime;
-	};
+	uint8_t _ledPin;
+	Hal::Timer timer;
+	LEDPattern::Player player;
 
-	typedef std::unordered_map<LEDStates_e, std::vector<BlinkPatterns_t>> ledStateMap_t;
-	static ledStateMap_t ledStateMap;
-	static std::vector<LEDStates_e> keepAliveStates;
-	LEDStates_e currentState;
-	unsigned int currentPatternIndex = 0;
+	std::atomic<LEDStates_e> requestedState{LEDStates_e::_LedStateNone};
+	std::atomic<bool> idle{false};
 };
 
 #endif // LEDMANAGER_HPP
@@ -0,0 +1,125 @@
+#pragma once
+#ifndef LEDPATTERN_HPP
+#define LEDPATTERN_HPP
+#include <stdint.h>
+#include <data/StateManager/StateManager.hpp>
+
+/**
+ * @brief Compact blink timelines for every LEDStates_e.
+ * @details Each step is packed into 16 bits, the top bit holds the LED level
+ * and the lower 15 bits hold how long the step lasts in milliseconds. The
+ * timelines are indexed directly by the state, so looking one up is a single
+ * array access instead of a map lookup.
+ */
+namespace LEDPattern {
+  typedef uint16_t Step_t;
+
+  constexpr Step_t ON(uint16_t ms) {
+    return 0x8000 | (ms & 0x7FFF);
+  }
+  constexpr Step_t OFF(uint16_t ms) {
+    return ms & 0x7FFF;
+  }
+  constexpr bool level(Step_t step) {
+    return step & 0x8000;
+  }
+  constexpr uint16_t duration(Step_t step) {
+    return step & 0x7FFF;
+  }
+
+  struct Timeline_t {
+    const Step_t* steps;
+    uint8_t length;
+    //! keepAlive timelines are replayed until the state changes
+    bool keepAlive;
+  };
+
+  constexpr Step_t none[] = {OFF(500)};
+  constexpr Step_t improvStart[] = {ON(500), OFF(300), OFF(300), OFF(300),
+                                    ON(500)};
+  constexpr Step_t improvStop[] = {ON(300), OFF(500), OFF(500), OFF(500),
+                                   ON(300)};
+  constexpr Step_t genericError[] = {ON(200), OFF(100), OFF(500), OFF(100),
+                                     ON(200)};
+  constexpr Step_t improvError[] = {ON(1000), OFF(500), OFF(1000), OFF(500),
+                                    ON(1000)};
+  constexpr Step_t mdnsError[] = {ON(200),  OFF(100), ON(200),
+                                  OFF(100), OFF(500), OFF(100),
+                                  ON(200),  OFF(100), ON(200)};
+  // this also works as a more general error - something went critically
+  // wrong? We go here
+  constexpr Step_t cameraError[] = {ON(5000)};
+  constexpr Step_t wifiConnecting[] = {ON(100), OFF(100)};
+  constexpr Step_t wifiConnected[] = {ON(100), OFF(100), ON(100), OFF(100),
+                                      ON(100), OFF(100), ON(100), OFF(100),
+                                      ON(100), OFF(100)};
+
+  template <size_t N>
+  constexpr Timeline_t timeline(const Step_t (&steps)[N],
+                                bool keepAlive = false) {
+    return {steps, static_cast<uint8_t>(N), keepAlive};
+  }
+
+  //! must follow the order of DeviceStates::LEDStates_e
+  constexpr Timeline_t timelines[] = {
+      timeline(none),                // _LedStateNone
+      timeline(improvStart),         // _Improv_Start
+      timeline(improvStop),          // _Improv_Stop
+      timeline(genericError),        // _Improv_Processing
+      timeline(improvError),         // _Improv_Error
+      timeline(genericError, true),  // _WebServerState_Error
+      timeline(genericError),        // _WiFiState_Error
+      timeline(mdnsError),           // _MDNSState_Error
+      timeline(cameraError, true),   // _Camera_Error
+      timeline(wifiConnecting),      // _WiFiState_Connecting
+      timeline(wifiConnected),       // _WiFiState_Connected
+  };
+
+  constexpr size_t timelineCount = sizeof(timelines) / sizeof(timelines[0]);
+
+  static_assert(timelineCount == LEDStates_e::_WiFiState_Connected + 1,
+                "Every LEDStates_e needs a timeline");
+
+  /**
+   * @brief Plays the timelines step by step, independent of any clock.
+   * @details The owner calls advance() whenever the previous step has elapsed
+   * and schedules the next call after the returned delay. Keeping the clock
+   * out of here lets the whole timing logic run against a virtual clock.
+   */
+  class Player {
+   public:
+    /**
+     * @brief Moves to the next step of the current timeline
+     * @param requested the state the device is currently in
+     * @param level set to the LED level the step wants to display
+     * @return the step duration in milliseconds, 0 once the player is idle and
+     * waits for a new state to be posted
+     */
+    uint32_t advance(LEDStates_e requested, bool& level) {
+      if (this->index >= timelines[this->current].length) {
+        // we want to keep displaying the same state only if its an keepAlive
+        // one, but we should change if the incoming one is also an errours
+        // state, maybe more serious one this time
+        if (!timelines[this->current].keepAlive &&
+            !timelines[requested].keepAlive && requested == this->current) {
+          level = false;
+          return 0;
+        }
+        this->current = requested;
+        this->index = 0;
+      }
+
+      Step_t step = timelines[this->current].steps[this->index++];
+      level = LEDPattern::level(step);
+      return duration(step);
+    }
+
+    LEDStates_e currentState() const { return this->current; }
+
+   private:
+    LEDStates_e current = LEDStates_e::_LedStateNone;
+    uint8_t index = 0;
+  };
+}  // namespace LEDPattern
+
+#endif  // LEDPATTERN_HPP
@@ -1,6 +1,5 @@
 #include "SerialManager.hpp"
 #include <WiFi.h>
-#include <WiFiUdp.h>
 
 const char* ssid = "boostiest booster";
 const char* pwd = "crystalize";
@@ -8,20 +7,24 @@ const char* pwd = "crystalize";
 const char* udpAddress = "192.168.50.58";
 const int udpPort = 3333;
 
-WiFiUDP udp;
+Hal::DatagramSocket udp;
 
 // Image is quite large, so many frags
 #define UDP_FRAG_NUM 12
 #define UDP_RETRY 5
-#define UDP_PACKET_SIZE (size_t)1024
 
-// UDP has max packet size
-struct PacketHeader {
-  int frameNum;
-  int id;
-  int size;
-  int totalPackets;
-} __attribute__((packed));
+#ifdef ETVR_EYE_TRACKER_USB_API
+static Metrics::Counter framesCaptured("openiris_frames_captured_total", "Frames taken from the camera", "transport=\"udp\"");
+static Metrics::Counter framesSent("openiris_frames_sent_total", "Frames delivered to a client, once per client", "transport=\"udp\"");
+static Metrics::Counter framesDropped("openiris_frames_dropped_total", "Frames that did not make it to a client", "transport=\"udp\"");
+static Metrics::Counter captureFailures("openiris_camera_capture_failures_total", "Captures the camera driver failed", "transport=\"udp\"");
+static Metrics::Histogram captureLatency("openiris_stage_latency_seconds", "Time spent per pipeline stage",
+                                         Metrics::latencyBoundsUs, 10, 1000000, "transport=\"udp\",stage=\"capture\"");
+static Metrics::Histogram sendLatency("openiris_stage_latency_seconds", "Time spent per pipeline stage",
+                                      Metrics::latencyBoundsUs, 10, 1000000, "transport=\"udp\",stage=\"send\"");
+static Metrics::Histogram jpegSize("openiris_jpeg_size_bytes", "Size of the captured JPEG frames",
+                                   Metrics::jpegBoundsBytes, 7, 1, "transport=\"udp\"");
+#endif  // ETVR_EYE_TRACKER_USB_API
 
 int currentFrameNum = 0;
 bool confirmed[UDP_FRAG_NUM];
@@ -40,11 +43,12 @@ void createByteArray(uint8_t** arr, size_t* len) {
   }
 }
 
-void sendPacket(PacketHeader* packetHeader, uint8_t* data){
-  udp.beginPacket(udpAddress, udpPort);
-  udp.write((uint8_t *)packetHeader, sizeof(PacketHeader));
-  udp.write((uint8_t *)data, packetHeader->size);
-  udp.endPacket();
+bool sendPacket(void* ctx,
+                const UdpPacketizer::PacketHeader& packetHeader,
+                const uint8_t* data) {
+  return udp.send(udpAddress, udpPort,
+                  reinterpret_cast<const uint8_t*>(&packetHeader),
+                  sizeof(packetHeader), data, packetHeader.size);
 }
 
 SerialManager::SerialManager(CommandManager* commandManager)
@@ -53,53 +57,35 @@ SerialManager::SerialManager(CommandManager* commandManager)
 #ifdef ETVR_EYE_TRACKER_USB_API
 void SerialManager::send_frame() {
   if (!last_frame)
-    last_frame = esp_timer_get_time();
-
-  uint8_t len_bytes[2];
-
-  size_t len = 0;
-  uint8_t* buf = NULL;
-
-  // createByteArray(&buf, &len);
-
-  auto fb = esp_camera_fb_get();
-  if (fb) {
-    len = fb->len;
-    buf = fb->buf;
-  } else
-    err = ESP_FAIL;
-
-  // if we failed to capture the frame, we bail, but we still want to listen to
-  // commands
-  if (err != ESP_OK) {
-    log_e("Camera capture failed with response: %s", esp_err_to_name(err));
+    last_frame = Hal::micros();
+
+  FrameTracer::Record_t trace = {};
+  int64_t captureStart = Hal::micros();
+  Hal::Frame_t frame;
+  if (!Hal::cameraAcquire(frame)) {
+    // we still want to listen to commands
+    captureFailures.add();
+    log_e("Camera capture failed");
     return;
   }
+  trace.captured = Hal::micros();
+  trace.vsync = frame.timestampUs;
+  captureLatency.observe(trace.captured - captureStart);
+  framesCaptured.add();
+  jpegSize.observe(frame.len);
 
-  udp.flush();
   currentFrameNum++;
 
   memset(confirmed, false, sizeof(confirmed)); // Clear confirmed
-  PacketHeader packetHeader;
-  for (size_t sendInteration = 0; sendInteration < 1 ; sendInteration++)
-  {
-    for (size_t i = 0; i < UDP_FRAG_NUM; i++)
-    {
-      if (sendInteration > 0 && i == 0) continue; // Skip first packet if resending the rest
-
-      packetHeader.frameNum = currentFrameNum;
-      packetHeader.id = i;
-      packetHeader.totalPackets = ceil(len / UDP_PACKET_SIZE ) +1;
-
-      size_t offset = min(i * UDP_PACKET_SIZE, len);
-      packetHeader.size = min(UDP_PACKET_SIZE, len - offset);
-
-      // Serial.print("Sending size of: ");
-      // Serial.println(sizeof(int) * 2 + );
-
-      sendPacket(&packetHeader, buf + offset);
-      // vTaskDelay(1); 
-    }
+  trace.firstByte = Hal::micros();
+  bool delivered = UdpPacketizer::send(currentFrameNum, frame.data, frame.len,
+                                       &sendPacket, nullptr);
+  if (delivered) {
+    trace.lastByte = Hal::micros();
+    sendLatency.observe(trace.lastByte - trace.firstByte);
+    framesSent.add();
+  } else {
+    framesDropped.add();
   }
   
 
@@ -155,19 +141,16 @@ void SerialManager::send_frame() {
   
   
 
-  if (fb) {
-    esp_camera_fb_return(fb);
-    fb = NULL;
-    buf = NULL;
-  } else if (buf) {
-    free(buf);
-    buf = NULL;
-  }
+  size_t len = frame.len;
+  Hal::cameraRelease(frame);
+  trace.returned = Hal::micros();
+  trace.frame = frameTracer.nextFrame();
+  trace.size = len;
+  trace.transport = FrameTracer::Transport_UDP;
+  frameTracer.record(trace);
 
   vTaskDelay(pdMS_TO_TICKS(1000/90));
 
-  free(buf);
-
   long request_end = millis();
   long latency = request_end - last_request_time;
   last_request_time = request_end;
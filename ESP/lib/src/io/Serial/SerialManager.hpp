@@ -7,7 +7,11 @@
 #include <USBCDC.h>
 #include <esp_camera.h>
 #include "data/CommandManager/CommandManager.hpp"
+#include "data/FrameTrace/FrameTrace.hpp"
+#include "data/Metrics/Metrics.hpp"
 #include "data/config/project_config.hpp"
+#include "hal/hal.hpp"
+#include "udpPacketizer.hpp"
 
 const char* const ETVR_HEADER = "\xff\xa0";
 const char* const ETVR_HEADER_FRAME = "\xff\xa1";
@@ -0,0 +1,25 @@
+#include "udpPacketizer.hpp"
+
+namespace UdpPacketizer {
+  uint32_t packetCount(size_t len) {
+    // one more than the full packets, a frame that fills its last packet
+    // exactly ends with an empty one
+    return len / PACKET_SIZE + 1;
+  }
+
+  bool send(int32_t frameNum, const uint8_t* data, size_t len, Send send,
+            void* ctx) {
+    PacketHeader header;
+    header.frameNum = frameNum;
+    header.totalPackets = packetCount(len);
+
+    bool delivered = true;
+    for (int32_t id = 0; id < header.totalPackets; id++) {
+      size_t offset = (size_t)id * PACKET_SIZE;
+      header.id = id;
+      header.size = len - offset < PACKET_SIZE ? len - offset : PACKET_SIZE;
+      delivered &= send(ctx, header, data + offset);
+    }
+    return delivered;
+  }
+}  // namespace UdpPacketizer
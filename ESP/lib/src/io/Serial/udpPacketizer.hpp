@@ -0,0 +1,40 @@
+#pragma once
+#ifndef UDP_PACKETIZER_HPP
+#define UDP_PACKETIZER_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Splits a frame into the datagrams the USB tracker receiver expects
+ * @details Pure code, the datagrams go out through a callback, so the framing
+ * can be checked and benchmarked on the host
+ */
+namespace UdpPacketizer {
+  //! payload bytes per datagram
+  constexpr size_t PACKET_SIZE = 1024;
+
+  // UDP has max packet size
+  struct PacketHeader {
+    int32_t frameNum;
+    int32_t id;
+    int32_t size;
+    int32_t totalPackets;
+  } __attribute__((packed));
+
+  //! returns false if the datagram could not be sent
+  using Send = bool (*)(void* ctx,
+                        const PacketHeader& header,
+                        const uint8_t* payload);
+
+  //! how many datagrams a frame is announced as, the receiver counts on it
+  uint32_t packetCount(size_t len);
+
+  /**
+   * @brief Send every datagram of one frame
+   * @return false if any of them failed, the rest are sent regardless
+   */
+  bool send(int32_t frameNum, const uint8_t* data, size_t len, Send send,
+            void* ctx);
+}  // namespace UdpPacketizer
+
+#endif  // UDP_PACKETIZER_HPP
@@ -1,5 +1,12 @@
 #include "cameraHandler.hpp"
 
+static Metrics::Counter hardwareResets("openiris_camera_resets_total",
+                                       "Camera recoveries by reset kind",
+                                       "kind=\"hardware\"");
+static Metrics::Counter softwareResets("openiris_camera_resets_total",
+                                       "Camera recoveries by reset kind",
+                                       "kind=\"software\"");
+
 CameraHandler::CameraHandler(ProjectConfig& configManager)
     : configManager(configManager) {}
 
@@ -69,7 +76,7 @@ void CameraHandler::setupBasicResolution() {
     log_e("[Camera]: Did not find psram, setting lower image quality");
     config.fb_location = CAMERA_FB_IN_DRAM;
     config.jpeg_quality = 9;
-    config.fb_count = 2;
+    config.fb_count = this->dramFrameBuffers;
     return;
   }
 
@@ -107,11 +114,8 @@ void CameraHandler::setupCameraSensor() {
                                    0);               // 0 = disable , 1 = enable
   camera_sensor->set_aec2(camera_sensor, 0);         // 0 = disable , 1 = enable
   camera_sensor->set_ae_level(camera_sensor, 0);     // -2 to 2
-  camera_sensor->set_aec_value(camera_sensor, 300);  // 0 to 1200
-  // Use a lower aec value for babble to better isolate the face with illuminators 
-  #ifdef CONFIG_CAMERA_MODULE_SWROOM_BABBLE_S3
-    camera_sensor->set_aec_value(camera_sensor, 100);  // 0 to 1200
-  #endif
+  camera_sensor->set_aec_value(camera_sensor,
+                                this->exposureLines);  // 0 to 1200
 
   // controls the gain
   camera_sensor->set_gain_ctrl(camera_sensor, 0);  // 0 = disable , 1 = enable
@@ -194,6 +198,8 @@ void CameraHandler::loadConfigData() {
   this->setHFlip(cameraConfig.href);
   this->setVFlip(cameraConfig.vflip);
   this->setCameraResolution((framesize_t)cameraConfig.framesize);
+  // a new frame size can change the sensor mode, keep our exposure
+  camera_sensor->set_aec_value(camera_sensor, this->exposureLines);
   camera_sensor->set_quality(camera_sensor, cameraConfig.quality);
   camera_sensor->set_agc_gain(camera_sensor, cameraConfig.brightness);
   log_d("Loading camera config data done");
@@ -250,22 +256,98 @@ int CameraHandler::setVieWindow(int offsetX,
   return 0;
 }
 
+int CameraHandler::setExposureLines(uint16_t lines) {
+  this->exposureLines = lines;
+  // a reset in progress applies it once the sensor is back
+  if (!this->camera_sensor || this->resetPending)
+    return 0;
+  return camera_sensor->set_aec_value(camera_sensor, lines);
+}
+
+uint16_t CameraHandler::getFrameLines() const {
+  if (!this->camera_sensor || camera_sensor->id.PID != OV2640_PID)
+    return 0;
+#ifdef CONFIG_CAMERA_MODULE_SWROOM_BABBLE_S3
+  // the crop always runs the sensor in its CIF mode
+  return OV2640_FRAME_LINES_CIF;
+#else
+  framesize_t frameSize = camera_sensor->status.framesize;
+  if (frameSize <= FRAMESIZE_CIF)
+    return OV2640_FRAME_LINES_CIF;
+  if (frameSize <= FRAMESIZE_SVGA)
+    return OV2640_FRAME_LINES_SVGA;
+  return OV2640_FRAME_LINES_UXGA;
+#endif  // CONFIG_CAMERA_MODULE_SWROOM_BABBLE_S3
+}
+
 //! either hardware(1) or software(0)
 void CameraHandler::resetCamera(bool type) {
+  if (this->resetPending) {
+    log_w("[Camera]: A reset is already in progress");
+    return;
+  }
+  this->resetPending = true;
+  (type ? hardwareResets : softwareResets).add();
+
   if (type) {
     // power cycle the camera module (handy if camera stops responding)
     digitalWrite(PWDN_GPIO_NUM, HIGH);  // turn power off to camera module
-    Network_Utilities::my_delay(0.3);   // a for loop with a delay of 300ms
-    digitalWrite(PWDN_GPIO_NUM, LOW);
-    Network_Utilities::my_delay(0.3);
-    setupCamera();
+    this->afterReset(300, [this]() {
+      digitalWrite(PWDN_GPIO_NUM, LOW);
+      this->afterReset(300, [this]() { this->finishReset(); });
+    });
   } else {
     // reset via software (handy if you wish to change resolution or image type
     // etc. - see test procedure)
     esp_camera_deinit();
-    Network_Utilities::my_delay(0.05);
-    setupCamera();
+    this->afterReset(50, [this]() { this->finishReset(); });
+  }
+}
+
+void CameraHandler::afterReset(uint32_t delayMs, Scheduler::Job step) {
+  if (scheduler.scheduleAfter(delayMs, step) != Scheduler::INVALID_JOB)
+    return;
+  // better late than leaving the camera powered down
+  delay(delayMs);
+  step();
+}
+
+void CameraHandler::finishReset() {
+  bool ready = this->setupCamera();
+  if (!ready && this->dramFrameBuffers > 2) {
+    log_w("[Camera]: No room for a third frame buffer after all");
+    this->dramFrameBuffers = 2;
+    ready = this->setupCamera();
   }
+  // the sensor comes back at the default frame size
+  if (ready)
+    this->loadConfigData();
+  this->resetPending = false;
+}
+
+/**
+ * @details The camera is set up before WiFi and the servers, so the free
+ * internal RAM it sees then says nothing about what's left at runtime. It
+ * boots with two buffers and takes the third one here, from what has been
+ * measured after everything else allocated.
+ */
+void CameraHandler::checkFrameBuffers() {
+  size_t freeInternal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  if (psramFound() || this->dramFrameBuffers >= 3) {
+    log_i("[Camera]: %u bytes of internal RAM free", (unsigned)freeInternal);
+    return;
+  }
+
+  // the driver sizes a JPEG buffer at a fifth of the raw frame
+  size_t frameBufferSize = resolution[config.frame_size].width *
+                           resolution[config.frame_size].height / 5;
+  log_i("[Camera]: %u frame buffers of %u bytes in DRAM, %u bytes free",
+        (unsigned)this->dramFrameBuffers, (unsigned)frameBufferSize,
+        (unsigned)freeInternal);
+  if (freeInternal <= CAMERA_DRAM_HEADROOM + frameBufferSize)
+    return;
+  this->dramFrameBuffers = 3;
+  this->resetCamera(0);
 }
 
 void CameraHandler::update(ConfigState_e event) {
@@ -1,20 +1,45 @@
 #pragma once
 #include <Arduino.h>
 #include <esp_camera.h>
+#include <esp_heap_caps.h>
+#include "data/Metrics/Metrics.hpp"
 #include "data/StateManager/StateManager.hpp"
 #include "data/config/project_config.hpp"
 #include "data/utilities/Observer.hpp"
 #include "data/utilities/network_utilities.hpp"
+#include "tasks/scheduler.hpp"
 
 #define DEFAULT_XCLK_FREQ_HZ 16500000
 #define USB_DEFAULT_XCLK_FREQ_HZ 24000000
 #define OV5640_XCLK_FREQ_HZ DEFAULT_XCLK_FREQ_HZ
+//! internal RAM that has to stay free for connections, lwIP and uploads once
+//! the servers run, before a third frame buffer is taken from DRAM
+#define CAMERA_DRAM_HEADROOM (64 * 1024)
+//! manual exposure in sensor lines, Babble uses a shorter one to better
+//! isolate the face with its illuminators
+#ifdef CONFIG_CAMERA_MODULE_SWROOM_BABBLE_S3
+#define CAMERA_AEC_LINES 100
+#else
+#define CAMERA_AEC_LINES 300
+#endif  // CONFIG_CAMERA_MODULE_SWROOM_BABBLE_S3
+//! OV2640 frame length in lines, blanking included, in each of the three
+//! sensor modes the driver picks between by frame size
+#define OV2640_FRAME_LINES_CIF 336
+#define OV2640_FRAME_LINES_SVGA 672
+#define OV2640_FRAME_LINES_UXGA 1248
 
 class CameraHandler : public IObserver<ConfigState_e> {
  private:
-  sensor_t* camera_sensor;
+  sensor_t* camera_sensor = nullptr;
   camera_config_t config;
   ProjectConfig& configManager;
+  //! the reset steps run on the scheduler, this keeps resets from overlapping
+  volatile bool resetPending = false;
+  //! applied again whenever the sensor is set up
+  volatile uint16_t exposureLines = CAMERA_AEC_LINES;
+  //! without PSRAM, raised by checkFrameBuffers once it's known what the rest
+  //! of the firmware left
+  uint8_t dramFrameBuffers = 2;
 
  public:
   CameraHandler(ProjectConfig& configManager);
@@ -25,6 +50,13 @@ class CameraHandler : public IObserver<ConfigState_e> {
   void update(ConfigState_e event);
   std::string getName();
   void resetCamera(bool type = 0);
+  //! manual exposure in lines, kept across camera resets
+  int setExposureLines(uint16_t lines);
+  //! lines per frame, blanking included, 0 if the sensor isn't an OV2640
+  uint16_t getFrameLines() const;
+  //! takes a third frame buffer from DRAM if there's room, call once the
+  //! servers are up
+  void checkFrameBuffers();
 
  private:
   void loadConfigData();
@@ -32,4 +64,6 @@ class CameraHandler : public IObserver<ConfigState_e> {
   void setupCameraPinout();
   void setupBasicResolution();
   void setupCameraSensor();
+  void afterReset(uint32_t delayMs, Scheduler::Job step);
+  void finishReset();
 };
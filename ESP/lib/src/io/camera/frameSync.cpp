@@ -0,0 +1,132 @@
+#include "frameSync.hpp"
+#include <math.h>
+#include <algorithm>
+
+namespace {
+  //! the line count shows two frames later, a higher gain rings
+  constexpr double KP = 0.3;
+  constexpr double KI = 0.02;
+}  // namespace
+
+void FrameSync::setSchedule(int64_t epochUs, uint32_t periodUs) {
+  if (epochUs == this->epochUs && periodUs == this->periodUs)
+    return;
+  this->epochUs = epochUs;
+  this->periodUs = periodUs;
+  this->integralUs = 0;
+  this->onTime = 0;
+  if (this->current == State_Unsupported)
+    return;
+  if (this->lineUs > 0) {
+    this->current = State_Locking;
+    return;
+  }
+  // from the start, a schedule that went away may have cut it short
+  this->current = State_Calibrating;
+  this->naturalUs = 0;
+  this->settled = 0;
+  this->shortestGapUs = 0;
+}
+
+void FrameSync::clearSchedule() {
+  this->periodUs = 0;
+  this->integralUs = 0;
+  if (this->current != State_Unsupported)
+    this->current = State_Free;
+}
+
+void FrameSync::unsupported() {
+  this->current = State_Unsupported;
+  this->extraLines = 0;
+}
+
+FrameSync::Result_t FrameSync::onFrame(int64_t localUs, int64_t hostUs) {
+  Result_t result = {-1, 0, false, this->extraLines};
+  int64_t gapUs = this->lastLocalUs ? localUs - this->lastLocalUs : 0;
+  this->lastLocalUs = localUs;
+
+  if (!this->periodUs || hostUs < 0) {
+    // without slots to aim for, frames go back to their own length
+    if (this->extraLines && this->current != State_Unsupported)
+      this->setLines(0, result);
+    return result;
+  }
+
+  // the nearest slot, frames up to half a slot early belong to it too
+  int64_t period = this->periodUs;
+  int64_t since = hostUs - this->epochUs + period / 2;
+  int64_t slot = since >= 0 ? since / period : (since - period + 1) / period;
+  result.seq = (int32_t)(slot & 0x7fffffff);
+  result.phaseErrorUs = (int32_t)(hostUs - this->epochUs - slot * period);
+
+  if (this->current == State_Calibrating)
+    this->calibrate(gapUs, result);
+  else if (this->current == State_Locking || this->current == State_Locked)
+    this->steer(result.phaseErrorUs, result);
+  return result;
+}
+
+void FrameSync::calibrate(int64_t gapUs, Result_t& result) {
+  // start from the sensor's own frame length
+  if (!this->naturalUs && this->extraLines) {
+    this->setLines(0, result);
+    return;
+  }
+  if (++this->settled <= SETTLE_FRAMES || gapUs <= 0)
+    return;
+  // dropped frames only make gaps longer
+  if (!this->shortestGapUs || gapUs < this->shortestGapUs)
+    this->shortestGapUs = gapUs;
+  if (this->settled < SETTLE_FRAMES + CAL_FRAMES)
+    return;
+
+  if (!this->naturalUs) {
+    this->naturalUs = this->shortestGapUs;
+    this->setLines(CAL_LINES, result);
+    return;
+  }
+  this->lineUs = (double)(this->shortestGapUs - this->naturalUs) / CAL_LINES;
+  if (this->lineUs < 0.1) {
+    // the lines didn't make it slower
+    this->lineUs = 0;
+    this->setLines(0, result);
+    this->current = State_Unsupported;
+    return;
+  }
+  this->current = State_Locking;
+  this->steer(result.phaseErrorUs, result);
+}
+
+void FrameSync::steer(int32_t errorUs, Result_t& result) {
+  double period = this->periodUs;
+  // only once close, far off the proportional part has it and the sum would
+  // just overshoot
+  if (fabs((double)errorUs) < period / 8) {
+    this->integralUs += KI * errorUs;
+    this->integralUs =
+        std::max(-period / 8, std::min(period / 8, this->integralUs));
+  }
+  // late frames make the next ones shorter
+  double targetUs = period - KP * errorUs - this->integralUs;
+  double lines = round((targetUs - this->naturalUs) / this->lineUs);
+  uint16_t wanted = (uint16_t)std::max(0.0, std::min(lines, (double)MAX_EXTRA_LINES));
+  if (wanted != this->extraLines)
+    this->setLines(wanted, result);
+
+  int32_t magnitude = errorUs < 0 ? -errorUs : errorUs;
+  if (magnitude <= LOCK_US) {
+    if (this->onTime < LOCK_FRAMES && ++this->onTime == LOCK_FRAMES)
+      this->current = State_Locked;
+  } else if (magnitude > 2 * LOCK_US) {
+    this->onTime = 0;
+    this->current = State_Locking;
+  }
+}
+
+void FrameSync::setLines(uint16_t lines, Result_t& result) {
+  this->extraLines = lines;
+  this->settled = 0;
+  this->shortestGapUs = 0;
+  result.applyLines = true;
+  result.extraLines = lines;
+}
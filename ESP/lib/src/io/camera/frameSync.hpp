@@ -0,0 +1,92 @@
+#pragma once
+#ifndef FRAME_SYNC_HPP
+#define FRAME_SYNC_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Phase locks the camera to frame slots shared by both eyes
+ * @details The host hands both trackers the same schedule, a slot every
+ * periodUs from epochUs on its clock, and ClockSync puts our frames on that
+ * clock. Sensors can't be told when to start a frame, but they can be told to
+ * make frames longer by a number of blank lines. So the schedule has to be a
+ * little slower than the sensor, and every frame is stretched by however much
+ * brings the next one closer to its slot, a PI loop on the phase error.
+ *
+ * How long a line is depends on the sensor, the resolution and the clock, so
+ * it is measured first: a few frames as they are, then a few with
+ * CAL_LINES more. A sensor that doesn't get slower can't be locked, frames
+ * then only get their slot number.
+ *
+ * Pure code, so it can be checked on the host against synthetic cameras.
+ */
+class FrameSync {
+ public:
+  //! what a frame is stretched by at most
+  static constexpr uint16_t MAX_EXTRA_LINES = 1024;
+  //! frames this close to their slot count as on time
+  static constexpr int32_t LOCK_US = 500;
+
+  enum State_e {
+    //! no schedule, frames come as they come
+    State_Free,
+    //! measuring the sensor
+    State_Calibrating,
+    //! steering towards the slots
+    State_Locking,
+    //! the last LOCK_FRAMES frames were within LOCK_US
+    State_Locked,
+    //! the camera can't stretch frames
+    State_Unsupported,
+  };
+
+  struct Result_t {
+    //! the slot the frame belongs to, -1 without a schedule
+    int32_t seq;
+    //! how much later than its slot the frame started
+    int32_t phaseErrorUs;
+    //! set when the camera should get a new extraLines
+    bool applyLines;
+    uint16_t extraLines;
+  };
+
+  //! the slots on the host's clock, the same ones again change nothing
+  void setSchedule(int64_t epochUs, uint32_t periodUs);
+  void clearSchedule();
+  //! the start of every frame on both clocks, hostUs -1 if not in sync
+  Result_t onFrame(int64_t localUs, int64_t hostUs);
+  //! the camera didn't take the lines, only number the frames from now on
+  void unsupported();
+
+  State_e state() const { return this->current; }
+
+ private:
+  static constexpr uint16_t CAL_LINES = 64;
+  //! gaps measured at both line counts, the shortest one counts
+  static constexpr uint8_t CAL_FRAMES = 8;
+  //! frames until a new line count surely shows
+  static constexpr uint8_t SETTLE_FRAMES = 3;
+  static constexpr uint8_t LOCK_FRAMES = 8;
+
+  void calibrate(int64_t gapUs, Result_t& result);
+  void steer(int32_t errorUs, Result_t& result);
+  void setLines(uint16_t lines, Result_t& result);
+
+  State_e current = State_Free;
+  int64_t epochUs = 0;
+  uint32_t periodUs = 0;
+  int64_t lastLocalUs = 0;
+  uint16_t extraLines = 0;
+
+  //! frames since the line count last changed
+  uint8_t settled = 0;
+  int64_t shortestGapUs = 0;
+  //! the sensor's own frame length and what a line adds, 0 until measured
+  int64_t naturalUs = 0;
+  double lineUs = 0;
+
+  double integralUs = 0;
+  uint8_t onTime = 0;
+};
+
+#endif  // FRAME_SYNC_HPP
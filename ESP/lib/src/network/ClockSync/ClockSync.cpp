@@ -0,0 +1,143 @@
+#include "ClockSync.hpp"
+#include <esp_timer.h>
+#include <lwip/sockets.h>
+
+ClockSync clockSync;
+
+namespace {
+  constexpr char MAGIC[4] = {'O', 'I', 'C', 'S'};
+}  // namespace
+
+ClockSync::ClockSync() {
+  this->lock = xSemaphoreCreateMutex();
+}
+
+void ClockSync::begin() {
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  // priority 2, answers are timestamped when the task gets to them, so it
+  // should not sit behind the idle work
+  if (!this->task &&
+      xTaskCreatePinnedToCore(&ClockSync::run, "ClockSync", 3072, this, 2,
+                              &this->task, tskNO_AFFINITY) != pdPASS) {
+    log_e("[ClockSync]: Could not start the sync task");
+    this->task = nullptr;
+  }
+  xSemaphoreGive(this->lock);
+}
+
+bool ClockSync::fresh(int64_t now) const {
+  return this->estimator.synced() &&
+         now - this->estimator.lastUs() < CLOCK_SYNC_TIMEOUT_MS * 1000LL;
+}
+
+int64_t ClockSync::toHost(int64_t localUs) {
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  int64_t hostUs =
+      this->fresh(esp_timer_get_time()) ? this->estimator.toHost(localUs) : -1;
+  xSemaphoreGive(this->lock);
+  return hostUs;
+}
+
+ClockSync::Status_t ClockSync::status() {
+  int64_t now = esp_timer_get_time();
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  Status_t status = {this->fresh(now), this->estimator.offsetUs(now),
+                     this->estimator.driftPpm(), this->estimator.delayUs()};
+  xSemaphoreGive(this->lock);
+  return status;
+}
+
+bool ClockSync::schedule(int64_t& epochUs, uint32_t& periodUs) {
+  int64_t now = esp_timer_get_time();
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  bool recent = this->periodUs &&
+                now - this->beaconUs < CLOCK_SYNC_BEACON_TIMEOUT_MS * 1000LL;
+  epochUs = this->epochUs;
+  periodUs = this->periodUs;
+  xSemaphoreGive(this->lock);
+  return recent;
+}
+
+void ClockSync::run(void* arg) {
+  auto* self = static_cast<ClockSync*>(arg);
+  int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (sock < 0) {
+    log_e("[ClockSync]: Could not create the UDP socket");
+    vTaskDelete(nullptr);
+  }
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(CLOCK_SYNC_PORT);
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(sock, (sockaddr*)&address, sizeof(address)) < 0) {
+    log_e("[ClockSync]: Could not bind the UDP socket to port %d",
+          CLOCK_SYNC_PORT);
+    close(sock);
+    vTaskDelete(nullptr);
+  }
+  // wake up often enough to send the requests on time
+  timeval timeout = {0, 50000};
+  setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  log_i("[ClockSync]: Waiting for a host on UDP port %d", CLOCK_SYNC_PORT);
+
+  sockaddr_in host = {};
+  bool haveHost = false;
+  int64_t nextRequest = 0;
+  Packet_t pending = {};
+  uint32_t seq = 0;
+
+  while (true) {
+    Packet_t packet;
+    sockaddr_in from = {};
+    socklen_t fromLen = sizeof(from);
+    int len = recvfrom(sock, &packet, sizeof(packet), 0, (sockaddr*)&from,
+                       &fromLen);
+    int64_t now = esp_timer_get_time();
+
+    if (len == sizeof(packet) && !memcmp(packet.magic, MAGIC, sizeof(MAGIC))) {
+      if (packet.type == Packet_Announce) {
+        if (!haveHost || host.sin_addr.s_addr != from.sin_addr.s_addr) {
+          log_i("[ClockSync]: Syncing to %s", inet_ntoa(from.sin_addr));
+          // a different host has a different clock
+          xSemaphoreTake(self->lock, portMAX_DELAY);
+          self->estimator.reset();
+          xSemaphoreGive(self->lock);
+          nextRequest = now;
+        }
+        host = from;
+        haveHost = true;
+      } else if (packet.type == Packet_Response && pending.seq &&
+                 packet.seq == pending.seq && packet.t1 == pending.t1) {
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        self->estimator.add({packet.t1, packet.t2, packet.t3, now});
+        xSemaphoreGive(self->lock);
+        // late answers to it would be off by however late they are
+        pending.seq = 0;
+      } else if (packet.type == Packet_Beacon && packet.t2 > 0 &&
+                 packet.t2 <= 1000000) {
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        if (packet.t1 != self->epochUs || packet.t2 != self->periodUs)
+          log_i("[ClockSync]: Frame slots every %lld us", packet.t2);
+        self->epochUs = packet.t1;
+        self->periodUs = packet.t2;
+        self->beaconUs = now;
+        xSemaphoreGive(self->lock);
+      }
+    }
+
+    if (haveHost && now >= nextRequest) {
+      pending = {};
+      memcpy(pending.magic, MAGIC, sizeof(MAGIC));
+      pending.type = Packet_Request;
+      // 0 means nothing is pending
+      if (!++seq)
+        seq = 1;
+      pending.seq = seq;
+      pending.t1 = esp_timer_get_time();
+      sendto(sock, &pending, sizeof(pending), 0, (sockaddr*)&host,
+             sizeof(host));
+      nextRequest = now + CLOCK_SYNC_INTERVAL_MS * 1000LL;
+    }
+  }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#ifndef CLOCKSYNC_HPP
+#define CLOCKSYNC_HPP
+#include <Arduino.h>
+#include "clockEstimator.hpp"
+
+#define CLOCK_SYNC_PORT 83
+//! two exchanges a second, the estimator remembers about half a minute
+#define CLOCK_SYNC_INTERVAL_MS 500
+//! without an answer for this long the host's time is no longer reported
+#define CLOCK_SYNC_TIMEOUT_MS 10000
+//! without a beacon for this long the frames run free again
+#define CLOCK_SYNC_BEACON_TIMEOUT_MS 5000
+
+/**
+ * @brief Keeps track of the clock of the host the frames go to
+ * @details The host announces itself with a datagram to CLOCK_SYNC_PORT,
+ * from then on a low priority task asks it for its time every
+ * CLOCK_SYNC_INTERVAL_MS, NTP style, and feeds the answers to a
+ * ClockEstimator. Frames can then carry the host's time next to ours, which
+ * lets the host line up two eyes or compare frames with its own clock.
+ * PythonExamples/clocksync.py is the host side.
+ *
+ * Every datagram, both ways, is a Packet_t: "OICS", the type, a sequence
+ * number and three timestamps, little endian. An announce carries nothing
+ * else, a request its send time as t1, the answer echoes t1 and adds when
+ * the host received it, t2, and when it answered, t3.
+ *
+ * The host can also send a beacon to the trackers of both eyes: the host time
+ * of a frame slot as t1 and the slot length as t2. From then on frames are
+ * meant to start on the slots, see FrameSync, and the slot number since t1 is
+ * their shared sequence number.
+ */
+class ClockSync {
+ public:
+  struct Status_t {
+    bool synced;
+    int64_t offsetUs;
+    float driftPpm;
+    uint32_t delayUs;
+  };
+
+  ClockSync();
+  //! start listening for a host, safe to call more than once
+  void begin();
+  //! one of our timestamps on the host's clock, -1 while not in sync
+  int64_t toHost(int64_t localUs);
+  Status_t status();
+  //! the frame slots of the last beacon, on the host's clock, false without
+  //! a recent one
+  bool schedule(int64_t& epochUs, uint32_t& periodUs);
+
+ private:
+  enum Packet_e : uint8_t {
+    Packet_Announce = 0,
+    Packet_Request = 1,
+    Packet_Response = 2,
+    Packet_Beacon = 3,
+  };
+
+  struct Packet_t {
+    char magic[4];
+    Packet_e type;
+    uint8_t reserved[3];
+    uint32_t seq;
+    int64_t t1;
+    int64_t t2;
+    int64_t t3;
+  } __attribute__((packed));
+
+  static void run(void* arg);
+  bool fresh(int64_t now) const;
+
+  TaskHandle_t task = nullptr;
+  //! guards the estimator, fed by the sync task and read by the streams
+  SemaphoreHandle_t lock = nullptr;
+  ClockEstimator estimator;
+  int64_t epochUs = 0;
+  uint32_t periodUs = 0;
+  //! our time of the last beacon, the schedule is forgotten without one
+  int64_t beaconUs = 0;
+};
+
+extern ClockSync clockSync;
+
+#endif  // CLOCKSYNC_HPP
@@ -0,0 +1,86 @@
+#include "clockEstimator.hpp"
+#include <algorithm>
+
+namespace {
+  //! a quick exchange this far off the line means the host's clock was set
+  constexpr int64_t STEP_US = 5000;
+}  // namespace
+
+void ClockEstimator::add(const Exchange_t& exchange) {
+  int64_t roundTrip = (exchange.t4 - exchange.t1) - (exchange.t3 - exchange.t2);
+  Point_t point;
+  point.localUs = exchange.t1 + (exchange.t4 - exchange.t1) / 2;
+  point.offsetUs =
+      ((exchange.t2 - exchange.t1) + (exchange.t3 - exchange.t4)) / 2;
+  point.delayUs = roundTrip > 0 ? roundTrip : 0;
+
+  if (this->synced() && point.delayUs <= this->maxDelay) {
+    int64_t error = point.offsetUs - this->offsetUs(point.localUs);
+    if (error > STEP_US || error < -STEP_US)
+      this->reset();
+  }
+
+  this->points[this->next] = point;
+  this->next = (this->next + 1) % WINDOW;
+  if (this->count < WINDOW)
+    this->count++;
+  this->last = exchange.t4;
+  this->fit();
+}
+
+void ClockEstimator::reset() {
+  this->count = 0;
+  this->next = 0;
+  this->minDelay = 0;
+  this->maxDelay = 0;
+  this->base = 0;
+  this->slope = 0;
+}
+
+int64_t ClockEstimator::offsetUs(int64_t localUs) const {
+  return (int64_t)(this->base + this->slope * (localUs - this->origin));
+}
+
+int64_t ClockEstimator::toHost(int64_t localUs) const {
+  return localUs + this->offsetUs(localUs);
+}
+
+void ClockEstimator::fit() {
+  // the quickest quarter, how long round trips take depends on the network
+  // and how busy it is, so no fixed limit works everywhere
+  uint32_t delays[WINDOW];
+  for (size_t i = 0; i < this->count; i++)
+    delays[i] = this->points[i].delayUs;
+  size_t quickest = std::min(this->count, std::max(MIN_SAMPLES, this->count / 4));
+  std::nth_element(delays, delays + quickest - 1, delays + this->count);
+  this->maxDelay = delays[quickest - 1];
+  this->minDelay = *std::min_element(delays, delays + quickest);
+  uint32_t limit = this->maxDelay;
+
+  // relative to the newest exchange, keeps the sums small
+  size_t newest = (this->next + WINDOW - 1) % WINDOW;
+  int64_t origin = this->points[newest].localUs;
+  double sumX = 0, sumY = 0;
+  size_t kept = 0;
+  for (size_t i = 0; i < this->count; i++) {
+    if (this->points[i].delayUs > limit)
+      continue;
+    sumX += this->points[i].localUs - origin;
+    sumY += this->points[i].offsetUs;
+    kept++;
+  }
+  double meanX = sumX / kept, meanY = sumY / kept;
+  double sxx = 0, sxy = 0;
+  for (size_t i = 0; i < this->count; i++) {
+    if (this->points[i].delayUs > limit)
+      continue;
+    double dx = this->points[i].localUs - origin - meanX;
+    sxx += dx * dx;
+    sxy += dx * (this->points[i].offsetUs - meanY);
+  }
+
+  this->origin = origin;
+  // a single exchange, or all at once, says nothing about drift
+  this->slope = sxx > 0 ? sxy / sxx : 0;
+  this->base = meanY - this->slope * meanX;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#ifndef CLOCK_ESTIMATOR_HPP
+#define CLOCK_ESTIMATOR_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Where the host's clock is, seen from ours
+ * @details Fed with NTP style exchanges: we send at t1, the host receives at
+ * t2 and answers at t3, we receive at t4. Every exchange gives the offset
+ * between the clocks, off by up to half the round trip, and queueing only
+ * ever makes round trips longer. So only the exchanges with the fastest
+ * round trips seen lately are kept, and a line fitted through their offsets
+ * gives the offset and how fast it drifts.
+ *
+ * Pure code, so it can be checked on the host against simulated clocks.
+ */
+class ClockEstimator {
+ public:
+  //! exchanges remembered, at two a second about half a minute
+  static constexpr size_t WINDOW = 64;
+  //! fewer exchanges than this and the estimate isn't trusted
+  static constexpr size_t MIN_SAMPLES = 4;
+
+  struct Exchange_t {
+    //! ours
+    int64_t t1;
+    //! the host's
+    int64_t t2;
+    int64_t t3;
+    //! ours
+    int64_t t4;
+  };
+
+  void add(const Exchange_t& exchange);
+  void reset();
+
+  bool synced() const { return this->count >= MIN_SAMPLES; }
+  //! one of our timestamps on the host's clock, only meaningful once synced
+  int64_t toHost(int64_t localUs) const;
+  //! host minus ours at localUs
+  int64_t offsetUs(int64_t localUs) const;
+  //! how much faster the host's clock runs, in parts per million
+  float driftPpm() const { return this->slope * 1e6; }
+  //! shortest round trip in the window, half of it bounds the error
+  uint32_t delayUs() const { return this->minDelay; }
+  //! when the last exchange was added, on our clock
+  int64_t lastUs() const { return this->last; }
+
+ private:
+  struct Point_t {
+    int64_t localUs;
+    int64_t offsetUs;
+    uint32_t delayUs;
+  };
+
+  void fit();
+
+  Point_t points[WINDOW] = {};
+  size_t count = 0;
+  size_t next = 0;
+  uint32_t minDelay = 0;
+  //! longest round trip that still counts
+  uint32_t maxDelay = 0;
+  int64_t last = 0;
+  //! the line, offset = base + slope * (local - origin)
+  int64_t origin = 0;
+  double base = 0;
+  double slope = 0;
+};
+
+#endif  // CLOCK_ESTIMATOR_HPP
@@ -1,19 +1,49 @@
 #pragma once
 #ifndef HAPTIC_ENGINE_HPP
 #define HAPTIC_ENGINE_HPP
-#define PART_BOUNDARY "123456789000000000000987654321"
 #include <Arduino.h>
 #include <WiFi.h>
-#include "esp_http_server.h"
+#include <esp_timer.h>
+#include <lwip/sockets.h>
+#include "data/StateManager/StateManager.hpp"
+#include "data/config/project_config.hpp"
+#include "data/utilities/Observer.hpp"
+#include "network/HttpServer/HttpServer.hpp"
 #include "HapticInstance.hpp"
-#include <vector>
+#include "HapticPacket.hpp"
+#include "HapticSequencer.hpp"
+#include <algorithm>
 
-class HapticEngine
+//! the HTTP routes live under this prefix of the shared server on port 80
+#define HAPTIC_HTTP_PREFIX "/haptics"
+#define HAPTIC_UDP_PORT 82
+//! how often the sequencer advances the effects while something is playing
+#define HAPTIC_SEQUENCER_TICK_MS 5
+
+//! LEDC channel 0 is the camera XCLK and 2 the IR emitter, every two channels
+//! share a timer so the motors start on a fresh pair
+#define HAPTIC_LEDC_FIRST_CHANNEL 4
+#ifdef SOC_LEDC_SUPPORT_HS_MODE
+#define HAPTIC_LEDC_CHANNELS (SOC_LEDC_CHANNEL_NUM * 2)
+#else
+#define HAPTIC_LEDC_CHANNELS SOC_LEDC_CHANNEL_NUM
+#endif
+
+class HapticEngine : public HapticPwmSink, public IObserver<ConfigState_e>
 {
 private:
-    std::vector<HapticInstance> instances;
-    httpd_handle_t server;
-    httpd_config_t serverConf;
+    ProjectConfig& configManager;
+    //! fixed storage, channels are reconfigured in place and never move
+    HapticInstance instances[ProjectConfig::maxHapticChannels];
+    uint8_t channelCount = 0;
+    HapticPacket::SequenceFilter sequenceFilter;
+
+    HapticSequencer sequencer{*this};
+    esp_timer_handle_t sequencerTimer = nullptr;
+    //! guards the channels and the sequencer, they are touched from the UDP
+    //! task, the sequencer timer and config updates
+    SemaphoreHandle_t engineLock = nullptr;
+    bool sequencerRunning = false;
 
     static esp_err_t ping_handler(httpd_req_t *req)
     {
@@ -45,51 +75,56 @@ private:
         return ESP_OK;
     }
 
-    
-    // Static handler – will be shared by all endpoints
-    static esp_err_t handleHapticInstance(httpd_req_t *req) {
-        // Recover the instance pointer we stored in user_ctx
-        HapticInstance* inst = static_cast<HapticInstance*>(req->user_ctx);
+    static esp_err_t instances_handler(httpd_req_t *req)
+    {
+        auto *self = reinterpret_cast<HapticEngine*>(req->user_ctx);
+        return self->doInstances(req);
+    }
+
+    // Describes the motor layout, so that clients know which index in the
+    // UDP datagram drives which motor
+    esp_err_t doInstances(httpd_req_t *req)
+    {
         setCorsHeaders(req);
+        httpd_resp_set_type(req, "application/json");
 
-        // Only allow POST
-        if (req->method != HTTP_POST) {
-            httpd_resp_set_status(req, "405 Method Not Allowed");
-            return httpd_resp_send(req, nullptr, 0);
-        }
+        char buffer[128];
+        int len = snprintf(buffer, sizeof(buffer),
+                           "{\"udp_port\": %d, \"instances\": [",
+                           HAPTIC_UDP_PORT);
+        httpd_resp_send_chunk(req, buffer, len);
 
-        // Read the JSON body
-        int len = req->content_len;
-        if (len <= 0) {
-            httpd_resp_send_500(req);
-            return ESP_FAIL;
-        }
-        std::string body;
-        body.resize(len);
-        int ret = httpd_req_recv(req, &body[0], len);
-        if (ret <= 0) {
-            httpd_resp_send_500(req);
-            return ESP_FAIL;
+        for (size_t i = 0; i < channelCount; i++) {
+            len = snprintf(buffer, sizeof(buffer),
+                           "%s{\"index\": %u, \"name\": \"%s\", \"pin\": %d, "
+                           "\"frequency\": %u, \"resolution\": %u}",
+                           i ? ", " : "", (unsigned)i, instances[i].name,
+                           instances[i].gpioPin, instances[i].frequency,
+                           instances[i].resolution);
+            httpd_resp_send_chunk(req, buffer, len);
         }
 
-        // Parse it
-        DynamicJsonDocument doc(256);
-        auto err = deserializeJson(doc, body);
-        if (err) {
-            httpd_resp_set_status(req, "400 Bad Request");
-            return httpd_resp_send(req, "Invalid JSON", HTTPD_RESP_USE_STRLEN);
-        }
+        httpd_resp_send_chunk(req, "]}", 2);
+        return httpd_resp_send_chunk(req, nullptr, 0);
+    }
 
-        // Update strength if present
-        if (doc.containsKey("strength")) {
-            inst->strength = doc["strength"].as<int>();
-            Serial.printf("[%s] Got strength: %d\n", inst->name, inst->strength);
-            inst->updateInstance();
-            return httpd_resp_send(req, "OK", HTTPD_RESP_USE_STRLEN);
-        } else {
-            httpd_resp_set_status(req, "400 Bad Request");
-            return httpd_resp_send(req, "Missing 'strength'", HTTPD_RESP_USE_STRLEN);
+    static esp_err_t presets_handler(httpd_req_t *req)
+    {
+        setCorsHeaders(req);
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_send_chunk(req, "{\"presets\": [", HTTPD_RESP_USE_STRLEN);
+
+        char buffer[64];
+        for (size_t i = 0; i < HapticEffects::presetCount; i++) {
+            int len = snprintf(buffer, sizeof(buffer),
+                               "%s{\"id\": %u, \"name\": \"%s\"}",
+                               i ? ", " : "", (unsigned)i,
+                               HapticEffects::presets[i].name);
+            httpd_resp_send_chunk(req, buffer, len);
         }
+
+        httpd_resp_send_chunk(req, "]}", 2);
+        return httpd_resp_send_chunk(req, nullptr, 0);
     }
 
     // Inject the CORS headers needed by browsers
@@ -106,97 +141,210 @@ private:
         return httpd_resp_send(req, nullptr, 0);
     }
 
-    void setupHapticInstancesApi(std::vector<HapticInstance>& inst) {
-        for (auto& instance : inst) {
-            // build a path like "/motor1"
-            String path = "/" + instance.name;
+    /**
+     * @brief Bring the channels in line with the haptics config, motors that
+     * were dropped from it get released
+     */
+    void applyConfig()
+    {
+        auto& channels = configManager.getHapticsConfig();
+        uint8_t available = HAPTIC_LEDC_CHANNELS - HAPTIC_LEDC_FIRST_CHANNEL;
+        uint8_t count = std::min<size_t>(channels.size(), ProjectConfig::maxHapticChannels);
+        if (count > available) {
+            log_e("[Haptics]: Only %u LEDC channels are free, ignoring the remaining %u motors",
+                  available, count - available);
+            count = available;
+        }
 
-            httpd_uri_t instance_page = {
-                .uri      = path.c_str(),
-                .method   = HTTP_POST,                   // expect a JSON POST
-                .handler  = handleHapticInstance,        // our shared handler
-                .user_ctx = &instance                    // pointer to this instance
-            };
+        xSemaphoreTake(engineLock, portMAX_DELAY);
+        // the motors are switched off with their channels
+        sequencer.reset();
+        for (auto& instance : instances)
+            instance.release();
 
-            // register on your HTTP server
-            httpd_register_uri_handler(server, &instance_page);
+        for (uint8_t i = 0; i < count; i++) {
+            // odd channels share their timer with the one before them, the
+            // later setup wins for both
+            if (i % 2 == 1 && (channels[i].frequency != channels[i - 1].frequency ||
+                               channels[i].resolution != channels[i - 1].resolution))
+                log_w("[Haptics]: %s and %s share a PWM timer, both run at %uHz with %u bits",
+                      channels[i - 1].name.c_str(), channels[i].name.c_str(),
+                      channels[i].frequency, channels[i].resolution);
 
-            Serial.printf(
-                "Haptic instance \"%s\" listening on port %d at \"%s\"\n",
-                instance.name,
-                serverConf.server_port,
-                path.c_str()
-            );
+            instances[i].strength = 0;
+            instances[i].configure(channels[i], HAPTIC_LEDC_FIRST_CHANNEL + i);
         }
+        channelCount = count;
+        xSemaphoreGive(engineLock);
+
+        log_i("[Haptics]: %u motors configured", channelCount);
     }
 
-    void updateHaptics(std::vector<HapticInstance>& inst){
-        for (auto& instance : inst){
-            instance.updateInstance();
+    void setupSequencer()
+    {
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = &HapticEngine::onSequencerTick;
+        timerArgs.arg = this;
+        timerArgs.dispatch_method = ESP_TIMER_TASK;
+        timerArgs.name = "haptic_seq";
+        if (esp_timer_create(&timerArgs, &sequencerTimer) != ESP_OK) {
+            log_e("[Haptics]: Could not create the sequencer timer");
+            sequencerTimer = nullptr;
         }
     }
-    
-public:
 
-    void runTask(void* /*pvParameters*/)
+    static void onSequencerTick(void* arg)
     {
-        // Just gonna hard code this for now
-        instances.reserve(4);
+        auto *self = static_cast<HapticEngine*>(arg);
+        xSemaphoreTake(self->engineLock, portMAX_DELAY);
+        if (!self->sequencer.tick(HAPTIC_SEQUENCER_TICK_MS)) {
+            // nothing left to play, don't wake up until the next effect
+            esp_timer_stop(self->sequencerTimer);
+            self->sequencerRunning = false;
+        }
+        xSemaphoreGive(self->engineLock);
+    }
 
-        instances.emplace_back(2, "RightEar");
-        instances.emplace_back(3, "LeftEar");
-        instances.emplace_back(4, "None1");
-        instances.emplace_back(5, "None2");
+    void playEffect(uint8_t preset, uint8_t intensity, uint16_t motorMask)
+    {
+        if (!sequencerTimer)
+            return;
 
-        
-        updateHaptics(instances);
+        // motors we don't have can't play anything
+        xSemaphoreTake(engineLock, portMAX_DELAY);
+        motorMask &= (1 << channelCount) - 1;
+        if (sequencer.play(preset, intensity, motorMask) && !sequencerRunning) {
+            sequencer.tick(0);
+            esp_timer_start_periodic(sequencerTimer, HAPTIC_SEQUENCER_TICK_MS * 1000);
+            sequencerRunning = true;
+        }
+        xSemaphoreGive(engineLock);
+    }
 
-        serverConf = HTTPD_DEFAULT_CONFIG();
-        serverConf.server_port = 82;
-        serverConf.ctrl_port   = 82;
-        serverConf.core_id     = 0;
+    void stopEffect(uint16_t motorMask)
+    {
+        if (!sequencerTimer)
+            return;
 
-        httpd_uri_t ping_page = {
-            .uri      = "/ping",
-            .method   = HTTP_GET,
-            .handler  = ping_handler,
-            .user_ctx = this
-        };
+        xSemaphoreTake(engineLock, portMAX_DELAY);
+        sequencer.stop(motorMask);
+        xSemaphoreGive(engineLock);
+    }
 
-        httpd_uri_t status_page = {
-            .uri      = "/",
-            .method   = HTTP_GET,
-            .handler  = hapticEngineStatus_handler,
-            .user_ctx = this
-        };
+    /**
+     * @brief Apply a strengths datagram, stale and malformed ones are dropped
+     */
+    void handleDatagram(const uint8_t* data, size_t len)
+    {
+        HapticPacket_t packet;
+        if (HapticPacket::parse(data, len, packet) != HapticPacket_Ok)
+            return;
+
+        if (!sequenceFilter.accept(packet.sequence, millis()))
+            return;
+
+        switch (packet.type) {
+            case HapticPacket_Strengths: {
+                xSemaphoreTake(engineLock, portMAX_DELAY);
+                // a static strength overrides whatever effect was playing
+                sequencer.setStrengths(packet.strengths,
+                                       std::min<uint8_t>(packet.count, channelCount));
+                xSemaphoreGive(engineLock);
+                break;
+            }
+            case HapticPacket_Play:
+                playEffect(packet.preset, packet.intensity, packet.motorMask);
+                break;
+            case HapticPacket_Stop:
+                stopEffect(packet.motorMask);
+                break;
+        }
+    }
+
+    /**
+     * @brief Blocks on the haptics UDP socket and applies every datagram as
+     * soon as it arrives
+     */
+    void receiveDatagrams()
+    {
+        int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (sock < 0) {
+            log_e("[Haptics]: Could not create the UDP socket");
+            return;
+        }
 
-        httpd_uri_t cors_uri = {
-            .uri      = "/*",
-            .method   = HTTP_OPTIONS,
-            .handler  = cors_handler,
-            .user_ctx = this
-          };
-        httpd_register_uri_handler(server, &cors_uri);
-
-        // Haptics pages is generated dynamically
-        
-        server = nullptr;
-        if (httpd_start(&server, &serverConf) == ESP_OK) {
-            setupHapticInstancesApi(instances);
-            
-            httpd_register_uri_handler(server, &ping_page);
-            Serial.printf("Ping running on port %d at: \"/ping\"", serverConf.server_port);
-            httpd_register_uri_handler(server, &status_page);
-            Serial.printf("HapticEngine check status running on port %d at: \"/\"", serverConf.server_port);
-        } else {
-            Serial.println("Failed to start ping server");
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(HAPTIC_UDP_PORT);
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (bind(sock, (sockaddr*)&address, sizeof(address)) < 0) {
+            log_e("[Haptics]: Could not bind the UDP socket to port %d", HAPTIC_UDP_PORT);
+            close(sock);
+            return;
         }
-        
 
-        // while (true)
-        // {
-            
-        // }
+        Serial.printf("Haptic datagrams accepted on UDP port %d\n", HAPTIC_UDP_PORT);
+
+        uint8_t buffer[HAPTIC_PACKET_HEADER_SIZE + HAPTIC_PACKET_STRENGTHS_SIZE +
+                       HAPTIC_PACKET_MAX_MOTORS];
+        while (true) {
+            int len = recv(sock, buffer, sizeof(buffer), 0);
+            if (len < 0) {
+                log_e("[Haptics]: UDP receive failed: %d", errno);
+                vTaskDelay(pdMS_TO_TICKS(100));
+                continue;
+            }
+            handleDatagram(buffer, len);
+        }
+    }
+
+public:
+    explicit HapticEngine(ProjectConfig& configManager)
+        : configManager(configManager), engineLock(xSemaphoreCreateMutex()) {}
+
+    // only ever called with engineLock held
+    void setLevel(uint8_t motor, uint16_t level) override
+    {
+        if (motor < channelCount)
+            instances[motor].setLevel(level);
+    }
+
+    void update(ConfigState_e event) override
+    {
+        if (event == ConfigState_e::configLoaded ||
+            event == ConfigState_e::hapticsConfigUpdated)
+            applyConfig();
+    }
+
+    std::string getName() override
+    {
+        return "HapticEngine";
+    }
+
+    /**
+     * @brief HTTP is only used to describe and configure the engine, the
+     * strengths themselves come in over UDP
+     */
+    void attachRoutes(HttpServer& httpServer)
+    {
+        static const HttpServer::Route_t routes[] = {
+            {"",           HTTP_GET,     hapticEngineStatus_handler},
+            {"/ping",      HTTP_GET,     ping_handler},
+            {"/instances", HTTP_GET,     instances_handler},
+            {"/presets",   HTTP_GET,     presets_handler},
+            {"/*",         HTTP_OPTIONS, cors_handler},
+        };
+
+        if (httpServer.addGroup(HAPTIC_HTTP_PREFIX, routes, this))
+            Serial.printf("Haptic engine routes available on port %d under \"%s\"\n",
+                          HTTP_SERVER_PORT, HAPTIC_HTTP_PREFIX);
+    }
+
+    void runTask(void* /*pvParameters*/)
+    {
+        setupSequencer();
+        receiveDatagrams();
+
         vTaskDelete(nullptr);
     }
 };
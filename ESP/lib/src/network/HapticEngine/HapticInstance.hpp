@@ -2,33 +2,114 @@
 #ifndef HAPTIC_INSTANCE_HPP
 #define HAPTIC_INSTANCE_HPP
 #include <Arduino.h>
+#include <math.h>
+#include "data/config/project_config.hpp"
+#include "HapticSequencer.hpp"
 
+#define HAPTIC_NAME_LENGTH 16
+//! LEDC timers run off the 80MHz APB clock, frequency times the number of
+//! steps can't go above that
+#define HAPTIC_LEDC_CLOCK_HZ 80000000
+
+namespace HapticCurves {
+    /**
+     * @brief Shape a level from 0 to HAPTIC_LEVEL_MAX with one of the
+     * ProjectConfig::HapticCurve_e curves, the result has the same range
+     */
+    inline uint32_t apply(uint8_t curve, uint16_t level)
+    {
+        switch (curve) {
+            case ProjectConfig::HapticCurve_Quadratic:
+                return (uint32_t)level * level / HAPTIC_LEVEL_MAX;
+            case ProjectConfig::HapticCurve_SquareRoot:
+                return (uint32_t)sqrtf((float)level * HAPTIC_LEVEL_MAX);
+            default:
+                return level;
+        }
+    }
+}
+
+/**
+ * @brief A single motor, driven by its own LEDC channel
+ * @details Instances live in a fixed array owned by the engine and get
+ * reconfigured in place, so nothing that points at them is ever invalidated
+ */
 struct HapticInstance {
-  int gpioPin;
+  int8_t gpioPin = -1;
   int strength = 0; // Precentage
-  String name = "none";
-
-  HapticInstance()
-    : gpioPin(-1),
-      strength(0),
-      name("undefined")
-  {}
-  
-  HapticInstance(int pin, const String& nm)
-    : gpioPin(pin),
-      strength(0),
-      name(nm)
+  char name[HAPTIC_NAME_LENGTH] = "none";
+
+  uint8_t ledcChannel = 0;
+  uint8_t resolution = 0;
+  uint8_t curve = ProjectConfig::HapticCurve_Linear;
+  uint32_t frequency = 0;
+
+public:
+  /**
+   * @brief Move the motor to the pin and PWM settings of config, releasing
+   * whatever pin it was driving before
+   * @return false if LEDC could not be set up with these settings
+   */
+  bool configure(const ProjectConfig::HapticChannelConfig_t& config, uint8_t channel)
+  {
+    release();
+
+    strncpy(name, config.name.c_str(), sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    curve = config.curve;
+    ledcChannel = channel;
+    resolution = std::min<uint8_t>(std::max<uint8_t>(config.resolution, 1), SOC_LEDC_TIMER_BIT_WIDE_NUM);
+
+    if (config.pin < 0)
+      return false;
+
+    if ((uint64_t)config.frequency << resolution > HAPTIC_LEDC_CLOCK_HZ) {
+      log_e("[Haptics]: %s can't run at %uHz with %u bits", name, config.frequency, resolution);
+      return false;
+    }
+
+    frequency = ledcSetup(ledcChannel, config.frequency, resolution);
+    if (frequency == 0) {
+      log_e("[Haptics]: Could not set up LEDC channel %u for %s", ledcChannel, name);
+      return false;
+    }
+
+    gpioPin = config.pin;
+    ledcAttachPin(gpioPin, ledcChannel);
+    updateInstance();
+    return true;
+  }
+
+  /**
+   * @brief Stop driving the pin, the motor is left switched off
+   */
+  void release()
   {
-    pinMode(pin, OUTPUT);
-    analogWrite(pin, 0);
+    if (gpioPin < 0)
+      return;
+
+    ledcWrite(ledcChannel, 0);
+    ledcDetachPin(gpioPin);
+    pinMode(gpioPin, OUTPUT);
+    digitalWrite(gpioPin, LOW);
+    gpioPin = -1;
   }
 
-public: 
   void updateInstance(){
-    int mappedValue = map(strength, 0, 100, 0, 255);
-    Serial.printf("Haptic \"%s\" set to: %d\n", name);
-    analogWrite(gpioPin, mappedValue);
+    setLevel(strength * (HAPTIC_LEVEL_MAX / 100));
+  }
+
+  // Drive the motor directly, used by the sequencer - level goes from 0 to
+  // HAPTIC_LEVEL_MAX, anything above is full strength
+  void setLevel(uint16_t level){
+    if (gpioPin < 0)
+      return;
+
+    level = std::min<uint16_t>(level, HAPTIC_LEVEL_MAX);
+    uint32_t maxDuty = (1 << resolution) - 1;
+    uint32_t duty = HapticCurves::apply(curve, level) * maxDuty / HAPTIC_LEVEL_MAX;
+    ledcWrite(ledcChannel, duty);
   }
 };
 
-#endif // HAPTIC_INSTANCE_HPP
\ No newline at end of file
+#endif // HAPTIC_INSTANCE_HPP
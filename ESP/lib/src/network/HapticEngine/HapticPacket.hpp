@@ -0,0 +1,188 @@
+#pragma once
+#ifndef HAPTIC_PACKET_HPP
+#define HAPTIC_PACKET_HPP
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Binary datagram format for driving the haptic motors over UDP
+ * @details Every datagram carries the strength of all motors at once, so a
+ * single packet replaces one HTTP request per motor. All multi byte fields are
+ * little endian.
+ *
+ *   offset  size  field
+ *   0       2     magic, "OH"
+ *   2       1     version, HAPTIC_PACKET_VERSION
+ *   3       1     type, HapticPacketType_e
+ *   4       4     sequence number, incremented by the sender for every packet
+ *
+ * followed by, for HapticPacket_Strengths
+ *   8       1     motor count
+ *   9       n     strength per motor, 0 to 100 percent
+ *
+ * for HapticPacket_Play
+ *   8       1     preset id, see HapticEffects::presets
+ *   9       1     intensity, 0 to 100 percent, more reads as 100
+ *   10      2     motor mask, bit n selects motor n
+ *
+ * for HapticPacket_Stop
+ *   8       2     motor mask, bit n selects motor n
+ */
+#define HAPTIC_PACKET_VERSION 1
+#define HAPTIC_PACKET_HEADER_SIZE 8
+#define HAPTIC_PACKET_STRENGTHS_SIZE 1
+#define HAPTIC_PACKET_PLAY_SIZE 4
+#define HAPTIC_PACKET_STOP_SIZE 2
+#define HAPTIC_PACKET_MAX_MOTORS 16
+//! if the sender goes quiet for this long, we accept whatever sequence it
+//! comes back with, it most likely got restarted
+#define HAPTIC_SEQUENCE_RESET_MS 1000
+
+enum HapticPacketType_e : uint8_t {
+  HapticPacket_Strengths = 0,
+  HapticPacket_Play = 1,
+  HapticPacket_Stop = 2,
+};
+
+enum HapticPacketStatus_e {
+  HapticPacket_Ok,
+  HapticPacket_TooShort,
+  HapticPacket_BadMagic,
+  HapticPacket_BadVersion,
+  HapticPacket_UnknownType,
+  HapticPacket_Truncated,
+};
+
+struct HapticPacket_t {
+  HapticPacketType_e type;
+  uint32_t sequence;
+
+  // HapticPacket_Strengths
+  uint8_t count;
+  const uint8_t* strengths;
+
+  // HapticPacket_Play and HapticPacket_Stop
+  uint8_t preset;
+  uint8_t intensity;
+  uint16_t motorMask;
+};
+
+namespace HapticPacket {
+  inline uint32_t readU32(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+           ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+  }
+
+  inline uint16_t readU16(const uint8_t* data) {
+    return (uint16_t)data[0] | ((uint16_t)data[1] << 8);
+  }
+
+  inline void writeU32(uint8_t* data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+  }
+
+  /**
+   * @brief Parse a datagram without copying it, the resulting packet points
+   * into data
+   */
+  inline HapticPacketStatus_e parse(const uint8_t* data,
+                                    size_t len,
+                                    HapticPacket_t& packet) {
+    if (len < HAPTIC_PACKET_HEADER_SIZE)
+      return HapticPacket_TooShort;
+    if (data[0] != 'O' || data[1] != 'H')
+      return HapticPacket_BadMagic;
+    if (data[2] != HAPTIC_PACKET_VERSION)
+      return HapticPacket_BadVersion;
+
+    packet.type = static_cast<HapticPacketType_e>(data[3]);
+    packet.sequence = readU32(data + 4);
+    const uint8_t* payload = data + HAPTIC_PACKET_HEADER_SIZE;
+    size_t payloadLen = len - HAPTIC_PACKET_HEADER_SIZE;
+
+    switch (packet.type) {
+      case HapticPacket_Strengths: {
+        if (payloadLen < HAPTIC_PACKET_STRENGTHS_SIZE)
+          return HapticPacket_Truncated;
+        packet.count = payload[0];
+        if (payloadLen < HAPTIC_PACKET_STRENGTHS_SIZE + (size_t)packet.count)
+          return HapticPacket_Truncated;
+        packet.strengths = payload + HAPTIC_PACKET_STRENGTHS_SIZE;
+        return HapticPacket_Ok;
+      }
+      case HapticPacket_Play: {
+        if (payloadLen < HAPTIC_PACKET_PLAY_SIZE)
+          return HapticPacket_Truncated;
+        packet.preset = payload[0];
+        // percent, anything above plays at full intensity
+        packet.intensity = payload[1] > 100 ? 100 : payload[1];
+        packet.motorMask = readU16(payload + 2);
+        return HapticPacket_Ok;
+      }
+      case HapticPacket_Stop: {
+        if (payloadLen < HAPTIC_PACKET_STOP_SIZE)
+          return HapticPacket_Truncated;
+        packet.motorMask = readU16(payload);
+        return HapticPacket_Ok;
+      }
+      default:
+        return HapticPacket_UnknownType;
+    }
+  }
+
+  /**
+   * @brief Build a strengths datagram, returns the number of bytes written or
+   * 0 if out is too small
+   */
+  inline size_t build(uint8_t* out,
+                      size_t outLen,
+                      uint32_t sequence,
+                      const uint8_t* strengths,
+                      uint8_t count) {
+    size_t size =
+        HAPTIC_PACKET_HEADER_SIZE + HAPTIC_PACKET_STRENGTHS_SIZE + count;
+    if (outLen < size)
+      return 0;
+    out[0] = 'O';
+    out[1] = 'H';
+    out[2] = HAPTIC_PACKET_VERSION;
+    out[3] = HapticPacket_Strengths;
+    writeU32(out + 4, sequence);
+    out[8] = count;
+    memcpy(out + HAPTIC_PACKET_HEADER_SIZE + HAPTIC_PACKET_STRENGTHS_SIZE,
+           strengths, count);
+    return size;
+  }
+
+  /**
+   * @brief Drops datagrams that arrive after a newer one was already applied
+   * @details Sequence numbers are compared with serial number arithmetic, so
+   * wrapping around 2^32 is fine
+   */
+  class SequenceFilter {
+   public:
+    bool accept(uint32_t sequence, uint32_t nowMs) {
+      bool stale = this->initialized &&
+                   (nowMs - this->lastAcceptedMs) < HAPTIC_SEQUENCE_RESET_MS &&
+                   (int32_t)(sequence - this->lastSequence) <= 0;
+      if (stale)
+        return false;
+
+      this->initialized = true;
+      this->lastSequence = sequence;
+      this->lastAcceptedMs = nowMs;
+      return true;
+    }
+
+   private:
+    bool initialized = false;
+    uint32_t lastSequence = 0;
+    uint32_t lastAcceptedMs = 0;
+  };
+}  // namespace HapticPacket
+
+#endif  // HAPTIC_PACKET_HPP
@@ -0,0 +1,239 @@
+#pragma once
+#ifndef HAPTIC_SEQUENCER_HPP
+#define HAPTIC_SEQUENCER_HPP
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define HAPTIC_SEQUENCER_MAX_MOTORS 16
+//! full scale of the levels handed to the sink
+#define HAPTIC_LEVEL_MAX 1000
+
+/**
+ * @brief Where the sequencer writes its levels to, 0 to HAPTIC_LEVEL_MAX
+ * @details On the device this is the motor PWM, on the host it can be any
+ * recorder
+ */
+class HapticPwmSink {
+ public:
+  virtual ~HapticPwmSink() {}
+  virtual void setLevel(uint8_t motor, uint16_t level) = 0;
+};
+
+/**
+ * @brief Vibration effects compiled into linear ramps, so that the sequencer
+ * only ever has to interpolate between two levels
+ * @details Envelopes are an attack ramp, a hold and a decay ramp, pulse
+ * trains are repeated holds at full and zero level
+ */
+namespace HapticEffects {
+  struct Segment_t {
+    uint16_t from;
+    uint16_t to;
+    uint16_t durationMs;
+  };
+
+  constexpr Segment_t ramp(uint16_t from, uint16_t to, uint16_t ms) {
+    return {from, to, ms};
+  }
+  constexpr Segment_t hold(uint16_t level, uint16_t ms) {
+    return {level, level, ms};
+  }
+
+  constexpr uint16_t FULL = HAPTIC_LEVEL_MAX;
+
+  constexpr Segment_t tap[] = {ramp(0, FULL, 10), hold(FULL, 30),
+                               ramp(FULL, 0, 40)};
+  constexpr Segment_t doubleTap[] = {ramp(0, FULL, 10), hold(FULL, 30),
+                                     ramp(FULL, 0, 20), hold(0, 80),
+                                     ramp(0, FULL, 10), hold(FULL, 30),
+                                     ramp(FULL, 0, 20)};
+  constexpr Segment_t buzz[] = {hold(FULL, 40), hold(0, 40),  hold(FULL, 40),
+                                hold(0, 40),    hold(FULL, 40), hold(0, 40),
+                                hold(FULL, 40), hold(0, 40)};
+  constexpr Segment_t heartbeat[] = {
+      ramp(0, FULL, 30),     ramp(FULL, 0, 90),      hold(0, 80),
+      ramp(0, FULL / 2, 30), ramp(FULL / 2, 0, 120), hold(0, 400)};
+  constexpr Segment_t rampUp[] = {ramp(0, FULL, 800), ramp(FULL, 0, 50)};
+  constexpr Segment_t swell[] = {ramp(0, FULL, 300), hold(FULL, 200),
+                                 ramp(FULL, 0, 500)};
+
+  struct Preset_t {
+    const char* name;
+    const Segment_t* segments;
+    uint8_t length;
+  };
+
+  template <size_t N>
+  constexpr Preset_t preset(const char* name, const Segment_t (&segments)[N]) {
+    return {name, segments, static_cast<uint8_t>(N)};
+  }
+
+  //! the index in this table is the preset id used on the wire, only ever
+  //! append to it
+  constexpr Preset_t presets[] = {
+      preset("tap", tap),
+      preset("double_tap", doubleTap),
+      preset("buzz", buzz),
+      preset("heartbeat", heartbeat),
+      preset("ramp_up", rampUp),
+      preset("swell", swell),
+  };
+
+  constexpr size_t presetCount = sizeof(presets) / sizeof(presets[0]);
+
+  inline int findPreset(const char* name) {
+    for (size_t i = 0; i < presetCount; i++) {
+      if (strcmp(presets[i].name, name) == 0)
+        return i;
+    }
+    return -1;
+  }
+}  // namespace HapticEffects
+
+/**
+ * @brief Plays effect presets on any set of motors, one voice per motor
+ * @details tick() has to be called periodically with the time elapsed since
+ * the previous call, the owner decides where that time comes from
+ */
+class HapticSequencer {
+ public:
+  explicit HapticSequencer(HapticPwmSink& sink) : sink(sink) {}
+
+  /**
+   * @brief Start a preset on every motor in the mask, restarting it on
+   * motors that were already playing something
+   * @param intensity 0 to 100 percent, scales the whole effect
+   * @return false if the preset does not exist
+   */
+  bool play(uint8_t presetId, uint8_t intensity, uint16_t motorMask) {
+    if (presetId >= HapticEffects::presetCount)
+      return false;
+
+    if (intensity > 100)
+      intensity = 100;
+
+    for (uint8_t motor = 0; motor < HAPTIC_SEQUENCER_MAX_MOTORS; motor++) {
+      if (!(motorMask & (1 << motor)))
+        continue;
+      Voice_t& voice = this->voices[motor];
+      voice.preset = &HapticEffects::presets[presetId];
+      voice.segment = 0;
+      voice.elapsedMs = 0;
+      voice.intensity = intensity;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Silence the motors in the mask
+   */
+  void stop(uint16_t motorMask) {
+    for (uint8_t motor = 0; motor < HAPTIC_SEQUENCER_MAX_MOTORS; motor++) {
+      if (!(motorMask & (1 << motor)) || !this->voices[motor].preset)
+        continue;
+      this->voices[motor].preset = nullptr;
+      this->write(motor, 0);
+    }
+  }
+
+  /**
+   * @brief Hold motors 0 to count - 1 at fixed strengths, what a strengths
+   * datagram asks for, cancelling whatever effect they were playing
+   * @param strengths 0 to 100 percent per motor, more reads as 100
+   */
+  void setStrengths(const uint8_t* strengths, uint8_t count) {
+    if (count > HAPTIC_SEQUENCER_MAX_MOTORS)
+      count = HAPTIC_SEQUENCER_MAX_MOTORS;
+
+    for (uint8_t motor = 0; motor < count; motor++) {
+      Voice_t& voice = this->voices[motor];
+      uint16_t level =
+          (strengths[motor] > 100 ? 100 : strengths[motor]) *
+          (HAPTIC_LEVEL_MAX / 100);
+      // the same strength again is the common case, the PWM already has it
+      if (!voice.preset && voice.level == level)
+        continue;
+      voice.preset = nullptr;
+      this->write(motor, level);
+    }
+  }
+
+  /**
+   * @brief Forget every voice without writing anything, for when the owner
+   * has switched the motors off itself
+   */
+  void reset() {
+    for (Voice_t& voice : this->voices)
+      voice = Voice_t();
+  }
+
+  bool isPlaying(uint8_t motor) const {
+    return motor < HAPTIC_SEQUENCER_MAX_MOTORS && this->voices[motor].preset;
+  }
+
+  bool isActive() const {
+    for (const Voice_t& voice : this->voices) {
+      if (voice.preset)
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Advance every active voice and write the resulting levels
+   * @return true while at least one voice is still playing
+   */
+  bool tick(uint32_t elapsedMs) {
+    bool active = false;
+    for (uint8_t motor = 0; motor < HAPTIC_SEQUENCER_MAX_MOTORS; motor++) {
+      Voice_t& voice = this->voices[motor];
+      if (!voice.preset)
+        continue;
+
+      voice.elapsedMs += elapsedMs;
+      // skip over every segment that has fully elapsed since the last tick
+      while (voice.segment < voice.preset->length &&
+             voice.elapsedMs >=
+                 voice.preset->segments[voice.segment].durationMs) {
+        voice.elapsedMs -= voice.preset->segments[voice.segment].durationMs;
+        voice.segment++;
+      }
+
+      if (voice.segment >= voice.preset->length) {
+        voice.preset = nullptr;
+        this->write(motor, 0);
+        continue;
+      }
+
+      const HapticEffects::Segment_t& segment =
+          voice.preset->segments[voice.segment];
+      int32_t level = segment.from + ((int32_t)segment.to - segment.from) *
+                                         (int32_t)voice.elapsedMs /
+                                         segment.durationMs;
+      this->write(motor, (uint16_t)(level * voice.intensity / 100));
+      active = true;
+    }
+    return active;
+  }
+
+ private:
+  struct Voice_t {
+    const HapticEffects::Preset_t* preset = nullptr;
+    uint8_t segment = 0;
+    uint8_t intensity = 0;
+    uint32_t elapsedMs = 0;
+    //! what the sink was last told
+    uint16_t level = 0;
+  };
+
+  void write(uint8_t motor, uint16_t level) {
+    this->voices[motor].level = level;
+    this->sink.setLevel(motor, level);
+  }
+
+  HapticPwmSink& sink;
+  Voice_t voices[HAPTIC_SEQUENCER_MAX_MOTORS];
+};
+
+#endif  // HAPTIC_SEQUENCER_HPP
@@ -0,0 +1,178 @@
+#include "HttpRequest.hpp"
+
+namespace {
+  const char* statusLine(int code) {
+    switch (code) {
+      case 200:
+        return "200 OK";
+      case 204:
+        return "204 No Content";
+      case 304:
+        return "304 Not Modified";
+      case 400:
+        return "400 Bad Request";
+      case 401:
+        return "401 Unauthorized";
+      case 404:
+        return "404 Not Found";
+      case 412:
+        return "412 Precondition Failed";
+      case 413:
+        return "413 Payload Too Large";
+      default:
+        return "500 Internal Server Error";
+    }
+  }
+
+  //! a stalled client gets this many receive timeouts before we give up
+  constexpr int MAX_RECEIVE_TIMEOUTS = 3;
+}  // namespace
+
+HttpRequest::HttpRequest(httpd_req_t* req) : req(req) {}
+
+HttpRequest::~HttpRequest() {
+  free(this->paramBuffer);
+}
+
+bool HttpRequest::readParams() {
+  size_t queryLength = httpd_req_get_url_query_len(this->req);
+  size_t bodyLength = 0;
+  char type[64];
+  if (this->req->content_len && this->header("Content-Type", type, sizeof(type)) &&
+      !strncasecmp(type, "application/x-www-form-urlencoded", 33))
+    bodyLength = this->req->content_len;
+  if (!queryLength && !bodyLength)
+    return true;
+
+  // room for both and their terminating zeros
+  if (queryLength + bodyLength + 2 > MAX_PARAMS_SIZE) {
+    this->send(413, "application/json", "{\"msg\":\"Parameters too large\"}");
+    return false;
+  }
+  this->paramBuffer = (char*)malloc(queryLength + bodyLength + 2);
+  if (!this->paramBuffer) {
+    this->send(500, "application/json", "{\"msg\":\"Out of memory\"}");
+    return false;
+  }
+
+  if (queryLength &&
+      httpd_req_get_url_query_str(this->req, this->paramBuffer,
+                                  queryLength + 1) == ESP_OK) {
+    this->paramCount = HttpForm::parse(this->paramBuffer, queryLength,
+                                       this->paramList, MAX_PARAMS);
+  }
+  if (bodyLength) {
+    char* body = this->paramBuffer + queryLength + 1;
+    if (!this->readBody(body, bodyLength)) {
+      this->send(400, "application/json", "{\"msg\":\"Incomplete body\"}");
+      return false;
+    }
+    this->paramCount +=
+        HttpForm::parse(body, bodyLength, this->paramList + this->paramCount,
+                        MAX_PARAMS - this->paramCount);
+  }
+  return true;
+}
+
+Helpers::string_view HttpRequest::url() const {
+  const char* query = strchr(this->req->uri, '?');
+  return Helpers::string_view(this->req->uri, query ? query - this->req->uri
+                                                     : strlen(this->req->uri));
+}
+
+Helpers::string_view HttpRequest::arg(const char* name) const {
+  for (size_t i = 0; i < this->paramCount; i++) {
+    if (this->paramList[i].name == Helpers::string_view(name))
+      return this->paramList[i].value;
+  }
+  return Helpers::string_view();
+}
+
+bool HttpRequest::header(const char* name, char* value, size_t size) const {
+  size_t len = httpd_req_get_hdr_value_len(this->req, name);
+  if (!len || len >= size)
+    return false;
+  return httpd_req_get_hdr_value_str(this->req, name, value, size) == ESP_OK;
+}
+
+bool HttpRequest::readBody(char* buffer, size_t len) {
+  size_t received = 0;
+  int timeouts = 0;
+  while (received < len) {
+    int result = httpd_req_recv(this->req, buffer + received, len - received);
+    if (result == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts < MAX_RECEIVE_TIMEOUTS)
+      continue;
+    if (result <= 0)
+      return false;
+    received += result;
+  }
+  return true;
+}
+
+void HttpRequest::addHeader(const char* name, const char* value) {
+  httpd_resp_set_hdr(this->req, name, value);
+}
+
+esp_err_t HttpRequest::send(int code,
+                            const char* type,
+                            const char* body,
+                            ssize_t len) {
+  this->beginResponse(code, type);
+  return httpd_resp_send(this->req, body, body ? len : 0);
+}
+
+void HttpRequest::beginResponse(int code, const char* type) {
+  httpd_resp_set_status(this->req, statusLine(code));
+  if (type)
+    httpd_resp_set_type(this->req, type);
+  httpd_resp_set_hdr(this->req, "Access-Control-Allow-Origin", "*");
+}
+
+//*********************************************************************************************
+//!                                     Response Stream
+//*********************************************************************************************
+
+HttpResponseStream::HttpResponseStream(HttpRequest& request, const char* type)
+    : request(request) {
+  request.beginResponse(200, type);
+}
+
+HttpResponseStream::~HttpResponseStream() {
+  if (this->flush())
+    httpd_resp_send_chunk(this->request.handle(), nullptr, 0);
+}
+
+size_t HttpResponseStream::write(uint8_t c) {
+  if (this->used == sizeof(this->buffer) && !this->flush())
+    return 0;
+  this->buffer[this->used++] = (char)c;
+  return 1;
+}
+
+size_t HttpResponseStream::write(const uint8_t* data, size_t len) {
+  // large writes go out as they are, the rest is gathered into chunks
+  if (len >= sizeof(this->buffer)) {
+    if (!this->flush() ||
+        httpd_resp_send_chunk(this->request.handle(), (const char*)data, len) !=
+            ESP_OK) {
+      this->failed = true;
+      return 0;
+    }
+    return len;
+  }
+  if (this->used + len > sizeof(this->buffer) && !this->flush())
+    return 0;
+  memcpy(this->buffer + this->used, data, len);
+  this->used += len;
+  return len;
+}
+
+bool HttpResponseStream::flush() {
+  if (this->failed)
+    return false;
+  if (this->used && httpd_resp_send_chunk(this->request.handle(), this->buffer,
+                                          this->used) != ESP_OK)
+    this->failed = true;
+  this->used = 0;
+  return !this->failed;
+}
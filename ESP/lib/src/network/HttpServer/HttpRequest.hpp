@@ -0,0 +1,100 @@
+#pragma once
+#ifndef HTTP_REQUEST_HPP
+#define HTTP_REQUEST_HPP
+#include <Arduino.h>
+#include <esp_http_server.h>
+#include "data/utilities/string_view.hpp"
+#include "network/HttpServer/httpForm.hpp"
+
+/**
+ * @brief A request to the HttpServer with its parameters taken apart
+ * @details Parameters come from the query and, for a form post, from the
+ * body, the two ways the web UI and the tools send them. Every response
+ * carries Access-Control-Allow-Origin, the API has always been open to any
+ * page.
+ */
+class HttpRequest {
+ public:
+  static constexpr size_t MAX_PARAMS = 16;
+  //! the query and a form body together, more is refused
+  static constexpr size_t MAX_PARAMS_SIZE = 1024;
+
+  explicit HttpRequest(httpd_req_t* req);
+  ~HttpRequest();
+  HttpRequest(const HttpRequest&) = delete;
+  HttpRequest& operator=(const HttpRequest&) = delete;
+
+  //! false if they couldn't be read, the request has been answered then
+  bool readParams();
+
+  int method() const { return this->req->method; }
+  //! the path, without the query
+  Helpers::string_view url() const;
+  size_t params() const { return this->paramCount; }
+  const HttpForm::Param_t& getParam(size_t i) const {
+    return this->paramList[i];
+  }
+  //! empty if it wasn't sent
+  Helpers::string_view arg(const char* name) const;
+  //! false if it wasn't sent or doesn't fit
+  bool header(const char* name, char* value, size_t size) const;
+  size_t contentLength() const { return this->req->content_len; }
+  //! read the next len bytes of the body, false if the client stopped
+  //! sending
+  bool readBody(char* buffer, size_t len);
+
+  //! the value is sent as it is when the response goes out, it has to stay
+  //! around until then
+  void addHeader(const char* name, const char* value);
+  esp_err_t send(int code,
+                 const char* type = nullptr,
+                 const char* body = nullptr,
+                 ssize_t len = HTTPD_RESP_USE_STRLEN);
+  //! sets the status and type of a response whose body follows in chunks
+  void beginResponse(int code, const char* type);
+
+  httpd_req_t* handle() const { return this->req; }
+
+  /**
+   * @brief A route handler that calls a member of the group's context with
+   * the request
+   */
+  template <typename T, void (T::*handler)(HttpRequest*)>
+  static esp_err_t bind(httpd_req_t* req) {
+    HttpRequest request(req);
+    if (request.readParams())
+      (static_cast<T*>(req->user_ctx)->*handler)(&request);
+    return ESP_OK;
+  }
+
+ private:
+  httpd_req_t* req;
+  //! the decoded parameters point into it
+  char* paramBuffer = nullptr;
+  HttpForm::Param_t paramList[MAX_PARAMS];
+  size_t paramCount = 0;
+};
+
+/**
+ * @brief Writes a response body in chunks as it's printed
+ * @details The response ends when the stream goes out of scope
+ */
+class HttpResponseStream : public Print {
+ public:
+  HttpResponseStream(HttpRequest& request, const char* type);
+  ~HttpResponseStream();
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* data, size_t len) override;
+
+ private:
+  bool flush();
+
+  HttpRequest& request;
+  char buffer[256];
+  size_t used = 0;
+  //! the client went away, the rest is dropped
+  bool failed = false;
+};
+
+#endif  // HTTP_REQUEST_HPP
@@ -0,0 +1,84 @@
+#include "HttpServer.hpp"
+#include <esp_heap_caps.h>
+
+HttpServer httpServer;
+
+bool HttpServer::addGroup(const char* prefix,
+                          const Route_t* routes,
+                          size_t count,
+                          void* ctx) {
+  if (this->groupCount == HTTP_SERVER_MAX_GROUPS ||
+      this->routeCount + count > HTTP_SERVER_MAX_ROUTES) {
+    log_e("[HttpServer]: No room left for the routes under %s", prefix);
+    return false;
+  }
+
+  Group_t& group = this->groups[this->groupCount++];
+  group = {prefix, routes, count, ctx};
+  this->routeCount += count;
+
+  if (this->server)
+    return this->registerGroup(group);
+  return true;
+}
+
+void HttpServer::setNotFound(httpd_err_handler_func_t handler) {
+  this->notFound = handler;
+  if (this->server)
+    httpd_register_err_handler(this->server, HTTPD_404_NOT_FOUND, handler);
+}
+
+bool HttpServer::begin() {
+  if (this->server)
+    return true;
+
+  httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+  config.server_port = HTTP_SERVER_PORT;
+  config.ctrl_port = HTTP_SERVER_PORT;
+  config.core_id = 1;
+  config.stack_size = HTTP_SERVER_STACK_SIZE;
+  config.max_open_sockets = HTTP_SERVER_MAX_SOCKETS;
+  config.max_uri_handlers = HTTP_SERVER_MAX_ROUTES;
+  config.uri_match_fn = httpd_uri_match_wildcard;
+
+  size_t freeBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  if (httpd_start(&this->server, &config) != ESP_OK) {
+    log_e("[HttpServer]: Failed to start the server on port %d",
+          HTTP_SERVER_PORT);
+    this->server = nullptr;
+    return false;
+  }
+  log_i("[HttpServer]: Started on port %d, using %u bytes of internal RAM",
+        HTTP_SERVER_PORT,
+        (unsigned)(freeBefore - heap_caps_get_free_size(MALLOC_CAP_INTERNAL)));
+
+  if (this->notFound)
+    httpd_register_err_handler(this->server, HTTPD_404_NOT_FOUND,
+                               this->notFound);
+  bool registered = true;
+  for (uint8_t i = 0; i < this->groupCount; i++)
+    registered &= this->registerGroup(this->groups[i]);
+  return registered;
+}
+
+bool HttpServer::registerGroup(const Group_t& group) {
+  bool registered = true;
+  for (size_t i = 0; i < group.count; i++) {
+    // the server keeps its own copy of the uri
+    char uri[64];
+    snprintf(uri, sizeof(uri), "%s%s", group.prefix, group.routes[i].uri);
+
+    httpd_uri_t handler = {};
+    handler.uri = uri;
+    handler.method = group.routes[i].method;
+    handler.handler = group.routes[i].handler;
+    handler.user_ctx = group.ctx;
+    if (httpd_register_uri_handler(this->server, &handler) != ESP_OK) {
+      log_e("[HttpServer]: Could not register %s", uri);
+      registered = false;
+      continue;
+    }
+    log_d("[HttpServer]: Serving %s", uri);
+  }
+  return registered;
+}
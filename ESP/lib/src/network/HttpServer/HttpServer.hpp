@@ -0,0 +1,76 @@
+#pragma once
+#ifndef HTTP_SERVER_HPP
+#define HTTP_SERVER_HPP
+#include <Arduino.h>
+#include <esp_http_server.h>
+
+#define HTTP_SERVER_PORT 80
+//! shared by every group, each stream client holds one for as long as it
+//! watches
+#define HTTP_SERVER_MAX_SOCKETS 6
+//! handlers only ever answer short requests, long running work like the
+//! stream lives on its own task. Parsing a config PUT or a firmware upload
+//! are the deepest of them.
+#define HTTP_SERVER_STACK_SIZE 8192
+#define HTTP_SERVER_MAX_ROUTES 24
+#define HTTP_SERVER_MAX_GROUPS 6
+
+/**
+ * @brief The one esp_http_server instance, shared by everything that speaks
+ * HTTP, the stream, the haptics routes, the REST API and OTA
+ * @details Modules hand in a group of routes under a common prefix, the
+ * server registers them once it runs. All groups share a single task, socket
+ * pool and control port, so a handler must never block, anything long
+ * running has to take its socket over to a task of its own. The firmware
+ * upload is the one exception, nothing else is served while it's written.
+ */
+class HttpServer {
+ public:
+  struct Route_t {
+    //! appended to the prefix of the group
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* req);
+  };
+
+  /**
+   * @brief Add a group of routes, registered right away if the server is
+   * already running
+   * @param ctx handed to every handler of the group as req->user_ctx
+   */
+  bool addGroup(const char* prefix,
+                const Route_t* routes,
+                size_t count,
+                void* ctx);
+
+  template <size_t N>
+  bool addGroup(const char* prefix, const Route_t (&routes)[N], void* ctx) {
+    return this->addGroup(prefix, routes, N, ctx);
+  }
+
+  //! answers every request no route took, registered once the server runs
+  void setNotFound(httpd_err_handler_func_t handler);
+
+  bool begin();
+  httpd_handle_t getHandle() const { return this->server; }
+
+ private:
+  struct Group_t {
+    const char* prefix;
+    const Route_t* routes;
+    size_t count;
+    void* ctx;
+  };
+
+  bool registerGroup(const Group_t& group);
+
+  httpd_handle_t server = nullptr;
+  httpd_err_handler_func_t notFound = nullptr;
+  Group_t groups[HTTP_SERVER_MAX_GROUPS] = {};
+  uint8_t groupCount = 0;
+  size_t routeCount = 0;
+};
+
+extern HttpServer httpServer;
+
+#endif  // HTTP_SERVER_HPP
@@ -0,0 +1,240 @@
+#include "httpForm.hpp"
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+  int hexValue(char c) {
+    if (c >= '0' && c <= '9')
+      return c - '0';
+    if (c >= 'a' && c <= 'f')
+      return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+      return c - 'A' + 10;
+    return -1;
+  }
+
+  //! decodes text in place, returns the decoded length
+  size_t decode(char* text, size_t len) {
+    size_t out = 0;
+    for (size_t i = 0; i < len; i++) {
+      char c = text[i];
+      if (c == '+') {
+        c = ' ';
+      } else if (c == '%' && i + 2 < len) {
+        int high = hexValue(text[i + 1]);
+        int low = hexValue(text[i + 2]);
+        if (high >= 0 && low >= 0) {
+          c = (char)(high << 4 | low);
+          i += 2;
+        }
+      }
+      text[out++] = c;
+    }
+    return out;
+  }
+
+  Helpers::string_view trim(Helpers::string_view text) {
+    while (!text.empty() && isspace((unsigned char)text.front()))
+      text.remove_prefix(1);
+    while (!text.empty() && isspace((unsigned char)text.back()))
+      text.remove_suffix(1);
+    if (text.size() >= 2 && text.front() == '"' && text.back() == '"')
+      text = text.substr(1, text.size() - 2);
+    return text;
+  }
+
+  bool equalsIgnoreCase(Helpers::string_view text, const char* other) {
+    size_t len = strlen(other);
+    if (text.size() != len)
+      return false;
+    for (size_t i = 0; i < len; i++) {
+      if (tolower((unsigned char)text[i]) != tolower((unsigned char)other[i]))
+        return false;
+    }
+    return true;
+  }
+
+  //! the value of "key=value" in a header split by ';', empty if it's not
+  //! there
+  Helpers::string_view attribute(Helpers::string_view header, const char* key) {
+    size_t start = 0;
+    while (start <= header.size()) {
+      size_t end = header.find(';', start);
+      if (end == Helpers::string_view::npos)
+        end = header.size();
+      Helpers::string_view token = header.substr(start, end - start);
+      size_t equals = token.find('=');
+      if (equals != Helpers::string_view::npos &&
+          equalsIgnoreCase(trim(token.substr(0, equals)), key))
+        return trim(token.substr(equals + 1));
+      start = end + 1;
+    }
+    return Helpers::string_view();
+  }
+
+  void copy(Helpers::string_view text, char* out, size_t size) {
+    snprintf(out, size, "%.*s", (int)text.size(), text.data());
+  }
+}  // namespace
+
+namespace HttpForm {
+  size_t parse(char* text, size_t len, Param_t* params, size_t maxParams) {
+    size_t count = 0;
+    size_t start = 0;
+    while (start < len && count < maxParams) {
+      char* pair = text + start;
+      char* end = static_cast<char*>(memchr(pair, '&', len - start));
+      size_t pairLength = end ? (size_t)(end - pair) : len - start;
+      start += pairLength + 1;
+      if (!pairLength)
+        continue;
+
+      char* equals = static_cast<char*>(memchr(pair, '=', pairLength));
+      size_t nameLength = equals ? (size_t)(equals - pair) : pairLength;
+      char* value = equals ? equals + 1 : pair + pairLength;
+      size_t valueLength = equals ? pairLength - nameLength - 1 : 0;
+
+      params[count].name = Helpers::string_view(pair, decode(pair, nameLength));
+      params[count].value =
+          Helpers::string_view(value, decode(value, valueLength));
+      count++;
+    }
+    return count;
+  }
+
+  Helpers::string_view boundary(Helpers::string_view contentType) {
+    return attribute(contentType, "boundary");
+  }
+
+  MultipartReader::MultipartReader(Helpers::string_view boundary,
+                                   Handler& handler)
+      : handler(handler) {
+    if (boundary.empty() || boundary.size() > MAX_BOUNDARY) {
+      this->state = State_Failed;
+      return;
+    }
+    memcpy(this->delimiter, "\r\n--", 4);
+    memcpy(this->delimiter + 4, boundary.data(), boundary.size());
+    this->delimiterLength = 4 + boundary.size();
+  }
+
+  bool MultipartReader::flush(const uint8_t* data, size_t len) {
+    if (!len || this->handler.onData(data, len))
+      return true;
+    this->state = State_Failed;
+    return false;
+  }
+
+  /**
+   * @details Part data runs up to the next delimiter. The boundary can't hold
+   * a line break, so a mismatch can only start a new match on a '\r', and the
+   * bytes held back until then were the start of the delimiter itself.
+   */
+  bool MultipartReader::feed(const uint8_t* data, size_t len) {
+    // the first byte of part data that hasn't been handed on yet
+    size_t pending = 0;
+    for (size_t i = 0; i < len; i++) {
+      char c = (char)data[i];
+      switch (this->state) {
+        case State_Preamble:
+        case State_Data: {
+          bool inPart = this->state == State_Data;
+          if (c == this->delimiter[this->matched]) {
+            if (inPart && !this->matched &&
+                !this->flush(data + pending, i - pending))
+              return false;
+            pending = i + 1;
+            if (++this->matched < this->delimiterLength)
+              break;
+            this->matched = 0;
+            this->lineLength = 0;
+            this->state = State_AfterDelimiter;
+            if (inPart && !this->handler.onPartEnd()) {
+              this->state = State_Failed;
+              return false;
+            }
+            break;
+          }
+
+          // anything else is part data and simply extends the run
+          if (!this->matched)
+            break;
+          if (inPart &&
+              !this->flush((const uint8_t*)this->delimiter, this->matched))
+            return false;
+          this->matched = c == '\r' ? 1 : 0;
+          pending = this->matched ? i + 1 : i;
+          break;
+        }
+        case State_AfterDelimiter: {
+          // transport padding
+          if (!this->lineLength && (c == ' ' || c == '\t'))
+            break;
+          this->line[this->lineLength++] = c;
+          if (this->lineLength < 2)
+            break;
+          if (!memcmp(this->line, "--", 2)) {
+            this->state = State_Done;
+            return true;
+          }
+          if (memcmp(this->line, "\r\n", 2)) {
+            this->state = State_Failed;
+            return false;
+          }
+          this->lineLength = 0;
+          this->part = {};
+          this->state = State_Headers;
+          break;
+        }
+        case State_Headers: {
+          if (c == '\n' && this->lineLength &&
+              this->line[this->lineLength - 1] == '\r') {
+            this->lineLength--;
+            if (this->lineLength) {
+              this->readHeader();
+              this->lineLength = 0;
+              break;
+            }
+            if (!this->handler.onPart(this->part)) {
+              this->state = State_Failed;
+              return false;
+            }
+            this->matched = 0;
+            pending = i + 1;
+            this->state = State_Data;
+            break;
+          }
+          if (this->lineLength == MAX_HEADER_LINE) {
+            this->state = State_Failed;
+            return false;
+          }
+          this->line[this->lineLength++] = c;
+          break;
+        }
+        case State_Done:
+          return true;
+        case State_Failed:
+          return false;
+      }
+    }
+
+    if (this->state == State_Data && !this->matched)
+      return this->flush(data + pending, len - pending);
+    return this->state != State_Failed;
+  }
+
+  //! only the name and filename are of interest, other headers are skipped
+  void MultipartReader::readHeader() {
+    Helpers::string_view header(this->line, this->lineLength);
+    size_t colon = header.find(':');
+    if (colon == Helpers::string_view::npos ||
+        !equalsIgnoreCase(trim(header.substr(0, colon)), "Content-Disposition"))
+      return;
+
+    Helpers::string_view value = header.substr(colon + 1);
+    copy(attribute(value, "name"), this->part.name, sizeof(this->part.name));
+    copy(attribute(value, "filename"), this->part.filename,
+         sizeof(this->part.filename));
+  }
+}  // namespace HttpForm
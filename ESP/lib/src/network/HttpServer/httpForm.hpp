@@ -0,0 +1,94 @@
+#pragma once
+#ifndef HTTP_FORM_HPP
+#define HTTP_FORM_HPP
+#include <stddef.h>
+#include <stdint.h>
+#include "data/utilities/string_view.hpp"
+
+/**
+ * @brief Request parameters and multipart uploads, the parsing esp_http_server
+ * leaves to its handlers
+ * @details Pure code, so it can be checked on the host
+ */
+namespace HttpForm {
+  struct Param_t {
+    Helpers::string_view name;
+    Helpers::string_view value;
+  };
+
+  /**
+   * @brief Split an application/x-www-form-urlencoded string, a query or a
+   * form body, into its parameters
+   * @details Decodes in place, the views point into text. '+' is a space and
+   * %XX a byte, a broken escape is kept as it was sent. A parameter without
+   * '=' has an empty value, the ones past maxParams are dropped.
+   * @return the number of parameters
+   */
+  size_t parse(char* text, size_t len, Param_t* params, size_t maxParams);
+
+  //! the boundary of a multipart Content-Type, empty if it has none
+  Helpers::string_view boundary(Helpers::string_view contentType);
+
+  /**
+   * @brief Takes a multipart/form-data body apart as it arrives
+   * @details The body can be fed in chunks of any size, part data is handed
+   * on without being buffered. Only the bytes that could be the start of the
+   * next delimiter are held back until it's clear they aren't.
+   */
+  class MultipartReader {
+   public:
+    //! the most RFC 2046 allows
+    static constexpr size_t MAX_BOUNDARY = 70;
+    static constexpr size_t MAX_HEADER_LINE = 256;
+
+    struct Part_t {
+      char name[32];
+      //! empty for plain fields
+      char filename[64];
+    };
+
+    //! every call returns false to stop reading the body
+    class Handler {
+     public:
+      virtual ~Handler() = default;
+      virtual bool onPart(const Part_t& part) = 0;
+      virtual bool onData(const uint8_t* data, size_t len) = 0;
+      virtual bool onPartEnd() = 0;
+    };
+
+    MultipartReader(Helpers::string_view boundary, Handler& handler);
+
+    //! false once the body turned out malformed or the handler stopped, the
+    //! rest of it is ignored
+    bool feed(const uint8_t* data, size_t len);
+    //! the closing delimiter has been read
+    bool done() const { return this->state == State_Done; }
+
+   private:
+    enum State_e : uint8_t {
+      State_Preamble,
+      State_AfterDelimiter,
+      State_Headers,
+      State_Data,
+      State_Done,
+      State_Failed,
+    };
+
+    void readHeader();
+    bool flush(const uint8_t* data, size_t len);
+
+    Handler& handler;
+    State_e state = State_Preamble;
+    //! "\r\n--" and the boundary
+    char delimiter[4 + MAX_BOUNDARY];
+    size_t delimiterLength = 0;
+    //! how much of the delimiter the last bytes matched, the body starts
+    //! with it minus the line break
+    size_t matched = 2;
+    char line[MAX_HEADER_LINE];
+    size_t lineLength = 0;
+    Part_t part = {};
+  };
+}  // namespace HttpForm
+
+#endif  // HTTP_FORM_HPP
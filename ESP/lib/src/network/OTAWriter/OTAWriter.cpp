@@ -0,0 +1,290 @@
+#include "OTAWriter.hpp"
+#include <string.h>
+
+namespace {
+  constexpr uint8_t GZIP_FLAG_HEADER_CRC = 1 << 1;
+  constexpr uint8_t GZIP_FLAG_EXTRA = 1 << 2;
+  constexpr uint8_t GZIP_FLAG_NAME = 1 << 3;
+  constexpr uint8_t GZIP_FLAG_COMMENT = 1 << 4;
+  constexpr uint8_t GZIP_FLAG_RESERVED = 0xE0;
+  constexpr uint8_t GZIP_METHOD_DEFLATE = 8;
+
+  int hexValue(char c) {
+    if (c >= '0' && c <= '9')
+      return c - '0';
+    if (c >= 'a' && c <= 'f')
+      return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+      return c - 'A' + 10;
+    return -1;
+  }
+
+  bool parseHex(const char* hex, uint8_t* out, size_t len) {
+    if (strlen(hex) != len * 2)
+      return false;
+    for (size_t i = 0; i < len; i++) {
+      int high = hexValue(hex[i * 2]);
+      int low = hexValue(hex[i * 2 + 1]);
+      if (high < 0 || low < 0)
+        return false;
+      out[i] = (high << 4) | low;
+    }
+    return true;
+  }
+}  // namespace
+
+OTAWriter::~OTAWriter() {
+  if (this->isActive())
+    this->abort();
+}
+
+bool OTAWriter::begin(int command, const char* md5, const char* sha256) {
+  if (this->isActive())
+    this->abort();
+  this->error = nullptr;
+  this->checkMd5 = md5 && *md5;
+  this->checkSha = sha256 && *sha256;
+  if (!this->checkMd5 && !this->checkSha) {
+    this->error = "MD5 or SHA256 parameter missing";
+    return false;
+  }
+
+  if (this->checkMd5 &&
+      !parseHex(md5, this->expectedMd5, sizeof(this->expectedMd5))) {
+    this->error = "MD5 parameter invalid";
+    return false;
+  }
+  if (this->checkSha &&
+      !parseHex(sha256, this->expectedSha, sizeof(this->expectedSha))) {
+    this->error = "SHA256 parameter invalid";
+    return false;
+  }
+
+  if ((this->checkMd5 && !this->md5.begin(Hal::Digest::Digest_Md5)) ||
+      (this->checkSha && !this->sha.begin(Hal::Digest::Digest_Sha256))) {
+    this->error = "Not enough memory to hash the image";
+    return false;
+  }
+
+  if (!Hal::otaBegin(command)) {
+    this->error = "OTA could not begin";
+    return false;
+  }
+
+  this->imageSize = 0;
+  this->detectLength = 0;
+  this->state = State_Detect;
+  return true;
+}
+
+bool OTAWriter::write(const uint8_t* data, size_t len) {
+  if (this->state == State_Failed || this->state == State_Idle)
+    return false;
+
+  if (this->checkMd5)
+    this->md5.add(data, len);
+
+  size_t offset = 0;
+  while (offset < len) {
+    switch (this->state) {
+      case State_Detect: {
+        this->detectBuffer[this->detectLength++] = data[offset++];
+        if (this->detectLength < sizeof(this->detectBuffer))
+          break;
+
+        if (this->detectBuffer[0] == 0x1f && this->detectBuffer[1] == 0x8b) {
+          if (!this->startGzip())
+            return false;
+          this->consumeGzipByte(this->detectBuffer[0]);
+          this->consumeGzipByte(this->detectBuffer[1]);
+        } else {
+          this->state = State_Raw;
+          this->writeImage(this->detectBuffer, sizeof(this->detectBuffer));
+        }
+        break;
+      }
+      case State_Raw:
+        this->writeImage(data + offset, len - offset);
+        offset = len;
+        break;
+      case State_Inflate: {
+        size_t consumed = 0;
+        this->inflate(data + offset, len - offset, consumed);
+        offset += consumed;
+        break;
+      }
+      case State_Done:
+        return this->fail("Data after the end of the image");
+      default:
+        this->consumeGzipByte(data[offset++]);
+        break;
+    }
+
+    if (this->state == State_Failed)
+      return false;
+  }
+  return true;
+}
+
+bool OTAWriter::end() {
+  // keep the first error
+  if (this->state == State_Failed)
+    return false;
+  if (this->state != State_Raw && this->state != State_Done)
+    return this->fail("Upload ended in the middle of the image");
+
+  uint8_t digest[Hal::Digest::size(Hal::Digest::Digest_Sha256)];
+  if (this->checkMd5) {
+    this->md5.finish(digest);
+    if (memcmp(digest, this->expectedMd5, sizeof(this->expectedMd5)))
+      return this->fail("MD5 mismatch");
+  }
+
+  if (this->checkSha) {
+    this->sha.finish(digest);
+    if (memcmp(digest, this->expectedSha, sizeof(this->expectedSha)))
+      return this->fail("SHA256 mismatch");
+  }
+
+  // only now the new partition gets marked as the one to boot
+  if (!Hal::otaEnd())
+    return this->fail("Could not end OTA");
+
+  log_i("[OTA]: Wrote %u bytes", (unsigned)this->imageSize);
+  this->release();
+  this->state = State_Idle;
+  return true;
+}
+
+void OTAWriter::abort() {
+  if (!this->isActive())
+    return;
+  Hal::otaAbort();
+  this->release();
+  this->state = State_Idle;
+}
+
+bool OTAWriter::fail(const char* reason) {
+  log_e("[OTA]: %s", reason);
+  if (this->state != State_Failed && this->state != State_Idle) {
+    Hal::otaAbort();
+    this->release();
+  }
+  this->error = reason;
+  this->state = State_Failed;
+  return false;
+}
+
+void OTAWriter::release() {
+  this->inflater.end();
+}
+
+bool OTAWriter::writeImage(const uint8_t* data, size_t len) {
+  if (this->checkSha)
+    this->sha.add(data, len);
+  if (!Hal::otaWrite(data, len))
+    return this->fail("Could not write the image");
+  this->imageSize += len;
+  return true;
+}
+
+bool OTAWriter::writeInflated(void* arg, const uint8_t* data, size_t len) {
+  return static_cast<OTAWriter*>(arg)->writeImage(data, len);
+}
+
+bool OTAWriter::startGzip() {
+  if (!this->inflater.begin())
+    return this->fail("Not enough memory to inflate the image");
+  this->headerPosition = 0;
+  this->state = State_GzipHeader;
+  return true;
+}
+
+OTAWriter::State_e OTAWriter::nextGzipField() {
+  static constexpr struct {
+    uint8_t flag;
+    State_e state;
+  } fields[] = {
+      {GZIP_FLAG_EXTRA, State_GzipExtraLength},
+      {GZIP_FLAG_NAME, State_GzipName},
+      {GZIP_FLAG_COMMENT, State_GzipComment},
+      {GZIP_FLAG_HEADER_CRC, State_GzipHeaderCrc},
+  };
+
+  this->headerPosition = 0;
+  this->extraRemaining = 0;
+  for (auto& field : fields) {
+    if (this->headerFlags & field.flag) {
+      this->headerFlags &= ~field.flag;
+      return field.state;
+    }
+  }
+  return State_Inflate;
+}
+
+bool OTAWriter::consumeGzipByte(uint8_t byte) {
+  switch (this->state) {
+    case State_GzipHeader:
+      this->headerBuffer[this->headerPosition++] = byte;
+      if (this->headerPosition < sizeof(this->headerBuffer))
+        return true;
+      if (this->headerBuffer[2] != GZIP_METHOD_DEFLATE ||
+          (this->headerBuffer[3] & GZIP_FLAG_RESERVED))
+        return this->fail("Unsupported gzip header");
+      this->headerFlags = this->headerBuffer[3];
+      this->state = this->nextGzipField();
+      return true;
+    case State_GzipExtraLength:
+      this->extraRemaining |= byte << (8 * this->headerPosition++);
+      if (this->headerPosition == 2)
+        this->state =
+            this->extraRemaining ? State_GzipExtra : this->nextGzipField();
+      return true;
+    case State_GzipExtra:
+      if (--this->extraRemaining == 0)
+        this->state = this->nextGzipField();
+      return true;
+    case State_GzipName:
+    case State_GzipComment:
+      if (byte == 0)
+        this->state = this->nextGzipField();
+      return true;
+    case State_GzipHeaderCrc:
+      if (++this->headerPosition == 2)
+        this->state = this->nextGzipField();
+      return true;
+    case State_GzipTrailer: {
+      this->trailer[this->headerPosition++] = byte;
+      if (this->headerPosition < sizeof(this->trailer))
+        return true;
+      // the CRC is left to the SHA-256, the size still catches truncation
+      uint32_t size = this->trailer[4] | (this->trailer[5] << 8) |
+                      (this->trailer[6] << 16) |
+                      ((uint32_t)this->trailer[7] << 24);
+      if (size != (uint32_t)this->imageSize)
+        return this->fail("Inflated size does not match the gzip trailer");
+      this->state = State_Done;
+      return true;
+    }
+    default:
+      return this->fail("Unexpected gzip state");
+  }
+}
+
+bool OTAWriter::inflate(const uint8_t* data, size_t len, size_t& consumed) {
+  switch (this->inflater.inflate(data, len, consumed, &OTAWriter::writeInflated,
+                                 this)) {
+    case Hal::Inflater::Inflate_Done:
+      // the trailer follows right after the deflate stream
+      this->headerPosition = 0;
+      this->state = State_GzipTrailer;
+      return true;
+    case Hal::Inflater::Inflate_NeedsInput:
+      return true;
+    default:
+      // a failed write has already said why
+      if (this->state == State_Failed)
+        return false;
+      return this->fail("Corrupt gzip data");
+  }
+}
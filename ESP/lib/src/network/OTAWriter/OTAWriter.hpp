@@ -0,0 +1,95 @@
+#pragma once
+#ifndef OTAWRITER_HPP
+#define OTAWRITER_HPP
+#include "hal/hal.hpp"
+
+/**
+ * @brief Writes an uploaded firmware image into the update partition, raw or
+ * gzip compressed
+ * @details Compressed images are recognised by their gzip magic and inflated
+ * chunk by chunk with Hal::Inflater, so RAM use stays at the inflater state
+ * plus its 32KB window no matter how large the image is.
+ *
+ * Two checksums can be verified, the MD5 covers the bytes as they were
+ * uploaded, the SHA-256 the image as it ends up in flash. A mismatch aborts
+ * the update before the new partition is marked bootable.
+ */
+class OTAWriter {
+ public:
+  ~OTAWriter();
+
+  /**
+   * @param command U_FLASH or U_SPIFFS
+   * @param md5 hex digest of the upload, empty to skip the check
+   * @param sha256 hex digest of the image, empty to skip the check
+   * @return false if neither digest was given, or either is malformed
+   */
+  bool begin(int command, const char* md5, const char* sha256);
+  //! feed the next chunk of the upload
+  bool write(const uint8_t* data, size_t len);
+  //! verify and finish, the update only becomes bootable if this succeeds
+  bool end();
+  void abort();
+
+  bool isActive() const { return this->state != State_Idle; }
+  //! nullptr while nothing went wrong
+  const char* getError() const { return this->error; }
+
+ private:
+  enum State_e : uint8_t {
+    State_Idle,
+    //! waiting for enough bytes to tell raw from gzip
+    State_Detect,
+    State_Raw,
+    State_GzipHeader,
+    State_GzipExtraLength,
+    State_GzipExtra,
+    State_GzipName,
+    State_GzipComment,
+    State_GzipHeaderCrc,
+    State_Inflate,
+    State_GzipTrailer,
+    State_Done,
+    State_Failed,
+  };
+
+  bool fail(const char* reason);
+  bool writeImage(const uint8_t* data, size_t len);
+  //! Hal::Inflater::Output
+  static bool writeInflated(void* arg, const uint8_t* data, size_t len);
+  bool inflate(const uint8_t* data, size_t len, size_t& consumed);
+  //! walks the gzip header and trailer one byte at a time
+  bool consumeGzipByte(uint8_t byte);
+  //! the next optional header field the flags announce, or the body
+  State_e nextGzipField();
+  bool startGzip();
+  void release();
+
+  State_e state = State_Idle;
+  const char* error = nullptr;
+
+  Hal::Digest md5;
+  bool checkMd5 = false;
+  uint8_t expectedMd5[Hal::Digest::size(Hal::Digest::Digest_Md5)] = {};
+
+  Hal::Digest sha;
+  bool checkSha = false;
+  uint8_t expectedSha[Hal::Digest::size(Hal::Digest::Digest_Sha256)] = {};
+
+  //! what has been written to the partition so far
+  size_t imageSize = 0;
+
+  uint8_t detectBuffer[2] = {};
+  uint8_t detectLength = 0;
+
+  //! gzip header and trailer bookkeeping
+  uint8_t headerBuffer[10] = {};
+  uint8_t headerFlags = 0;
+  uint8_t headerPosition = 0;
+  uint16_t extraRemaining = 0;
+  uint8_t trailer[8] = {};
+
+  Hal::Inflater inflater;
+};
+
+#endif  // OTAWRITER_HPP
@@ -0,0 +1,113 @@
+#include "WiFiMonitor.hpp"
+#include <algorithm>
+
+WiFiMonitor wifiMonitor;
+
+namespace {
+  Metrics::Counter reconnects("openiris_wifi_reconnects_total",
+                              "Times the link came back after it was lost");
+
+  Metrics::Collector rssi("openiris_wifi_rssi_dbm",
+                          "Link quality as sampled by the WiFiMonitor",
+                          "gauge",
+                          [](Print& out, const char* name) {
+                            WiFiLinkStats_t stats = wifiMonitor.getStats();
+                            if (!stats.connected)
+                              return;
+                            out.printf("%s{kind=\"current\"} %d\n", name,
+                                       stats.rssi);
+                            out.printf("%s{kind=\"average\"} %d\n", name,
+                                       stats.averageRssi);
+                            out.printf("%s{kind=\"min\"} %d\n", name,
+                                       stats.minRssi);
+                            out.printf("%s{kind=\"max\"} %d\n", name,
+                                       stats.maxRssi);
+                          });
+
+  Metrics::Collector connected("openiris_wifi_connected",
+                               "1 while associated with an access point",
+                               "gauge",
+                               [](Print& out, const char* name) {
+                                 out.printf("%s %d\n", name,
+                                            wifiMonitor.getStats().connected);
+                               });
+}  // namespace
+
+void WiFiMonitor::begin() {
+  if (this->task)
+    return;
+
+  // priority 1, right above idle, the samples are never urgent
+  if (xTaskCreatePinnedToCore(&WiFiMonitor::run, "WiFiMonitor", 2048, this, 1,
+                              &this->task, 0) != pdPASS) {
+    log_e("[WiFiMonitor]: Could not start the sampling task");
+    this->task = nullptr;
+  }
+}
+
+WiFiLinkStats_t WiFiMonitor::getStats() {
+  portENTER_CRITICAL(&this->lock);
+  WiFiLinkStats_t copy = this->stats;
+  portEXIT_CRITICAL(&this->lock);
+  return copy;
+}
+
+void WiFiMonitor::run(void* arg) {
+  auto* self = static_cast<WiFiMonitor*>(arg);
+  TickType_t lastWake = xTaskGetTickCount();
+  while (true) {
+    self->sample();
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(WIFI_MONITOR_PERIOD_MS));
+  }
+}
+
+void WiFiMonitor::sample() {
+  wifi_ap_record_t ap;
+  if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+    // start over once we're back, the old samples say nothing about the new
+    // link
+    this->windowSize = 0;
+    this->windowHead = 0;
+    portENTER_CRITICAL(&this->lock);
+    this->stats.connected = false;
+    portEXIT_CRITICAL(&this->lock);
+    return;
+  }
+
+  // only this task writes the stats, reading them unlocked is fine
+  if (!this->stats.connected && this->stats.samples)
+    reconnects.add();
+
+  if (this->windowSize == 0)
+    this->averageRssiQ8 = ap.rssi * 256;
+  else
+    this->averageRssiQ8 +=
+        ((ap.rssi * 256 - this->averageRssiQ8) * WIFI_MONITOR_EWMA_WEIGHT) /
+        256;
+
+  this->window[this->windowHead] = ap.rssi;
+  this->windowHead = (this->windowHead + 1) % WIFI_MONITOR_WINDOW;
+  if (this->windowSize < WIFI_MONITOR_WINDOW)
+    this->windowSize++;
+
+  int8_t minRssi = INT8_MAX;
+  int8_t maxRssi = INT8_MIN;
+  for (uint8_t i = 0; i < this->windowSize; i++) {
+    minRssi = std::min(minRssi, this->window[i]);
+    maxRssi = std::max(maxRssi, this->window[i]);
+  }
+
+  uint8_t phyModes = (ap.phy_11b ? 1 : 0) | (ap.phy_11g ? 2 : 0) |
+                     (ap.phy_11n ? 4 : 0);
+
+  portENTER_CRITICAL(&this->lock);
+  this->stats.connected = true;
+  this->stats.rssi = ap.rssi;
+  this->stats.averageRssi = this->averageRssiQ8 / 256;
+  this->stats.minRssi = minRssi;
+  this->stats.maxRssi = maxRssi;
+  this->stats.channel = ap.primary;
+  this->stats.phyModes = phyModes;
+  this->stats.samples++;
+  portEXIT_CRITICAL(&this->lock);
+}
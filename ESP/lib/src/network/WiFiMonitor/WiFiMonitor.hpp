@@ -0,0 +1,61 @@
+#pragma once
+#ifndef WIFIMONITOR_HPP
+#define WIFIMONITOR_HPP
+#include <Arduino.h>
+#include <esp_wifi.h>
+#include "data/Metrics/Metrics.hpp"
+
+#define WIFI_MONITOR_PERIOD_MS 250
+//! the min/max window covers the last WIFI_MONITOR_WINDOW samples, 10s
+#define WIFI_MONITOR_WINDOW 40
+//! weight of a new sample in the moving average, in 1/256ths
+#define WIFI_MONITOR_EWMA_WEIGHT 32
+
+/**
+ * @brief A consistent copy of the link statistics
+ */
+struct WiFiLinkStats_t {
+  //! false while we're not connected to an access point, the rest is stale
+  bool connected;
+  int8_t rssi;
+  //! exponentially weighted moving average of the RSSI
+  int8_t averageRssi;
+  int8_t minRssi;
+  int8_t maxRssi;
+  uint8_t channel;
+  //! bit 0 - 802.11b, bit 1 - 802.11g, bit 2 - 802.11n, as negotiated with the
+  //! access point
+  uint8_t phyModes;
+  uint32_t samples;
+};
+
+/**
+ * @brief Samples the link quality in the background so readers never block
+ * @details A low priority task polls the station info every
+ * WIFI_MONITOR_PERIOD_MS and keeps a moving average and a min/max window of
+ * the RSSI. Anyone interested in the link, the API, stream rate control or
+ * diagnostics, reads the cached statistics.
+ */
+class WiFiMonitor {
+ public:
+  void begin();
+  WiFiLinkStats_t getStats();
+
+ private:
+  static void run(void* arg);
+  void sample();
+
+  TaskHandle_t task = nullptr;
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+  WiFiLinkStats_t stats = {};
+  //! the average is kept in 1/256 dBm to not lose the small steps
+  int32_t averageRssiQ8 = 0;
+  int8_t window[WIFI_MONITOR_WINDOW] = {};
+  uint8_t windowSize = 0;
+  uint8_t windowHead = 0;
+};
+
+extern WiFiMonitor wifiMonitor;
+
+#endif  // WIFIMONITOR_HPP
@@ -2,14 +2,27 @@
 
 const char* BaseAPI::MIMETYPE_JSON{"application/json"};
 
+namespace {
+  Metrics::Counter configRequests("openiris_http_requests_total",
+                                  "Requests per route",
+                                  "route=\"/config\"");
+  Metrics::Counter metricsRequests("openiris_http_requests_total",
+                                   "Requests per route",
+                                   "route=\"/metrics\"");
+  Metrics::Counter otaSucceeded("openiris_ota_updates_total",
+                                "Finished firmware uploads",
+                                "result=\"ok\"");
+  Metrics::Counter otaFailed("openiris_ota_updates_total",
+                             "Finished firmware uploads",
+                             "result=\"failed\"");
+}  // namespace
+
 BaseAPI::BaseAPI(ProjectConfig& projectConfig,
 #ifndef SIM_ENABLED
                  CameraHandler& camera,
 #endif  // SIM_ENABLED
-                 const std::string& api_url,
-                 const int CONTROL_PORT)
-    : server(CONTROL_PORT),
-      projectConfig(projectConfig),
+                 const std::string& api_url)
+    : projectConfig(projectConfig),
 #ifndef SIM_ENABLED
       camera(camera),
 #endif  // SIM_ENABLED
@@ -18,122 +31,249 @@ BaseAPI::BaseAPI(ProjectConfig& projectConfig,
 
 BaseAPI::~BaseAPI() {}
 
-void BaseAPI::begin() {
-  //! i have changed this to use lambdas instead of std::bind to avoid the
-  //! overhead. Lambdas are always more preferable.
-  server.on("/", 0b00000001,
-            [&](AsyncWebServerRequest* request) { request->send(200); });
-
-  // preflight cors check
-  server.on("/", 0b01000000, [&](AsyncWebServerRequest* request) {
-    AsyncWebServerResponse* response = request->beginResponse(204);
-    response->addHeader("Access-Control-Allow-Methods", "PUT,POST,GET,OPTIONS");
-    response->addHeader("Access-Control-Allow-Headers",
-                        "Accept, Content-Type, Authorization");
-    response->addHeader("Access-Control-Allow-Credentials", "true");
-    request->send(response);
-  });
-
-  DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
-
-  // std::bind(&BaseAPI::notFound, &std::placeholders::_1);
-  server.onNotFound([&](AsyncWebServerRequest* request) { notFound(request); });
+void BaseAPI::begin(HttpServer& httpServer) {
+  static const HttpServer::Route_t routes[] = {
+      {"/config", HTTP_GET, &HttpRequest::bind<BaseAPI, &BaseAPI::configResource>},
+      {"/config", HTTP_PUT, &HttpRequest::bind<BaseAPI, &BaseAPI::configResource>},
+      {"/metrics", HTTP_GET, &HttpRequest::bind<BaseAPI, &BaseAPI::metrics>},
+      {"/trace", HTTP_GET, &HttpRequest::bind<BaseAPI, &BaseAPI::frameTrace>},
+      // groups registered before this one answer their own preflights
+      {"/*", HTTP_OPTIONS, &HttpRequest::bind<BaseAPI, &BaseAPI::preflight>},
+  };
+  httpServer.addGroup("", routes, this);
+  httpServer.setNotFound(&BaseAPI::notFound);
 }
 
-void BaseAPI::notFound(AsyncWebServerRequest* request) const {
-  if (_networkMethodsMap.find(request->method()) != _networkMethodsMap.end()) {
-    log_i("%s: http://%s%s/\n",
-          _networkMethodsMap.at(request->method()).c_str(),
-          request->host().c_str(), request->url().c_str());
-    char buffer[100];
-    snprintf(buffer, sizeof(buffer), "Request %s Not found: %s",
-             _networkMethodsMap.at(request->method()).c_str(),
-             request->url().c_str());
-    request->send(404, "text/plain", buffer);
-  } else {
-    request->send(404, "text/plain", "Request Not found using unknown method");
-  }
+void BaseAPI::preflight(HttpRequest* request) {
+  request->addHeader("Access-Control-Allow-Methods",
+                     "PUT,POST,GET,DELETE,OPTIONS");
+  request->addHeader("Access-Control-Allow-Headers",
+                     "Accept, Content-Type, Authorization, If-Match, "
+                     "If-None-Match");
+  request->addHeader("Access-Control-Allow-Credentials", "true");
+  request->send(204);
+}
+
+esp_err_t BaseAPI::notFound(httpd_req_t* req, httpd_err_code_t error) {
+  const char* method = http_method_str((enum http_method)req->method);
+  log_i("%s: %s", method, req->uri);
+  char buffer[100];
+  snprintf(buffer, sizeof(buffer), "Request %s Not found: %s", method,
+           req->uri);
+  HttpRequest request(req);
+  request.send(404, "text/plain", buffer);
+  // keep the connection
+  return ESP_OK;
+}
+
+/**
+ * @brief Answer a request that failed its parameter schema with a 400 that
+ * names the parameter and what was wrong with it
+ */
+void BaseAPI::sendParamError(HttpRequest* request,
+                             const ParamSchema::Result_t& result) const {
+  char buffer[128];
+  snprintf(buffer, sizeof(buffer),
+           "{\"msg\":\"Invalid parameter\",\"param\":\"%s\",\"error\":\"%s\"}",
+           result.field, ParamSchema::errorName(result.error));
+  log_e("[API]: Parameter %s is %s", result.field,
+        ParamSchema::errorName(result.error));
+  request->send(400, MIMETYPE_JSON, buffer);
+}
+
+/**
+ * @brief Look up a parameter without copying it, returns an empty view if it
+ * was not sent
+ */
+Helpers::string_view BaseAPI::findParam(HttpRequest* request,
+                                        const char* name) const {
+  return request->arg(name);
 }
 
 //*********************************************************************************************
 //!                                     Command Functions
 //*********************************************************************************************
-void BaseAPI::setWiFi(AsyncWebServerRequest* request) {
+void BaseAPI::setWiFi(HttpRequest* request) {
   switch (_networkMethodsMap_enum[request->method()]) {
     case POST: {
-      int params = request->params();
-      std::string networkName;
-      std::string ssid;
-      std::string password;
-      uint8_t channel = 0;
-      uint8_t power = 0;
-      uint8_t adhoc = 0;
-
-      log_d("Number of Params: %d", params);
-      for (int i = 0; i < params; i++) {
-        const AsyncWebParameter* param = request->getParam(i);
-        if (param->name() == "networkName") {
-          networkName.assign(param->value().c_str());
-        } else if (param->name() == "ssid") {
-          ssid.assign(param->value().c_str());
-        } else if (param->name() == "password") {
-          password.assign(param->value().c_str());
-        } else if (param->name() == "channel") {
-          channel = (uint8_t)atoi(param->value().c_str());
-        } else if (param->name() == "power") {
-          power = (uint8_t)atoi(param->value().c_str());
-        } else if (param->name() == "adhoc") {
-          adhoc = (uint8_t)atoi(param->value().c_str());
-        }
-
-        log_i("%s[%s]: %s\n", _networkMethodsMap[request->method()].c_str(),
-              param->name().c_str(), param->value().c_str());
+      struct WiFiParams_t {
+        char networkName[33];
+        char ssid[33];
+        char password[65];
+        uint8_t channel;
+        uint8_t power;
+        bool adhoc;
+      };
+      static constexpr ParamSchema::Field_t schema[] = {
+          ParamSchema::text("networkName", offsetof(WiFiParams_t, networkName),
+                            sizeof(WiFiParams_t::networkName),
+                            ParamSchema::Param_Required),
+          ParamSchema::text("ssid", offsetof(WiFiParams_t, ssid),
+                            sizeof(WiFiParams_t::ssid)),
+          ParamSchema::text("password", offsetof(WiFiParams_t, password),
+                            sizeof(WiFiParams_t::password)),
+          ParamSchema::number("channel", ParamSchema::Param_UInt8,
+                              offsetof(WiFiParams_t, channel), 0, 13),
+          ParamSchema::number("power", ParamSchema::Param_UInt8,
+                              offsetof(WiFiParams_t, power), 0, 84),
+          ParamSchema::boolean("adhoc", offsetof(WiFiParams_t, adhoc)),
+      };
+
+      WiFiParams_t params = {};
+      // a network we already know only gets the fields that were sent changed
+      Helpers::string_view networkName = findParam(request, "networkName");
+      for (auto& network : projectConfig.getWifiConfigs()) {
+        if (networkName != Helpers::string_view(network.name))
+          continue;
+        strlcpy(params.ssid, network.ssid.c_str(), sizeof(params.ssid));
+        strlcpy(params.password, network.password.c_str(),
+                sizeof(params.password));
+        params.channel = network.channel;
+        params.power = network.power;
+        params.adhoc = network.adhoc;
+        break;
       }
-      // note: We're passing empty params by design, this is done to reset
-      // specific fields
-      projectConfig.setWifiConfig(networkName, ssid, password, channel, power,
-                                  adhoc, true);
+
+      if (!parseParams(request, schema, &params))
+        return;
+
+      projectConfig.setWifiConfig(params.networkName, params.ssid,
+                                  params.password, params.channel,
+                                  params.power, params.adhoc, true);
 
       request->send(200, MIMETYPE_JSON,
                     "{\"msg\":\"Done. Wifi Creds have been set.\"}");
       break;
     }
     case DELETE: {
-      projectConfig.deleteWifiConfig(request->arg("networkName").c_str(), true);
+      Helpers::string_view networkName = request->arg("networkName");
+      projectConfig.deleteWifiConfig(
+          std::string(networkName.data(), networkName.size()), true);
       request->send(200, MIMETYPE_JSON,
                     "{\"msg\":\"Done. Wifi Creds have been deleted.\"}");
       break;
     }
     default: {
       request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
-      request->redirect("/");
       break;
     }
   }
 }
 
-void BaseAPI::getJsonConfig(AsyncWebServerRequest* request) {
+void BaseAPI::getJsonConfig(HttpRequest* request) {
   // returns the current stored config in case it get's deleted on the PC.
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET: {
-      std::string wifiConfigSerialized = "\"wifi_config\": [";
-      auto networksConfigs = projectConfig.getWifiConfigs();
-      for (auto& networkConfig : networksConfigs) {
-        wifiConfigSerialized += networkConfig.toRepresentation();
+      sendConfig(request);
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Stream the whole config into the response, with its ETag
+ * @details Answers 304 when the client already has this version
+ */
+void BaseAPI::sendConfig(HttpRequest* request) {
+  auto& config = projectConfig.getTrackerConfig();
+  char etag[12];
+  ConfigSerializer::etag(config, etag, sizeof(etag));
+
+  char ifNoneMatch[sizeof(etag)];
+  request->addHeader("ETag", etag);
+  if (request->header("If-None-Match", ifNoneMatch, sizeof(ifNoneMatch)) &&
+      !strcmp(ifNoneMatch, etag)) {
+    request->send(304);
+    return;
+  }
+
+  HttpResponseStream response(*request, MIMETYPE_JSON);
+  ConfigSerializer::write(config, response);
+}
+
+/**
+ * @brief The whole config as a single resource
+ * @details GET streams it, PUT takes a full or partial document and applies it
+ * in one go once every field has been validated. PUT honours If-Match, so a
+ * client can make sure it is changing the version it last read.
+ */
+void BaseAPI::configResource(HttpRequest* request) {
+  configRequests.add();
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET: {
+      sendConfig(request);
+      break;
+    }
+    case PUT: {
+      auto& config = projectConfig.getTrackerConfig();
+      char etag[12];
+      ConfigSerializer::etag(config, etag, sizeof(etag));
+
+      // an ETag that doesn't fit can't be ours either
+      char ifMatch[16];
+      bool hasIfMatch = httpd_req_get_hdr_value_len(request->handle(), "If-Match");
+      if (hasIfMatch &&
+          (!request->header("If-Match", ifMatch, sizeof(ifMatch)) ||
+           (strcmp(ifMatch, "*") && strcmp(ifMatch, etag)))) {
+        request->addHeader("ETag", etag);
+        request->send(412, MIMETYPE_JSON, "{\"msg\":\"Config has changed\"}");
+        return;
+      }
 
-        if (&networkConfig != &networksConfigs.back())
-          wifiConfigSerialized += ",";
+      if (request->contentLength() > MAX_CONFIG_BODY_SIZE) {
+        request->send(413, MIMETYPE_JSON, "{\"msg\":\"Config too large\"}");
+        return;
+      }
+      if (!request->contentLength()) {
+        request->send(400, MIMETYPE_JSON, "{\"msg\":\"Missing body\"}");
+        return;
       }
-      wifiConfigSerialized += "]";
-
-      std::string json = Helpers::format_string(
-          "{%s, %s, %s, %s, %s}",
-          projectConfig.getDeviceConfig().toRepresentation().c_str(),
-          projectConfig.getCameraConfig().toRepresentation().c_str(),
-          wifiConfigSerialized.c_str(),
-          projectConfig.getMDNSConfig().toRepresentation().c_str(),
-          projectConfig.getAPWifiConfig().toRepresentation().c_str());
-      request->send(200, MIMETYPE_JSON, json.c_str());
+      std::unique_ptr<char, decltype(&free)> body(
+          (char*)malloc(request->contentLength()), &free);
+      if (!body || !request->readBody(body.get(), request->contentLength())) {
+        request->send(400, MIMETYPE_JSON, "{\"msg\":\"Incomplete body\"}");
+        return;
+      }
+
+      JsonDocument doc;
+      DeserializationError jsonError =
+          deserializeJson(doc, body.get(), request->contentLength());
+      if (jsonError) {
+        char buffer[96];
+        snprintf(buffer, sizeof(buffer),
+                 "{\"msg\":\"Invalid JSON\",\"error\":\"%s\"}",
+                 jsonError.c_str());
+        request->send(400, MIMETYPE_JSON, buffer);
+        return;
+      }
+
+      // everything gets validated on a copy, the live config is only touched
+      // once the whole document turned out to be fine
+      ProjectConfig::TrackerConfig_t staged = config;
+      uint32_t sections = 0;
+      ConfigSerializer::Error_t error;
+      if (!ConfigSerializer::read(doc.as<JsonVariantConst>(), staged, sections,
+                                  error)) {
+        char buffer[160];
+        snprintf(buffer, sizeof(buffer),
+                 "{\"msg\":\"Invalid config\",\"section\":\"%s\","
+                 "\"field\":\"%s\",\"error\":\"%s\"}",
+                 error.section ? error.section : "",
+                 error.field ? error.field : "", error.reason);
+        request->send(400, MIMETYPE_JSON, buffer);
+        return;
+      }
+
+      projectConfig.commitTrackerConfig(staged, sections);
+
+      ConfigSerializer::etag(config, etag, sizeof(etag));
+      request->addHeader("ETag", etag);
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Config has been applied.\"}");
       break;
     }
     default: {
@@ -143,66 +283,81 @@ void BaseAPI::getJsonConfig(AsyncWebServerRequest* request) {
   }
 }
 
-void BaseAPI::setDeviceConfig(AsyncWebServerRequest* request) {
+void BaseAPI::setDeviceConfig(HttpRequest* request) {
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET: {
       request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
       break;
     }
     case POST: {
-      int params = request->params();
-
-      std::string hostname;
-      std::string service;
-      std::string ota_password;
-      std::string ota_login;
-      int ota_port;
-
-      for (int i = 0; i < params; i++) {
-        const AsyncWebParameter* param = request->getParam(i);
-        if (param->name() == "hostname") {
-          std::string result = param->value().c_str();
-
-          // Convert to lower case using lambda - to  force lower case
-          std::for_each(result.begin(), result.end(),
-                        [](char& c) { c = ::tolower(c); });
-
-          hostname.assign(result);
-        } else if (param->name() == "service") {
-          service.assign(param->value().c_str());
-        } else if (param->name() == "ota_port") {
-          ota_port = atoi(param->value().c_str());
-        } else if (param->name() == "ota_login") {
-          ota_login.assign(param->value().c_str());
-        } else if (param->name() == "ota_password") {
-          ota_password.assign(param->value().c_str());
-        }
-      }
-      // note: We're passing empty params by design, this is done to reset
-      // specific fields
-      projectConfig.setDeviceConfig(ota_login, ota_password, ota_port, true);
-      projectConfig.setMDNSConfig(hostname, service, true);
+      struct DeviceParams_t {
+        char hostname[64];
+        char service[64];
+        char otaLogin[64];
+        char otaPassword[64];
+        int32_t otaPort;
+      };
+      static constexpr ParamSchema::Field_t schema[] = {
+          // mDNS hostnames are case insensitive, we always store them lower
+          // case
+          ParamSchema::text("hostname", offsetof(DeviceParams_t, hostname),
+                            sizeof(DeviceParams_t::hostname),
+                            ParamSchema::Param_Lowercase),
+          ParamSchema::text("service", offsetof(DeviceParams_t, service),
+                            sizeof(DeviceParams_t::service)),
+          ParamSchema::number("ota_port", ParamSchema::Param_Int32,
+                              offsetof(DeviceParams_t, otaPort), 1, 65535),
+          ParamSchema::text("ota_login", offsetof(DeviceParams_t, otaLogin),
+                            sizeof(DeviceParams_t::otaLogin)),
+          ParamSchema::text("ota_password",
+                            offsetof(DeviceParams_t, otaPassword),
+                            sizeof(DeviceParams_t::otaPassword)),
+      };
+
+      auto& deviceConfig = projectConfig.getDeviceConfig();
+      auto& mdnsConfig = projectConfig.getMDNSConfig();
+      DeviceParams_t params = {};
+      strlcpy(params.hostname, mdnsConfig.hostname.c_str(),
+              sizeof(params.hostname));
+      strlcpy(params.service, mdnsConfig.service.c_str(),
+              sizeof(params.service));
+      strlcpy(params.otaLogin, deviceConfig.OTALogin.c_str(),
+              sizeof(params.otaLogin));
+      strlcpy(params.otaPassword, deviceConfig.OTAPassword.c_str(),
+              sizeof(params.otaPassword));
+      params.otaPort = deviceConfig.OTAPort;
+
+      if (!parseParams(request, schema, &params))
+        return;
+
+      projectConfig.setDeviceConfig(params.otaLogin, params.otaPassword,
+                                    params.otaPort, true);
+      projectConfig.setMDNSConfig(params.hostname, params.service, true);
       request->send(200, MIMETYPE_JSON,
                     "{\"msg\":\"Done. Device Config has been set.\"}");
     }
   }
 }
 
-void BaseAPI::setWiFiTXPower(AsyncWebServerRequest* request) {
+void BaseAPI::setWiFiTXPower(HttpRequest* request) {
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET:
     case POST: {
-      int params = request->params();
-
-      uint8_t txPower = 0;
-
-      for (int i = 0; i < params; i++) {
-        const AsyncWebParameter* param = request->getParam(i);
-        if (param->name() == "txpower" || param->name() == "txPower") {
-          txPower = atoi(param->value().c_str());
-        }
-      }
-      projectConfig.setWiFiTxPower(txPower, true);
+      static constexpr ParamSchema::Field_t schema[] = {
+          ParamSchema::number("txpower", ParamSchema::Param_UInt8,
+                              offsetof(ProjectConfig::WiFiTxPower_t, power), 0,
+                              84),
+          ParamSchema::number("txPower", ParamSchema::Param_UInt8,
+                              offsetof(ProjectConfig::WiFiTxPower_t, power), 0,
+                              84),
+      };
+
+      ProjectConfig::WiFiTxPower_t txPower =
+          projectConfig.getWiFiTxPowerConfig();
+      if (!parseParams(request, schema, &txPower))
+        return;
+
+      projectConfig.setWiFiTxPower(txPower.power, true);
       projectConfig.wifiTxPowerConfigSave();
       request->send(200, MIMETYPE_JSON,
                     "{\"msg\":\"Done. TX Power has been set.\"}");
@@ -210,11 +365,12 @@ void BaseAPI::setWiFiTXPower(AsyncWebServerRequest* request) {
   }
 }
 
-void BaseAPI::rebootDevice(AsyncWebServerRequest* request) {
+void BaseAPI::rebootDevice(HttpRequest* request) {
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET: {
       request->send(200, MIMETYPE_JSON, "{\"msg\":\"Rebooting Device\"}");
       OpenIrisTasks::ScheduleRestart(2000);
+      break;
     }
     default: {
       request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
@@ -223,7 +379,7 @@ void BaseAPI::rebootDevice(AsyncWebServerRequest* request) {
   }
 }
 
-void BaseAPI::factoryReset(AsyncWebServerRequest* request) {
+void BaseAPI::factoryReset(HttpRequest* request) {
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET: {
       log_d("Factory Reset");
@@ -241,39 +397,33 @@ void BaseAPI::factoryReset(AsyncWebServerRequest* request) {
 //!                                     Camera Command Functions
 //*********************************************************************************************
 #ifndef SIM_ENABLED
-void BaseAPI::setCamera(AsyncWebServerRequest* request) {
+void BaseAPI::setCamera(HttpRequest* request) {
   switch (_networkMethodsMap_enum[request->method()]) {
     case GET: {
-      // create temporary variables to store the values
-      uint8_t temp_camera_framesize = 0;
-      uint8_t temp_camera_vflip = 0;
-      uint8_t temp_camera_hflip = 0;
-      uint8_t temp_camera_quality = 0;
-      uint8_t temp_camera_brightness = 0;
-
-      int params = request->params();
-      //! Using the else if statements to ensure that the values do not need to
-      //! be set in a specific order This means the order of the URL params does
-      //! not matter
-      for (int i = 0; i < params; i++) {
-        const AsyncWebParameter* param = request->getParam(i);
-        if (param->name() == "framesize") {
-          temp_camera_framesize = (uint8_t)param->value().toInt();
-        } else if (param->name() == "vflip") {
-          temp_camera_vflip = (uint8_t)param->value().toInt();
-        } else if (param->name() == "hflip") {
-          temp_camera_hflip = (uint8_t)param->value().toInt();
-        } else if (param->name() == "quality") {
-          temp_camera_quality = (uint8_t)param->value().toInt();
-        } else if (param->name() == "brightness") {
-          temp_camera_brightness = (uint8_t)param->value().toInt();
-        }
-      }
-      // note: We're passing empty params by design, this is done to reset
-      // specific fields
-      projectConfig.setCameraConfig(temp_camera_vflip, temp_camera_framesize,
-                                    temp_camera_hflip, temp_camera_quality,
-                                    temp_camera_brightness, true);
+      using CameraConfig_t = ProjectConfig::CameraConfig_t;
+      static constexpr ParamSchema::Field_t schema[] = {
+          ParamSchema::number("framesize", ParamSchema::Param_UInt8,
+                              offsetof(CameraConfig_t, framesize), 0,
+                              FRAMESIZE_INVALID - 1),
+          ParamSchema::number("vflip", ParamSchema::Param_UInt8,
+                              offsetof(CameraConfig_t, vflip), 0, 1),
+          ParamSchema::number("hflip", ParamSchema::Param_UInt8,
+                              offsetof(CameraConfig_t, href), 0, 1),
+          // 0-63, lower is better quality
+          ParamSchema::number("quality", ParamSchema::Param_UInt8,
+                              offsetof(CameraConfig_t, quality), 0, 63),
+          // applied as the sensor gain, which goes from 0 to 30
+          ParamSchema::number("brightness", ParamSchema::Param_UInt8,
+                              offsetof(CameraConfig_t, brightness), 0, 30),
+      };
+
+      CameraConfig_t cameraConfig = projectConfig.getCameraConfig();
+      if (!parseParams(request, schema, &cameraConfig))
+        return;
+
+      projectConfig.setCameraConfig(cameraConfig.vflip, cameraConfig.framesize,
+                                    cameraConfig.href, cameraConfig.quality,
+                                    cameraConfig.brightness, true);
 
       request->send(200, MIMETYPE_JSON,
                     "{\"msg\":\"Done. Camera Settings have been set.\"}");
@@ -281,15 +431,15 @@ void BaseAPI::setCamera(AsyncWebServerRequest* request) {
     }
     default: {
       request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
-      request->redirect("/");
       break;
     }
   }
 }
 
-void BaseAPI::restartCamera(AsyncWebServerRequest* request) {
-  bool mode = (bool)atoi(request->arg("mode").c_str());
-  camera.resetCamera(mode);
+void BaseAPI::restartCamera(HttpRequest* request) {
+  int64_t mode = 0;
+  ParamSchema::parseInteger(request->arg("mode"), mode);
+  camera.resetCamera(mode != 0);
 
   request->send(200, MIMETYPE_JSON,
                 "{\"msg\":\"Done. Camera had been restarted.\"}");
@@ -300,47 +450,336 @@ void BaseAPI::restartCamera(AsyncWebServerRequest* request) {
 //!                                     General Command Functions
 //*********************************************************************************************
 
-void BaseAPI::ping(AsyncWebServerRequest* request) {
+void BaseAPI::ping(HttpRequest* request) {
   request->send(200, MIMETYPE_JSON, "{\"msg\": \"ok\" }");
 }
 
-void BaseAPI::save(AsyncWebServerRequest* request) {
+void BaseAPI::save(HttpRequest* request) {
   projectConfig.save();
   request->send(200, MIMETYPE_JSON, "{\"msg\": \"ok\" }");
 }
 
-void BaseAPI::rssi(AsyncWebServerRequest* request) {
-  int rssi = Network_Utilities::getStrength(
-      request->getParam("points")->value().toInt());
-  char _rssiBuffer[20];
-  snprintf(_rssiBuffer, sizeof(_rssiBuffer), "{\"rssi\": %d }", rssi);
+/**
+ * @brief Scrape endpoint for Prometheus
+ * @details The text is streamed as it's written, every metric only costs a
+ * few relaxed loads.
+ */
+void BaseAPI::metrics(HttpRequest* request) {
+  metricsRequests.add();
+  HttpResponseStream response(*request, "text/plain; version=0.0.4");
+  Metrics::write(response);
+}
+
+/**
+ * @brief Report the link quality as sampled in the background by the
+ * WiFiMonitor, rssi is the moving average
+ */
+void BaseAPI::rssi(HttpRequest* request) {
+  WiFiLinkStats_t stats = wifiMonitor.getStats();
+  char _rssiBuffer[160];
+  snprintf(_rssiBuffer, sizeof(_rssiBuffer),
+           "{\"rssi\": %d, \"current\": %d, \"min\": %d, \"max\": %d, "
+           "\"channel\": %u, \"connected\": %s, \"samples\": %u}",
+           stats.connected ? stats.averageRssi : 0,
+           stats.connected ? stats.rssi : 0, stats.minRssi, stats.maxRssi,
+           stats.channel, stats.connected ? "true" : "false",
+           (unsigned)stats.samples);
   request->send(200, MIMETYPE_JSON, _rssiBuffer);
 }
 
+/**
+ * @brief Dump of the frame trace ring, open it in ui.perfetto.dev
+ * @details The records are copied out once and then formatted chunk by chunk,
+ * the whole JSON never sits in RAM
+ */
+void BaseAPI::frameTrace(HttpRequest* request) {
+  FrameTracer::Export trace(frameTracer);
+  request->addHeader("Content-Disposition",
+                     "attachment; filename=\"openiris-trace.json\"");
+  HttpResponseStream response(*request, MIMETYPE_JSON);
+  uint8_t buffer[256];
+  size_t len;
+  while ((len = trace.read(buffer, sizeof(buffer))))
+    response.write(buffer, len);
+}
+
+/**
+ * @brief CPU per task and core and the stack high-water marks
+ * @details The profiler starts with the first request, the CPU shares follow
+ * once it has a second sample
+ */
+void BaseAPI::profile(HttpRequest* request) {
+  HttpResponseStream response(*request, MIMETYPE_JSON);
+  profiler.writeJson(response);
+}
+
+void BaseAPI::setIREmitter(HttpRequest* request) {
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET:
+    case POST: {
+      // start from the current settings, so that only the fields that were
+      // sent get changed
+      ProjectConfig::IREmitterConfig_t emitterConfig =
+          projectConfig.getIREmitterConfig();
+
+      using IREmitterConfig_t = ProjectConfig::IREmitterConfig_t;
+      static constexpr ParamSchema::Field_t schema[] = {
+          ParamSchema::number("mode", ParamSchema::Param_UInt8,
+                              offsetof(IREmitterConfig_t, mode), 0, 1),
+          ParamSchema::number("intensity", ParamSchema::Param_UInt8,
+                              offsetof(IREmitterConfig_t, intensity), 0, 100),
+          ParamSchema::number("duty", ParamSchema::Param_UInt8,
+                              offsetof(IREmitterConfig_t, duty), 1, 100),
+      };
+      if (!parseParams(request, schema, &emitterConfig))
+        return;
+
+      projectConfig.setIREmitterConfig(emitterConfig.mode,
+                                       emitterConfig.intensity,
+                                       emitterConfig.duty, true);
+      projectConfig.irEmitterConfigSave();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. IR Emitter has been set.\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Declare or change a haptic channel
+ * @details POST updates the channel at "index", or adds one when the index is
+ * one past the last channel. Only the fields that were sent get changed.
+ * DELETE removes the channel at "index". Changes apply right away and are
+ * stored.
+ */
+void BaseAPI::setHaptics(HttpRequest* request) {
+  struct HapticParams_t {
+    int32_t index;
+    int8_t pin;
+    char name[16];
+    uint32_t frequency;
+    uint8_t resolution;
+    uint8_t curve;
+  };
+  static constexpr ParamSchema::Field_t schema[] = {
+      ParamSchema::number("index", ParamSchema::Param_Int32,
+                          offsetof(HapticParams_t, index), 0,
+                          ProjectConfig::maxHapticChannels - 1,
+                          ParamSchema::Param_Required),
+      ParamSchema::number("pin", ParamSchema::Param_Int8,
+                          offsetof(HapticParams_t, pin), -1, 48),
+      ParamSchema::text("name", offsetof(HapticParams_t, name),
+                        sizeof(HapticParams_t::name)),
+      ParamSchema::number("frequency", ParamSchema::Param_UInt32,
+                          offsetof(HapticParams_t, frequency), 1, 40000000),
+      ParamSchema::number("resolution", ParamSchema::Param_UInt8,
+                          offsetof(HapticParams_t, resolution), 1, 20),
+      ParamSchema::number("curve", ParamSchema::Param_UInt8,
+                          offsetof(HapticParams_t, curve), 0,
+                          ProjectConfig::HapticCurve_SquareRoot),
+  };
+
+  // the index picks the channel the other fields default to, so it has to be
+  // known before the rest gets parsed
+  auto& haptics = projectConfig.getHapticsConfig();
+  int64_t index = -1;
+  ParamSchema::parseInteger(findParam(request, "index"), index);
+
+  HapticParams_t params = {};
+  if (index >= 0 && index < haptics.size()) {
+    params.pin = haptics[index].pin;
+    strlcpy(params.name, haptics[index].name.c_str(), sizeof(params.name));
+    params.frequency = haptics[index].frequency;
+    params.resolution = haptics[index].resolution;
+    params.curve = haptics[index].curve;
+  } else {
+    params.pin = -1;
+    strlcpy(params.name, "none", sizeof(params.name));
+    params.frequency = 20000;
+    params.resolution = 10;
+    params.curve = ProjectConfig::HapticCurve_Linear;
+  }
+
+  if (!parseParams(request, schema, &params))
+    return;
+
+  if ((size_t)params.index > haptics.size()) {
+    request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid index\"}");
+    return;
+  }
+
+  switch (_networkMethodsMap_enum[request->method()]) {
+    case GET:
+    case POST: {
+      if (!projectConfig.setHapticChannelConfig(
+              params.index, params.pin, params.name, params.frequency,
+              params.resolution, params.curve, true)) {
+        request->send(400, MIMETYPE_JSON,
+                      "{\"msg\":\"No room for another haptic channel\"}");
+        return;
+      }
+      projectConfig.hapticsConfigSave();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Haptic channel has been set.\"}");
+      break;
+    }
+    case DELETE: {
+      // one past the end is only there to add a channel
+      if ((size_t)params.index >= haptics.size()) {
+        request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid index\"}");
+        return;
+      }
+      projectConfig.deleteHapticChannelConfig(params.index, true);
+      projectConfig.hapticsConfigSave();
+      request->send(200, MIMETYPE_JSON,
+                    "{\"msg\":\"Done. Haptic channel has been deleted.\"}");
+      break;
+    }
+    default: {
+      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Request\"}");
+      break;
+    }
+  }
+}
+
 //*********************************************************************************************
 //!                                     OTA Command Functions
 //*********************************************************************************************
 
-void BaseAPI::checkAuthentication(AsyncWebServerRequest* request,
+namespace {
+  //! "Basic " and base64 of "login:password", both at most 64 characters
+  constexpr size_t MAX_AUTHORIZATION = 6 + 176;
+
+  /**
+   * @brief Hands the file part of an upload to the OTAWriter
+   * @details The MD5 and SHA256 fields come ahead of the file, the web UI
+   * appends them first. Parts after the first file are ignored.
+   */
+  class UploadParts : public HttpForm::MultipartReader::Handler {
+   public:
+    explicit UploadParts(OTAWriter& writer) : writer(writer) {}
+
+    bool onPart(const HttpForm::MultipartReader::Part_t& part) override {
+      this->field = nullptr;
+      this->fieldLength = 0;
+      if (!part.filename[0]) {
+        if (!strcmp(part.name, "MD5")) {
+          this->field = this->md5;
+          this->fieldSize = sizeof(this->md5);
+        } else if (!strcmp(part.name, "SHA256")) {
+          this->field = this->sha256;
+          this->fieldSize = sizeof(this->sha256);
+        }
+        return true;
+      }
+      if (this->started)
+        return true;
+      this->started = this->inFile = true;
+      // the MD5 covers the upload as sent, the SHA256 the image once it has
+      // been inflated
+      int command = !strcmp(part.filename, "filesystem") ? U_SPIFFS : U_FLASH;
+      return this->writer.begin(command, this->md5, this->sha256);
+    }
+
+    bool onData(const uint8_t* data, size_t len) override {
+      if (this->inFile)
+        return this->writer.write(data, len);
+      if (!this->field)
+        return true;
+      // an overlong value is cut short and fails the digest check
+      size_t room = this->fieldSize - 1 - this->fieldLength;
+      len = std::min(len, room);
+      memcpy(this->field + this->fieldLength, data, len);
+      this->fieldLength += len;
+      this->field[this->fieldLength] = '\0';
+      return true;
+    }
+
+    bool onPartEnd() override {
+      this->field = nullptr;
+      if (!this->inFile)
+        return true;
+      this->inFile = false;
+      this->finished = this->writer.end();
+      return this->finished;
+    }
+
+    //! the image has been written and checked
+    bool finished = false;
+
+   private:
+    OTAWriter& writer;
+    char md5[33] = {};
+    char sha256[65] = {};
+    char* field = nullptr;
+    size_t fieldSize = 0;
+    size_t fieldLength = 0;
+    bool started = false;
+    bool inFile = false;
+  };
+}  // namespace
+
+bool BaseAPI::checkAuthentication(HttpRequest* request,
                                   const char* login,
                                   const char* password) {
-  log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-  if (_authRequired) {
-    log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-    log_i("Auth required");
-    log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-    if (!request->authenticate(login, password, NULL, false)) {
-      log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-      return request->requestAuthentication(NULL, false);
-    }
+  if (!_authRequired)
+    return true;
+
+  char expected[MAX_AUTHORIZATION];
+  char credentials[130];
+  int credentialsLength =
+      snprintf(credentials, sizeof(credentials), "%s:%s", login, password);
+  size_t encodedLength = 0;
+  memcpy(expected, "Basic ", 6);
+  bool valid =
+      credentialsLength > 0 && (size_t)credentialsLength < sizeof(credentials) &&
+      mbedtls_base64_encode((unsigned char*)expected + 6,
+                            sizeof(expected) - 6, &encodedLength,
+                            (const unsigned char*)credentials,
+                            credentialsLength) == 0;
+
+  char authorization[MAX_AUTHORIZATION];
+  if (valid && request->header("Authorization", authorization,
+                               sizeof(authorization)) &&
+      !strcmp(authorization, expected))
+    return true;
+
+  log_i("Auth required");
+  request->addHeader("WWW-Authenticate", "Basic realm=\"OpenIris\"");
+  request->send(401);
+  return false;
+}
+
+/**
+ * @brief Send a precompressed asset straight from flash
+ * @details The page lives at a fixed url, so browsers keep their copy but
+ * revalidate it, which costs a 304 instead of the whole page once it's cached
+ */
+void BaseAPI::sendWebAsset(HttpRequest* request, const WebAsset_t& asset) {
+  request->addHeader("ETag", asset.etag);
+  request->addHeader("Cache-Control", "no-cache");
+
+  char etag[16];
+  if (request->header("If-None-Match", etag, sizeof(etag)) &&
+      !strcmp(etag, asset.etag)) {
+    request->send(304);
+    return;
   }
+
+  request->addHeader("Content-Encoding", "gzip");
+  request->addHeader("Vary", "Accept-Encoding");
+  request->send(200, asset.contentType, (const char*)asset.data, asset.size);
 }
 
-void BaseAPI::beginOTA() {
+void BaseAPI::beginOTA(HttpServer& httpServer) {
   // NOTE: Code adapted from: https://github.com/ayushsharma82/AsyncElegantOTA/
 
-  auto device_config = projectConfig.getDeviceConfig();
-  auto mdns_config = projectConfig.getMDNSConfig();
+  auto& device_config = projectConfig.getDeviceConfig();
+  auto& mdns_config = projectConfig.getMDNSConfig();
 
   if (device_config.OTAPassword.empty()) {
     log_e(
@@ -350,95 +789,90 @@ void BaseAPI::beginOTA() {
   }
 
   log_i("[OTA Server]: Initializing OTA Server");
-  log_i(
-      "[OTA Server]: Navigate to http://%s.local:81/update to update the "
-      "firmware",
-      mdns_config.hostname.c_str());
-
+  log_i("[OTA Server]: Navigate to http://%s.local/update to update the "
+        "firmware",
+        mdns_config.hostname.c_str());
   log_d("[OTA Server]: Username: %s, Password: %s",
         device_config.OTALogin.c_str(), device_config.OTAPassword.c_str());
-  log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-  const char* login = device_config.OTALogin.c_str();
-  const char* password = device_config.OTAPassword.c_str();
-  log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-
-  // Note: HTTP_GET
-  server.on(
-      "/update/identity", 0b00000001, [&](AsyncWebServerRequest* request) {
-        checkAuthentication(request, login, password);
-
-        String _id = String((uint32_t)ESP.getEfuseMac(), HEX);
-        _id.toUpperCase();
-        request->send(200, "application/json",
-                      "{\"id\": \"" + _id + "\", \"hardware\": \"ESP32\"}");
-      });
-
-  server.on("/update", 0b00000001, [&](AsyncWebServerRequest* request) {
-    log_d("[DEBUG] Free Heap: %d", ESP.getFreeHeap());
-    checkAuthentication(request, login, password);
-
-    // turn off the camera and stop the stream
-    esp_camera_deinit();                // deinitialize the camera driver
-    digitalWrite(PWDN_GPIO_NUM, HIGH);  // turn power off to camera module
-
-    AsyncWebServerResponse* response = request->beginResponse_P(
-        200, "text/html", ELEGANT_HTML, ELEGANT_HTML_SIZE);
-    response->addHeader("Content-Encoding", "gzip");
-    request->send(response);
-  });
-
-  // HTTP_POST
-  server.on(
-      "/update", 0b00000010,
-      [&](AsyncWebServerRequest* request) {
-        checkAuthentication(request, login, password);
-        // the request handler is triggered after the upload has finished...
-        // create the response, add header, and send response
-        AsyncWebServerResponse* response = request->beginResponse(
-            (Update.hasError()) ? 500 : 200, "text/plain",
-            (Update.hasError()) ? "FAIL" : "OK");
-        response->addHeader("Connection", "close");
-        response->addHeader("Access-Control-Allow-Origin", "*");
-        request->send(response);
-        this->save(request);
-      },
-      [&](AsyncWebServerRequest* request, String filename, size_t index,
-          uint8_t* data, size_t len, bool final) {
-        // Upload handler chunks in data
-        checkAuthentication(request, login, password);
-
-        if (!index) {
-          if (!request->hasParam("MD5", true)) {
-            return request->send(400, "text/plain", "MD5 parameter missing");
-          }
-
-          if (!Update.setMD5(request->getParam("MD5", true)->value().c_str())) {
-            return request->send(400, "text/plain", "MD5 parameter invalid");
-          }
-          int cmd = (filename == "filesystem") ? U_SPIFFS : U_FLASH;
-          if (!Update.begin(UPDATE_SIZE_UNKNOWN,
-                            cmd)) {  // Start with max available size
-            Update.printError(Serial);
-            return request->send(400, "text/plain", "OTA could not begin");
-          }
-        }
 
-        // Write chunked data to the free sketch space
-        if (len) {
-          if (Update.write(data, len) != len) {
-            return request->send(400, "text/plain", "OTA could not begin");
-          }
-        }
+  static const HttpServer::Route_t routes[] = {
+      {"", HTTP_GET, &HttpRequest::bind<BaseAPI, &BaseAPI::updatePage>},
+      {"", HTTP_POST, &BaseAPI::upload_handler},
+      {"/identity", HTTP_GET,
+       &HttpRequest::bind<BaseAPI, &BaseAPI::updateIdentity>},
+  };
+  httpServer.addGroup("/update", routes, this);
+}
 
-        if (final) {  // if the final flag is set then this is the last frame of
-                      // data
-          if (!Update.end(
-                  true)) {  // true to set the size to the current progress
-            Update.printError(Serial);
-            return request->send(400, "text/plain", "Could not end OTA");
-          }
-        } else {
-          return;
-        }
-      });
+void BaseAPI::updateIdentity(HttpRequest* request) {
+  auto& device_config = projectConfig.getDeviceConfig();
+  if (!checkAuthentication(request, device_config.OTALogin.c_str(),
+                           device_config.OTAPassword.c_str()))
+    return;
+
+  char identity[64];
+  snprintf(identity, sizeof(identity),
+           "{\"id\": \"%X\", \"hardware\": \"ESP32\"}",
+           (uint32_t)ESP.getEfuseMac());
+  request->send(200, MIMETYPE_JSON, identity);
+}
+
+void BaseAPI::updatePage(HttpRequest* request) {
+  auto& device_config = projectConfig.getDeviceConfig();
+  if (!checkAuthentication(request, device_config.OTALogin.c_str(),
+                           device_config.OTAPassword.c_str()))
+    return;
+
+  // turn off the camera and stop the stream
+  esp_camera_deinit();                // deinitialize the camera driver
+  digitalWrite(PWDN_GPIO_NUM, HIGH);  // turn power off to camera module
+
+  sendWebAsset(request, WEB_ASSET_UPDATE);
+}
+
+esp_err_t BaseAPI::upload_handler(httpd_req_t* req) {
+  HttpRequest request(req);
+  return static_cast<BaseAPI*>(req->user_ctx)->upload(&request);
+}
+
+/**
+ * @details Runs on the server task until the whole image is in, the other
+ * routes wait meanwhile. A failed upload is answered right away and the
+ * connection closed instead of reading the rest of the image.
+ */
+esp_err_t BaseAPI::upload(HttpRequest* request) {
+  auto& device_config = projectConfig.getDeviceConfig();
+  if (!checkAuthentication(request, device_config.OTALogin.c_str(),
+                           device_config.OTAPassword.c_str()))
+    return ESP_OK;
+
+  char contentType[128];
+  Helpers::string_view boundary;
+  if (request->header("Content-Type", contentType, sizeof(contentType)))
+    boundary = HttpForm::boundary(contentType);
+  UploadParts parts(otaWriter);
+  HttpForm::MultipartReader reader(boundary, parts);
+
+  char chunk[1024];
+  size_t remaining = request->contentLength();
+  bool ok = true;
+  while (ok && remaining) {
+    size_t len = std::min(remaining, sizeof(chunk));
+    ok = request->readBody(chunk, len) &&
+         reader.feed((const uint8_t*)chunk, len);
+    remaining -= len;
+  }
+
+  request->addHeader("Connection", "close");
+  if (!ok || !reader.done() || !parts.finished) {
+    otaFailed.add();
+    const char* error = otaWriter.getError();
+    request->send(400, "text/plain", error ? error : "Malformed upload");
+    return remaining ? ESP_FAIL : ESP_OK;
+  }
+
+  otaSucceeded.add();
+  request->send(200, "text/plain", "OK");
+  projectConfig.save();
+  return ESP_OK;
 }
@@ -1,76 +1,113 @@
 #ifndef BASEAPI_HPP
 #define BASEAPI_HPP
 
-//! Warning do not format this file with clang-format or it will break the code
-
+#include <memory>
 #include <string>
 #include <unordered_map>
 
 #include <stdlib_noniso.h>
 
-#define WEBSERVER_H
-
-// hack, we have to include it JUST so the macro executes and defines HTTP_*
-// methods cause it's beging included later in streamServer.hpp, but then the
-// macro executes too late and tries to redefine the methods, failing. but if we
-// don't include it here, then ESPAsyncWebServer fails to compile due to
-// WEBSERVER_H which has to be set because if it isn't, ESPAsyncWebServer will
-// define the methods and thus the circus continues
-#include <http_parser.h>
-
-constexpr int HTTP_ANY = 0b01111111;
-
 #include <Update.h>
 #include <esp_int_wdt.h>
 #include <esp_task_wdt.h>
+#include <mbedtls/base64.h>
 
-#include <AsyncTCP.h>
-#include <ESPAsyncWebServer.h>
-#include <FS.h>
 #include "Hash.h"
+#include "data/FrameTrace/FrameTrace.hpp"
+#include "data/Metrics/Metrics.hpp"
 #include "data/StateManager/StateManager.hpp"
+#include "data/config/config_serializer.hpp"
 #include "data/config/project_config.hpp"
 #include "data/utilities/network_utilities.hpp"
-#include "elegantWebpage.h"
 #include "io/camera/cameraHandler.hpp"
+#include "network/HttpServer/HttpRequest.hpp"
+#include "network/HttpServer/HttpServer.hpp"
+#include "network/OTAWriter/OTAWriter.hpp"
+#include "network/WiFiMonitor/WiFiMonitor.hpp"
+#include "network/api/paramSchema/paramSchema.hpp"
 #include "tasks/tasks.hpp"
+#include "webAssets.h"
 
 class BaseAPI {
  protected:
   std::string api_url;
-  bool _authRequired;
+  bool _authRequired = false;
 
   static const char* MIMETYPE_HTML;
   static const char* MIMETYPE_JSON;
+  //! larger config documents are refused, ours is well below 2KB
+  static constexpr size_t MAX_CONFIG_BODY_SIZE = 4096;
 
  protected:
   /* Commands */
-  void setWiFi(AsyncWebServerRequest* request);
-  void setWiFiTXPower(AsyncWebServerRequest* request);
-  void getJsonConfig(AsyncWebServerRequest* request);
-  void factoryReset(AsyncWebServerRequest* request);
-  void setDeviceConfig(AsyncWebServerRequest* request);
-  void rebootDevice(AsyncWebServerRequest* request);
-  void ping(AsyncWebServerRequest* request);
-  void save(AsyncWebServerRequest* request);
-  void rssi(AsyncWebServerRequest* request);
+  void setWiFi(HttpRequest* request);
+  void setWiFiTXPower(HttpRequest* request);
+  void getJsonConfig(HttpRequest* request);
+  void factoryReset(HttpRequest* request);
+  void setDeviceConfig(HttpRequest* request);
+  void rebootDevice(HttpRequest* request);
+  void ping(HttpRequest* request);
+  void save(HttpRequest* request);
+  void rssi(HttpRequest* request);
+  void setIREmitter(HttpRequest* request);
+  void setHaptics(HttpRequest* request);
+  void profile(HttpRequest* request);
+
+  //! every registered metric in the Prometheus text format
+  void metrics(HttpRequest* request);
+  //! the recent frames as Chrome trace-event JSON
+  void frameTrace(HttpRequest* request);
+
+  //! answers the CORS preflight for every route
+  void preflight(HttpRequest* request);
+
+  /* Config Resource */
+  void configResource(HttpRequest* request);
+  void sendConfig(HttpRequest* request);
 
   /* Camera Handlers */
-  void setCamera(AsyncWebServerRequest* request);
-  void restartCamera(AsyncWebServerRequest* request);
+  void setCamera(HttpRequest* request);
+  void restartCamera(HttpRequest* request);
+
+  /* Parameter parsing */
+  /**
+   * @brief Parse the request parameters into out according to schema
+   * @details Sends a 400 describing the offending parameter and returns false
+   * if anything does not fit the schema. Fields that were not sent keep the
+   * value out already had.
+   */
+  template <size_t N>
+  bool parseParams(HttpRequest* request,
+                   const ParamSchema::Field_t (&schema)[N],
+                   void* out) const {
+    static_assert(N <= ParamSchema::MAX_FIELDS, "Too many parameters");
+    uint32_t present = 0;
+    int params = request->params();
+    for (int i = 0; i < params; i++) {
+      const HttpForm::Param_t& param = request->getParam(i);
+      ParamSchema::Result_t result = ParamSchema::apply(
+          schema, N, param.name, param.value, out, present);
+      if (result.error != ParamSchema::Param_Ok) {
+        sendParamError(request, result);
+        return false;
+      }
+    }
+
+    ParamSchema::Result_t result =
+        ParamSchema::checkRequired(schema, N, present);
+    if (result.error != ParamSchema::Param_Ok) {
+      sendParamError(request, result);
+      return false;
+    }
+    return true;
+  }
+  void sendParamError(HttpRequest* request,
+                      const ParamSchema::Result_t& result) const;
+  Helpers::string_view findParam(HttpRequest* request,
+                                 const char* name) const;
 
   /* Route Command types */
-  using route_method = void (BaseAPI::*)(AsyncWebServerRequest*);
-  typedef std::unordered_map<std::string, route_method> route_t;
-  typedef std::unordered_map<std::string, route_t> route_map_t;
-
-  route_t routes;
-  route_map_t route_map;
-
-  std::unordered_map<int, std::string> _networkMethodsMap = {
-      {0b00000001, "GET"},    {0b00000010, "POST"},  {0b00001000, "PUT"},
-      {0b00000100, "DELETE"}, {0b00010000, "PATCH"}, {0b01000000, "OPTIONS"},
-  };
+  using route_method = void (BaseAPI::*)(HttpRequest*);
 
   enum RequestMethods {
     GET,
@@ -82,17 +119,13 @@ class BaseAPI {
   };
 
   std::unordered_map<int, RequestMethods> _networkMethodsMap_enum = {
-      {0b00000001, GET},    {0b00000010, POST},  {0b00001000, PUT},
-      {0b00000100, DELETE}, {0b00010000, PATCH}, {0b01000000, OPTIONS},
+      {HTTP_GET, GET},       {HTTP_POST, POST},   {HTTP_PUT, PUT},
+      {HTTP_DELETE, DELETE}, {HTTP_PATCH, PATCH}, {HTTP_OPTIONS, OPTIONS},
   };
 
-  typedef std::unordered_map<std::string, WebRequestMethodComposite>
-      networkMethodsMap_t;
-
   ProjectConfig& projectConfig;
-  /// @brief Local instance of the AsyncWebServer - so that we dont need to use
-  /// new and delete
-  AsyncWebServer server;
+  //! one upload at a time, the server task feeds it chunk by chunk
+  OTAWriter otaWriter;
 #ifndef SIM_ENABLED
   CameraHandler& camera;
 #endif  // SIM_ENABLED
@@ -102,21 +135,25 @@ class BaseAPI {
 #ifndef SIM_ENABLED
           CameraHandler& camera,
 #endif  // SIM_ENABLED
-          const std::string& api_url,
-#ifndef SIM_ENABLED
-          int port = 81
-#else
-          int port = 80
-#endif
-  );
+          const std::string& api_url);
 
   virtual ~BaseAPI();
-  virtual void begin();
-  void checkAuthentication(AsyncWebServerRequest* request,
+  virtual void begin(HttpServer& httpServer);
+  //! false if the request has been turned away
+  bool checkAuthentication(HttpRequest* request,
                            const char* login,
                            const char* password);
-  void beginOTA();
-  void notFound(AsyncWebServerRequest* request) const;
+  void beginOTA(HttpServer& httpServer);
+  void sendWebAsset(HttpRequest* request, const WebAsset_t& asset);
+  static esp_err_t notFound(httpd_req_t* req, httpd_err_code_t error);
+
+ private:
+  /* OTA */
+  void updateIdentity(HttpRequest* request);
+  void updatePage(HttpRequest* request);
+  //! takes the multipart upload apart as it arrives
+  static esp_err_t upload_handler(httpd_req_t* req);
+  esp_err_t upload(HttpRequest* request);
 };
 
 #endif  // BASEAPI_HPP
@@ -0,0 +1,1890 @@
+// Generated by tools/webassets.py from the files in webui/, do not edit.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset_t {
+  const char* url;
+  const char* contentType;
+  //! gzip compressed
+  const uint8_t* data;
+  size_t size;
+  //! quoted strong validator, a hash of the compressed bytes
+  const char* etag;
+};
+
+const uint8_t WEB_ASSET_UPDATE_DATA[] PROGMEM = {
+31,139,8,0,0,0,0,0,2,3,188,189,89,119,219,198,182,48,248,126,126,133,136,235,230,1,142,74,148,228,
+36,62,9,104,152,109,203,82,236,196,83,108,217,78,162,232,106,65,100,145,132,5,2,12,0,82,146,69,246,111,
+239,61,212,4,16,148,243,245,67,103,197,34,80,168,121,216,181,231,253,175,199,157,231,111,143,78,255,120,119,188,
+51,173,102,233,147,127,61,198,159,157,52,206,38,145,204,158,252,11,222,101,60,122,242,175,29,248,239,241,76,86,
+241,206,112,26,23,165,172,162,69,53,222,251,209,253,48,173,170,249,158,252,123,145,44,163,223,247,62,62,221,59,
+202,103,243,184,74,46,83,185,51,204,179,74,102,85,228,189,60,142,228,104,34,61,183,92,22,207,100,180,76,228,
+245,60,47,42,155,245,58,25,85,211,104,36,151,201,80,238,209,139,72,178,164,74,226,116,175,28,198,169,140,14,
+117,45,105,146,93,237,20,50,141,18,40,188,51,45,228,56,218,31,199,75,124,235,193,159,39,59,143,171,164,74,
+229,147,227,84,78,226,172,122,123,250,244,241,62,167,112,249,114,88,36,243,106,103,20,87,241,30,117,198,123,246,
+250,104,239,115,2,29,173,188,157,184,188,205,134,59,101,49,140,60,28,97,25,238,239,15,71,217,151,178,119,185,
+184,157,201,120,152,143,199,82,246,134,249,108,255,176,119,208,59,216,191,166,114,189,121,145,143,122,179,36,235,125,
+41,61,174,58,25,69,222,163,223,126,254,52,255,240,69,165,140,36,55,157,228,89,228,125,88,204,105,2,102,114,
+7,70,241,108,113,139,79,48,221,84,127,71,149,152,201,178,140,39,208,195,63,242,197,206,48,206,118,226,244,58,
+190,45,119,74,93,248,118,231,58,47,174,118,46,111,119,160,123,73,54,105,171,100,152,167,121,17,121,255,115,114,
+242,227,225,119,39,42,113,158,151,9,119,164,72,38,211,74,165,222,92,204,226,98,146,64,234,195,239,85,210,173,
+155,244,228,241,62,15,1,54,206,62,239,148,127,61,190,204,71,183,59,101,117,11,107,228,229,75,89,140,211,252,
+58,220,153,38,163,145,204,250,122,209,178,92,23,220,81,255,61,46,171,34,207,38,79,62,203,127,23,114,167,204,
+139,2,7,81,237,216,101,219,25,229,178,204,254,93,241,24,97,134,231,178,72,97,196,73,53,205,33,227,47,241,
+50,254,192,107,41,179,24,246,221,168,183,243,46,149,113,41,213,251,78,82,237,84,57,109,177,36,91,200,30,116,
+158,155,228,46,237,215,251,244,120,148,44,119,96,209,226,249,28,134,9,47,141,237,34,199,178,120,226,143,23,217,
+16,231,205,175,130,187,101,92,236,200,232,110,221,215,137,59,133,159,5,119,201,216,151,103,217,121,80,200,106,81,
+100,59,248,220,147,55,184,94,101,31,139,228,17,38,69,119,73,152,137,52,236,28,10,245,49,188,91,175,251,170,
+80,133,133,96,219,167,126,174,203,138,92,216,231,34,128,151,52,234,28,216,180,117,209,155,69,149,40,122,195,72,
+194,223,81,100,187,42,164,128,126,21,189,28,31,131,213,234,237,229,23,57,172,122,48,164,36,147,239,104,94,171,
+91,202,118,39,179,197,76,22,56,123,33,84,14,59,59,204,214,193,26,234,43,34,119,232,222,34,227,210,35,175,
+19,69,213,237,92,230,227,157,15,183,179,203,60,237,118,249,183,87,229,31,170,2,246,228,105,60,233,118,183,53,
+185,153,87,192,188,166,11,25,122,175,243,209,34,149,222,58,16,219,10,123,23,23,178,84,217,116,177,206,1,247,
+183,170,141,159,86,229,176,43,187,93,191,138,10,24,65,32,126,236,74,189,68,85,31,190,126,143,95,189,156,154,
+242,34,51,168,170,219,197,255,123,182,41,91,10,87,51,139,84,239,134,133,140,43,233,103,139,52,13,176,62,152,
+50,216,13,91,250,158,9,15,82,226,69,90,121,205,57,231,97,84,48,236,135,212,163,146,38,6,166,89,119,40,
+24,231,133,79,27,105,39,129,94,4,176,214,80,95,46,204,120,97,180,102,27,201,243,117,239,50,201,70,212,47,
+145,7,129,222,97,25,78,82,22,109,238,231,198,104,7,38,135,83,171,233,252,249,58,108,249,110,182,49,118,77,
+10,47,246,96,5,132,196,22,243,198,178,168,140,106,150,224,140,87,57,142,179,55,141,203,183,215,153,158,47,62,
+10,88,0,235,152,71,222,190,39,10,152,225,50,58,8,214,129,127,119,16,214,54,123,17,220,85,250,88,192,106,
+123,63,60,26,253,215,131,162,222,193,129,148,222,70,94,94,70,200,119,249,232,225,67,15,78,86,148,249,158,179,
+35,33,41,193,99,158,156,229,231,145,247,213,19,182,114,239,140,55,204,206,215,115,220,51,92,196,79,168,173,239,
+30,61,186,167,173,195,225,193,165,23,244,109,85,205,156,176,133,112,85,196,50,79,70,59,7,80,185,179,241,74,
+128,129,195,169,15,185,134,8,238,14,66,245,165,101,45,120,234,96,226,250,148,245,112,35,107,177,145,23,90,87,
+185,31,110,230,38,72,210,204,15,137,170,196,119,109,37,96,223,181,149,129,228,245,250,158,158,3,36,78,111,33,
+43,220,63,112,64,178,170,132,236,56,177,63,252,240,253,61,19,251,211,163,248,123,152,88,125,110,236,73,206,224,
+240,103,209,217,89,213,75,160,109,207,59,63,15,68,214,75,115,232,80,137,112,193,172,132,78,12,20,184,134,74,
+191,255,233,39,233,5,61,181,237,251,57,172,223,127,31,29,30,254,248,221,143,30,212,5,167,246,174,204,23,197,
+80,190,142,231,8,209,203,105,60,202,175,225,0,193,137,62,92,211,110,248,225,191,227,123,58,61,30,62,138,105,
+231,193,243,195,239,15,135,208,214,152,54,157,129,140,34,142,44,112,82,35,186,134,131,157,95,119,187,250,87,157,
+34,128,218,206,217,121,3,40,78,57,216,254,201,231,210,65,120,118,46,202,26,60,168,138,91,189,24,112,115,4,
+235,97,140,155,206,30,218,184,87,166,128,173,249,176,44,118,31,247,198,181,58,116,86,0,100,250,168,124,166,246,
+240,188,36,234,92,7,131,18,254,132,57,109,248,128,214,248,209,240,190,233,250,241,187,248,82,79,215,232,80,254,
+151,78,40,30,244,225,35,152,58,152,42,59,165,4,0,134,7,223,195,242,137,33,229,57,252,238,7,120,78,241,
+249,96,56,198,122,22,81,235,244,60,87,248,90,94,244,37,12,43,27,44,194,141,59,165,138,98,60,164,50,42,
+97,163,118,14,160,222,192,153,182,5,195,44,158,56,24,192,26,74,12,41,77,159,229,196,239,228,189,177,133,111,
+2,65,54,79,1,246,237,31,78,193,193,119,63,233,41,24,14,15,31,214,224,74,7,246,125,39,247,253,205,19,
+246,223,78,212,126,59,37,80,101,178,132,26,17,114,223,33,18,208,82,120,189,14,122,241,58,192,205,125,248,83,
+28,123,141,185,185,23,176,117,252,10,238,174,178,138,179,33,238,99,152,142,106,90,228,215,59,167,176,175,143,139,
+2,238,55,239,101,54,4,148,16,247,139,183,235,23,131,98,215,219,241,66,207,11,118,189,36,91,194,241,196,26,
+61,115,155,85,56,99,135,151,242,62,192,48,58,0,128,236,206,12,64,249,81,62,36,208,226,9,243,8,248,39,
+165,208,192,16,72,255,131,129,209,160,60,253,238,222,213,205,113,169,27,162,130,113,236,36,229,78,150,87,128,175,
+155,130,141,241,12,255,251,79,111,171,164,2,4,2,54,42,237,130,206,97,31,247,32,102,140,163,3,56,1,119,
+153,188,105,89,195,187,81,158,1,128,234,196,187,187,208,28,167,185,185,160,166,3,56,218,37,94,123,45,240,121,
+154,148,107,241,180,40,226,219,222,184,200,103,126,41,220,61,198,3,127,136,27,132,183,255,16,182,127,251,166,224,
+45,1,184,78,39,81,199,2,70,128,189,47,220,161,100,120,5,103,173,125,185,119,124,5,141,2,6,88,1,58,
+230,244,69,163,40,60,211,163,225,61,51,253,221,247,15,199,181,157,179,239,39,243,41,84,190,74,230,249,8,254,
+196,163,160,247,31,188,174,228,181,188,188,74,170,253,164,87,201,146,26,132,202,71,63,30,252,227,77,164,111,251,
+205,157,227,29,197,72,11,33,164,0,42,15,72,160,17,18,142,222,110,213,216,52,64,118,221,123,8,8,84,228,
+206,6,34,176,241,112,116,112,64,144,19,174,182,114,46,135,137,44,183,96,39,102,3,36,79,162,31,14,87,171,
+78,86,131,45,140,68,194,93,82,68,72,38,195,33,47,22,67,216,153,184,122,122,202,207,226,182,69,28,231,121,
+120,8,67,56,4,138,66,158,85,231,254,179,60,7,114,46,131,171,48,207,215,116,47,60,124,248,232,209,61,32,
+241,225,15,230,18,149,63,209,51,223,10,7,195,239,245,173,64,88,153,186,21,190,251,33,62,212,183,194,79,151,
+163,17,221,10,141,117,130,77,222,43,171,124,62,151,35,32,174,232,181,144,37,224,0,17,160,179,139,104,27,148,
+19,11,49,230,158,141,196,92,76,197,76,44,197,165,152,136,91,184,46,232,243,224,97,120,72,100,194,56,128,138,
+251,50,45,37,46,255,60,194,155,80,180,128,146,249,230,134,56,5,196,72,86,26,140,16,8,0,26,194,163,106,
+115,127,30,4,119,72,41,76,1,4,204,162,4,240,155,84,102,147,106,26,244,103,79,166,253,233,238,110,128,219,
+45,90,12,128,26,241,39,81,117,54,61,15,206,14,206,197,228,236,240,60,8,129,188,194,4,177,236,118,151,46,
+168,78,245,197,181,52,132,132,188,222,73,253,206,97,176,30,69,115,125,161,175,47,163,81,15,79,101,255,122,154,
+164,18,0,254,36,186,228,143,163,0,240,40,56,59,220,252,208,31,137,91,49,233,17,213,35,22,48,244,38,146,
+131,61,248,63,232,68,127,65,235,213,182,97,85,166,3,81,209,5,251,240,187,225,125,23,108,252,232,167,67,218,
+77,175,227,106,218,155,197,55,176,153,248,49,201,250,219,0,25,67,45,108,212,108,246,199,7,131,220,47,118,165,
+56,8,194,4,176,97,169,26,7,172,229,158,99,26,255,248,189,222,202,132,11,49,62,136,27,245,16,239,119,222,
+204,143,164,188,52,40,142,180,40,142,252,241,167,239,52,138,243,211,247,195,120,43,157,161,58,140,187,85,168,141,
+10,91,186,162,125,37,150,240,56,73,243,203,56,21,151,240,8,179,79,116,242,34,90,14,178,240,114,144,157,205,
+206,87,171,210,159,137,187,117,16,250,252,10,143,150,136,131,229,196,13,56,70,50,149,129,252,28,14,246,248,28,
+232,167,44,231,205,251,179,172,6,176,67,115,31,207,139,24,69,211,110,119,202,123,33,8,71,209,2,51,23,81,
+234,47,7,227,112,182,235,95,14,188,30,32,1,255,3,88,192,24,42,129,202,135,114,20,136,78,1,251,131,224,
+38,64,142,17,163,101,234,208,88,236,127,20,104,62,80,127,232,207,197,40,88,195,137,0,60,125,182,90,141,186,
+221,17,61,6,221,110,2,223,60,124,246,8,155,139,177,99,48,49,21,147,30,132,154,111,95,181,161,179,106,255,
+253,81,225,100,57,66,65,184,118,124,143,207,31,160,26,102,134,96,97,16,179,220,142,156,175,86,109,251,24,26,
+78,120,23,125,223,134,35,122,11,32,196,144,252,129,99,100,121,83,181,29,90,193,33,95,173,60,32,94,224,241,
+187,115,92,215,78,166,79,85,129,175,200,122,48,80,200,78,227,101,149,199,92,9,140,12,249,27,49,144,75,76,
+251,148,112,72,230,190,191,217,97,111,255,63,255,179,195,121,62,190,127,21,121,122,66,116,193,247,121,94,97,103,
+2,253,161,18,222,206,127,246,1,3,51,236,138,179,226,92,127,140,77,182,179,228,60,232,125,201,19,192,127,254,
+2,220,105,109,179,58,137,102,252,185,101,113,224,32,252,69,6,232,125,60,151,190,4,76,115,4,61,123,137,28,
+108,0,76,89,229,255,242,225,237,155,30,19,144,201,248,22,137,146,32,128,141,232,25,34,111,14,95,112,44,200,
+34,13,241,226,79,24,35,221,255,82,230,89,191,198,51,239,95,2,93,252,232,123,97,134,45,245,160,104,94,76,
+114,161,7,221,126,233,234,123,85,195,21,105,40,195,45,184,89,99,53,28,224,36,133,5,79,242,236,225,249,192,
+251,191,103,114,148,196,182,47,152,10,221,185,179,75,2,189,91,123,65,88,192,146,168,217,69,4,89,246,18,23,
+158,16,115,96,147,240,174,136,235,118,118,70,44,168,138,41,111,69,90,35,87,101,12,219,72,179,180,146,232,160,
+159,60,166,238,243,105,233,39,112,81,41,84,22,147,97,205,225,146,234,99,85,157,8,168,74,63,71,100,2,142,
+234,90,87,81,66,21,229,99,125,219,245,75,93,126,8,147,103,54,216,89,9,93,0,194,40,63,27,66,117,112,
+20,124,128,33,254,16,39,3,255,68,94,109,89,226,108,180,99,167,2,51,4,33,101,43,128,242,235,205,23,37,
+98,148,120,32,37,29,202,31,198,7,223,56,148,6,98,40,8,158,59,232,75,226,160,105,4,229,227,209,163,17,
+65,121,195,147,242,0,204,191,151,147,227,155,185,3,108,211,104,8,163,2,156,36,105,161,245,188,253,120,255,18,
+144,137,148,239,96,197,173,8,145,190,27,167,241,164,12,189,75,111,141,231,77,140,33,15,74,69,58,81,217,247,
+23,0,127,0,40,102,254,70,107,117,100,31,199,83,1,60,192,21,66,98,88,83,57,234,128,227,217,1,112,141,
+13,1,192,81,31,13,95,11,102,190,70,13,114,91,64,13,0,69,133,69,128,224,219,25,6,131,88,227,22,97,
+97,15,144,183,43,119,241,111,182,14,196,221,34,43,227,177,230,0,63,124,244,240,209,63,92,4,38,12,121,17,
+126,186,28,27,156,88,225,199,177,67,110,151,48,187,223,196,143,249,168,18,243,174,0,240,63,238,195,62,69,234,
+70,194,250,116,187,133,143,179,119,7,155,105,156,76,22,53,86,251,22,34,107,205,176,254,242,64,126,99,91,213,
+96,239,191,246,255,211,249,215,206,127,118,62,45,100,239,75,185,179,124,216,123,212,59,60,196,20,216,172,59,15,
+15,14,191,223,131,63,63,237,28,47,227,108,231,143,124,129,95,222,75,146,159,140,118,144,189,15,75,58,149,59,
+175,95,158,238,188,74,134,50,43,101,15,178,236,255,139,161,136,186,178,198,133,148,95,165,15,215,126,237,162,49,
+253,55,139,12,0,30,207,44,62,53,64,114,45,39,10,19,96,191,209,233,118,115,38,54,103,231,160,94,73,236,
+124,58,172,127,42,157,59,104,19,42,193,149,147,45,102,151,178,104,36,150,36,146,104,36,94,50,45,226,166,218,
+118,134,238,229,172,250,222,42,75,88,227,228,165,209,6,183,91,31,108,59,137,11,167,235,154,113,198,197,136,209,
+156,26,68,219,148,24,183,148,224,163,180,173,196,200,110,214,57,94,88,39,105,14,224,205,112,40,236,29,241,36,
+58,232,118,9,247,29,167,57,128,89,25,32,59,26,144,165,242,4,101,180,178,86,235,220,153,12,92,224,118,60,
+2,176,204,169,204,182,125,35,42,221,86,57,109,204,47,228,28,120,94,200,188,135,164,164,95,200,178,90,45,168,
+189,202,94,141,48,238,65,243,50,23,116,15,61,12,66,51,82,219,210,172,117,74,236,117,153,148,111,226,55,48,
+254,65,21,74,91,106,201,168,149,190,129,138,54,145,16,98,90,189,18,16,5,64,4,5,65,155,131,126,254,56,
+211,215,84,14,215,84,113,134,236,13,188,205,204,204,15,90,208,191,226,12,7,248,42,191,150,197,17,28,86,63,
+112,133,48,181,108,231,235,245,18,192,85,154,87,98,168,113,27,194,107,9,246,93,70,240,241,74,222,138,66,142,
+5,101,194,63,123,229,16,240,79,145,32,120,51,3,156,88,126,167,166,34,53,34,217,75,0,84,220,188,29,35,
+90,131,82,175,39,123,135,70,78,65,227,29,74,184,67,129,48,163,189,127,27,125,67,210,99,219,188,174,9,136,
+92,17,144,201,114,99,87,171,77,8,215,34,233,96,152,47,1,71,52,148,35,220,253,248,30,193,85,31,168,94,
+94,68,251,123,254,95,215,193,254,68,92,69,55,109,40,45,140,173,144,243,52,134,193,93,56,55,161,219,99,57,
+192,115,253,113,62,215,203,20,122,30,114,49,224,142,125,181,181,82,196,28,159,86,254,65,80,47,186,91,41,86,
+251,33,149,127,29,237,255,245,204,63,123,186,247,231,57,246,241,232,155,125,124,45,188,189,7,64,205,214,247,13,
+162,215,102,46,191,168,61,108,69,217,102,186,140,252,69,111,86,61,117,131,236,201,225,160,77,78,19,58,162,164,
+208,138,160,140,84,240,130,43,138,244,110,18,133,93,212,15,181,89,172,88,122,9,133,177,47,111,163,19,149,205,
+217,64,152,97,240,33,252,98,199,242,148,171,144,145,92,173,14,250,122,163,114,83,123,18,78,34,114,2,24,106,
+0,46,193,28,138,98,111,47,200,104,31,156,1,177,110,183,135,237,216,105,227,148,51,89,91,97,25,119,67,57,
+247,194,27,92,12,157,31,53,5,0,31,128,179,109,145,211,2,78,61,86,208,237,158,34,86,14,79,22,232,218,
+106,142,245,101,79,115,240,114,131,161,174,47,191,181,248,218,198,246,168,28,5,133,7,142,224,194,74,20,59,122,
+146,240,34,131,233,25,170,195,220,41,144,189,167,51,1,158,134,178,4,3,53,173,188,19,114,107,46,109,30,53,
+161,50,224,82,245,36,174,59,135,235,195,2,10,181,31,160,75,234,17,161,184,92,202,226,214,221,217,118,176,60,
+16,156,47,220,196,56,28,23,131,124,14,48,0,80,174,102,146,109,14,144,173,211,100,6,71,128,90,52,111,212,
+175,213,170,193,133,142,53,112,1,88,73,220,185,178,150,96,200,185,157,216,14,163,52,195,136,55,134,81,27,4,
+12,193,140,67,49,167,83,103,69,237,38,120,222,188,99,54,54,18,116,94,87,24,88,82,158,31,246,14,109,77,
+239,44,212,132,17,110,202,95,37,66,68,84,45,209,39,27,145,80,231,112,43,32,121,18,121,164,32,84,202,2,
+6,184,87,72,68,25,229,200,19,31,163,51,207,185,110,188,81,130,98,156,100,41,225,121,156,164,21,32,92,231,
+226,15,200,116,41,97,52,242,136,64,54,124,99,216,13,21,168,15,175,243,5,149,159,225,175,147,254,113,62,226,
+2,11,122,176,31,158,75,212,239,185,197,38,249,137,190,197,216,182,202,55,146,238,155,68,54,234,81,60,135,9,
+160,119,30,201,59,184,14,37,172,3,116,242,125,116,151,147,186,214,107,89,76,36,108,118,40,56,1,204,63,108,
+187,223,75,128,34,89,133,210,95,212,5,91,208,108,158,38,36,14,30,201,101,5,248,99,73,31,101,1,125,157,
+225,182,36,221,31,236,195,11,32,48,83,89,132,132,152,92,199,69,86,75,72,38,25,12,110,164,228,82,37,202,
+105,97,227,29,229,163,45,29,73,202,247,146,134,50,58,141,39,225,75,231,253,105,85,21,148,240,49,187,202,242,
+235,76,85,9,73,120,4,226,9,177,156,230,112,97,132,199,130,208,159,119,105,92,97,111,213,183,240,171,152,45,
+202,234,99,73,162,66,40,70,202,114,72,189,92,164,201,88,14,111,135,169,124,145,231,87,101,248,199,90,60,139,
+246,227,189,175,112,71,253,181,56,56,120,246,95,252,123,116,176,135,63,207,31,209,223,31,233,229,132,94,78,232,
+229,187,255,62,167,191,39,240,114,120,114,114,242,215,226,33,20,218,163,159,231,248,247,187,19,122,249,254,0,255,
+254,23,107,123,120,248,35,102,59,58,160,151,147,99,120,249,238,224,224,16,94,158,255,23,43,56,249,137,190,156,
+60,63,194,151,231,39,244,114,114,242,124,223,194,196,223,236,121,240,171,93,98,67,193,45,140,243,75,55,177,62,
+33,223,61,66,96,177,90,253,244,3,254,218,227,244,179,226,248,103,193,221,61,122,85,172,213,83,8,87,215,167,
+147,137,235,34,169,52,5,216,160,8,215,124,229,189,160,203,138,17,121,223,59,251,95,111,247,153,162,170,119,189,
+222,131,139,191,254,26,157,187,152,218,103,37,71,234,188,96,9,20,160,241,90,175,71,99,159,61,111,19,53,170,
+154,144,69,186,144,133,42,172,20,76,233,87,112,69,34,200,58,95,91,185,19,117,245,147,248,61,242,46,46,232,
+102,190,184,0,178,29,46,188,63,163,86,85,49,214,57,16,191,180,127,253,252,251,113,182,76,138,60,195,221,9,
+183,78,167,150,208,155,171,93,41,254,142,126,233,118,219,191,213,49,29,241,107,244,167,86,147,232,101,241,50,153,
+160,176,180,7,180,115,241,116,130,197,234,185,171,42,250,181,219,221,159,149,137,92,193,13,55,130,28,251,60,157,
+191,6,66,210,199,95,13,222,235,97,182,157,159,122,7,94,240,228,64,20,205,175,168,255,186,79,159,178,42,242,
+235,223,224,148,23,64,246,2,53,128,205,25,145,98,60,82,114,197,188,52,205,2,9,10,175,72,36,253,13,180,
+3,215,180,63,156,22,249,76,254,181,255,215,104,215,246,15,63,204,167,113,86,229,179,47,101,45,249,215,222,140,
+46,152,253,49,64,228,113,126,243,215,190,15,37,131,125,192,40,147,10,117,77,174,241,179,136,43,188,23,96,201,
+255,12,244,173,94,226,231,126,251,246,46,43,225,205,227,178,36,0,223,84,22,192,186,14,214,235,64,168,185,143,
+71,163,227,37,76,231,171,164,172,100,38,11,223,195,254,237,153,242,4,240,74,163,107,114,21,43,164,103,88,181,
+112,57,13,115,225,83,183,235,127,138,58,176,196,29,216,16,173,91,138,120,144,103,200,121,31,202,178,244,206,81,
+177,142,192,61,209,157,206,135,158,204,150,189,79,31,143,47,142,223,124,130,137,249,180,22,105,229,108,158,139,11,
+252,246,252,248,211,233,219,183,175,62,92,252,252,234,237,179,167,175,46,94,188,125,251,235,197,133,67,189,87,14,
+49,222,70,225,194,26,101,49,222,137,59,200,123,86,171,100,233,86,63,224,195,63,174,196,168,138,238,85,182,132,
+166,248,49,216,50,242,247,114,156,194,178,81,78,245,220,3,216,255,43,224,46,0,55,182,213,46,185,0,252,6,
+131,15,245,53,53,163,172,124,45,32,133,51,209,114,19,25,248,80,167,246,90,112,84,230,233,168,170,144,110,21,
+110,25,216,52,117,189,36,155,17,119,87,45,47,220,64,113,17,213,244,16,238,233,160,168,214,62,19,195,243,42,
+58,22,211,10,101,165,213,70,241,100,20,77,171,221,93,22,255,150,139,203,50,58,59,95,247,103,141,62,126,88,
+92,182,116,19,114,51,135,24,54,181,168,21,41,228,44,95,202,102,169,137,111,202,137,141,34,35,57,7,52,203,
+237,223,76,139,235,186,93,243,136,157,121,46,231,204,141,109,212,144,229,85,50,190,141,54,120,183,182,179,74,167,
+171,111,233,150,3,97,201,167,190,124,92,244,37,145,45,242,188,199,24,152,207,141,112,227,17,206,44,77,233,178,
+66,113,133,217,45,151,116,38,150,149,158,13,167,136,67,50,77,112,83,97,166,124,238,187,89,150,213,217,210,144,
+112,135,231,204,76,168,154,82,119,84,131,77,68,44,74,53,251,85,60,209,82,123,196,85,35,201,207,67,160,248,
+70,128,176,70,5,191,87,242,6,250,205,207,50,157,69,57,63,102,101,196,32,70,149,66,83,5,200,152,240,235,
+56,59,82,9,110,166,113,246,150,48,198,178,145,250,1,185,42,47,71,181,84,192,226,144,139,38,241,65,55,161,
+208,102,93,73,220,72,127,169,40,154,90,61,128,170,161,9,133,155,84,196,215,0,196,249,57,41,63,84,0,107,
+134,78,2,74,220,160,42,128,223,132,231,115,226,81,62,195,43,212,201,118,148,66,163,35,39,225,45,54,173,95,
+9,249,59,137,81,185,227,54,42,157,180,215,18,166,218,237,13,80,126,152,254,14,121,17,211,60,5,58,33,66,
+106,245,26,110,21,90,138,176,201,13,95,175,251,215,21,47,19,82,103,219,36,92,27,211,178,110,85,183,6,140,
+221,191,117,14,1,52,204,135,254,166,170,243,237,13,179,154,4,86,128,9,246,21,43,31,48,176,219,202,145,188,
+225,170,87,40,253,178,147,118,32,164,67,103,95,84,13,189,131,219,74,9,60,68,253,199,114,91,237,25,184,170,
+28,41,2,151,197,115,48,1,64,135,187,88,84,102,3,35,149,172,159,245,193,133,207,216,63,84,82,78,103,152,
+151,119,41,61,213,119,23,18,120,206,26,90,214,3,238,252,10,254,208,8,213,230,169,204,163,160,13,27,17,249,
+91,155,131,202,62,67,186,61,31,149,125,166,116,189,185,43,251,76,233,250,140,84,246,25,210,237,150,170,236,51,
+183,171,182,39,78,61,206,214,171,74,113,26,236,74,191,110,194,253,87,0,120,142,0,48,121,8,133,80,20,159,
+207,145,242,155,38,99,36,53,23,153,126,98,206,37,62,228,5,190,23,72,197,151,210,59,239,31,145,226,193,113,
+12,232,73,139,53,200,43,188,149,250,63,251,175,97,194,55,68,100,5,234,69,181,240,211,152,3,149,237,237,33,
+11,248,220,126,135,23,150,147,138,36,146,46,49,94,160,84,138,142,192,197,69,126,9,152,135,82,8,175,88,33,
+156,7,23,210,163,30,82,152,71,69,255,18,38,225,138,20,181,245,0,49,89,237,156,135,1,127,215,215,118,142,
+204,139,252,146,208,36,230,220,228,208,44,222,65,234,22,129,189,150,48,71,147,122,249,165,186,71,145,1,38,36,
+128,205,142,188,109,179,207,223,210,62,255,128,240,31,203,63,173,54,175,79,34,155,12,8,151,115,58,15,51,245,
+190,156,29,33,107,0,238,167,159,217,24,4,167,194,19,44,132,108,178,161,6,254,239,131,83,84,45,128,142,132,
+111,248,65,124,129,78,81,85,181,97,194,97,12,41,245,58,78,175,240,222,182,93,166,26,72,127,207,208,57,46,
+45,72,245,18,79,78,223,158,25,244,14,167,88,173,116,246,56,239,103,90,34,157,68,184,220,125,236,124,34,36,
+106,51,56,252,158,227,202,209,215,232,179,222,112,128,66,209,26,167,235,182,50,172,158,107,103,14,2,182,225,192,
+103,55,247,211,106,128,55,57,127,8,63,32,105,53,132,251,22,160,93,187,40,37,48,42,229,73,121,124,3,8,
+123,137,230,125,220,15,168,38,41,63,45,208,162,166,96,126,42,17,155,2,18,10,248,95,47,14,96,77,14,111,
+247,101,101,47,106,61,7,106,69,227,111,233,96,211,116,16,87,50,94,173,58,168,36,24,247,220,107,131,235,43,
+81,41,32,198,74,196,144,31,1,247,235,151,56,210,213,234,33,22,106,28,62,20,253,71,164,116,221,103,225,92,
+7,246,253,49,10,3,250,255,216,76,234,27,178,92,134,12,229,160,180,18,108,13,106,29,244,205,79,20,122,7,
+199,10,240,122,63,165,147,102,146,154,60,212,110,247,57,170,146,4,100,87,83,186,13,74,205,183,175,183,40,225,
+98,203,86,43,217,33,209,93,214,161,55,53,49,254,112,48,180,2,150,176,136,80,157,64,77,132,132,83,110,14,
+124,64,194,104,179,158,95,43,71,169,187,185,135,186,93,228,219,111,240,120,181,58,157,17,37,145,214,187,22,21,
+73,113,136,208,141,85,144,200,190,9,247,60,61,53,37,71,182,106,88,61,64,229,10,37,209,215,27,220,48,228,
+213,78,93,173,224,190,204,244,198,28,20,97,54,240,95,162,22,18,235,30,226,48,68,86,7,111,69,16,250,186,
+118,231,130,126,80,25,54,250,150,65,187,227,9,88,187,83,139,33,84,231,108,175,220,227,178,90,177,216,11,214,
+127,36,83,89,73,26,156,160,44,110,207,220,69,120,94,213,197,12,10,179,40,0,242,100,22,111,47,30,103,196,
+203,145,17,179,136,17,239,228,174,216,167,127,180,227,214,79,93,122,2,65,100,212,198,70,146,77,174,121,11,95,
+137,193,1,113,191,69,173,86,23,28,111,169,189,149,40,65,160,73,246,19,180,21,222,85,209,251,94,43,3,215,
+2,244,147,202,209,64,183,6,86,134,25,198,36,69,52,170,6,13,218,25,102,34,172,139,1,0,132,29,244,227,
+199,137,238,84,140,34,221,40,57,139,207,13,92,238,144,182,139,159,241,26,228,36,55,18,215,36,216,24,224,137,
+132,19,183,240,179,0,255,230,240,23,58,135,128,50,164,99,86,184,214,123,14,197,244,177,170,203,129,118,138,65,
+3,246,100,81,27,15,2,229,147,116,228,113,111,135,18,122,211,202,169,24,84,78,174,202,138,254,116,223,242,117,
+40,7,85,139,149,32,100,184,183,89,66,100,232,174,134,198,239,109,218,201,9,151,113,136,198,145,102,244,127,184,
+215,100,132,61,169,172,158,93,216,220,194,3,25,194,246,176,195,40,6,239,17,210,135,206,21,245,190,113,154,72,
+147,125,67,214,178,119,72,146,35,205,201,35,201,29,158,35,166,109,183,200,241,158,85,150,85,204,178,178,58,110,
+170,116,100,108,209,193,169,159,35,60,206,215,239,24,245,223,34,250,131,113,152,93,16,214,20,55,59,206,188,87,
+33,103,130,195,246,71,59,10,251,142,88,42,127,84,40,99,254,184,61,203,174,87,122,231,209,51,202,6,29,35,
+174,225,6,37,110,132,140,9,83,83,12,149,80,57,76,37,73,147,100,15,222,150,249,112,217,207,59,210,170,14,
+26,173,65,188,30,112,174,208,18,75,107,11,230,128,80,137,50,66,188,10,21,176,58,245,189,16,35,136,141,35,
+56,156,129,192,156,81,60,136,245,198,41,155,27,167,12,6,101,120,86,26,134,119,190,198,113,163,65,122,25,193,
+3,91,99,208,99,146,225,0,240,9,137,173,69,37,71,237,19,179,57,156,123,20,24,244,200,80,74,140,251,65,
+152,246,151,201,72,70,31,217,16,249,183,170,221,180,214,218,143,146,210,138,5,125,63,215,142,142,26,15,233,112,
+40,176,193,204,20,165,163,89,159,145,34,8,238,50,139,214,90,2,38,39,156,86,108,170,91,229,136,225,68,87,
+68,67,224,124,223,97,58,9,184,0,163,192,11,114,7,117,203,177,98,163,200,137,171,90,80,141,229,185,192,178,
+165,42,139,208,113,144,135,92,69,190,166,251,117,231,160,175,151,36,118,46,199,23,141,65,242,2,185,163,52,137,
+219,6,106,204,173,73,99,167,112,53,118,178,179,130,52,118,238,208,0,42,196,103,213,153,230,88,18,30,139,218,
+154,5,238,201,140,71,18,7,112,202,185,124,178,22,113,16,242,51,140,129,71,229,140,229,179,195,23,0,120,160,
+197,170,180,102,50,104,232,37,184,170,46,109,208,21,173,97,73,239,229,14,245,39,194,76,48,47,143,204,253,109,
+147,159,92,4,175,21,156,211,73,150,234,154,133,5,130,93,69,152,212,11,245,251,153,48,200,14,160,24,168,7,
+141,185,123,18,73,137,17,217,220,70,220,128,78,130,2,168,81,59,75,110,128,106,177,179,199,68,148,78,111,210,
+82,166,18,254,140,219,175,96,100,94,237,94,172,38,97,91,249,210,79,2,251,46,131,107,82,165,71,51,134,196,
+17,162,149,190,129,208,239,208,19,195,106,245,91,213,143,145,52,207,125,124,23,146,26,65,171,103,45,250,183,83,
+246,123,85,59,233,155,39,161,208,117,35,170,130,107,119,13,167,186,48,216,108,142,43,198,164,209,21,82,33,42,
+67,226,100,72,206,149,98,194,43,236,182,202,16,59,25,98,206,80,70,88,217,106,133,37,240,111,108,148,84,74,
+103,141,255,220,184,150,208,250,10,237,8,175,225,214,175,72,1,22,19,202,8,0,147,178,201,18,121,143,80,112,
+108,188,68,149,47,248,77,0,200,98,71,140,115,128,32,136,81,146,164,15,132,135,115,0,180,91,12,63,71,70,
+48,57,196,90,149,137,179,174,212,31,62,62,128,53,121,60,100,32,141,218,221,142,105,92,20,7,119,113,244,11,
+225,31,162,210,100,219,135,170,255,182,242,209,102,227,24,109,4,4,188,164,109,203,243,139,187,163,175,209,59,129,
+237,174,62,51,198,206,91,99,91,72,78,63,80,91,156,129,204,115,184,141,181,213,9,46,109,203,103,210,235,177,
+106,173,189,11,250,2,169,3,231,57,220,114,54,189,19,231,10,255,27,206,16,79,205,32,51,20,93,230,44,225,
+223,85,195,127,131,21,36,105,153,223,255,254,85,254,199,228,247,255,186,70,185,159,69,52,228,217,225,57,234,167,
+153,28,191,86,181,75,132,26,136,184,39,14,33,132,151,180,198,158,155,184,150,222,141,191,86,100,112,48,56,8,
+247,14,251,142,144,89,100,145,108,18,39,80,15,102,71,172,184,186,87,135,69,74,189,138,151,149,207,218,71,4,
+4,245,10,234,27,41,202,122,15,152,61,174,247,118,102,87,170,166,255,65,186,63,13,59,132,220,53,66,176,38,
+181,164,102,140,103,138,215,34,19,220,21,172,33,86,157,118,228,151,153,132,31,116,56,80,107,110,103,154,231,87,
+30,90,21,101,122,40,235,113,146,65,125,183,119,40,3,113,22,183,144,27,76,19,30,112,84,56,202,119,174,162,
+157,192,163,152,24,6,205,28,160,4,39,76,73,175,100,68,204,6,238,97,155,222,32,77,46,52,182,235,237,248,
+239,224,50,74,74,185,79,156,215,128,76,114,132,173,136,142,166,29,170,84,67,205,205,193,75,236,48,204,56,113,
+165,222,247,92,197,23,215,100,190,254,69,205,48,27,142,208,36,217,214,174,98,214,179,206,185,85,204,227,49,39,
+166,86,5,244,57,183,83,108,84,207,221,222,176,228,120,181,114,68,161,246,48,162,13,43,192,60,101,126,89,245,
+213,59,183,129,220,65,90,17,41,98,146,140,148,68,49,144,148,196,222,39,176,19,131,59,78,99,105,91,41,21,
+207,245,32,232,151,250,20,192,150,115,200,91,160,105,45,121,171,228,109,62,193,193,86,129,173,90,39,18,218,170,
+103,5,207,22,50,82,9,104,185,154,167,75,82,116,147,174,76,101,33,73,27,219,135,81,10,84,184,40,89,33,
+46,135,186,142,129,90,192,145,29,24,28,173,170,182,76,212,235,69,69,54,80,111,153,120,71,221,65,168,160,153,
+26,56,158,32,154,223,142,172,185,240,57,142,173,249,221,149,143,195,8,90,39,2,250,254,114,70,230,76,21,207,
+134,155,16,184,116,170,251,1,135,94,115,101,227,76,65,138,166,155,107,203,196,25,203,8,85,186,136,113,217,236,
+33,77,225,92,70,218,153,128,194,231,79,1,191,121,147,143,244,69,231,143,97,113,250,35,195,231,240,231,82,220,
+161,210,81,60,172,100,129,119,7,233,255,136,250,42,65,187,80,112,247,48,248,191,30,10,148,5,35,61,104,235,
+211,203,100,149,230,101,131,129,92,42,242,212,149,74,224,122,210,233,179,74,186,205,227,12,55,36,26,242,158,38,
+67,132,87,180,11,10,178,98,33,88,48,68,109,193,33,169,11,38,176,177,0,211,171,182,232,33,232,93,233,8,
+197,84,82,3,8,69,72,88,210,169,154,241,36,143,43,123,148,150,200,126,190,187,196,177,205,96,170,103,74,226,
+239,59,71,251,210,29,56,66,163,13,149,84,34,40,125,228,111,118,134,196,236,54,92,238,147,34,255,42,51,74,
+219,224,179,179,250,59,115,114,52,243,186,114,57,103,9,93,34,164,227,224,27,116,173,79,186,1,232,18,136,46,
+152,59,135,107,101,21,143,177,203,172,184,73,19,124,151,109,50,207,178,45,165,80,103,153,10,178,14,214,68,54,
+149,193,25,158,120,93,58,169,86,193,188,95,33,65,104,212,202,195,74,169,0,123,255,207,102,198,98,51,99,22,
+121,157,102,70,141,45,69,89,45,191,184,67,123,50,248,205,81,231,177,16,67,190,2,129,228,80,106,63,64,149,
+214,84,209,111,229,134,46,186,86,83,48,220,123,129,212,231,56,35,218,167,129,122,100,22,115,0,12,128,47,6,
+91,14,182,243,114,15,143,135,190,29,250,150,190,179,50,212,150,251,31,42,35,150,130,185,140,26,245,88,237,246,
+49,202,54,93,177,199,181,190,193,115,214,77,32,188,87,164,104,118,77,173,15,153,56,73,129,34,24,162,5,159,
+196,159,113,52,145,254,16,0,50,224,177,112,198,50,127,17,12,224,111,138,213,35,94,204,185,35,152,172,20,234,
+132,46,251,227,30,206,176,243,45,134,36,156,123,104,10,93,204,208,180,163,33,107,75,50,60,169,213,160,167,34,
+158,65,157,33,90,50,45,160,190,5,141,9,134,141,181,46,130,192,246,90,6,176,201,32,21,91,213,61,206,117,
+253,60,14,219,178,99,185,33,93,227,233,184,223,56,108,68,26,50,203,171,135,136,18,140,223,121,3,154,78,137,
+28,75,166,161,28,67,44,116,115,215,170,181,44,38,126,140,163,16,195,96,157,33,71,39,198,169,195,158,135,185,
+95,170,73,77,224,105,134,172,226,17,204,117,28,65,121,252,96,44,60,67,46,3,117,156,163,36,148,115,146,6,
+5,202,8,28,34,227,162,54,188,196,210,199,150,201,210,201,16,70,40,140,242,110,141,212,85,47,174,170,2,42,
+119,121,49,208,55,88,253,28,91,215,251,52,197,121,79,212,229,14,148,84,26,244,175,164,31,11,222,81,128,145,
+173,86,244,94,242,251,161,67,5,57,58,6,22,169,76,8,178,229,136,178,107,154,168,112,100,43,202,188,65,36,
+171,149,18,73,208,107,231,160,175,50,103,205,204,89,61,115,134,153,215,70,165,221,116,225,149,108,112,244,155,40,
+207,166,120,5,121,251,186,177,134,168,95,49,239,212,226,159,157,139,170,141,89,254,90,58,120,46,66,214,193,25,
+169,106,156,111,24,147,13,190,96,214,144,233,55,91,193,145,220,48,111,203,125,214,184,128,199,216,119,116,32,156,
+237,254,165,118,37,169,165,34,237,40,24,125,11,123,57,102,1,65,6,244,68,171,237,97,140,151,110,180,48,250,
+80,34,141,22,120,214,154,60,206,129,54,73,120,114,64,148,244,23,220,23,190,36,99,251,93,239,194,219,45,2,
+1,35,138,207,14,240,0,195,19,106,17,250,88,85,4,211,146,210,176,118,241,43,15,16,246,60,41,19,224,61,
+191,160,83,161,166,123,129,220,135,176,196,22,169,146,65,179,10,52,126,66,225,43,96,100,124,154,46,144,72,15,
+66,108,92,183,188,81,136,27,13,125,244,93,130,180,12,42,141,210,124,199,168,13,67,118,201,49,222,144,148,70,
+112,143,94,81,7,121,153,66,94,50,14,198,65,194,223,11,79,119,25,219,53,91,99,225,216,29,73,151,187,230,
+146,243,200,101,237,147,235,72,162,219,241,117,116,191,72,5,122,237,146,201,111,157,170,159,194,179,173,157,57,143,
+184,87,177,126,100,96,28,26,151,145,74,172,212,194,135,7,184,242,146,69,66,218,116,68,48,239,195,105,243,169,
+37,205,171,111,155,38,182,200,183,170,186,124,171,106,53,89,212,50,252,179,156,56,89,142,156,43,49,86,251,72,
+40,35,79,19,153,241,10,123,41,169,95,165,157,206,110,247,218,125,197,237,116,135,92,210,200,73,68,246,21,43,
+168,148,144,172,200,122,196,170,58,37,130,10,195,199,193,187,20,149,41,52,123,9,219,55,12,29,172,179,109,233,
+140,0,92,6,225,208,176,94,173,143,40,171,1,226,176,60,128,18,234,24,131,72,229,197,104,237,240,56,0,172,
+51,235,178,218,162,255,65,204,196,56,74,232,110,35,254,1,106,44,208,53,96,30,122,104,149,217,237,42,112,234,
+38,2,33,174,148,187,88,166,159,88,61,171,14,153,42,160,166,4,219,203,198,84,32,240,11,61,19,168,246,160,
+159,1,16,5,1,159,141,196,17,86,151,170,20,250,148,57,43,201,71,2,252,96,230,190,87,201,25,106,218,75,
+156,193,4,79,35,76,159,3,15,134,216,53,165,151,182,90,157,161,187,4,93,255,122,93,187,199,138,160,56,75,
+207,149,141,212,27,60,196,106,160,152,108,196,116,142,134,141,172,25,56,26,96,75,26,41,174,54,27,192,184,29,
+70,80,113,62,28,189,26,169,253,225,106,205,170,198,113,211,0,19,53,172,6,29,168,245,65,169,76,52,18,188,
+164,137,21,8,121,251,124,176,152,38,200,208,162,39,77,190,2,222,96,149,14,108,162,90,217,140,213,46,128,122,
+42,81,23,131,170,65,190,12,218,213,245,30,0,213,240,134,74,24,10,201,236,36,194,180,80,226,5,128,2,145,
+45,160,176,30,224,25,67,223,21,228,2,3,224,230,75,212,53,24,18,134,22,40,50,173,38,35,75,25,91,163,
+159,28,214,50,135,249,141,190,98,161,212,17,43,111,87,248,169,15,51,202,3,241,51,242,122,213,228,120,112,98,
+85,2,12,202,19,165,126,51,163,242,0,207,16,185,163,10,36,235,238,115,54,52,146,155,138,58,3,141,216,213,
+17,250,32,44,200,253,128,33,62,170,45,94,124,59,27,55,252,89,117,30,18,66,32,16,225,100,54,174,86,10,
+58,116,222,96,201,241,10,180,23,251,128,177,130,208,117,116,11,80,234,230,118,187,159,99,201,166,17,153,184,87,
+115,8,104,126,199,224,244,171,172,241,96,219,28,241,202,115,7,52,61,104,16,190,164,9,221,111,81,82,65,39,
+7,27,238,16,2,198,69,172,105,172,129,108,4,196,18,23,136,37,4,196,72,89,81,178,68,36,11,44,159,127,
+211,171,194,102,221,84,41,212,84,185,53,101,187,135,110,69,72,155,35,100,31,225,161,59,83,158,162,181,167,195,
+115,36,165,207,206,21,247,127,243,179,143,110,61,83,242,65,230,107,27,223,206,130,61,143,21,12,140,36,208,53,
+172,251,163,133,122,129,91,136,15,17,246,60,110,33,199,205,80,226,198,52,197,205,105,2,56,74,226,34,61,91,
+229,57,160,230,153,217,177,57,92,231,164,132,6,96,18,58,162,17,29,36,43,28,184,247,92,54,132,52,184,32,
+168,163,248,128,236,245,71,31,0,80,151,168,122,154,12,160,170,2,61,113,137,140,116,243,78,253,83,31,95,2,
+18,174,229,81,66,237,161,86,129,174,64,21,133,68,37,86,34,117,35,76,54,150,173,3,206,202,88,131,50,27,
+244,237,45,32,238,48,119,24,175,89,35,196,154,154,186,208,26,5,99,84,139,66,126,180,53,104,233,1,57,77,
+100,203,87,91,242,164,190,247,55,206,238,30,31,80,235,124,32,164,59,207,81,139,217,228,154,71,239,123,218,112,
+18,14,206,106,101,180,240,114,130,205,157,218,231,1,244,32,135,89,11,19,124,74,4,74,92,6,71,126,22,96,
+51,27,100,193,31,181,214,72,186,76,27,184,8,52,199,190,41,86,166,181,121,131,25,212,164,155,227,29,179,220,
+112,152,2,61,174,68,102,30,185,215,87,47,151,136,193,38,218,105,160,34,131,53,210,160,30,72,90,212,79,80,
+197,239,125,207,177,217,36,223,51,128,165,3,132,202,103,152,80,50,105,173,94,144,178,14,85,21,244,129,158,48,
+149,173,176,162,43,20,173,165,64,116,198,138,137,54,100,98,20,149,244,82,253,232,163,206,83,132,94,30,81,101,
+73,209,169,128,88,102,84,101,142,142,60,131,254,226,76,217,239,134,222,174,235,14,18,247,11,22,71,163,194,126,
+67,21,32,6,196,145,78,101,11,101,247,94,214,4,253,164,27,93,146,190,250,105,33,37,141,166,153,70,39,46,
+35,225,166,209,107,66,55,61,131,44,244,57,57,170,109,216,30,151,125,79,150,206,39,25,158,25,171,160,212,187,
+96,11,232,119,120,15,40,38,17,41,34,255,134,76,40,64,140,185,48,32,199,187,21,18,229,40,60,182,154,65,
+178,161,208,243,155,84,218,188,217,80,98,17,137,62,112,137,150,65,31,184,228,154,206,25,251,111,242,30,53,76,
+87,138,142,0,215,128,39,18,42,100,231,174,139,121,3,176,41,253,103,5,219,153,138,202,80,196,69,32,241,231,
+77,113,138,73,186,171,28,123,19,52,33,39,35,23,81,105,227,17,7,164,189,176,152,52,57,131,92,248,90,100,
+81,208,110,161,63,3,2,94,248,20,132,14,54,147,57,74,14,74,229,36,33,206,67,159,192,108,62,176,190,190,
+80,116,30,38,235,109,251,230,179,3,88,201,97,196,157,193,247,138,117,191,174,251,81,181,144,62,21,146,62,245,
+57,79,130,193,103,4,25,36,148,75,72,216,166,176,3,31,81,116,126,65,209,25,42,125,227,4,157,71,152,110,
+248,52,164,154,65,216,97,148,161,122,175,213,198,144,109,78,0,28,149,202,232,97,93,239,163,205,7,122,70,150,
+144,100,192,139,185,118,15,207,173,161,158,163,197,80,131,191,45,232,194,64,238,86,174,34,222,159,4,234,1,73,
+204,163,103,184,222,23,89,132,214,39,23,101,52,197,159,52,122,64,169,85,244,156,126,255,142,30,224,79,18,61,
+199,159,89,244,158,82,199,209,59,250,189,138,62,210,239,101,244,7,253,46,163,11,52,96,185,144,17,25,178,92,
+44,162,207,148,62,137,94,208,239,40,250,68,191,243,232,119,103,186,126,81,168,62,178,93,149,118,56,50,215,144,
+47,152,194,53,173,78,117,159,116,22,46,22,104,135,59,240,203,6,129,12,120,46,28,237,188,72,38,40,156,5,
+180,55,132,44,57,92,163,185,77,101,8,142,142,215,210,222,5,234,125,1,174,49,66,79,106,157,69,223,218,158,
+41,163,5,86,81,106,26,162,101,53,75,46,101,127,150,42,35,217,82,1,79,101,173,198,60,3,178,160,1,34,
+63,213,60,132,92,153,50,208,117,222,98,49,53,84,55,253,106,133,36,80,207,65,27,132,254,20,157,74,82,234,
+12,76,202,122,91,236,13,156,68,207,169,195,107,11,29,178,217,137,141,166,109,151,89,185,92,32,187,185,6,117,
+35,6,164,186,139,110,1,177,129,1,69,237,13,112,89,24,23,44,80,201,150,69,140,209,92,12,91,244,243,248,
+96,47,10,191,20,250,82,31,91,15,80,27,148,4,95,121,142,253,146,109,68,56,36,57,146,76,201,58,220,222,
+172,102,73,213,219,117,181,60,244,126,78,204,126,198,157,161,176,169,33,210,135,105,84,186,188,227,212,66,255,5,
+66,204,52,24,158,45,206,163,63,43,127,33,82,129,186,231,10,164,231,126,198,119,61,90,142,20,64,191,235,87,
+129,95,168,70,251,133,95,105,211,143,9,17,254,5,183,205,16,168,13,68,147,196,40,66,31,201,120,23,58,210,
+251,49,140,25,103,17,209,249,134,96,77,235,137,72,127,132,35,86,135,0,240,20,206,94,159,236,81,96,193,223,
+60,2,234,109,20,32,131,65,76,29,140,124,110,48,242,25,0,200,217,99,253,222,159,1,216,158,158,205,206,35,
+104,107,14,191,27,205,169,174,76,157,73,255,181,5,143,188,170,185,4,115,150,184,160,5,215,246,109,64,236,41,
+230,141,239,51,139,7,176,16,126,32,17,6,125,140,56,15,238,13,171,86,83,108,113,53,132,10,97,204,142,95,
+3,188,253,69,58,198,16,108,170,88,68,119,232,145,173,37,78,193,166,177,36,177,76,54,82,145,0,121,174,221,
+167,32,62,73,98,151,43,41,231,79,211,100,105,17,172,190,68,154,87,206,57,180,1,34,3,6,29,197,155,123,
+211,98,149,44,120,222,194,134,203,122,15,200,165,139,143,242,71,153,206,20,50,205,142,145,117,149,97,155,95,101,
+185,105,194,152,185,137,166,173,150,246,251,47,11,216,164,133,85,207,66,162,79,3,88,92,96,3,140,131,181,72,
+200,54,54,108,9,142,99,204,41,139,214,70,136,126,123,205,14,107,136,197,102,95,17,29,122,87,160,63,81,237,
+208,38,8,68,115,122,233,230,183,101,6,191,160,27,174,240,1,22,35,246,174,80,158,109,182,116,173,217,157,250,
+106,90,41,154,105,111,240,188,224,184,21,33,32,28,170,110,2,196,162,40,234,140,177,194,245,240,88,168,51,65,
+210,76,22,102,105,125,190,52,42,44,194,76,58,159,214,120,205,175,0,54,178,170,39,217,138,181,106,253,43,130,
+161,207,241,111,122,195,100,68,50,9,188,63,163,235,2,1,151,19,19,199,106,137,221,226,39,221,167,62,99,114,
+107,113,67,94,56,115,152,212,25,208,117,40,221,40,11,223,194,76,169,161,216,5,50,194,42,44,137,138,140,54,
+71,79,247,16,110,121,221,18,129,225,49,183,197,229,71,40,224,203,88,248,159,227,142,100,223,14,111,1,82,59,
+85,197,151,48,189,241,80,79,212,92,157,252,62,57,6,155,211,202,19,64,152,7,235,4,213,43,168,234,169,133,
+240,36,83,93,173,74,128,106,202,42,216,91,46,228,158,89,245,61,160,44,112,186,118,253,233,192,131,151,41,145,
+10,82,180,218,29,23,226,238,168,202,139,176,18,230,64,132,99,97,14,68,56,18,85,60,9,225,86,81,135,2,
+105,251,133,129,121,179,181,3,33,149,105,158,58,163,119,23,196,39,227,46,145,107,32,6,176,159,50,140,134,83,
+9,126,11,229,154,140,147,104,55,38,89,10,184,197,169,98,38,88,190,72,70,68,178,186,75,162,76,61,192,73,
+109,208,97,40,183,175,167,0,117,5,51,180,105,241,220,195,49,251,46,225,146,20,117,33,100,101,229,205,90,212,
+172,236,63,138,162,230,18,71,121,143,45,180,33,15,83,32,100,208,153,35,83,124,181,202,187,93,64,18,89,72,
+76,78,6,137,48,137,11,160,12,0,141,76,220,155,61,174,77,97,61,216,82,69,63,66,250,28,101,201,250,208,
+179,226,103,135,168,42,139,186,190,59,109,123,4,227,244,64,208,111,181,242,136,235,69,206,191,155,25,36,122,103,
+65,103,51,217,124,129,30,101,165,97,6,72,203,12,8,72,206,171,74,80,93,125,35,231,38,127,138,138,200,71,
+209,6,78,76,105,50,35,66,112,25,15,175,250,57,202,10,253,13,121,37,177,117,98,195,214,41,131,16,149,252,
+74,102,42,192,252,157,149,142,31,112,152,68,76,43,153,55,81,68,135,34,45,162,135,142,23,150,194,113,11,17,
+107,4,107,67,193,31,181,191,11,180,117,245,115,184,178,209,41,68,97,76,83,18,54,20,201,163,180,0,132,222,
+169,207,117,188,90,108,136,210,11,18,73,22,90,89,72,67,14,98,69,214,50,36,52,52,32,139,241,201,49,132,
+161,156,196,23,2,196,100,216,247,155,26,46,237,142,83,51,150,7,104,254,95,225,34,194,209,157,146,246,132,152,
+107,45,50,163,117,136,218,46,17,12,112,144,33,62,133,28,47,120,29,178,157,218,43,76,8,90,204,57,36,209,
+74,85,239,193,18,207,53,9,69,232,169,151,149,200,114,106,248,19,99,235,184,247,189,154,107,50,180,199,82,128,
+236,125,175,205,221,24,150,194,89,173,67,46,52,102,69,254,36,96,10,171,85,39,247,135,17,50,22,29,174,162,
+57,244,37,134,157,51,109,200,246,186,50,196,105,129,178,130,111,146,52,60,178,130,178,86,14,139,118,83,172,30,
+242,254,69,237,140,110,119,84,160,182,5,94,51,184,172,115,4,48,104,200,65,60,100,235,108,183,112,120,52,232,
+92,33,66,171,183,188,144,201,36,123,107,197,21,40,75,115,140,163,68,65,124,2,84,49,48,232,137,65,233,57,
+184,143,227,1,66,27,30,62,46,201,248,80,11,64,77,6,148,160,194,132,41,233,57,92,175,67,232,7,236,255,
+132,58,238,149,75,226,1,233,239,35,156,25,98,243,56,206,125,9,92,14,145,198,66,142,36,228,90,74,243,34,
+48,157,216,150,58,157,95,28,157,196,66,49,9,104,175,68,204,37,171,243,228,140,251,24,87,10,79,144,138,55,
+24,128,18,247,70,193,240,71,104,213,171,208,178,126,229,144,178,82,243,228,142,212,248,137,70,174,211,139,5,182,
+239,80,99,6,211,183,212,152,133,33,168,75,131,21,212,216,224,255,180,236,129,178,74,77,184,195,36,241,37,41,
+190,247,128,0,171,135,90,219,137,6,183,5,179,16,113,241,85,38,115,55,195,174,214,83,160,221,104,213,10,176,
+234,100,33,150,5,79,166,85,140,164,217,71,70,141,67,55,212,188,39,61,208,154,158,109,126,68,73,161,84,249,
+20,114,11,169,73,222,144,224,9,201,188,22,196,219,157,133,212,23,58,185,69,112,151,178,159,51,223,171,65,206,
+231,140,36,184,52,189,84,139,44,234,185,201,118,72,237,146,156,61,146,162,37,123,21,41,163,9,89,231,209,202,
+198,66,182,170,190,114,1,192,163,144,80,227,109,107,244,244,213,4,175,183,200,40,186,221,186,16,17,85,218,80,
+209,70,52,148,221,16,217,136,110,72,169,166,114,56,64,206,169,155,20,46,51,206,119,195,115,174,86,40,29,211,
+177,82,201,151,217,102,72,213,243,64,43,212,241,21,64,39,53,24,72,139,139,187,156,188,219,98,147,226,165,251,
+200,16,188,53,207,63,168,134,96,125,180,220,81,68,12,41,212,121,68,117,79,141,65,102,132,82,230,107,151,210,
+189,46,12,133,138,168,50,233,212,43,149,42,54,151,0,88,238,184,16,48,105,124,139,86,90,163,125,228,228,209,
+73,74,159,117,73,186,207,5,215,153,95,227,97,129,6,148,248,136,223,13,186,81,144,223,12,149,72,34,194,34,
+32,20,62,205,227,17,76,165,234,153,122,107,244,205,73,85,45,118,156,38,141,54,140,74,136,16,111,44,17,121,
+75,25,12,46,248,176,34,241,148,249,30,226,158,161,227,197,180,37,122,223,4,46,157,194,56,95,25,223,99,38,
+31,55,205,228,99,244,221,245,128,194,231,124,84,30,188,250,21,169,79,105,156,64,40,55,246,232,136,130,20,172,
+141,50,124,160,58,28,232,44,139,102,150,69,160,6,67,244,106,244,174,174,184,100,23,40,154,20,20,14,73,148,
+3,219,112,56,70,61,38,212,104,154,214,74,194,30,169,111,10,142,216,137,175,56,137,99,214,126,10,144,229,83,
+249,35,49,53,187,117,232,99,88,31,127,14,63,131,204,221,49,221,238,140,173,30,48,119,8,223,45,181,128,5,
+156,87,155,13,46,226,153,217,164,110,119,112,44,234,11,162,17,148,207,110,154,250,158,225,188,42,1,199,143,132,
+236,12,206,102,26,223,14,76,78,24,85,152,70,142,25,130,187,5,212,158,105,140,39,115,78,144,239,86,132,211,
+115,136,211,35,84,51,171,213,195,131,3,213,205,138,235,103,34,123,75,123,139,214,246,166,202,139,30,86,171,107,
+65,135,36,37,185,8,211,237,15,106,131,15,109,13,14,128,187,41,182,105,245,212,149,122,28,13,219,66,105,223,
+108,21,119,181,40,148,154,224,71,108,119,201,248,26,254,108,16,138,128,20,221,32,30,103,85,201,93,221,89,141,
+197,16,177,84,182,170,212,85,104,35,85,162,51,92,242,119,169,77,127,106,170,133,205,75,28,117,0,191,20,13,
+31,247,175,20,132,156,49,100,168,127,124,237,126,28,143,27,95,143,106,180,224,172,104,122,125,221,209,87,117,110,
+188,75,53,116,107,84,156,29,244,75,97,90,200,92,124,240,139,193,106,103,48,175,226,26,217,40,76,124,188,42,
+196,235,66,28,145,1,233,76,19,84,142,182,101,97,57,87,251,255,75,224,110,191,95,67,69,242,44,170,123,254,
+86,172,69,64,41,250,247,173,123,94,87,86,201,31,39,108,170,205,211,119,150,159,107,57,166,159,233,21,36,229,
+135,218,171,163,18,71,49,126,148,47,93,68,154,155,11,123,224,134,212,110,140,96,40,91,227,195,209,24,106,171,
+224,204,174,208,107,81,184,129,143,117,19,189,113,70,225,221,121,47,160,82,71,179,209,241,120,123,155,228,61,169,
+161,87,21,88,142,194,61,251,185,104,157,243,134,155,171,13,53,71,61,44,146,34,219,144,120,107,109,156,93,56,
+83,206,157,171,197,32,179,244,176,155,145,97,81,209,215,58,138,53,187,152,114,111,143,108,145,163,152,157,6,144,
+30,36,50,229,201,221,253,93,172,253,242,148,232,151,167,230,238,172,57,145,114,150,84,109,225,209,53,74,91,239,
+57,138,238,141,63,132,39,135,131,167,228,86,196,202,171,163,167,190,181,65,57,68,61,156,127,83,121,109,63,130,
+122,70,59,222,191,119,171,221,127,123,255,70,243,19,154,29,109,126,242,56,214,38,40,168,192,74,50,32,233,88,
+89,74,182,253,121,219,68,248,159,58,135,236,173,57,254,111,241,164,58,192,29,222,165,171,224,90,180,233,65,211,
+144,25,94,105,236,70,90,142,230,157,50,74,178,176,77,127,34,192,161,44,112,113,130,212,51,226,57,134,108,213,
+238,81,43,253,149,168,178,7,69,158,163,233,81,193,79,97,69,148,151,22,152,162,130,63,124,144,227,146,212,34,
+123,23,228,133,68,22,134,166,4,28,157,188,35,152,4,246,151,240,82,39,211,21,229,114,231,213,187,225,150,155,
+148,103,18,238,46,55,217,209,70,85,55,129,67,12,177,82,203,214,35,72,4,208,3,153,50,245,67,244,4,5,
+72,64,75,127,157,128,198,67,152,39,202,7,200,66,34,121,200,197,5,57,1,9,221,4,174,8,225,47,234,147,
+36,126,64,26,95,0,160,46,150,11,121,113,161,208,52,202,69,140,84,248,53,223,10,250,160,152,55,102,89,232,
+145,251,16,217,197,82,221,226,58,84,18,118,143,106,108,16,131,46,86,217,238,101,182,111,23,139,188,212,169,103,
+199,151,108,173,62,133,4,111,169,139,180,176,55,23,41,184,123,135,23,83,35,46,64,208,190,158,7,246,102,86,
+155,179,3,48,67,110,102,93,173,170,205,13,190,90,77,144,104,213,27,19,175,187,45,3,172,0,71,30,1,246,
+175,56,123,228,11,76,125,43,55,141,251,156,143,24,209,208,41,140,123,25,41,98,237,189,171,254,174,61,137,237,
+237,109,236,103,84,199,177,187,71,47,171,224,109,194,19,102,73,14,226,148,32,240,166,7,218,65,85,109,7,105,
+60,71,111,34,223,176,0,213,33,102,228,208,117,105,88,212,84,126,173,127,54,220,76,82,56,147,203,84,55,113,
+225,27,105,17,154,161,184,139,203,81,34,80,143,203,245,218,172,207,33,142,146,11,146,55,183,53,201,5,36,93,
+157,226,88,220,113,21,97,189,164,129,9,218,203,161,35,14,117,91,86,113,40,80,88,134,108,26,244,105,43,84,
+116,42,119,82,54,36,128,85,93,2,232,168,68,23,70,95,197,88,79,180,112,63,136,237,90,83,223,136,58,29,
+212,47,239,196,90,87,125,181,42,89,209,188,83,218,164,152,184,180,78,65,82,49,34,63,138,248,128,132,29,212,
+147,212,118,121,131,129,182,90,13,57,218,202,6,18,251,137,185,46,102,63,208,227,133,51,11,181,173,193,124,184,
+45,141,160,131,229,30,243,196,244,240,13,83,12,62,88,173,24,82,137,145,155,190,57,224,74,35,67,26,115,251,
+46,140,247,13,49,174,35,224,144,134,198,46,164,66,48,2,130,97,244,120,172,143,226,72,19,12,243,104,124,54,
+66,13,131,102,59,253,197,217,156,148,41,48,112,46,250,184,88,43,15,36,109,222,64,224,142,205,168,199,116,248,
+103,247,210,1,247,124,139,50,65,56,119,38,102,236,38,210,101,120,38,34,215,140,80,234,68,141,194,119,8,131,
+175,116,109,49,172,209,182,150,250,146,14,216,162,65,95,159,54,66,208,166,1,223,131,194,81,224,83,150,16,155,
+183,44,53,166,221,98,24,39,2,205,156,218,90,186,222,186,13,26,232,244,232,206,189,221,59,53,159,34,100,71,
+247,160,201,15,71,121,29,246,213,126,33,7,109,124,20,109,64,152,154,79,69,59,52,31,111,131,182,161,29,136,
+14,143,77,187,67,109,239,224,193,63,235,224,243,109,29,116,99,214,184,93,124,167,186,120,89,57,23,138,222,55,
+232,52,18,8,133,93,143,253,140,48,134,90,167,144,138,38,133,68,216,37,144,71,149,54,113,206,232,174,113,169,
+29,58,107,136,24,43,14,149,183,43,3,65,238,74,40,34,16,249,55,254,72,127,255,32,235,167,247,4,20,159,
+209,223,223,112,248,86,97,20,109,186,33,233,68,119,35,250,88,88,238,147,41,77,69,57,14,10,186,140,249,92,
+68,24,200,169,151,229,215,20,160,2,39,94,33,171,159,138,72,133,104,112,34,236,244,63,21,237,146,178,79,5,
+214,209,237,126,134,110,60,105,56,107,160,145,250,30,253,96,200,180,100,38,63,84,241,12,37,244,159,139,22,197,
+58,174,11,195,169,57,234,147,133,229,130,211,250,67,247,177,45,154,139,3,1,163,70,191,210,126,123,228,184,170,
+151,140,246,36,252,65,126,22,77,219,111,197,99,51,81,240,66,78,175,78,138,179,223,208,79,78,143,111,35,92,
+26,126,242,209,201,30,214,1,211,136,118,201,10,1,46,22,22,243,248,88,24,75,247,12,151,64,251,252,199,85,
+17,127,147,0,235,207,2,163,59,167,176,228,239,123,58,126,81,183,155,86,61,94,254,113,138,46,166,157,17,255,
+89,35,27,106,232,140,4,116,198,97,189,16,10,188,156,245,51,139,180,211,93,149,213,175,222,108,243,234,205,108,
+204,39,247,36,252,162,249,49,14,84,128,109,104,232,10,171,64,87,124,195,226,152,130,26,184,103,87,32,220,192,
+62,83,132,97,163,19,86,27,43,187,125,96,64,69,51,78,96,131,231,30,106,120,86,232,193,155,37,220,59,212,
+136,222,147,223,96,224,39,168,68,0,213,60,193,186,2,64,254,250,184,36,42,116,226,238,161,160,128,245,4,57,
+79,204,160,250,239,17,61,122,79,187,105,42,253,223,77,236,194,10,73,113,153,181,68,70,208,46,181,225,238,17,
+57,95,202,122,254,89,83,221,197,71,185,25,74,206,6,190,114,191,45,231,128,33,100,244,192,122,149,24,64,135,
+146,240,65,41,173,198,95,111,41,9,31,148,122,231,109,54,164,36,124,224,36,222,169,81,166,30,148,191,109,106,
+193,86,108,235,115,170,81,193,7,134,151,58,120,67,50,138,118,119,43,165,64,107,23,142,43,76,138,234,214,214,
+99,220,136,151,68,63,82,140,7,121,253,220,125,135,143,47,71,165,114,59,226,102,105,166,202,155,121,33,203,18,
+102,56,242,60,209,110,13,76,25,39,178,170,96,48,50,244,221,215,207,40,220,118,18,180,125,130,250,124,28,168,
+175,202,1,186,30,129,177,60,83,121,125,116,76,227,6,67,108,68,75,160,29,209,191,100,203,27,29,206,64,109,
+3,146,144,169,200,31,220,172,14,218,88,243,2,67,36,150,94,19,229,5,233,42,238,107,9,217,191,185,40,241,
+47,212,238,33,62,70,125,142,144,171,97,29,92,153,197,102,49,49,95,33,106,93,209,210,125,49,199,53,241,29,
+189,116,81,27,36,199,55,105,99,206,224,97,172,47,26,121,99,145,129,158,95,155,142,94,89,244,26,168,93,96,
+66,147,56,91,193,148,175,84,140,23,158,202,160,209,37,167,223,91,130,171,224,182,171,195,197,74,195,69,105,115,
+32,59,169,109,0,8,25,144,40,53,65,99,84,116,23,199,220,133,251,219,119,183,113,189,166,230,118,46,26,9,
+218,149,142,176,21,150,206,145,113,103,170,126,120,138,250,44,234,107,188,49,69,139,13,166,128,221,214,206,105,237,
+168,221,141,199,157,211,233,230,10,17,232,178,240,185,86,43,124,140,26,14,141,44,32,168,45,0,29,23,66,48,
+59,42,216,16,29,46,160,105,216,223,143,222,148,181,53,97,237,38,93,107,45,28,1,159,135,66,109,231,225,165,
+99,11,180,156,137,74,180,248,82,210,31,255,173,245,160,254,209,177,33,208,191,189,145,117,99,70,36,246,178,109,
+166,29,88,66,115,225,194,72,140,199,82,171,101,51,212,208,55,247,178,187,137,141,27,241,70,181,154,143,113,223,
+154,169,209,181,49,96,38,190,249,168,175,42,97,65,219,63,239,93,227,24,245,107,151,199,225,154,53,53,138,44,
+250,7,142,254,143,201,251,254,177,227,88,55,179,238,153,179,123,194,215,0,126,128,138,220,2,50,149,114,51,246,
+5,127,142,170,173,38,24,112,171,23,174,17,153,42,106,103,70,155,199,186,124,220,190,100,146,180,219,141,169,151,
+138,98,70,239,169,236,197,184,219,157,242,7,245,142,159,144,6,31,148,88,125,136,30,214,153,223,132,24,58,217,
+48,25,87,199,221,238,130,139,234,4,252,72,157,65,215,216,244,208,97,231,207,51,206,71,73,206,8,226,58,187,
+180,133,138,102,187,86,67,206,99,31,242,86,138,30,47,244,36,234,88,158,94,178,90,41,174,64,195,220,50,9,
+238,114,227,252,128,191,1,73,79,214,91,232,151,3,35,4,144,193,133,96,23,178,64,146,102,100,155,71,29,64,
+171,246,134,153,162,36,51,69,229,140,212,81,204,204,90,221,139,144,26,16,166,240,156,182,227,17,195,140,92,104,
+134,172,211,188,224,235,76,146,25,101,205,169,135,118,68,159,109,204,29,204,146,203,180,81,107,107,237,158,213,57,
+201,245,141,132,161,73,242,243,254,1,114,148,175,113,2,160,197,223,124,252,171,70,143,189,165,193,99,132,136,58,
+118,60,204,28,194,212,241,236,88,181,162,23,214,231,36,43,220,96,197,126,224,5,226,110,221,112,136,73,218,229,
+112,36,241,194,64,91,121,71,209,179,177,111,46,244,6,252,172,79,66,187,215,19,12,126,98,77,252,28,147,66,
+180,37,204,209,51,71,219,122,36,131,36,76,240,92,227,244,144,87,140,252,60,50,124,69,216,162,199,226,88,164,
+168,54,153,171,29,51,198,15,200,212,115,136,150,113,86,247,127,64,145,88,90,61,53,23,3,95,193,145,108,48,
+66,77,136,112,142,154,20,26,110,28,7,161,254,94,224,223,1,218,176,98,120,20,68,231,96,244,78,25,252,12,
+71,88,151,44,240,47,116,55,16,219,189,22,212,32,204,200,85,7,219,8,112,162,44,155,26,83,15,116,105,107,
+186,146,155,25,9,159,228,139,8,33,133,190,192,220,0,112,152,110,34,83,72,190,202,92,189,196,45,61,171,111,
+61,27,72,192,41,58,205,116,72,159,6,119,175,45,208,119,171,103,125,116,233,123,28,190,213,126,107,109,213,179,
+172,213,142,199,53,209,220,144,170,102,77,135,227,53,127,59,75,146,133,11,244,183,163,44,183,116,138,59,164,101,
+139,85,25,235,58,176,118,115,209,83,82,199,54,205,222,130,52,136,41,134,1,242,16,9,70,179,106,163,235,99,
+209,129,102,119,237,166,126,188,236,120,156,209,154,228,254,92,52,225,235,109,17,70,221,208,109,222,3,134,60,114,
+235,166,173,101,86,64,186,104,168,57,226,238,255,90,53,5,77,232,119,38,122,208,72,110,139,110,208,212,69,88,
+56,238,142,97,238,141,67,96,171,136,205,132,242,129,242,245,175,128,133,235,56,184,232,37,198,73,41,194,76,169,
+125,11,231,188,215,53,200,76,8,149,76,128,158,175,227,144,166,180,139,77,230,27,168,228,230,9,201,29,209,146,
+246,33,153,185,156,186,219,108,67,198,137,38,102,91,68,227,104,114,180,0,146,124,146,237,238,10,169,92,16,19,
+61,78,130,42,199,54,100,112,173,111,53,107,234,249,169,242,111,32,21,153,216,218,17,44,172,28,205,161,196,99,
+239,234,111,70,18,19,74,153,142,225,233,20,13,102,196,21,253,157,210,223,119,168,198,93,15,49,14,91,134,116,
+202,73,157,76,124,144,54,155,14,61,78,10,164,198,61,116,138,64,71,219,170,185,233,238,89,187,222,130,179,52,
+99,123,184,99,178,222,242,179,134,58,115,191,208,34,18,45,43,17,117,37,217,40,211,123,104,67,103,169,239,24,
+183,69,121,205,208,109,67,138,144,59,182,111,197,134,0,38,55,26,227,248,209,180,115,26,79,224,19,6,34,148,
+74,26,231,218,231,200,237,246,57,114,195,62,199,81,253,170,225,69,26,75,37,49,64,185,128,35,173,103,22,243,
+169,20,194,111,232,241,173,205,94,96,64,43,220,167,238,135,168,80,179,117,129,173,160,130,241,41,234,200,145,214,
+171,182,32,204,153,93,234,108,65,20,51,213,242,224,182,64,227,43,210,79,182,230,5,103,156,10,56,122,176,94,
+111,134,123,185,176,35,35,107,65,87,151,189,148,113,42,117,245,117,20,4,61,98,229,231,56,26,248,193,22,53,
+174,39,16,39,33,188,172,45,184,204,149,13,154,71,231,179,198,248,124,165,206,48,128,161,45,231,22,11,193,34,
+165,208,171,119,233,98,146,100,214,99,70,243,3,121,0,35,91,55,19,254,38,192,16,0,14,68,87,104,105,93,
+231,197,154,46,169,152,132,138,191,216,106,5,216,83,173,14,204,147,118,235,137,78,21,182,196,84,174,92,45,54,
+210,219,114,25,58,206,161,125,173,230,131,34,70,180,233,186,115,80,64,187,37,220,119,177,89,223,145,170,111,152,
+160,16,145,103,245,176,175,119,81,157,180,139,8,158,245,27,42,33,80,146,40,153,11,180,80,99,121,19,62,17,
+142,143,170,138,103,217,185,13,239,144,233,0,17,149,178,9,44,106,54,130,77,10,103,99,95,24,183,62,22,168,
+55,192,85,225,90,8,196,117,47,155,26,138,69,49,124,193,17,75,0,245,113,237,0,185,83,21,159,121,116,36,
+61,140,162,22,215,29,161,118,187,95,208,223,141,147,108,105,201,15,234,139,154,195,66,61,160,223,85,90,181,130,
+127,225,29,119,53,93,177,219,130,22,197,168,53,134,254,92,200,123,61,41,58,187,237,169,211,140,65,128,200,197,
+101,13,128,152,161,196,117,152,16,85,152,213,61,198,17,185,42,137,45,112,207,41,152,167,112,221,174,126,105,131,
+118,237,248,38,18,90,46,46,115,97,112,25,71,139,178,181,58,61,135,205,26,199,245,26,181,247,72,235,166,146,
+106,107,155,67,68,143,81,156,81,87,200,52,193,167,124,107,115,133,7,18,253,174,43,15,71,180,31,163,66,109,
+211,74,115,22,107,246,193,218,10,1,221,83,121,38,170,141,170,168,149,32,34,12,149,227,214,20,58,110,77,177,
+214,161,60,181,4,148,194,84,209,202,83,112,132,214,111,232,120,218,241,153,89,3,1,36,34,57,114,174,107,61,
+10,178,143,114,20,230,178,251,93,85,185,94,170,0,78,134,109,206,84,56,94,96,229,123,194,11,26,217,59,157,
+49,105,158,86,172,132,234,42,248,190,105,224,30,68,239,209,253,130,156,0,134,39,164,119,209,191,39,14,17,69,
+173,80,222,36,158,162,71,213,13,93,104,10,159,41,201,212,237,24,141,82,19,54,128,116,53,123,178,102,8,25,
+210,177,238,228,20,115,145,112,6,242,120,8,191,171,85,222,226,116,192,218,158,179,47,101,130,224,19,50,15,88,
+3,2,122,149,5,226,146,127,62,20,244,243,134,127,46,233,135,0,222,203,44,58,83,113,100,222,203,201,241,205,
+156,189,225,158,139,175,89,196,30,200,61,52,123,223,139,209,238,221,19,90,127,11,217,120,116,178,194,187,36,27,
+166,139,145,12,95,102,66,222,152,199,89,124,19,234,138,223,144,103,187,243,181,80,8,99,216,100,177,210,10,180,
+43,132,171,136,223,20,59,94,24,61,43,183,6,189,72,21,177,13,76,117,1,206,174,121,19,149,173,10,227,174,
+179,188,52,220,162,106,71,206,79,152,132,243,212,240,92,99,18,216,59,180,135,218,162,128,156,50,122,206,1,126,
+69,173,38,53,59,255,176,166,78,173,38,160,134,8,11,108,239,177,82,102,209,134,74,128,153,145,162,63,106,159,
+34,50,190,129,242,186,113,188,158,18,87,132,189,218,137,4,48,85,53,96,129,216,176,234,114,159,227,20,249,157,
+108,181,194,126,37,232,189,154,84,163,96,159,194,123,236,120,179,150,218,197,56,214,55,140,244,252,163,139,21,58,
+94,108,20,129,97,0,225,117,80,48,168,32,251,251,130,60,162,122,97,232,237,210,35,26,226,135,148,173,143,254,
+87,6,126,155,207,10,252,178,153,12,135,32,21,11,116,92,67,168,204,34,8,66,159,124,184,72,155,196,139,3,
+251,180,219,77,181,6,50,217,211,190,204,20,230,2,223,248,240,14,69,122,118,112,46,148,75,29,6,14,129,102,
+241,90,183,16,145,113,216,189,131,0,143,29,96,2,25,255,0,142,210,175,58,83,248,53,115,120,112,207,191,205,
+17,120,191,157,194,215,145,91,60,14,6,187,168,146,52,186,187,142,139,44,156,195,38,160,251,33,60,21,100,241,
+174,150,62,252,84,9,174,229,61,43,200,192,97,173,80,119,212,208,246,46,65,111,236,26,241,0,169,176,27,200,
+196,111,195,253,144,197,141,122,121,194,18,5,109,7,122,219,61,217,184,100,218,202,210,129,170,95,130,128,78,156,
+250,85,11,90,2,115,30,8,194,223,5,97,173,130,112,77,65,119,245,250,57,195,196,246,73,189,202,106,172,144,
+164,252,64,33,74,60,246,68,58,172,214,255,176,96,89,22,202,191,141,42,186,133,139,99,76,193,237,75,207,150,
+93,223,211,156,48,209,174,226,148,105,68,219,32,113,63,194,95,36,20,135,126,97,16,118,18,185,63,236,61,234,
+29,30,122,28,231,53,139,150,62,187,72,20,236,53,49,16,39,148,70,94,12,4,214,4,244,111,44,120,118,69,
+41,209,209,53,66,253,9,50,71,32,247,199,108,75,100,77,229,41,129,21,84,78,50,186,136,189,203,69,85,49,
+7,16,61,169,115,109,28,9,7,181,141,184,17,186,221,225,43,64,140,225,149,253,200,110,21,212,183,217,194,41,
+134,46,174,115,250,178,22,127,80,231,73,147,15,129,123,66,10,156,98,84,196,147,9,61,149,115,153,166,84,51,
+244,253,61,101,102,99,4,49,132,113,194,128,111,231,120,91,205,211,56,161,105,220,203,179,20,213,159,159,101,237,
+33,34,63,101,36,82,240,198,113,90,50,226,53,80,207,97,179,23,212,195,110,247,125,198,209,84,61,160,5,164,
+183,22,191,81,39,128,74,203,175,199,176,195,75,216,237,18,80,115,82,248,136,23,85,62,206,135,139,146,158,160,
+83,183,66,205,138,192,109,14,135,151,172,69,139,60,45,225,68,195,2,22,82,104,248,175,126,117,126,245,74,19,
+167,95,244,252,227,187,44,196,40,41,177,159,35,33,51,254,69,93,176,44,135,117,76,16,79,20,211,100,52,130,
+174,33,142,85,201,98,150,100,152,8,219,177,168,68,82,206,226,185,72,42,57,35,37,89,145,230,249,92,204,160,
+137,100,14,147,206,141,102,249,180,144,99,248,129,157,147,124,5,100,43,47,167,49,42,81,219,22,178,252,186,128,
+122,160,6,140,112,2,100,9,28,228,155,4,112,95,25,143,112,33,224,225,239,5,160,185,35,120,192,253,12,15,
+172,148,11,27,51,158,165,176,35,133,25,19,106,137,209,146,3,174,146,149,232,30,69,224,140,195,6,128,143,120,
+62,209,183,39,69,120,19,203,132,156,53,195,50,255,12,231,99,90,85,243,112,127,255,250,250,186,119,253,93,47,
+47,38,251,135,63,253,244,211,254,77,154,100,87,158,120,209,70,244,194,98,187,1,93,126,192,173,206,249,41,89,
+5,172,18,63,192,21,254,185,149,104,126,145,49,186,203,57,31,9,227,64,24,35,203,137,79,173,101,148,194,52,
+70,116,167,189,111,47,148,223,107,180,205,136,24,89,0,37,1,187,213,194,42,63,219,188,47,131,32,139,178,54,
+175,86,74,215,93,155,222,147,143,133,63,51,159,223,208,102,211,212,138,252,113,173,12,203,129,183,157,252,104,123,
+133,239,214,103,246,47,200,176,100,254,214,17,2,31,148,127,54,220,30,252,89,59,110,119,78,230,240,111,98,107,
+213,74,59,111,1,195,179,48,55,190,20,6,103,234,73,55,115,30,170,7,87,33,174,126,188,115,210,111,192,16,
+9,3,108,78,252,138,135,55,168,133,251,251,187,161,129,56,144,131,106,215,219,241,118,101,88,133,20,47,194,209,
+126,115,215,111,147,218,193,214,66,182,47,167,199,86,114,167,214,56,21,177,106,121,176,204,158,183,205,231,52,140,
+34,194,14,32,63,4,55,168,199,174,239,125,162,9,119,35,232,50,32,139,187,145,107,108,102,131,6,230,78,60,
+36,175,78,29,87,36,223,193,85,198,127,170,34,248,45,28,94,27,101,206,163,187,114,9,24,221,230,1,123,120,
+112,112,176,143,62,52,128,100,168,166,97,251,17,252,113,255,53,124,164,63,175,95,193,169,200,114,4,156,211,106,
+150,138,203,124,116,43,16,23,16,83,128,20,2,79,30,96,60,176,57,249,102,171,146,10,254,198,163,17,222,89,
+34,46,96,143,224,123,9,247,6,192,184,28,128,25,149,195,159,67,49,125,40,166,223,137,233,247,98,250,131,152,
+62,18,211,73,145,47,230,34,139,151,0,90,104,50,0,78,46,197,8,128,102,42,70,149,0,204,11,131,244,96,
+58,233,55,72,49,79,134,20,22,104,10,228,222,108,2,157,129,65,37,64,246,165,98,142,62,218,196,34,21,177,
+184,4,42,234,178,16,151,163,4,254,229,64,140,137,33,64,79,128,230,208,37,58,86,163,49,144,82,51,32,24,
+175,46,71,80,65,113,37,254,22,197,92,0,172,45,170,161,40,22,151,183,2,128,93,60,155,11,0,189,64,241,
+149,243,24,174,103,184,10,224,246,42,23,151,240,111,46,80,255,86,44,4,76,190,184,190,68,155,72,184,200,227,
+197,40,201,5,66,107,164,225,174,4,93,158,208,210,37,64,69,246,253,46,40,134,17,192,207,69,1,72,244,48,
+206,150,49,180,52,44,18,192,39,1,102,243,3,96,136,232,234,77,232,177,15,97,120,240,143,39,75,193,93,90,
+139,138,214,166,130,135,41,180,40,24,1,160,33,34,27,29,230,76,166,35,192,59,233,174,17,140,116,164,241,37,
+212,158,202,9,242,172,102,120,215,32,250,193,85,43,60,36,95,84,152,83,227,33,26,47,49,232,10,220,80,113,
+130,151,98,18,167,249,4,42,201,22,244,7,111,40,152,154,25,76,232,173,80,247,179,144,236,196,66,224,117,148,
+95,11,237,154,91,92,166,249,240,234,239,69,142,183,220,184,192,168,76,21,238,22,216,221,57,109,61,216,176,34,
+206,146,25,230,29,38,197,144,112,168,100,62,135,13,42,134,139,2,46,32,188,88,241,102,46,135,208,8,124,130,
+13,202,142,187,97,184,89,181,55,142,135,184,1,29,71,54,98,34,38,233,237,124,10,59,39,158,72,220,200,146,
+22,31,74,204,226,18,54,117,82,150,0,17,246,56,19,181,4,127,160,66,184,47,243,244,118,146,243,47,149,67,
+110,144,40,175,19,188,225,74,114,108,65,243,67,127,168,100,69,123,6,153,127,203,68,94,123,164,146,146,228,173,
+87,141,130,131,57,177,64,173,210,73,238,70,244,193,151,1,121,194,9,61,60,198,4,182,6,252,168,189,126,19,
+89,216,30,177,219,42,65,228,202,62,189,243,167,53,161,64,226,51,183,214,16,157,67,146,115,160,211,159,252,85,
+126,13,88,47,28,126,95,59,86,40,243,179,202,240,124,233,69,49,150,155,234,234,202,27,187,19,239,200,112,144,
+188,61,15,121,72,3,42,30,213,185,183,145,214,151,127,113,250,250,213,199,236,10,208,150,76,213,133,138,134,91,
+179,170,60,33,215,185,191,89,122,95,49,170,220,104,141,172,188,65,27,142,150,143,67,4,80,0,184,235,188,32,
+204,167,128,21,150,0,100,112,129,129,228,45,82,207,153,206,133,158,206,182,192,5,119,141,121,249,123,33,139,219,
+15,116,152,40,66,103,223,146,178,91,230,206,3,104,232,181,185,65,30,231,46,135,237,91,51,175,104,1,210,13,
+24,20,161,47,21,234,32,29,43,38,39,36,176,155,220,211,120,38,185,222,151,213,83,72,76,0,206,72,223,211,
+95,60,97,31,131,26,27,120,158,215,110,239,246,110,190,249,224,23,184,100,53,23,1,83,119,243,111,11,90,89,
+83,105,184,167,128,114,218,80,203,191,204,29,199,224,228,85,243,25,27,41,212,253,135,95,230,90,9,131,53,243,
+72,20,89,227,117,78,76,142,120,142,106,32,155,57,110,243,154,19,9,70,225,222,144,195,30,35,172,173,103,65,
+174,192,7,64,154,97,67,57,2,201,122,158,138,125,145,57,98,61,211,17,220,201,71,12,126,221,200,3,87,38,
+67,109,29,129,148,246,248,28,188,50,176,99,12,100,210,87,233,223,213,22,42,28,231,162,177,114,225,92,39,233,
+69,9,167,58,69,205,122,56,203,133,59,193,0,172,132,51,151,225,101,46,156,137,11,39,185,176,19,20,222,230,
+194,153,139,240,58,23,106,216,225,77,142,234,141,167,118,164,225,5,165,124,64,156,132,28,30,135,87,57,208,230,
+175,1,47,226,254,52,60,183,30,33,222,185,214,92,250,250,55,229,255,17,8,42,123,26,224,5,48,176,35,156,
+67,4,229,84,124,139,223,83,157,105,237,64,243,163,188,206,18,215,117,106,127,31,129,227,161,150,29,185,38,109,
+158,83,145,203,47,211,153,136,49,76,15,90,153,247,229,160,225,5,14,101,39,131,9,253,162,135,121,252,69,191,
+143,40,93,194,71,229,65,48,180,93,120,153,157,228,69,107,45,49,217,127,40,152,157,4,143,15,186,93,74,82,
+90,137,92,247,89,114,206,15,9,107,105,124,201,141,27,80,79,220,173,5,6,51,248,144,71,103,74,153,193,179,
+166,109,158,54,155,241,208,159,21,110,9,207,88,250,122,78,244,196,183,121,195,12,9,61,208,43,254,38,9,67,
+152,141,47,217,71,157,227,166,133,18,29,167,45,185,242,51,139,17,195,115,5,5,1,89,127,202,245,163,191,57,
+44,252,20,185,3,239,82,64,31,166,121,58,146,236,124,169,230,90,10,171,117,19,208,197,77,61,69,249,187,113,
+101,56,185,177,220,83,220,150,142,114,171,103,239,97,21,32,39,66,90,175,210,189,99,194,79,59,193,46,40,130,
+6,178,145,253,34,146,247,229,49,222,63,216,235,103,202,126,75,225,39,113,101,68,121,77,115,8,21,74,117,112,
+38,140,86,158,61,142,138,254,238,110,22,112,72,48,156,112,145,179,99,241,24,229,146,214,21,161,19,100,242,77,
+238,232,23,80,125,20,58,114,70,174,192,208,197,61,0,56,56,220,111,149,104,145,205,157,62,152,152,166,187,187,
+146,52,205,226,179,15,249,153,60,71,151,39,202,211,233,208,102,41,128,224,26,194,166,83,121,48,196,161,122,84,
+65,49,157,111,206,109,237,98,93,188,71,83,13,72,225,83,3,221,161,189,107,61,50,58,151,111,75,24,88,244,
+149,180,183,231,184,110,238,118,209,127,153,13,190,106,205,131,165,235,23,117,100,73,191,212,185,26,72,43,132,98,
+7,166,245,155,167,214,145,185,49,162,34,119,156,202,201,39,65,8,218,20,37,251,87,43,49,14,23,249,6,15,
+40,224,197,123,192,179,95,18,72,142,58,177,232,76,141,140,204,198,68,33,42,105,236,184,104,20,35,222,172,208,
+43,140,65,74,109,224,66,150,131,116,227,58,199,100,49,10,194,198,23,127,132,98,247,11,228,18,223,178,167,98,
+116,244,180,128,62,222,208,132,146,92,141,193,91,134,62,84,107,49,43,117,147,105,243,78,87,17,32,235,101,27,
+153,45,198,208,150,219,213,185,172,139,11,99,53,19,12,164,227,64,139,35,243,54,183,229,184,7,173,164,66,21,
+137,56,50,44,71,135,36,7,178,137,138,199,73,190,49,218,43,210,200,245,108,115,90,68,66,139,122,105,250,137,
+33,76,29,44,136,119,166,134,115,61,188,87,225,226,228,197,38,143,174,110,52,60,41,90,179,181,166,26,183,10,
+188,238,45,146,82,64,142,175,145,72,241,213,106,226,66,195,74,224,197,231,104,188,184,184,85,35,178,1,58,16,
+208,222,114,90,102,5,3,51,70,229,118,22,26,192,165,168,180,0,49,193,248,127,200,156,76,176,49,229,18,136,
+195,39,199,61,125,3,89,128,146,4,54,21,32,155,255,37,39,119,221,220,237,82,187,228,113,151,194,65,1,53,
+12,229,184,171,116,159,15,106,167,185,8,152,61,157,214,113,77,46,22,166,53,212,17,39,207,197,30,183,134,208,
+193,168,52,7,253,122,20,29,103,68,89,48,39,223,206,194,116,153,253,112,82,144,65,182,221,41,109,132,216,70,
+31,168,64,186,37,74,188,42,228,246,242,218,49,220,111,89,187,170,117,203,40,29,0,203,13,108,40,48,220,176,
+58,71,125,132,177,234,148,59,80,157,6,163,197,133,195,168,165,110,148,102,161,162,176,226,149,207,25,3,18,218,
+50,129,76,5,200,21,123,162,143,73,209,178,91,47,12,160,230,163,141,45,152,208,26,65,144,246,106,200,167,154,
+65,233,132,173,44,204,238,46,136,91,88,24,151,8,20,38,214,113,70,106,194,116,208,186,180,215,43,44,55,120,
+141,165,223,34,154,34,9,165,80,213,234,87,19,5,226,255,75,51,14,245,224,248,140,77,120,81,16,61,200,213,
+78,227,80,71,202,233,79,67,41,251,149,139,15,100,53,152,170,180,202,177,99,153,133,148,216,75,133,7,226,168,
+8,128,16,150,16,235,100,23,89,48,137,112,219,227,189,105,150,167,238,153,88,123,57,104,58,57,64,100,226,149,
+227,199,184,174,123,244,90,31,63,26,176,100,124,200,168,202,147,54,137,114,8,143,108,127,220,191,3,31,163,177,
+137,87,56,182,112,4,137,120,27,187,151,204,145,65,4,115,18,111,25,172,212,68,72,140,98,117,233,171,62,238,
+178,51,9,226,148,75,139,73,236,70,89,40,163,177,111,46,7,198,27,219,110,38,70,16,149,92,157,93,124,43,
+72,121,196,190,46,121,118,26,237,210,220,232,52,152,23,234,120,223,98,167,118,197,10,114,159,139,217,130,1,251,
+127,8,165,142,84,168,192,137,27,118,90,237,165,196,137,127,132,65,231,209,213,137,64,63,11,179,72,218,24,210,
+203,72,162,110,192,37,252,204,206,197,36,178,214,234,226,54,42,240,211,53,252,76,206,197,13,160,51,234,136,141,
+30,71,179,110,119,250,56,154,4,153,191,12,6,88,199,238,238,232,60,204,252,203,96,128,85,237,237,205,206,67,
+160,44,150,226,22,150,236,45,254,66,127,10,116,166,169,51,83,245,187,187,211,243,0,51,94,138,107,202,8,191,
+148,113,18,8,93,15,117,96,111,111,194,25,151,42,227,210,102,188,105,1,253,75,5,99,29,2,215,191,228,205,
+98,123,80,171,248,82,117,245,210,118,181,173,98,170,132,171,119,186,104,199,226,103,140,24,150,17,96,255,82,140,
+4,182,56,4,164,230,150,130,86,15,202,51,122,56,15,63,248,183,130,191,139,204,31,6,131,185,127,75,71,156,
+123,78,199,124,10,213,45,160,137,225,185,128,14,46,84,7,23,182,131,248,73,251,12,111,235,236,194,233,44,122,
+59,109,105,33,176,125,239,143,158,204,6,254,56,202,0,222,76,48,66,216,0,47,181,144,95,168,204,21,97,150,
+80,76,76,0,76,5,225,244,9,144,132,175,213,48,29,5,69,139,123,24,21,52,56,218,201,227,140,28,218,41,
+236,79,42,61,180,156,188,237,19,25,26,27,236,44,113,142,244,91,85,29,237,99,54,28,237,144,95,63,188,86,
+106,216,184,52,216,184,52,30,114,165,66,170,224,175,14,243,209,66,133,226,165,81,167,49,141,203,211,193,27,13,
+176,17,157,144,45,165,209,198,67,251,184,73,240,170,83,177,240,160,75,220,156,121,149,138,186,174,20,117,205,185,
+143,82,128,40,35,34,145,165,10,153,7,247,255,63,13,113,99,238,192,145,152,43,162,21,160,200,156,102,101,20,
+205,45,24,25,69,35,19,188,39,32,10,74,56,241,70,12,45,130,224,65,191,240,250,96,93,215,132,17,225,114,
+178,199,164,88,89,118,91,96,54,10,116,218,217,200,0,179,141,14,112,14,211,252,26,105,123,186,167,7,185,63,
+165,92,179,96,128,22,163,0,97,190,248,99,216,106,51,88,250,69,16,210,7,34,192,12,82,85,231,81,65,102,
+12,125,114,5,191,132,140,205,4,128,58,11,205,96,141,67,108,98,240,218,159,194,151,169,249,18,132,223,172,52,
+228,239,196,175,226,203,190,37,159,26,135,216,62,247,121,89,213,39,223,213,166,124,234,160,162,137,175,253,97,107,
+145,180,126,106,35,30,120,11,236,220,131,171,34,238,102,239,20,5,37,8,127,101,222,228,41,233,113,32,131,131,
+69,207,194,149,77,243,51,161,47,2,195,60,59,36,255,155,6,69,71,49,63,208,84,100,168,54,162,72,27,155,
+137,188,97,13,187,221,33,238,68,161,206,166,80,199,64,81,163,132,164,212,14,163,213,206,107,63,125,130,197,44,
+185,63,100,92,33,142,134,91,40,67,178,90,21,152,40,219,104,67,75,28,226,82,152,106,209,147,183,14,173,70,
+70,42,211,184,36,92,30,17,119,140,97,167,232,209,161,105,80,199,86,117,122,0,72,5,138,77,184,170,184,195,
+129,108,117,162,241,179,69,167,217,186,48,67,55,206,136,102,38,69,89,81,139,202,97,89,90,115,88,134,18,167,
+241,106,213,121,3,219,48,69,183,101,204,111,88,160,163,44,166,173,198,209,184,198,248,198,18,139,213,106,92,111,
+120,7,201,214,84,25,167,225,108,106,95,104,142,195,173,41,10,206,135,56,226,206,41,28,167,224,110,142,157,188,
+161,9,83,141,117,230,176,192,103,42,150,237,57,185,251,176,175,193,90,185,54,160,13,226,28,41,133,168,169,119,
+205,251,178,58,137,13,223,54,38,6,149,142,31,74,110,98,198,104,254,206,65,164,130,128,130,145,98,244,219,177,
+67,41,140,136,193,128,168,218,41,69,80,195,74,70,234,254,129,170,248,178,81,32,132,254,148,170,48,6,177,163,
+54,217,139,188,174,1,249,151,176,29,44,203,255,132,29,113,51,194,230,38,171,176,30,124,184,249,232,140,205,142,
+123,138,221,228,16,175,253,42,66,94,218,90,67,102,188,123,102,117,6,214,148,250,77,67,3,72,118,145,202,120,
+41,143,46,249,190,110,162,61,211,128,9,48,13,74,104,22,150,214,212,236,50,66,216,174,80,187,165,189,178,39,
+176,209,38,109,68,193,196,33,10,38,231,80,4,251,66,72,5,95,182,226,210,86,114,11,149,220,182,144,149,183,
+150,172,188,37,178,114,201,55,209,77,180,220,0,84,88,253,77,143,3,31,25,51,217,139,232,176,127,241,248,6,
+8,48,227,245,225,2,142,2,37,156,93,156,107,244,248,40,199,254,45,161,86,69,206,173,233,30,121,237,163,76,
+236,64,28,40,224,79,161,79,144,146,50,38,93,188,30,195,128,97,212,154,153,15,156,3,155,63,182,146,143,151,
+185,150,115,192,83,155,196,226,37,110,173,47,121,77,98,241,82,49,172,53,47,201,88,64,148,40,134,109,36,65,
+203,95,243,134,155,239,175,121,61,236,59,133,6,135,141,9,83,9,71,136,31,202,232,121,190,217,128,168,172,187,
+192,33,230,216,104,143,156,57,168,28,41,114,136,23,120,170,136,204,227,195,159,69,37,71,192,66,78,48,186,138,
+202,123,0,138,63,145,167,145,76,69,87,167,164,167,197,4,18,226,98,34,78,114,12,184,170,37,18,146,184,2,
+168,19,138,134,2,240,99,129,49,123,46,68,183,18,204,39,200,145,207,197,165,209,246,163,173,44,111,19,44,147,
+154,50,184,105,52,144,228,89,26,71,45,90,247,76,153,165,174,79,62,104,43,197,97,121,186,90,110,114,221,79,
+6,55,36,208,227,116,15,14,111,56,134,125,134,166,192,38,220,7,231,48,55,125,61,134,67,189,209,69,163,209,
+5,53,218,156,7,213,56,156,225,78,18,152,37,40,3,156,249,213,10,138,209,74,120,139,140,39,167,18,136,69,
+211,22,125,240,13,101,133,231,205,29,212,154,157,28,65,25,35,180,190,75,235,59,221,207,200,116,92,100,40,135,
+72,198,9,197,166,241,157,183,232,65,142,150,81,239,144,154,63,199,120,91,184,110,24,194,201,9,18,99,173,128,
+74,15,50,160,241,134,112,252,172,187,1,230,235,194,218,34,190,126,163,108,116,176,208,174,215,243,118,93,223,24,
+149,219,171,187,117,208,251,146,39,153,15,185,156,227,116,146,111,134,63,169,120,143,209,143,10,30,144,144,153,54,
+64,112,130,115,149,142,10,214,244,248,99,184,79,206,160,118,48,80,31,247,15,53,236,180,147,70,5,79,62,230,
+209,217,235,92,28,231,142,100,238,143,252,254,48,152,125,242,83,153,83,48,51,229,251,161,102,184,148,100,83,89,
+36,36,140,38,234,8,227,53,58,202,7,88,42,243,93,117,132,64,199,173,103,137,135,130,230,105,84,213,252,177,
+162,51,146,154,22,3,89,54,18,3,24,183,38,108,100,29,1,141,130,75,184,57,217,88,110,1,155,121,17,196,
+209,2,189,154,151,81,74,63,232,145,182,219,125,15,72,7,49,46,76,125,126,85,173,86,196,55,92,48,96,193,
+248,36,252,164,178,235,184,118,234,59,128,172,32,243,177,110,108,255,5,186,122,25,12,155,183,241,155,15,254,207,
+153,248,140,31,131,240,143,140,124,156,108,100,194,143,14,130,254,222,81,106,80,98,173,13,149,155,103,58,79,248,
+27,233,74,127,66,235,148,193,38,50,32,209,125,71,212,84,157,214,214,111,199,175,159,29,63,55,129,193,176,161,
+1,171,92,135,82,108,232,23,20,60,2,73,58,184,245,79,207,50,245,253,197,125,157,49,115,129,234,161,245,58,
+248,19,141,199,140,204,137,95,159,59,36,11,85,30,180,141,212,96,79,85,133,22,101,24,184,232,244,248,247,211,
+167,239,143,159,214,198,8,233,115,139,213,235,185,240,148,75,99,116,98,157,200,249,84,51,7,93,235,11,212,158,
+205,231,47,181,51,4,68,188,227,73,204,64,87,232,46,145,103,79,109,11,175,165,196,20,92,145,124,188,109,251,
+44,116,195,104,29,211,50,249,124,124,127,179,232,192,31,6,29,248,35,119,46,252,159,27,135,25,79,86,162,169,
+36,87,20,214,1,220,53,169,169,3,163,0,60,49,33,214,124,180,144,93,173,208,102,175,153,41,86,153,2,35,
+75,251,157,156,30,12,145,59,105,197,53,84,64,150,125,69,46,149,209,223,153,95,162,126,240,144,226,184,16,32,
+185,0,242,108,73,25,201,160,179,174,155,196,152,60,6,191,115,51,70,165,154,140,23,185,248,108,231,227,103,51,
+31,63,231,107,241,41,143,188,139,139,194,19,191,211,195,208,179,51,244,167,214,246,130,223,179,79,249,121,96,244,
+192,171,129,55,156,198,217,4,45,19,84,136,74,178,23,60,51,97,33,169,0,25,17,162,83,231,64,176,21,208,
+14,37,35,238,118,246,123,206,225,176,122,92,81,173,232,239,88,84,125,104,20,199,98,142,134,117,93,158,31,189,
+200,55,130,171,228,190,241,37,116,127,112,149,4,46,150,132,28,4,177,27,23,44,244,119,30,197,24,160,217,199,
+232,209,108,117,8,143,103,135,231,193,227,232,135,239,156,171,251,215,220,18,222,48,97,127,231,218,0,243,69,129,
+155,170,47,163,164,119,129,246,8,115,55,66,91,165,220,53,179,111,29,214,250,95,20,5,249,120,192,20,50,114,
+213,126,111,159,68,121,237,253,113,116,192,70,176,152,147,195,89,61,87,138,96,48,26,173,19,22,216,104,97,108,
+183,143,86,116,78,64,147,245,139,124,243,176,225,80,226,106,112,135,10,185,139,66,134,172,33,136,182,93,217,58,
+116,1,14,77,152,26,182,159,173,86,47,242,160,245,112,163,151,49,61,124,64,167,107,64,75,38,70,64,96,239,
+195,60,171,93,134,185,22,214,107,37,16,10,112,170,188,142,57,239,253,23,185,58,201,127,226,45,140,129,112,10,
+88,208,95,115,81,37,226,151,220,69,163,33,167,210,35,101,133,242,68,100,137,57,34,50,209,71,68,38,14,200,
+200,219,186,106,24,11,110,135,77,162,198,230,80,211,132,123,86,70,141,130,52,16,205,159,169,165,90,12,31,195,
+69,218,59,124,35,51,95,227,67,4,22,1,83,4,128,237,145,150,146,231,5,46,157,64,188,44,38,18,60,71,
+111,142,172,159,40,220,172,98,127,80,2,187,20,55,220,34,118,187,81,23,39,233,176,165,136,243,6,56,183,73,
+182,144,125,142,30,59,52,252,24,131,140,199,53,237,14,55,11,70,228,67,196,189,102,233,229,189,123,255,246,231,
+247,199,31,62,120,228,30,95,93,75,24,62,230,130,157,40,38,125,142,117,77,56,133,231,133,74,98,155,0,150,
+156,248,177,72,73,115,71,57,92,76,3,227,246,188,49,78,160,90,114,223,86,207,128,219,101,15,21,73,84,36,
+223,208,90,21,69,98,203,68,222,227,114,57,121,226,237,38,187,222,227,125,122,236,51,251,8,114,89,214,145,34,
+241,99,39,41,104,78,145,243,73,101,95,212,179,187,130,236,218,39,51,220,164,163,22,8,81,101,165,187,102,17,
+228,181,203,243,76,18,87,247,76,7,166,71,53,113,152,73,239,237,187,211,151,111,223,212,112,132,213,42,78,148,
+58,89,153,52,133,249,234,147,58,185,157,3,118,67,103,245,119,217,96,84,205,35,242,223,220,110,105,85,34,196,
+247,53,158,233,168,119,150,73,93,195,144,105,92,242,73,184,124,173,169,11,35,117,197,157,12,20,12,65,112,203,
+82,44,2,100,107,251,204,115,202,122,176,121,102,54,210,17,190,249,1,179,195,232,209,244,136,58,66,12,46,11,
+49,114,3,49,242,100,45,210,36,186,169,251,190,80,22,185,232,130,107,191,239,15,58,103,255,235,159,255,231,175,
+32,216,159,64,159,247,67,191,183,27,236,91,197,113,246,66,80,4,237,126,52,240,206,176,3,231,188,168,154,102,
+194,30,225,73,61,67,81,161,234,57,122,221,56,212,47,1,58,91,16,18,35,22,90,77,177,196,246,113,156,152,
+72,178,78,135,44,203,121,112,234,215,222,73,248,233,104,139,37,247,153,37,189,217,102,138,148,38,141,240,151,163,
+164,70,12,163,154,30,7,56,80,142,13,180,157,88,11,211,56,143,242,123,244,102,136,71,193,166,100,69,4,3,
+207,149,52,26,157,18,101,120,51,113,114,213,72,214,174,94,84,187,168,111,163,248,119,73,173,186,164,89,206,68,
+37,35,198,109,34,166,73,180,255,191,123,123,251,98,6,15,127,149,255,233,36,208,211,2,250,88,61,216,23,203,
+100,195,2,22,70,61,77,180,211,137,64,45,13,226,127,198,114,87,234,80,106,120,216,103,42,111,209,158,247,136,
+162,57,3,140,33,204,30,114,147,136,198,51,125,240,28,198,108,22,77,18,117,56,154,193,186,191,21,196,64,53,
+141,158,87,200,131,165,98,48,219,196,245,90,92,38,209,153,247,89,94,94,37,128,215,123,175,243,175,168,89,95,
+122,231,98,178,113,122,144,181,154,68,243,111,193,224,158,50,209,138,174,80,135,194,99,243,24,82,60,5,32,130,
+23,224,60,49,238,145,250,110,176,121,101,107,121,128,58,145,31,17,73,97,157,200,93,109,68,121,168,53,6,46,
+147,150,232,243,151,9,192,212,93,82,148,201,234,173,100,235,218,49,187,77,234,36,7,145,26,73,131,212,40,220,
+195,69,151,81,97,162,60,91,66,228,67,45,5,159,3,35,242,113,24,5,181,236,98,1,239,25,198,100,72,147,
+175,114,68,105,24,149,173,228,7,0,78,227,40,93,173,22,98,132,64,64,161,24,92,57,97,35,42,165,81,67,
+148,251,35,141,155,12,8,15,25,5,33,135,125,157,71,112,138,153,103,132,179,77,126,89,199,65,230,207,207,74,
+68,254,151,137,63,132,222,106,20,133,62,207,131,56,194,207,2,5,17,99,120,48,217,216,68,53,198,107,62,86,
+232,249,181,133,191,183,6,254,222,2,252,189,161,163,181,187,111,167,254,194,162,110,100,90,104,160,186,146,31,17,
+5,133,248,106,224,240,16,118,152,135,32,21,140,189,73,130,118,103,3,214,189,165,174,69,185,53,95,19,1,223,
+76,117,149,164,144,245,4,205,79,90,200,57,52,5,247,2,100,78,1,104,119,250,68,172,42,143,212,211,171,118,
+58,208,47,118,101,96,193,189,85,106,250,255,121,18,24,147,105,153,7,243,65,184,169,124,178,144,168,105,242,44,
+244,140,252,31,207,28,92,28,102,198,180,58,154,25,90,22,60,1,252,149,117,121,24,28,102,2,135,139,14,35,
+213,196,136,98,176,101,142,209,151,209,214,126,58,115,254,42,177,87,54,162,158,185,13,50,223,48,156,186,91,155,
+224,62,172,216,134,164,254,41,156,159,215,120,27,177,211,35,111,137,193,170,78,73,49,26,238,112,109,239,180,121,
+159,190,166,251,212,165,112,94,111,64,85,101,7,141,110,5,10,54,131,174,118,189,61,122,245,4,253,156,230,141,
+244,189,42,87,159,158,18,238,214,252,204,24,157,39,88,254,101,62,210,171,74,117,235,164,4,170,147,158,154,117,
+242,103,85,39,161,45,71,73,244,39,241,172,196,151,36,242,44,7,197,19,31,224,157,13,40,233,245,109,227,243,
+211,218,187,68,206,252,105,189,196,27,247,21,51,244,143,208,138,132,167,208,218,222,161,139,4,167,26,199,142,204,
+100,184,166,59,173,145,205,199,30,241,109,119,218,232,215,117,35,245,56,67,23,152,155,13,187,189,219,222,110,61,
+151,127,106,154,125,90,31,235,117,61,145,26,101,44,231,24,38,121,160,106,69,39,9,128,78,152,108,39,104,187,
+122,239,199,30,202,61,124,206,17,132,54,146,113,216,230,223,207,119,77,64,95,210,81,57,78,106,49,143,143,49,
+177,230,30,236,107,3,243,223,100,164,177,227,190,141,100,242,152,88,56,126,189,16,132,250,74,251,21,85,184,55,
+8,152,7,137,182,144,218,172,173,219,157,180,182,130,234,133,10,208,58,129,172,146,58,163,234,132,51,8,116,32,
+170,44,92,50,29,188,153,172,157,208,23,22,5,16,36,180,32,55,100,137,138,29,84,70,57,74,20,147,193,211,
+36,124,147,192,133,143,1,204,107,241,243,218,216,48,37,186,48,42,48,24,192,162,193,174,181,28,168,110,119,119,
+119,248,4,89,255,41,46,206,150,72,212,195,199,42,3,144,255,187,135,8,198,55,152,72,216,24,1,158,119,120,
+25,95,250,52,81,104,153,189,138,211,52,240,197,234,65,224,220,207,39,13,116,95,237,48,232,212,145,114,163,71,
+200,6,226,117,121,228,103,103,111,129,178,126,142,49,180,189,115,2,246,198,113,27,58,12,72,76,142,69,193,59,
+190,37,83,28,125,4,228,95,36,24,40,27,178,159,222,87,225,208,228,184,167,194,20,43,68,187,20,152,93,84,
+18,57,232,75,94,163,248,9,237,51,120,132,47,104,103,146,24,143,28,152,227,67,50,72,85,142,15,152,35,133,
+28,67,147,195,95,68,232,165,0,125,71,17,71,3,16,209,197,147,3,168,51,29,124,73,194,15,73,72,236,204,
+49,70,104,229,214,116,229,161,174,35,60,224,61,51,138,56,71,183,251,78,209,8,60,73,154,54,240,140,67,211,
+59,220,146,97,33,212,134,12,23,194,108,199,112,44,166,113,121,170,215,50,116,195,135,127,84,107,168,21,227,185,
+121,163,248,164,212,226,153,199,107,232,34,61,56,151,57,43,33,97,238,98,23,142,155,195,63,144,36,217,133,191,
+228,26,123,93,83,203,255,195,165,61,15,229,119,255,81,44,91,235,53,101,239,48,48,151,61,144,27,2,101,142,
+78,5,239,27,160,5,85,20,81,121,88,235,115,176,51,69,253,214,27,34,97,137,46,89,81,173,197,166,251,129,
+166,22,95,105,58,210,181,205,232,51,251,16,205,202,58,84,57,95,192,88,249,33,197,123,53,170,48,74,47,51,
+65,84,0,118,105,194,160,2,177,122,123,103,19,82,239,94,214,180,191,154,87,52,160,244,196,1,150,177,42,53,
+55,239,186,216,212,164,184,229,150,144,202,222,155,143,177,74,113,169,43,23,19,204,63,134,39,254,112,107,122,165,
+39,69,92,155,178,79,169,94,113,99,154,16,23,186,180,250,116,101,251,103,202,191,130,180,145,58,112,226,117,244,
+182,16,71,240,71,249,180,82,216,220,81,183,123,164,9,241,215,209,145,17,243,30,69,58,153,150,226,75,212,121,
+237,196,53,91,173,58,117,203,48,90,147,47,171,213,13,30,107,88,132,27,158,251,15,209,151,110,119,52,24,133,
+169,120,139,143,211,193,20,14,192,83,124,156,15,230,112,46,78,241,241,122,181,90,138,55,248,212,230,38,243,102,
+112,19,94,138,99,252,124,177,90,77,196,75,124,186,90,173,110,197,215,104,230,15,253,87,193,224,21,207,92,248,
+42,232,179,85,228,131,136,112,192,152,81,157,231,209,207,137,255,38,16,39,145,221,44,209,187,26,60,126,0,27,
+19,46,171,66,60,13,4,253,190,5,100,233,196,110,208,129,15,57,232,195,135,64,188,236,118,95,34,13,31,30,
+119,187,199,20,194,192,86,139,231,15,105,86,181,109,203,105,14,163,187,65,213,101,163,101,225,111,132,28,40,28,
+77,40,244,165,141,106,181,23,74,37,210,125,62,35,249,255,121,159,220,255,176,21,107,197,86,172,100,54,96,14,
+80,243,29,240,240,55,168,160,85,136,19,82,188,56,69,188,24,250,141,163,254,170,6,245,149,71,45,94,214,209,
+7,61,102,103,46,0,59,248,170,166,234,57,60,255,150,248,95,131,129,115,207,157,136,175,65,248,28,115,148,208,
+30,121,75,52,70,98,56,31,236,157,70,186,157,130,174,172,86,80,217,137,95,211,32,125,182,13,156,216,19,239,
+188,109,128,19,149,254,15,192,9,203,203,89,227,192,64,15,173,161,201,209,150,58,53,56,118,15,104,177,168,59,
+129,22,23,103,87,87,87,29,83,39,208,194,199,252,21,126,34,208,66,153,24,164,224,33,231,15,75,83,187,57,
+226,8,78,70,120,235,114,142,137,123,226,111,107,135,224,26,15,193,60,0,24,130,135,102,18,12,38,92,87,56,
+209,135,230,34,178,3,108,28,15,119,131,146,189,147,121,115,246,169,223,154,174,246,172,50,8,188,213,231,108,161,
+206,217,24,214,254,194,61,103,183,234,156,65,230,37,32,233,116,206,124,220,44,83,0,31,228,92,215,233,165,62,
+109,151,131,75,255,42,8,175,252,154,5,82,112,119,81,219,181,157,218,38,172,143,201,111,239,61,198,69,105,75,
+71,135,214,129,30,26,224,84,35,84,128,46,120,124,95,85,247,191,242,248,90,79,84,90,27,181,62,81,48,41,
+215,124,162,110,106,39,234,66,220,152,19,117,161,79,212,28,96,40,164,92,64,163,171,21,20,187,168,243,42,126,
+115,238,114,143,25,247,117,47,227,157,164,124,19,191,169,121,185,248,89,211,218,89,205,187,139,230,242,141,209,57,
+191,182,190,147,193,0,178,55,77,12,7,104,123,19,74,50,169,189,176,252,8,133,192,60,113,162,238,190,80,103,
+187,227,184,16,225,133,121,143,24,10,97,190,159,145,144,210,28,170,23,137,208,22,151,248,204,248,121,195,19,3,
+85,230,172,242,64,65,16,178,46,90,135,119,107,241,41,137,206,126,67,113,190,200,0,237,79,196,117,34,62,39,
+231,226,247,36,250,148,104,228,234,99,30,136,63,147,232,77,238,223,41,203,243,240,85,46,148,65,122,248,123,178,
+14,250,168,244,97,197,48,27,202,22,236,64,5,186,165,164,252,27,48,191,218,34,196,233,147,251,247,37,180,133,
+97,27,242,152,239,13,84,16,192,69,167,149,248,37,137,238,180,34,95,216,12,143,25,220,105,231,45,132,9,161,
+255,86,54,41,163,72,164,116,39,44,149,178,21,234,254,21,91,53,251,126,73,54,20,24,181,186,12,28,200,191,
+21,57,230,134,105,54,21,163,42,2,224,159,42,86,141,113,60,46,99,60,201,158,118,11,101,58,72,190,6,42,
+130,159,65,160,130,108,27,1,20,236,12,163,234,38,156,103,10,183,71,100,234,230,228,43,145,27,181,10,77,193,
+141,91,196,173,20,150,155,147,56,26,217,182,124,106,21,241,187,100,197,110,94,34,84,127,70,183,30,205,169,10,
+91,132,16,205,133,9,238,54,102,177,175,157,122,152,185,84,206,175,191,57,179,36,168,235,149,249,76,182,7,227,
+237,60,192,96,219,24,212,117,109,116,226,208,201,130,114,196,51,80,161,136,54,106,176,156,6,220,138,57,45,190,
+180,226,68,163,36,11,187,54,246,165,86,148,133,238,232,205,171,166,14,175,117,135,83,241,183,33,231,127,213,79,
+194,234,197,109,161,153,77,86,32,154,107,97,108,27,188,1,211,13,103,128,124,131,175,86,27,65,138,172,61,23,
+170,8,2,221,57,116,60,208,43,81,69,249,120,216,47,119,119,145,199,27,219,175,200,100,207,131,36,122,238,103,
+176,2,104,238,255,100,239,144,156,233,179,211,203,142,242,162,98,18,162,196,74,153,30,248,84,196,113,211,140,236,
+40,36,180,84,230,151,200,100,65,185,51,237,182,90,106,84,2,36,200,105,243,215,211,129,56,115,46,0,90,49,
+203,87,198,120,84,178,184,109,227,57,195,230,208,142,173,173,86,73,236,92,31,172,45,224,161,127,193,65,165,116,
+7,66,37,50,182,69,138,152,163,71,40,141,26,35,249,70,61,51,27,84,112,75,38,229,152,165,89,242,80,224,
+54,82,31,12,40,116,163,5,198,247,121,182,226,16,216,228,238,139,28,203,122,204,191,74,42,254,130,162,21,182,
+80,232,141,146,146,160,32,127,112,245,107,18,103,38,58,91,124,236,176,0,115,3,183,28,84,33,150,222,42,76,
+229,91,46,142,85,16,128,246,232,76,106,59,247,139,8,234,82,114,212,60,210,238,60,139,102,155,36,15,187,0,
+144,81,36,19,140,59,247,28,6,6,248,97,228,101,208,3,229,2,149,164,154,35,254,128,242,160,70,18,210,23,
+249,64,217,252,210,61,138,8,245,123,196,63,252,26,143,172,86,42,74,16,180,52,235,138,178,65,18,114,219,173,
+222,147,218,142,173,5,43,76,234,195,49,232,228,176,4,206,4,36,219,39,160,159,108,116,61,27,124,179,243,109,
+115,134,192,238,217,183,10,170,177,181,15,189,173,86,61,27,48,29,89,203,178,179,190,182,58,222,223,236,34,28,
+120,81,194,254,161,219,40,252,37,17,56,228,48,142,225,74,138,85,184,0,229,243,159,153,3,225,179,60,199,16,
+191,2,200,22,243,140,133,117,54,226,92,169,103,71,176,161,82,28,177,132,155,71,139,36,220,92,141,180,13,153,
+135,155,183,37,221,225,181,212,147,182,230,109,52,168,201,160,240,140,153,88,66,165,179,30,253,185,115,25,165,177,
+227,161,23,79,241,102,68,42,5,66,145,22,175,41,164,235,232,11,3,168,227,162,112,212,187,130,154,46,198,34,
+110,168,176,56,129,76,141,145,35,133,180,176,225,174,200,196,145,220,40,153,19,223,12,127,85,15,135,145,67,137,
+43,160,99,207,163,28,237,144,55,67,43,141,99,35,189,220,255,107,180,103,163,72,60,176,174,14,1,45,49,18,
+126,191,22,104,226,142,163,75,108,42,237,219,46,175,221,24,139,177,227,226,35,50,102,159,36,38,109,82,224,198,
+46,206,122,42,106,222,93,53,35,99,233,242,62,216,168,44,110,141,126,196,232,229,13,58,79,92,139,89,91,30,
+15,207,11,67,69,60,44,107,177,212,199,166,38,253,226,177,15,227,90,184,141,102,0,136,90,32,42,29,34,166,
+30,8,130,2,61,16,167,186,232,177,118,133,63,141,3,27,191,20,61,180,216,152,124,136,238,202,190,142,182,135,
+250,72,88,30,103,214,186,166,15,172,37,203,255,203,222,187,239,183,141,28,11,131,175,66,33,39,26,50,2,105,
+0,4,239,134,117,60,190,141,38,186,140,45,121,198,182,70,241,15,4,65,10,18,9,48,0,40,137,146,152,183,
+216,255,246,5,246,53,246,81,246,73,182,170,186,27,104,92,72,209,206,36,223,217,253,146,137,197,70,95,171,170,
+171,171,171,111,85,76,46,2,39,6,108,195,194,75,147,132,107,98,90,56,195,40,16,41,99,166,213,113,79,75,
+202,87,233,52,166,174,48,47,206,232,6,111,79,169,43,3,143,58,129,221,34,160,240,190,151,62,113,221,183,247,
+80,155,198,160,210,183,247,60,114,23,17,85,61,102,34,0,79,225,196,213,66,138,73,206,144,236,218,62,197,80,
+25,252,165,191,3,246,250,145,223,5,2,81,200,2,180,232,150,24,199,90,216,220,247,214,212,146,28,65,224,17,
+128,93,101,47,125,188,252,75,176,221,221,66,20,83,122,103,248,102,95,228,231,19,71,77,93,224,43,13,54,209,
+236,0,83,122,42,218,159,218,1,142,90,208,251,147,69,153,58,80,22,203,65,147,222,4,139,39,92,139,252,112,
+16,119,81,7,116,218,189,136,235,30,237,134,250,181,140,171,73,222,145,244,82,213,197,55,221,233,62,81,118,33,
+231,74,121,117,244,11,8,66,195,113,217,58,165,74,187,129,130,9,216,197,206,122,192,44,251,179,139,216,128,169,
+151,176,216,116,32,30,229,75,245,163,111,236,1,128,224,112,16,222,176,227,111,220,105,162,200,236,158,182,72,24,
+163,229,62,177,109,165,100,221,173,140,172,24,85,209,85,242,76,10,239,58,217,72,22,100,42,46,198,233,138,167,
+36,239,113,194,171,13,248,53,247,161,205,134,14,61,250,4,182,97,195,119,104,171,108,155,237,136,29,196,148,57,
+110,81,133,27,57,166,170,12,228,143,20,107,201,65,208,75,178,204,138,83,51,169,143,95,191,86,133,179,34,21,
+165,213,28,13,119,113,21,147,69,91,60,58,32,7,176,108,37,199,111,204,151,73,20,233,150,21,130,66,2,77,
+246,76,193,152,7,99,21,180,32,12,107,221,53,78,130,169,16,61,109,16,238,17,153,51,30,97,36,33,40,147,
+87,248,120,0,21,74,57,39,62,159,180,211,161,7,107,38,88,32,37,230,248,34,113,173,203,129,105,40,34,129,
+229,208,180,130,187,74,244,80,192,97,66,28,119,106,184,76,112,178,50,1,196,208,13,26,173,1,61,223,227,230,
+249,64,68,158,59,108,179,205,81,33,63,23,11,78,185,88,176,105,153,53,192,235,208,146,193,142,228,221,39,29,
+45,142,83,135,180,99,1,242,200,242,207,199,23,131,81,97,68,218,42,143,131,101,137,53,162,109,20,88,142,252,
+8,108,132,123,129,175,166,30,48,249,7,23,61,31,3,156,35,130,115,159,63,220,28,213,250,11,17,90,113,143,
+71,115,224,53,88,123,208,81,157,112,169,196,182,179,70,214,34,177,222,43,114,120,137,217,209,53,238,145,50,189,
+42,24,56,25,31,194,255,97,122,255,5,164,57,25,207,28,196,201,189,114,202,113,105,71,71,120,171,8,157,228,
+112,123,78,180,42,19,183,149,150,180,59,34,190,110,51,95,119,54,199,227,107,232,142,167,32,60,147,149,24,154,
+28,111,4,227,49,44,234,127,114,189,201,101,44,149,42,220,202,101,84,38,74,100,118,253,201,183,32,105,195,3,
+218,40,69,231,224,141,228,64,220,242,27,210,197,16,30,147,118,159,56,115,70,115,252,97,113,119,231,165,135,59,
+202,68,175,161,149,174,158,145,117,248,57,11,174,61,119,232,130,63,250,164,126,150,180,43,244,38,118,219,0,143,
+128,233,254,59,237,25,151,93,31,128,150,226,154,212,24,117,239,127,49,124,64,18,175,232,48,86,229,78,205,251,
+15,188,63,114,91,156,56,179,191,242,178,166,183,137,240,60,123,118,154,224,145,131,196,181,26,26,102,161,7,247,
+36,180,74,46,101,148,197,150,119,216,53,66,206,94,242,126,229,157,18,150,46,142,184,215,45,55,107,52,46,20,
+219,93,111,209,126,192,32,227,130,199,205,154,177,12,5,115,113,116,208,248,151,116,136,158,217,90,90,242,13,6,
+218,235,100,132,70,164,164,207,42,183,75,152,28,16,37,233,201,129,145,100,169,142,87,199,110,110,186,183,191,4,
+17,99,201,117,18,64,178,71,103,231,61,127,160,252,80,19,107,88,172,54,242,157,59,117,199,49,90,3,133,31,
+90,255,198,193,28,62,225,47,29,78,61,62,6,9,8,76,74,112,227,175,30,7,133,141,12,79,26,17,94,97,
+68,40,137,235,149,170,178,231,239,41,243,59,85,217,11,240,183,166,168,94,233,112,209,34,133,93,125,251,10,50,
+54,189,94,213,191,177,213,244,235,29,186,2,232,79,236,213,224,26,29,150,160,247,171,6,122,115,249,24,209,179,
+69,235,163,175,166,9,94,244,193,69,159,85,238,8,157,240,122,65,105,18,94,7,180,126,145,139,1,169,207,216,
+115,9,152,227,28,215,178,179,5,179,118,219,45,39,80,207,208,249,147,88,164,73,102,0,34,187,150,77,147,28,
+84,125,181,201,53,147,228,31,90,76,233,214,151,253,47,94,255,77,54,149,57,84,46,119,68,20,227,58,242,203,
+62,89,123,231,119,8,213,55,33,247,219,142,247,154,212,47,107,119,57,63,192,220,123,19,195,202,28,198,226,20,
+237,242,64,23,207,240,142,12,110,91,41,0,3,219,254,84,221,115,197,86,46,172,107,127,85,147,188,194,227,102,
+117,119,104,227,22,153,170,24,206,216,84,202,119,91,208,186,2,204,226,144,125,100,119,77,5,167,113,12,107,205,
+30,221,214,193,106,218,195,54,93,202,129,176,214,108,99,120,129,97,125,232,98,254,49,229,113,116,3,194,35,138,
+119,70,14,132,231,150,221,152,6,14,59,129,188,180,112,247,51,78,222,177,170,51,124,214,4,234,104,152,70,221,
+88,228,151,213,65,207,17,67,8,31,65,192,158,192,192,183,125,223,157,170,19,136,122,205,247,230,212,165,165,169,
+183,184,130,190,179,148,192,71,71,68,75,188,158,237,138,253,249,175,249,167,129,183,40,39,78,110,253,212,67,91,
+242,6,243,22,61,17,112,125,241,150,236,201,227,17,145,122,93,182,144,148,186,231,43,25,204,80,15,51,217,190,
+138,215,14,43,245,40,147,64,35,62,230,40,85,227,61,152,129,230,140,135,156,96,186,167,60,123,166,236,161,73,
+165,8,141,49,192,52,60,131,169,227,178,196,179,49,153,52,214,197,107,39,241,248,80,60,87,9,107,220,238,104,
+146,114,30,238,237,165,222,149,111,207,247,246,150,23,178,206,94,149,239,89,72,222,108,222,166,45,215,248,125,34,
+206,189,200,179,126,117,89,83,151,48,65,101,32,148,72,8,44,199,123,18,170,117,208,142,94,214,87,210,77,226,
+191,174,122,77,214,50,251,147,221,221,73,3,198,110,46,35,197,137,60,32,158,119,70,251,85,102,38,124,72,30,
+17,241,173,133,161,178,95,189,17,248,51,70,96,235,16,132,233,20,214,112,18,209,129,205,245,90,173,191,99,23,
+38,126,116,20,38,168,176,35,168,32,149,124,124,180,27,236,89,199,41,185,89,1,77,42,170,30,33,78,119,116,
+15,191,170,48,247,43,74,109,95,134,125,145,153,228,164,92,181,243,187,76,39,44,50,83,28,83,166,25,119,101,
+22,0,146,152,160,87,25,26,144,164,234,91,71,170,93,114,80,197,9,161,168,135,104,47,152,174,93,184,119,136,
+66,100,97,69,253,75,149,70,95,31,166,76,16,15,35,77,219,32,30,36,225,64,130,162,105,26,99,18,20,94,
+50,94,29,60,158,136,132,55,59,180,213,77,134,176,110,186,131,233,62,192,56,21,215,251,26,10,221,212,4,189,
+114,207,199,199,191,125,124,237,131,102,43,201,229,87,245,217,155,209,196,253,253,89,245,247,209,94,237,89,77,37,
+175,150,152,239,133,213,49,107,217,156,175,46,67,88,172,167,121,241,81,37,214,12,149,102,176,13,118,119,247,2,
+192,145,128,94,179,225,76,2,15,5,219,32,45,231,87,21,31,22,203,19,59,14,66,180,55,15,51,210,203,9,
+110,106,208,149,120,172,176,101,235,27,42,28,183,70,99,66,22,9,54,238,58,116,153,18,194,195,182,97,16,33,
+61,16,228,160,100,80,253,114,195,57,193,37,46,39,39,239,143,227,115,251,2,86,126,231,202,127,255,119,82,30,
+34,130,115,44,129,62,45,149,102,199,237,110,128,172,219,180,135,2,178,222,112,108,8,200,186,70,203,22,93,60,
+26,119,90,89,114,236,151,249,58,244,220,40,175,148,86,249,225,37,89,35,197,187,192,80,150,203,39,188,92,43,
+236,52,191,112,106,65,3,237,161,135,208,103,14,8,41,230,187,57,81,254,8,143,225,208,221,132,71,91,31,109,
+162,220,14,243,110,200,31,165,199,181,24,56,230,182,130,23,122,222,160,141,253,170,242,202,246,127,136,43,48,26,
+42,202,158,176,80,140,111,29,236,168,98,87,146,249,93,201,1,229,216,205,34,80,200,31,21,124,60,224,196,202,
+32,129,176,221,50,59,74,141,191,137,98,4,111,247,198,77,65,240,206,104,164,17,193,21,214,122,229,64,244,39,
+16,45,192,249,18,173,107,162,206,3,241,111,209,178,125,109,224,113,91,202,42,47,147,219,49,137,216,228,207,174,
+157,162,163,45,204,211,79,144,35,47,129,119,125,109,133,170,67,225,38,2,172,24,29,46,126,240,77,21,43,76,
+90,40,21,75,110,124,188,72,94,169,237,115,111,150,124,110,24,129,2,213,223,209,64,44,197,104,105,83,13,112,
+99,131,202,238,37,142,207,132,3,204,152,231,214,87,204,137,46,27,36,5,127,26,137,208,66,218,155,70,119,227,
+24,38,25,37,51,45,150,49,237,209,198,113,79,138,78,32,41,58,30,44,15,153,188,202,136,131,106,193,75,232,
+14,27,18,85,229,30,58,89,44,252,14,162,55,62,204,189,33,58,219,170,106,136,219,126,201,102,243,169,120,103,
+66,238,153,60,177,251,131,246,24,121,165,32,254,121,144,144,24,25,27,144,224,50,133,144,232,56,157,132,193,248,
+232,182,81,152,45,124,52,218,140,80,69,36,187,217,249,119,194,229,3,241,72,34,2,241,130,91,163,227,106,164,
+218,234,3,83,173,23,132,14,110,117,179,206,11,132,219,87,181,124,244,97,37,232,76,9,109,204,19,244,238,183,
+116,91,150,7,216,130,149,148,252,40,128,197,13,121,48,36,47,25,32,241,233,125,124,78,13,218,231,201,168,114,
+39,65,90,88,175,84,179,107,106,27,36,10,147,128,1,211,98,181,97,153,204,142,230,174,227,33,13,55,3,140,
+207,16,208,51,132,228,117,106,32,157,239,211,115,20,239,241,81,132,171,33,189,188,7,178,161,19,82,180,184,128,
+192,246,154,218,83,156,43,65,177,195,249,17,5,134,164,233,158,146,147,49,244,120,94,202,195,92,54,176,92,85,
+238,209,90,49,123,61,247,9,41,151,30,228,115,175,22,137,5,48,80,82,241,149,49,208,81,27,4,169,181,206,
+64,236,174,121,150,123,30,224,214,161,135,54,152,65,141,128,73,27,36,157,119,110,92,224,189,201,243,38,238,206,
+61,120,35,124,185,212,135,165,41,29,81,70,42,173,19,250,14,119,129,119,100,207,251,211,213,192,7,146,237,227,
+31,60,87,2,22,224,30,164,251,252,45,10,166,80,85,182,74,233,253,243,197,197,42,125,127,190,10,27,33,123,
+198,139,30,50,20,190,215,153,221,54,231,121,47,197,173,171,192,130,177,196,102,193,17,189,136,101,250,162,216,230,
+162,205,243,178,12,175,223,252,248,241,221,238,46,255,217,9,248,124,132,186,44,159,143,110,22,110,157,22,240,245,
+105,128,126,15,43,14,172,124,130,184,50,116,43,64,248,17,234,154,118,197,15,252,250,16,10,130,62,82,113,253,
+27,47,68,165,215,143,27,21,88,102,87,30,42,108,143,170,95,249,1,247,132,127,168,172,176,208,18,8,86,249,
+205,29,194,138,249,186,194,6,116,37,14,32,101,228,193,242,204,133,74,105,185,29,214,217,174,51,206,68,114,205,
+138,56,104,135,46,181,81,159,170,38,91,122,232,75,80,122,73,12,45,243,165,119,244,227,146,175,211,171,10,102,
+82,106,104,150,2,117,1,220,233,98,143,108,118,116,249,241,76,141,30,205,82,242,200,82,112,13,85,39,122,68,
+97,221,195,195,130,114,170,39,42,218,238,238,179,89,228,185,149,243,118,189,119,241,251,80,236,199,137,228,70,162,
+191,101,125,181,72,79,138,133,11,143,160,246,0,75,93,128,37,160,167,186,236,64,140,241,248,32,177,119,96,195,
+186,87,186,61,147,225,125,198,246,118,129,237,35,203,70,182,71,70,143,26,222,232,98,128,86,185,198,81,189,174,
+134,98,115,123,229,238,87,69,99,42,182,2,10,178,176,79,200,170,13,51,213,58,236,77,56,176,28,202,19,86,
+159,188,207,173,13,166,207,29,62,50,120,185,41,148,227,81,231,211,139,106,114,82,226,157,59,8,84,198,134,197,
+44,123,238,128,134,244,19,211,120,174,64,43,36,99,246,48,226,189,243,144,208,98,155,237,62,1,179,183,55,144,
+222,183,3,252,126,22,26,196,130,71,1,34,236,134,45,5,217,67,102,66,120,93,1,70,180,161,92,168,54,200,
+214,255,34,91,26,87,16,153,8,43,155,206,12,125,240,11,221,57,178,23,160,176,75,219,231,68,32,153,131,33,
+21,169,208,215,185,244,177,51,228,189,41,94,1,205,189,197,39,105,32,41,160,116,55,210,162,155,147,207,28,124,
+59,155,53,90,66,94,222,101,55,41,178,247,132,53,222,4,89,27,231,202,222,104,239,135,127,88,202,15,123,49,
+64,189,247,131,114,241,67,141,247,36,90,155,20,139,143,5,35,176,184,4,45,175,91,125,178,58,51,23,199,97,
+160,211,15,124,11,15,29,34,11,16,69,71,12,75,246,160,145,153,159,133,133,229,14,25,3,40,196,106,220,222,
+10,122,224,198,98,183,114,6,44,33,201,140,77,208,36,23,31,144,46,73,25,134,16,255,139,119,246,173,228,133,
+176,223,160,41,134,34,40,132,81,201,108,195,46,76,137,47,78,144,1,222,105,16,94,81,240,61,224,138,153,151,
+45,28,207,156,95,228,237,105,101,222,98,145,205,47,244,183,194,239,2,240,11,57,194,158,227,239,62,222,155,172,
+202,6,16,178,230,169,65,101,193,235,91,132,16,29,4,176,157,224,211,75,215,141,107,242,7,102,64,219,222,214,
+164,74,215,51,19,134,247,172,117,222,18,131,26,25,113,75,45,12,13,108,128,22,183,202,51,246,117,240,74,169,
+42,164,222,126,206,57,162,167,82,122,63,235,236,208,147,111,41,222,230,44,66,70,108,67,156,58,130,22,33,9,
+237,137,47,139,79,246,41,39,217,181,27,55,96,218,56,24,21,178,140,112,57,50,170,161,229,18,242,173,252,187,
+255,236,47,127,170,176,122,63,126,56,180,64,215,224,173,160,21,37,88,9,254,229,153,162,230,51,2,0,232,140,
+30,243,227,44,213,199,221,49,143,109,115,62,187,138,2,127,128,30,143,219,166,170,236,13,227,192,174,46,124,55,
+114,236,185,91,117,125,116,35,252,241,195,193,43,177,211,92,253,249,244,228,152,47,179,188,241,18,77,187,214,106,
+172,85,84,172,159,234,193,144,117,158,120,35,40,217,43,202,246,76,38,105,144,237,129,117,125,142,30,232,72,117,
+31,181,205,77,155,28,78,59,81,152,91,154,99,10,133,217,104,58,67,82,152,55,109,161,146,147,183,196,141,135,
+69,230,252,166,22,218,231,226,210,24,95,205,208,75,77,226,104,80,251,119,208,146,22,195,119,250,98,193,28,59,
+57,231,11,220,61,136,118,172,40,189,62,148,24,141,31,64,190,193,130,221,216,173,198,143,143,11,102,188,11,109,
+120,47,46,200,50,151,24,128,144,246,248,168,9,187,1,208,90,93,95,173,36,237,250,193,243,157,233,2,184,191,
+111,87,201,212,53,59,163,198,47,188,108,171,50,252,215,147,202,110,247,116,34,21,123,166,233,249,107,54,46,4,
+60,47,180,253,128,94,95,168,61,77,235,232,189,158,209,50,59,166,214,235,233,181,62,174,170,90,122,179,213,47,
+91,41,61,172,114,91,221,107,23,42,137,129,38,190,250,68,163,253,106,171,221,51,214,99,225,152,77,45,93,46,
+59,184,255,82,125,162,122,116,209,10,179,0,57,215,77,61,197,194,42,231,1,87,254,160,245,242,61,67,5,29,
+62,178,57,245,129,199,245,149,102,163,221,48,21,118,47,209,223,87,230,139,16,13,37,78,166,193,208,158,42,42,
+44,104,151,33,158,36,247,149,255,251,255,170,24,154,161,85,94,187,190,23,85,126,129,90,174,97,98,184,169,84,
+239,167,1,104,178,206,117,35,92,212,148,21,174,109,90,237,81,231,137,181,13,91,22,12,0,73,215,104,35,194,
+24,106,59,99,22,114,28,187,205,66,118,167,55,82,106,210,134,79,207,230,228,105,224,76,195,7,195,80,115,179,
+131,33,127,207,164,241,95,153,121,159,14,6,191,70,238,116,220,248,234,60,62,38,142,174,112,91,215,246,124,69,
+125,144,172,99,246,21,124,51,0,209,110,168,172,212,243,144,25,240,41,100,153,46,102,126,84,153,197,245,38,230,
+130,234,103,85,141,80,40,207,93,215,141,202,188,238,208,49,40,40,220,180,208,199,69,9,72,170,253,141,133,176,
+133,76,73,222,152,94,35,233,255,21,223,111,65,5,242,149,186,7,178,159,219,231,151,237,198,176,242,225,29,46,
+238,60,173,168,18,222,60,94,178,94,204,147,15,118,11,13,232,117,114,246,146,150,81,251,235,114,238,80,158,211,
+133,131,27,214,107,114,237,51,8,251,9,138,120,17,77,9,144,188,100,51,117,75,140,215,83,168,89,193,191,209,
+172,222,163,192,108,84,111,111,85,22,15,110,235,228,107,189,50,143,235,212,168,193,115,147,95,246,210,252,33,224,
+20,84,40,232,249,232,124,188,50,11,147,98,28,163,135,244,76,180,127,206,187,128,174,16,227,91,25,178,61,221,
+87,110,234,60,70,92,247,167,23,142,48,232,209,201,59,13,83,218,39,93,193,146,158,245,36,237,62,42,212,60,
+62,149,161,110,245,194,217,45,140,72,202,137,222,213,243,81,172,238,36,18,160,20,38,25,251,15,206,165,235,92,
+187,35,228,159,191,243,7,66,106,154,19,198,52,192,240,192,142,254,250,242,178,76,232,203,105,165,171,21,177,159,
+87,74,47,15,70,18,99,245,175,55,85,165,242,150,151,170,40,192,187,234,183,82,122,250,63,159,210,83,55,90,
+70,177,59,219,134,214,73,222,109,168,157,86,252,109,244,22,229,136,226,23,235,196,83,201,88,104,230,72,13,139,
+46,134,96,110,200,242,30,130,76,21,76,173,243,252,25,98,178,98,54,136,137,57,204,43,184,246,80,241,79,99,
+114,175,100,80,23,98,3,132,10,96,121,65,255,229,4,71,196,132,205,38,185,129,8,252,49,194,163,130,171,66,
+254,197,235,137,110,38,73,61,100,244,163,255,128,211,45,124,217,83,188,205,61,241,97,50,157,121,163,209,20,199,
+27,167,194,173,55,138,47,97,230,53,230,119,138,122,233,178,233,149,125,221,120,238,237,143,193,93,95,209,42,90,
+197,48,225,255,16,39,166,106,189,161,43,234,221,108,234,3,180,151,113,60,239,63,123,118,123,123,219,184,109,54,
+130,112,242,204,208,52,237,25,193,163,176,60,119,48,76,174,149,178,172,160,235,244,158,177,228,21,195,99,146,78,
+18,232,130,226,218,229,47,39,84,133,125,214,9,102,168,12,32,128,238,155,38,201,248,81,15,23,83,84,26,220,
+27,215,15,70,35,81,39,142,197,180,90,88,173,43,67,188,195,3,40,0,122,138,186,164,191,156,22,136,167,160,
+4,132,57,83,59,94,232,32,171,200,117,156,192,224,170,183,4,20,127,50,141,31,95,246,218,138,26,204,109,199,
+139,177,206,70,19,212,22,104,66,55,224,119,201,126,97,132,234,154,168,117,14,234,97,90,39,84,121,164,183,27,
+157,118,183,103,154,29,181,211,232,234,16,214,59,173,202,43,189,211,208,205,86,167,211,197,104,83,111,246,154,186,
+214,169,64,44,68,181,218,157,54,196,54,123,134,14,145,16,219,109,232,93,163,169,119,155,16,203,43,107,66,21,
+221,70,171,219,214,224,91,237,138,202,48,111,91,235,116,187,61,3,34,89,93,45,138,133,242,90,171,213,84,123,
+188,46,163,85,57,212,245,36,26,192,108,179,54,160,98,173,209,109,183,76,211,108,171,0,144,6,122,171,217,236,
+85,32,214,104,181,53,179,69,177,0,88,175,99,86,122,141,174,217,51,180,110,155,106,232,180,64,207,109,183,43,
+135,237,70,51,137,110,38,209,175,90,141,158,209,235,118,141,78,23,163,155,189,94,183,105,182,42,173,70,183,171,
+55,13,221,104,169,186,129,248,181,48,182,221,48,76,104,186,105,98,36,175,173,242,10,160,212,52,189,221,106,65,
+94,157,215,214,173,116,16,13,179,77,120,232,162,54,136,109,183,0,74,189,217,193,42,120,109,128,180,214,48,13,
+3,52,114,0,194,108,180,117,208,236,1,226,242,110,250,162,168,200,23,191,64,175,214,123,70,158,49,184,224,192,
+126,103,119,118,179,131,30,39,145,202,108,8,51,137,186,229,32,102,234,22,74,83,16,75,21,174,236,36,19,216,
+48,84,178,191,139,56,14,10,173,14,99,191,2,255,234,243,208,155,217,225,146,201,87,38,249,96,161,123,77,230,
+231,92,59,92,21,101,12,175,0,132,154,158,8,213,45,36,2,31,101,122,91,150,56,236,171,68,226,20,101,2,
+219,45,198,217,15,40,113,104,47,221,176,98,60,149,205,6,93,241,182,62,180,157,235,114,129,80,62,242,213,228,
+94,29,76,186,1,94,56,170,246,180,10,112,138,110,212,228,81,94,62,152,89,223,115,187,228,175,130,41,30,244,
+210,0,135,161,161,255,132,195,121,10,235,157,102,221,108,52,219,182,94,209,1,101,248,87,215,27,45,19,254,24,
+93,144,44,21,72,104,96,126,252,131,52,209,234,13,13,6,100,203,209,42,13,173,85,193,191,93,136,130,202,154,
+47,89,21,248,159,9,0,218,233,39,166,55,219,114,17,86,34,95,119,133,213,61,133,102,165,202,116,248,127,79,
+174,173,109,214,97,248,84,164,24,189,9,0,155,250,33,226,84,209,155,63,101,242,107,117,227,94,73,166,76,49,
+251,255,136,135,19,74,249,60,74,103,120,255,153,69,255,119,157,69,95,191,53,97,2,248,166,89,180,8,23,222,
+201,5,189,13,148,190,94,161,98,172,73,39,104,59,41,180,41,176,93,168,28,179,108,85,121,253,85,48,95,110,
+104,65,111,151,53,97,72,77,60,53,35,124,199,100,128,254,121,190,162,183,32,177,74,38,147,158,107,102,133,146,
+113,35,169,216,155,231,140,41,162,195,150,153,255,153,49,254,51,99,252,123,102,140,111,80,101,166,121,198,132,69,
+113,184,164,37,220,255,151,121,19,214,187,161,27,93,126,19,99,126,47,239,25,32,125,161,135,26,102,51,237,33,
+100,182,22,40,203,47,169,251,232,15,245,59,48,17,44,22,160,243,49,142,254,177,232,22,114,87,54,10,66,221,
+122,7,21,241,54,251,195,162,65,191,134,204,141,118,7,122,174,161,119,234,41,163,179,102,117,208,253,51,140,132,
+95,200,129,38,232,235,141,206,37,148,145,25,175,9,140,167,193,218,2,214,14,205,132,245,40,170,3,139,157,174,
+136,50,234,13,93,159,2,47,227,175,131,35,166,69,31,200,220,77,136,107,69,16,167,67,44,252,53,97,12,192,
+170,128,254,36,131,5,226,187,83,88,182,212,77,9,90,168,181,9,67,178,97,192,114,170,97,182,94,246,26,134,
+94,161,63,124,152,16,177,154,16,165,211,63,22,219,68,90,101,163,112,5,86,233,65,121,144,35,244,135,69,67,
+69,184,30,233,74,77,54,58,212,53,37,163,231,3,50,126,162,112,137,57,231,155,247,101,119,146,141,84,60,109,
+75,55,82,159,222,36,198,117,205,183,105,110,114,65,174,195,117,132,14,103,50,197,141,78,3,182,170,112,104,135,
+172,58,8,64,77,27,51,214,61,220,148,194,167,24,177,55,199,233,151,38,94,54,174,98,188,67,55,193,253,185,
+61,229,207,169,254,199,134,167,40,146,207,181,90,191,187,53,231,59,187,212,77,124,214,22,101,107,88,88,168,200,
+108,171,250,226,137,77,252,194,238,116,237,66,213,255,201,45,248,194,46,249,198,179,134,141,224,149,104,219,37,90,
+15,109,188,86,232,111,61,68,253,18,244,116,177,149,45,211,105,228,222,120,142,139,6,8,240,152,87,98,246,122,
+69,89,171,82,149,85,206,190,50,179,198,250,166,46,237,112,132,187,171,181,116,44,1,137,87,106,100,157,255,1,
+39,62,79,116,109,145,128,222,108,82,148,253,93,13,231,31,123,10,178,31,154,156,216,126,12,115,30,112,114,232,
+244,137,83,251,128,233,196,197,9,108,15,166,56,113,132,253,203,235,158,57,252,237,118,50,154,253,186,116,140,233,
+205,240,74,243,142,78,205,219,3,239,199,233,112,118,124,243,229,221,116,241,229,94,243,70,159,62,204,14,207,38,
+222,47,247,230,95,127,249,233,216,248,178,252,17,202,221,45,28,72,179,127,250,160,57,175,131,155,195,230,168,57,
+90,182,154,71,203,214,141,51,115,110,142,174,94,222,30,189,234,221,143,102,142,119,240,211,101,60,124,215,186,63,
+241,47,35,251,183,86,248,203,233,207,193,232,167,15,183,39,94,247,6,74,53,15,125,231,254,112,214,91,126,89,
+118,239,78,206,174,91,135,77,150,15,224,48,190,124,250,249,222,254,173,183,248,229,244,224,238,240,234,141,119,240,
+110,122,13,229,143,62,127,154,78,157,105,247,14,242,152,144,118,235,252,52,129,118,174,123,7,87,63,222,186,175,
+14,0,167,233,116,164,253,124,227,190,6,156,94,189,188,61,120,125,160,31,191,122,105,30,45,15,38,78,243,67,
+107,248,238,99,239,96,246,235,226,243,111,63,71,95,78,117,239,243,111,199,225,151,230,207,55,163,223,90,215,39,
+179,214,116,180,196,50,47,39,71,87,31,181,131,215,147,251,147,229,193,222,171,171,187,251,209,79,83,200,255,163,
+230,126,250,113,10,112,104,95,62,93,106,135,198,241,189,131,233,147,235,133,211,124,127,235,26,95,230,195,119,183,
+237,131,251,159,223,30,221,191,188,63,126,29,247,120,218,93,154,246,222,60,121,243,235,187,15,87,144,118,117,123,
+195,97,194,54,124,142,227,216,125,125,116,251,201,56,104,30,191,62,208,142,175,156,248,232,106,52,253,124,170,95,
+126,57,59,134,254,24,93,125,153,189,137,63,27,111,110,191,156,189,185,253,252,219,209,237,241,187,143,77,160,135,
+230,204,222,46,28,227,11,244,131,6,56,234,151,163,159,126,158,187,175,38,203,195,171,131,232,232,213,237,237,225,
+235,131,197,145,119,123,119,244,250,104,113,242,122,210,60,190,122,127,119,124,245,217,60,186,127,211,58,94,66,252,
+61,164,223,127,212,161,47,12,200,99,28,159,29,180,142,207,62,206,15,174,204,191,190,58,187,187,253,252,233,67,
+112,240,238,56,250,252,233,248,30,224,188,31,189,126,9,253,242,190,119,112,173,197,199,158,121,119,120,246,94,63,
+188,250,96,28,158,189,61,56,60,123,115,63,186,186,94,28,25,19,227,240,234,18,227,130,195,179,143,139,147,159,
+62,199,71,75,243,206,126,253,113,113,228,67,248,183,73,124,124,106,46,71,158,118,127,120,133,229,62,47,142,62,
+5,147,179,83,252,254,28,31,191,30,65,185,55,16,247,185,5,245,4,192,167,119,191,122,154,118,220,132,60,24,
+191,212,238,79,94,189,156,28,188,59,138,33,77,59,124,253,50,62,242,204,123,40,131,191,250,225,25,224,52,155,
+0,92,83,128,225,229,226,248,221,209,45,196,97,94,200,115,180,56,166,118,63,34,76,134,179,164,112,4,105,6,
+165,157,222,194,247,151,51,44,119,242,74,187,71,26,29,94,65,59,128,57,182,11,223,26,228,107,30,94,93,71,
+199,175,176,173,35,128,241,231,3,168,235,254,0,96,122,127,143,121,39,88,207,146,149,155,68,188,93,211,245,126,
+60,134,240,18,104,6,109,28,95,81,252,235,151,17,192,188,132,223,197,9,149,121,143,223,119,246,43,77,3,220,
+95,19,28,167,154,6,113,26,134,143,48,188,196,114,64,7,143,133,169,94,160,203,49,164,1,76,203,209,21,164,
+157,114,250,16,140,132,11,195,131,218,63,192,188,240,253,243,21,132,129,79,144,6,239,83,26,188,34,26,92,1,
+255,44,169,157,37,126,127,142,160,45,160,53,164,207,142,238,56,127,45,137,190,4,247,71,162,239,232,234,45,150,
+131,244,247,216,118,147,241,159,134,180,32,60,145,70,159,151,216,246,27,108,23,126,39,152,79,227,253,115,119,10,
+60,114,2,252,205,225,161,246,169,126,104,23,224,88,126,70,126,61,69,190,198,111,94,207,146,245,43,240,11,242,
+164,121,250,250,13,196,255,218,62,120,163,65,223,188,161,254,56,250,141,112,55,56,175,232,196,95,4,215,71,252,
+54,8,174,251,151,130,159,144,230,75,194,153,243,19,195,249,35,195,57,129,237,0,105,5,223,95,94,115,250,223,
+159,80,159,190,185,69,62,166,118,79,111,83,24,62,17,255,54,177,31,142,95,191,135,113,2,48,121,128,11,163,
+249,29,149,17,52,246,177,189,35,196,205,160,111,234,147,207,147,131,87,63,94,177,182,145,111,180,91,130,73,224,
+227,127,134,50,111,3,162,131,1,116,253,68,223,0,219,53,210,10,121,197,4,216,76,236,27,106,31,120,251,152,
+104,247,30,120,237,24,233,133,223,200,223,38,235,163,207,216,71,162,111,5,223,192,247,232,138,245,29,208,225,149,
+217,162,248,229,173,160,101,147,209,18,232,225,49,249,195,112,59,136,136,135,241,91,59,186,3,58,153,108,236,64,
+252,217,53,27,39,103,14,228,5,26,254,132,116,58,128,250,28,6,167,255,185,105,191,126,11,188,249,129,183,11,
+116,33,56,222,208,88,161,241,254,155,196,147,216,127,244,123,128,60,161,177,178,239,197,152,144,101,1,194,11,112,
+28,95,17,253,144,175,224,247,4,229,38,195,133,141,51,148,89,196,155,8,211,8,233,116,79,99,150,228,192,207,
+6,201,175,223,38,208,254,23,146,55,39,32,223,144,215,70,196,95,191,10,89,150,132,143,127,250,12,245,79,81,
+174,105,163,43,40,251,113,66,245,185,222,75,236,223,227,163,123,214,95,192,203,58,244,3,148,155,96,63,64,31,
+57,28,223,247,11,146,67,87,151,108,140,98,63,157,66,63,188,22,241,14,202,166,166,115,143,223,140,78,248,77,
+229,180,35,144,17,36,39,160,47,222,99,26,208,248,51,201,61,226,221,179,247,6,31,59,252,251,8,248,229,13,
+241,29,209,121,201,249,149,241,7,242,107,147,190,13,162,43,210,144,141,125,140,127,77,249,128,111,71,247,236,155,
+120,226,158,240,128,239,247,247,239,239,25,15,0,188,148,134,114,29,240,123,141,113,71,210,152,249,8,117,94,51,
+56,223,193,220,177,52,245,17,242,249,18,101,221,4,231,155,59,160,53,192,121,132,112,82,60,205,23,192,111,40,
+27,143,207,62,51,217,8,223,54,241,207,113,132,48,159,208,216,60,198,126,88,14,177,159,25,111,7,64,27,131,
+125,223,210,55,166,159,189,254,104,32,79,16,12,196,159,31,97,156,188,135,126,188,100,180,71,218,254,134,184,179,
+121,1,228,24,180,125,112,243,203,36,232,30,26,142,60,215,95,127,190,255,108,158,188,123,127,247,197,211,47,143,
+94,127,54,14,127,59,104,126,57,115,226,147,119,111,61,28,119,71,103,191,206,62,67,221,95,206,174,181,227,215,
+31,65,215,249,176,252,252,91,235,254,11,232,77,195,51,205,27,254,246,22,230,253,169,249,87,224,243,163,43,208,
+117,206,14,110,143,207,28,13,230,247,229,201,153,3,229,223,240,185,127,67,58,242,6,140,177,99,232,131,147,179,
+9,234,4,198,9,226,8,178,19,232,123,11,99,17,116,145,247,45,208,69,32,207,145,254,215,83,210,121,186,206,
+187,183,64,195,31,175,134,239,222,222,163,78,136,122,14,232,33,136,23,206,65,64,7,224,47,144,89,159,239,63,
+34,47,2,12,14,142,39,3,121,148,230,75,146,141,151,192,75,14,234,37,36,139,142,144,118,32,35,142,153,172,
+101,114,231,234,61,206,3,49,241,59,201,16,205,224,242,24,232,126,13,248,177,249,13,218,130,113,56,193,244,59,
+226,233,179,55,212,79,71,87,196,79,75,136,107,1,77,53,234,187,83,172,139,228,254,29,27,219,159,105,14,1,
+25,102,218,175,223,220,179,249,208,161,121,1,248,16,228,194,1,201,238,99,38,247,116,22,247,17,226,222,94,161,
+94,195,198,0,200,18,28,211,98,46,195,242,52,183,78,196,152,49,249,248,213,161,125,196,95,39,94,6,61,9,
+198,130,118,52,59,194,177,210,66,58,33,92,52,78,217,252,67,112,145,108,49,72,94,162,188,209,176,174,99,144,
+231,199,88,31,202,222,215,215,38,147,147,144,111,118,116,127,76,243,151,131,227,217,192,121,27,218,104,66,61,32,
+11,29,28,151,8,19,204,7,47,239,137,238,247,239,155,68,83,169,223,176,255,161,109,208,99,161,14,159,116,50,
+243,136,104,124,116,139,48,0,45,117,26,191,175,180,38,226,11,125,70,178,245,152,195,251,249,158,240,48,105,110,
+160,126,213,88,191,190,62,96,242,130,245,43,201,29,54,31,124,166,126,194,252,48,30,111,217,220,145,240,70,148,
+225,141,215,25,222,192,62,141,168,79,105,46,191,101,125,138,244,66,189,22,96,57,69,26,253,134,50,26,230,5,
+144,19,56,39,156,16,15,124,92,82,217,51,138,211,49,142,243,43,155,67,168,63,49,204,230,36,38,211,88,127,
+242,122,128,175,63,234,196,103,168,223,2,173,79,72,119,122,15,250,9,202,21,141,181,73,114,26,231,104,224,87,
+210,193,112,28,208,92,195,230,61,104,243,8,249,138,250,12,235,59,128,181,220,132,100,56,151,253,172,63,207,112,
+12,105,6,215,115,12,210,31,238,81,239,210,154,32,123,154,128,39,245,81,86,222,224,58,227,139,15,223,22,219,
+164,88,169,255,186,37,108,114,16,167,107,91,237,216,240,221,135,10,255,173,79,39,124,143,1,225,188,192,203,154,
+227,33,93,71,166,23,123,45,126,89,115,212,28,118,88,168,71,23,56,211,43,244,78,106,102,19,77,96,212,30,
+208,167,42,123,168,19,159,123,23,248,198,199,177,34,110,219,150,185,83,157,38,183,90,233,38,107,8,17,171,168,
+129,15,89,247,221,170,83,235,255,18,6,51,47,194,151,8,81,48,189,193,168,70,124,233,250,85,180,228,153,222,
+116,159,150,27,148,200,152,12,76,30,53,38,94,47,221,219,10,175,94,122,198,71,38,66,133,1,24,102,167,129,
+124,88,166,142,99,177,45,167,234,17,150,232,209,80,65,203,11,138,42,27,123,143,10,121,232,105,26,101,178,249,
+3,116,122,23,40,217,177,228,111,172,243,110,73,147,235,212,43,188,29,107,142,154,252,238,172,166,243,142,25,25,
+221,33,11,25,173,49,191,89,75,79,170,89,234,104,168,201,93,52,78,44,29,177,247,137,13,241,226,29,175,113,
+39,15,101,31,31,149,115,230,12,174,242,82,144,237,2,45,215,241,247,144,169,169,150,56,96,207,29,249,141,231,
+196,21,54,189,88,220,209,212,0,31,165,121,252,154,50,249,216,21,175,151,208,36,116,124,158,131,2,159,79,237,
+84,125,171,106,3,159,32,93,171,181,26,113,67,109,128,213,225,165,115,254,180,139,187,78,174,169,228,52,129,63,
+62,178,44,183,54,132,49,116,205,185,203,169,61,4,8,133,103,57,171,49,154,118,157,46,137,39,125,113,205,53,
+58,87,248,251,225,139,199,71,233,3,109,13,241,252,104,253,155,191,44,244,86,233,59,71,201,28,39,90,174,77,
+94,30,74,175,225,15,124,0,17,240,182,227,216,157,205,99,124,33,56,114,217,219,213,69,232,210,187,67,194,123,
+56,117,129,250,204,152,161,34,113,209,60,115,235,123,65,253,50,230,14,141,209,52,32,89,231,20,38,53,95,206,
+231,138,74,27,79,133,151,150,15,124,124,227,107,227,100,63,185,15,253,34,118,65,251,154,42,142,49,153,203,166,
+244,90,47,102,19,183,248,248,149,79,60,137,117,89,190,116,207,142,78,109,41,78,108,222,209,23,62,121,72,140,
+110,97,185,163,215,173,53,86,61,55,15,203,244,93,14,116,38,222,107,148,120,144,28,40,61,62,230,98,103,193,
+253,105,105,2,115,46,71,105,170,109,25,90,175,163,183,12,96,70,122,70,224,184,30,154,127,143,188,123,247,25,
+137,43,4,199,109,156,206,237,240,26,96,111,208,176,252,113,49,30,187,161,58,165,68,172,253,131,139,175,75,209,
+183,214,96,218,8,124,36,113,222,118,130,195,95,137,164,166,184,129,242,139,105,92,83,23,123,150,174,46,158,71,
+181,160,42,189,30,114,45,167,129,217,241,206,60,61,35,192,138,233,218,70,166,102,159,236,175,6,86,65,234,45,
+254,98,163,205,129,61,251,133,197,208,217,103,63,125,136,26,160,9,48,123,244,50,146,176,169,38,79,230,81,220,
+97,157,85,246,114,57,185,147,185,174,223,200,124,88,194,87,194,126,86,200,136,19,132,179,215,220,129,108,98,54,
+130,63,126,152,167,164,160,11,174,170,94,99,117,225,23,89,52,89,177,135,88,88,209,167,163,195,159,226,120,254,
+129,121,245,27,4,37,6,90,16,128,236,67,99,67,195,71,156,1,249,153,93,68,251,174,116,93,29,192,236,183,
+52,124,56,145,77,166,65,96,41,231,63,157,157,253,82,121,243,225,195,201,135,139,138,34,156,87,136,172,248,168,
+7,109,245,39,249,3,236,204,121,224,71,244,222,71,117,101,114,160,97,80,49,208,44,13,45,186,5,60,185,4,
+7,145,49,103,132,66,170,129,184,20,100,136,239,84,217,241,129,59,122,134,79,112,99,123,250,23,93,163,89,5,
+26,184,245,226,203,87,48,247,67,229,158,61,69,108,213,132,180,192,198,213,228,131,79,167,89,183,4,130,85,21,
+200,170,48,187,122,60,198,229,247,167,169,172,202,190,176,189,0,82,171,228,239,66,81,149,103,204,164,34,62,219,
+104,68,88,138,28,91,52,152,72,206,218,79,77,41,206,13,141,85,136,197,43,244,36,169,194,200,164,86,232,6,
+117,5,0,173,112,147,5,120,49,28,100,105,108,123,211,168,161,60,65,111,180,253,201,142,164,101,209,72,20,72,
+154,39,201,37,162,18,22,209,85,137,183,33,129,219,104,224,134,126,190,181,50,20,133,204,197,87,185,173,201,193,
+216,69,2,9,242,61,243,168,247,226,165,194,251,168,48,196,167,213,208,157,32,223,224,204,249,1,106,246,102,232,
+157,46,188,78,137,92,193,135,103,201,179,164,98,238,219,48,235,204,78,60,6,211,107,17,176,16,64,227,146,5,
+76,203,165,201,24,116,26,59,114,43,90,31,109,193,132,141,224,26,187,16,19,172,214,128,77,187,137,81,105,138,
+109,2,227,224,3,62,16,98,84,176,217,151,143,121,240,1,34,170,185,201,41,24,208,136,229,107,245,241,71,65,
+191,33,253,164,198,40,14,230,248,28,180,166,146,207,222,90,225,245,103,44,217,180,102,138,27,105,126,137,222,71,
+239,61,81,146,206,172,75,212,109,91,100,143,98,32,61,30,206,104,175,106,196,141,173,130,156,47,243,157,134,238,
+26,184,169,187,62,217,40,64,79,71,40,88,241,197,191,229,130,188,102,186,246,7,138,120,235,71,22,204,24,160,
+201,7,179,185,199,252,104,49,19,75,211,134,168,220,38,159,39,170,71,145,95,209,184,136,123,144,188,220,175,43,
+123,94,77,181,247,171,78,70,254,3,235,100,140,214,114,123,163,220,130,109,20,133,175,152,255,19,158,137,189,237,
+229,153,216,71,182,96,38,78,42,175,66,13,146,189,128,148,12,95,191,254,250,241,205,215,211,211,15,95,95,157,
+28,159,189,249,116,246,245,43,154,69,181,74,226,107,204,193,125,106,81,15,95,87,147,85,76,224,76,20,129,32,
+176,146,167,156,209,218,4,242,84,141,246,224,144,72,81,248,129,103,177,96,181,128,207,80,97,133,177,47,13,149,
+76,123,68,154,48,8,82,27,241,141,232,210,30,5,183,232,109,175,182,234,7,48,227,163,142,41,247,73,237,1,
+218,241,124,212,123,233,126,88,100,57,52,193,45,44,209,217,131,164,215,75,159,235,57,12,2,144,147,11,254,36,
+48,153,228,199,80,7,179,155,252,138,86,126,131,236,167,53,222,63,191,16,147,207,24,64,235,159,59,23,43,225,
+26,153,61,17,236,199,170,224,194,41,123,43,61,180,110,170,51,90,117,128,0,99,111,188,197,159,154,58,177,134,
+226,113,225,192,35,51,135,194,214,35,200,204,209,130,160,63,243,230,40,251,202,204,83,45,171,188,80,162,78,169,
+138,208,141,20,97,136,8,38,103,24,165,56,107,179,204,213,135,18,227,203,137,41,222,9,142,105,110,242,177,170,
+252,9,70,174,194,222,20,186,79,91,23,99,207,38,13,83,79,140,129,117,76,189,43,76,110,49,227,51,89,11,
+100,31,220,49,121,10,82,21,152,108,254,234,46,201,33,119,81,177,65,75,90,184,208,195,199,241,94,99,156,44,
+189,247,93,209,29,104,12,7,116,0,122,167,138,130,100,75,3,86,90,171,101,74,239,25,81,145,161,26,218,27,
+44,53,149,113,213,131,155,216,68,234,239,84,245,93,24,74,89,195,66,85,3,227,110,67,47,230,223,38,126,179,
+14,114,233,37,114,91,27,217,219,130,45,91,56,227,6,158,188,212,170,25,35,55,39,61,179,118,169,187,29,97,
+237,178,51,36,187,63,100,237,146,108,71,225,51,100,206,92,118,20,121,19,95,29,91,165,204,38,155,226,89,60,
+62,6,25,229,129,61,89,71,47,124,139,234,195,176,175,131,166,90,29,163,121,119,96,57,53,67,30,77,69,3,
+46,82,81,102,214,87,85,134,9,203,54,85,185,128,78,6,131,85,168,213,64,197,101,152,60,131,30,176,217,26,
+26,225,206,38,132,145,31,160,140,98,15,29,0,127,114,233,93,93,79,103,126,48,255,123,24,225,195,87,97,142,
+32,188,176,58,168,16,49,179,125,74,173,220,240,175,139,143,122,209,70,187,218,217,65,196,86,32,36,161,232,227,
+163,87,165,47,183,38,44,24,40,181,29,43,200,26,195,74,159,44,59,204,25,113,222,144,19,16,94,7,98,219,
+141,177,58,130,5,246,152,219,142,11,94,44,88,193,185,122,9,90,69,106,235,18,31,130,215,208,40,229,190,87,
+189,172,37,146,8,194,181,62,198,168,55,214,76,84,61,76,76,209,221,188,24,214,230,214,236,124,136,207,200,209,
+172,243,136,73,192,75,117,78,6,156,207,231,23,214,37,252,145,172,6,245,23,43,21,109,187,109,241,218,27,45,
+73,141,186,26,113,224,19,143,225,249,70,14,121,159,226,86,153,208,185,30,45,235,208,240,241,212,74,236,143,8,
+89,253,92,123,124,116,94,88,211,253,24,173,63,176,109,139,126,213,179,34,178,57,247,10,38,197,151,49,218,76,
+247,158,183,90,70,175,13,253,242,162,213,110,234,61,40,181,135,166,179,166,128,160,157,203,189,167,215,106,207,33,
+151,1,117,219,47,90,157,166,217,132,234,35,110,197,14,119,185,188,62,126,51,71,192,142,234,236,25,181,190,93,
+167,18,123,85,175,78,45,61,127,174,107,181,61,124,79,211,174,101,159,209,59,212,12,244,7,90,255,96,117,226,
+135,70,111,232,219,184,39,244,148,197,63,70,85,183,59,108,253,19,246,185,82,247,133,49,249,14,101,14,149,133,
+169,46,181,196,32,104,248,248,24,194,240,165,69,40,247,55,156,76,43,181,125,236,33,230,206,227,220,190,80,249,
+171,100,230,224,131,111,160,213,250,73,16,103,155,106,98,6,44,220,167,58,251,97,141,172,248,184,251,90,223,101,
+212,192,215,228,5,106,84,179,111,46,5,142,228,194,33,59,58,11,194,209,181,206,241,62,62,94,240,199,27,231,
+74,19,254,153,240,15,38,67,165,13,255,58,240,175,11,255,122,10,137,37,148,56,138,3,255,96,161,170,208,67,
+0,229,34,85,64,195,140,71,86,180,228,229,195,143,142,246,143,98,180,228,229,193,79,243,98,16,238,89,32,249,
+130,199,127,248,187,94,109,15,157,66,214,219,93,173,219,105,247,154,237,71,13,132,82,53,124,254,188,243,24,190,
+120,241,194,104,213,246,124,136,243,160,72,184,235,63,254,35,220,13,176,136,126,81,111,118,123,173,182,217,234,98,
+17,207,170,122,192,95,6,48,51,148,1,54,11,33,50,128,50,222,110,248,248,15,111,215,199,50,198,197,94,91,
+107,235,90,171,11,220,142,27,123,213,0,202,116,30,3,40,163,67,59,30,68,250,80,38,216,245,30,255,17,236,
+134,88,166,121,81,215,53,211,108,25,173,102,83,195,116,128,252,249,115,195,120,244,177,16,52,20,32,192,57,124,
+76,40,212,105,195,100,210,237,117,182,196,167,117,177,167,227,125,225,174,102,26,91,35,212,134,118,204,78,211,104,
+234,77,83,223,22,163,206,69,221,108,117,180,86,175,219,220,22,159,46,0,215,233,104,90,179,101,234,219,118,80,
+15,96,235,181,186,166,110,154,122,103,91,132,116,224,4,211,208,218,205,109,145,209,117,108,166,167,153,26,64,102,
+108,139,143,14,156,160,3,165,219,90,179,221,53,182,229,56,96,5,83,3,66,235,154,190,53,62,200,9,45,13,
+58,214,48,122,218,214,72,17,51,52,219,173,102,171,105,244,54,35,229,61,6,187,255,240,248,136,208,219,173,78,
+175,221,210,181,4,165,22,67,169,35,163,20,60,250,187,255,8,4,255,104,237,94,75,211,65,80,39,56,245,24,
+74,77,25,37,255,49,220,253,135,207,41,190,215,54,155,29,96,8,93,234,38,147,97,212,149,49,10,31,189,221,
+127,132,124,128,55,59,48,94,59,77,77,234,36,141,225,99,148,227,211,186,168,119,52,189,5,227,187,167,111,137,
+15,176,207,94,179,11,216,104,196,219,91,161,3,205,180,219,154,217,233,54,155,173,109,209,49,145,19,96,30,235,
+116,205,238,182,232,244,46,246,90,237,174,105,2,237,186,219,162,131,220,163,233,189,46,176,41,113,207,54,8,161,
+192,234,118,154,237,102,175,173,111,139,15,142,111,96,129,86,19,120,85,223,22,33,28,15,58,62,231,237,234,102,
+187,179,37,74,198,69,189,165,195,40,2,202,109,137,79,7,101,15,14,132,46,72,186,109,17,130,1,14,98,193,
+128,142,237,128,174,178,17,163,191,5,127,19,236,6,80,1,187,37,152,152,12,147,174,132,201,223,32,59,35,88,
+221,128,33,221,234,0,250,41,167,233,58,195,68,151,48,249,27,148,17,195,70,239,54,123,90,83,107,145,160,226,
+120,180,25,30,109,9,143,191,65,33,209,253,128,184,214,107,181,218,41,10,77,66,161,87,130,1,10,0,204,222,
+3,1,170,109,131,133,137,98,166,99,116,123,192,250,219,97,209,193,38,90,102,175,195,228,197,22,56,104,200,194,
+61,232,58,173,109,106,91,97,209,4,249,210,5,184,122,122,199,220,6,11,148,45,173,46,12,70,195,48,182,66,
+2,248,22,242,182,12,189,215,233,109,133,68,251,98,175,211,214,140,158,222,237,109,131,1,204,124,128,107,179,109,
+154,221,206,54,8,32,179,154,134,222,213,91,93,18,65,91,48,19,76,16,208,211,29,19,176,208,182,66,1,154,
+232,245,64,133,233,194,236,176,1,135,224,111,85,152,240,188,26,167,43,136,158,118,83,3,161,149,160,209,102,104,
+180,83,52,252,191,85,97,190,11,106,98,172,234,70,187,219,211,77,93,194,68,99,152,24,41,38,225,223,170,48,
+221,249,181,68,202,153,40,126,204,158,38,137,224,22,195,166,147,98,227,253,173,10,115,120,88,227,195,181,133,47,
+239,65,12,167,248,232,108,120,235,229,8,209,172,15,90,140,9,163,188,163,111,137,18,137,211,158,9,132,0,213,
+113,107,148,136,235,91,122,203,104,110,139,143,142,18,5,40,96,0,227,247,182,197,8,229,54,200,122,80,255,154,
+173,222,150,8,225,132,7,131,81,135,209,101,110,139,15,234,9,173,54,206,68,48,187,110,141,17,12,100,29,196,
+145,222,210,219,230,214,40,17,51,192,114,17,184,91,219,22,35,20,124,160,60,27,58,204,43,189,109,113,2,102,
+232,0,241,186,29,163,213,219,22,37,24,217,176,242,69,254,145,71,81,22,33,92,245,88,225,30,254,208,151,126,
+97,249,123,248,67,95,198,133,21,236,225,15,125,53,47,44,111,15,127,30,101,31,200,146,137,78,97,112,148,217,
+89,109,155,3,119,207,50,107,225,185,11,120,93,144,253,197,100,141,238,214,246,170,217,8,88,180,63,127,222,45,
+70,27,53,148,21,197,248,38,196,27,102,114,42,17,74,110,148,183,7,233,220,189,128,138,207,161,241,11,222,56,
+132,141,11,209,34,124,52,47,214,53,227,165,205,240,243,11,21,143,46,226,116,235,231,28,84,1,3,23,21,189,
+166,90,55,64,7,5,137,214,233,169,245,36,218,84,69,108,87,128,137,32,62,183,166,8,103,27,0,173,46,84,
+31,143,199,23,67,102,100,177,234,130,180,198,77,41,102,93,22,189,145,102,211,106,228,42,156,131,224,89,231,154,
+186,241,191,11,149,81,38,192,6,245,154,199,8,243,152,239,172,231,207,171,238,159,205,231,207,155,204,17,165,200,
+165,27,221,52,69,117,95,180,90,53,132,10,161,246,106,188,102,189,157,84,125,97,9,235,132,21,219,234,254,101,
+170,218,150,157,92,104,169,2,201,133,103,140,106,227,47,251,181,106,227,65,83,187,171,218,127,61,195,61,206,185,
+29,70,238,129,31,87,109,92,153,67,94,213,145,227,116,138,123,196,225,132,34,218,138,240,183,133,30,246,56,48,
+139,85,246,66,17,235,56,255,95,217,113,1,235,56,155,46,22,229,251,13,191,159,79,247,115,57,106,125,220,197,
+255,232,249,113,151,221,71,210,200,221,225,183,247,167,159,239,79,160,254,255,175,58,49,18,157,136,134,129,21,133,
+168,26,34,104,207,77,220,176,209,107,32,13,221,243,248,197,139,238,95,194,61,115,23,117,16,241,137,31,201,229,
+151,149,124,153,142,179,133,36,49,36,99,209,80,39,217,184,141,80,46,72,126,62,146,237,225,210,235,113,207,206,
+127,95,224,62,73,253,247,197,91,248,223,5,55,235,77,91,118,177,181,201,180,106,76,94,96,50,23,214,82,219,
+252,18,83,176,251,26,242,205,18,50,219,152,99,164,160,38,145,200,103,36,242,112,143,60,51,210,83,223,117,238,
+190,215,15,86,242,53,182,100,199,151,95,64,27,135,193,236,21,47,202,207,127,217,185,87,182,225,88,246,112,63,
+202,110,136,230,179,54,134,203,216,61,36,180,246,92,233,35,129,202,71,107,184,213,98,11,106,105,130,139,175,39,
+165,90,212,112,223,239,251,141,33,81,41,115,237,75,158,47,36,218,74,140,224,215,117,228,1,163,198,175,195,37,
+108,43,4,112,213,85,141,26,242,111,2,236,122,58,113,7,40,161,68,153,75,113,171,33,116,17,19,177,85,175,
+180,70,38,172,64,13,123,232,152,67,195,238,180,135,189,142,222,27,245,112,91,167,227,180,122,6,90,146,119,170,
+30,218,168,159,78,3,165,6,124,85,118,62,81,197,141,236,214,110,12,179,26,11,161,215,73,171,26,51,5,188,
+234,242,223,144,126,19,106,147,150,206,242,135,43,181,244,56,90,226,187,199,71,233,163,120,93,76,62,15,74,111,
+75,100,93,205,105,143,49,14,255,248,185,182,207,140,204,218,119,213,120,207,85,181,90,95,24,157,101,71,186,27,
+90,178,74,239,176,49,49,207,252,137,166,44,1,98,223,133,108,14,158,144,57,9,218,120,105,10,134,231,2,210,
+124,72,171,169,211,23,139,253,252,32,3,144,170,129,181,168,79,249,88,147,211,200,222,116,142,25,61,242,29,144,
+227,92,60,21,155,162,147,25,242,45,87,141,106,232,33,117,85,173,169,151,18,86,236,42,80,169,137,93,196,134,
+37,255,232,249,118,184,172,210,149,80,58,119,95,149,212,193,50,101,239,51,144,47,74,28,18,123,86,172,10,127,
+204,52,2,211,97,192,181,28,43,205,156,29,32,108,238,11,146,185,47,113,112,121,137,218,75,90,168,76,141,201,
+184,248,196,92,214,218,2,101,136,229,41,147,90,139,79,171,65,17,249,13,83,168,52,234,243,106,145,191,86,45,
+202,160,1,131,196,3,25,225,97,207,134,220,35,17,163,7,93,192,0,41,60,71,251,212,170,60,224,213,48,139,
+24,69,91,69,47,30,18,161,20,37,211,97,150,150,122,22,189,252,54,29,166,132,176,19,55,62,141,51,158,162,
+147,163,112,108,188,47,145,151,53,223,151,97,81,17,134,126,10,14,63,107,195,67,33,185,145,168,208,72,92,134,
+104,76,50,59,139,108,50,255,73,56,199,13,226,185,34,50,116,13,56,88,102,124,125,51,167,17,18,171,102,98,
+168,193,76,12,107,46,91,47,239,233,146,227,57,225,149,210,37,203,223,231,182,172,107,217,92,215,178,83,93,75,
+2,35,70,225,161,13,108,84,186,108,166,117,216,168,116,249,160,109,101,72,236,163,103,224,109,20,175,32,85,178,
+124,161,120,121,114,92,170,120,197,164,120,5,248,11,138,151,167,230,32,67,236,137,210,165,23,111,88,154,36,137,
+200,213,162,28,91,234,24,9,23,82,128,140,147,209,62,230,160,197,244,125,44,45,9,86,43,127,5,80,76,150,
+217,108,155,101,39,215,252,173,145,44,153,152,78,160,198,228,222,220,179,124,89,190,229,133,162,52,125,8,209,231,
+149,137,190,160,234,151,233,255,69,246,166,181,128,183,159,155,28,132,162,194,135,14,9,192,178,245,129,224,246,114,
+2,252,155,229,99,118,153,241,7,9,197,114,204,182,16,144,229,196,250,35,229,101,57,104,101,178,147,221,100,41,
+147,176,233,133,57,105,81,65,240,163,23,12,12,224,58,96,109,99,27,101,40,171,103,193,235,33,238,46,147,191,
+153,59,130,235,155,18,98,180,68,180,174,45,35,68,100,137,216,204,149,41,17,44,76,64,216,165,26,255,58,129,
+193,220,127,145,151,194,167,252,5,119,198,61,59,185,65,197,220,131,58,210,45,13,186,65,5,170,182,33,252,5,
+163,199,2,225,47,120,220,233,36,254,130,71,26,229,153,91,81,227,55,215,190,62,178,241,94,79,73,119,160,164,
+219,39,71,202,8,17,122,15,200,57,160,45,220,169,17,119,61,240,2,176,83,101,254,216,45,186,83,67,87,193,
+203,189,66,30,248,120,233,213,142,61,124,232,18,186,142,235,221,128,108,67,19,122,123,10,124,255,125,225,225,43,
+53,105,79,107,133,245,115,71,22,55,52,106,230,234,208,186,65,14,85,39,240,11,61,163,46,225,23,216,101,224,
+151,203,254,37,99,161,27,242,9,173,186,153,39,18,41,98,195,36,87,13,93,83,173,202,175,20,77,210,92,210,
+221,205,91,11,29,208,198,116,209,125,48,58,191,69,223,124,234,26,104,240,89,197,237,38,64,112,49,125,91,219,
+143,161,154,254,90,56,88,166,213,42,231,120,214,167,235,109,1,170,56,125,79,117,125,16,135,142,219,191,84,19,
+47,151,204,37,109,219,117,135,79,250,12,228,62,76,25,143,121,18,143,17,127,58,174,233,10,254,236,246,140,150,
+224,79,238,130,115,106,57,212,69,11,122,186,66,96,0,111,10,119,120,244,83,19,247,223,184,187,198,181,206,46,
+96,74,16,247,175,173,157,29,244,181,183,19,53,22,126,100,143,93,116,116,38,98,210,91,123,192,249,73,172,31,
+156,209,187,146,119,192,31,37,238,152,241,18,145,194,244,248,244,50,146,139,87,236,66,85,33,251,111,53,188,108,
+40,62,84,186,185,27,214,184,35,27,107,204,119,88,34,225,113,82,212,176,239,246,21,5,103,12,24,6,254,126,
+213,217,223,65,135,57,228,217,167,74,87,187,251,66,129,67,247,94,211,125,230,162,168,31,136,55,55,253,36,202,
+166,219,107,171,90,85,120,141,150,239,219,10,29,171,204,169,94,153,243,105,144,162,187,187,92,160,115,28,208,221,
+50,125,147,112,194,139,155,185,203,167,110,35,185,146,89,234,251,16,248,169,99,182,55,93,208,37,207,162,194,145,
+13,227,33,226,39,183,213,76,46,232,50,111,154,141,241,26,199,45,236,130,149,223,96,109,130,168,17,65,11,68,
+213,0,164,14,13,91,164,85,44,238,113,162,151,77,24,165,168,215,119,186,205,222,218,43,181,231,138,116,55,77,
+81,149,172,127,23,136,240,162,95,4,197,79,198,10,57,223,46,56,35,85,176,47,14,3,16,14,174,232,17,169,
+115,20,130,8,10,163,239,110,186,3,187,158,88,236,66,227,102,255,53,252,113,38,57,16,199,241,76,110,73,215,
+205,40,146,239,77,162,58,57,48,22,247,116,187,116,127,55,146,102,10,71,242,62,63,149,188,207,47,164,153,5,
+214,119,47,20,244,36,248,156,124,7,166,222,124,97,110,17,142,184,97,250,88,128,188,127,243,245,151,15,39,103,
+39,10,222,15,205,184,35,28,150,33,54,218,187,220,27,195,92,48,218,83,158,41,24,94,169,147,236,158,64,3,
+175,49,187,213,97,149,13,175,134,51,13,208,213,32,191,129,23,243,71,11,191,121,254,40,184,109,48,58,37,154,
+11,123,141,3,114,119,105,149,120,231,157,86,21,111,28,210,144,7,37,80,185,178,111,108,4,65,233,39,23,119,
+93,230,40,170,49,242,64,114,217,75,139,155,240,117,50,78,159,80,178,55,162,208,17,194,46,4,40,45,186,42,
+30,167,128,9,207,80,106,204,158,75,33,38,9,98,137,219,168,183,124,220,101,48,133,208,219,149,122,155,89,111,
+224,51,214,212,195,216,40,64,71,54,187,187,180,245,67,62,49,62,9,95,186,151,241,108,74,46,24,106,252,85,
+44,140,132,213,45,72,168,9,170,40,75,78,199,216,74,252,43,114,255,87,245,122,45,113,64,63,191,56,183,207,
+227,139,100,159,250,22,22,57,131,232,124,70,147,94,202,182,92,100,176,103,236,242,189,250,194,45,81,241,24,112,
+191,122,131,215,129,81,9,81,217,147,193,27,149,98,168,219,66,108,1,157,206,90,208,160,154,220,239,116,247,195,
+62,10,107,118,169,147,156,62,111,121,143,221,104,210,189,116,54,203,185,163,196,175,175,171,183,155,137,167,110,99,
+56,76,198,135,73,51,158,35,205,138,52,62,104,50,229,227,131,223,149,29,75,222,156,70,146,143,242,57,221,94,
+118,123,88,255,165,53,111,8,151,212,137,124,129,65,51,111,252,248,241,221,187,207,95,79,95,190,125,249,225,224,
+235,193,217,155,15,47,207,78,62,156,194,248,89,200,78,205,97,0,41,215,248,104,1,70,8,147,47,16,4,158,
+4,14,8,241,138,110,150,69,164,5,200,106,176,118,154,93,168,115,245,78,253,90,123,192,25,207,85,23,140,29,
+174,213,67,245,72,125,149,127,197,26,3,245,231,187,187,103,226,85,250,25,105,130,51,152,230,232,253,184,136,62,
+1,94,25,240,23,100,226,213,216,176,95,124,160,47,61,249,13,19,117,159,189,1,155,124,91,246,229,182,217,87,
+91,228,67,182,186,178,92,208,78,83,255,225,167,244,36,198,146,222,190,171,47,173,147,243,155,139,199,199,147,188,
+231,120,160,208,9,240,176,122,102,33,105,94,62,62,190,170,206,107,234,177,165,208,114,1,166,102,23,50,52,120,
+167,61,62,190,68,34,30,131,146,112,109,121,213,99,166,108,34,48,184,172,184,220,41,62,186,223,221,189,166,247,
+117,80,98,140,90,203,117,13,122,229,18,47,158,239,219,213,107,245,178,214,47,185,108,125,13,160,238,238,58,144,
+126,3,74,36,176,55,132,174,96,1,70,107,176,49,186,160,61,191,186,176,110,241,144,103,110,89,19,0,27,254,
+223,64,5,104,135,62,171,167,56,212,207,74,248,235,165,180,96,92,81,93,59,95,145,40,55,232,14,238,236,241,
+209,169,158,64,155,103,48,42,80,185,57,83,231,248,194,234,208,98,51,118,212,127,85,157,212,84,100,234,254,221,
+254,25,124,13,65,150,50,202,192,199,18,212,147,175,180,39,117,132,12,118,88,67,130,238,156,238,238,210,231,201,
+227,227,20,42,63,82,15,207,143,46,216,219,233,138,95,125,224,30,123,93,149,40,134,239,63,72,23,29,245,103,
+143,143,167,43,245,48,89,105,28,146,248,192,69,215,118,122,49,215,121,113,63,134,175,171,164,97,85,246,70,208,
+219,221,125,230,219,40,141,43,120,158,198,15,219,130,170,71,107,66,154,160,159,186,155,191,70,41,192,97,71,170,
+64,126,181,149,120,166,7,238,245,162,10,122,59,182,253,74,192,231,148,100,90,68,204,233,81,207,183,184,195,46,
+115,119,93,233,236,148,63,222,193,215,42,186,250,144,123,122,35,10,173,86,181,115,253,130,212,207,110,94,253,92,
+47,190,29,141,196,113,32,185,98,103,139,20,124,63,85,91,43,227,106,15,194,231,176,91,27,216,200,57,241,62,
+190,240,138,85,91,245,170,26,233,222,180,171,25,18,89,144,238,91,60,198,74,116,110,78,92,249,105,168,152,222,
+250,165,47,71,161,21,100,165,13,78,1,201,17,32,224,153,232,255,66,175,28,148,12,109,31,61,131,206,241,125,
+34,41,247,228,147,55,19,83,166,117,137,119,145,89,151,243,185,130,64,141,158,230,54,149,82,183,136,184,218,165,
+83,176,208,6,253,102,86,221,172,191,42,252,169,148,178,199,57,52,153,205,233,165,13,242,107,237,171,178,87,221,
+219,11,247,252,90,186,145,76,207,93,84,156,123,55,140,20,233,117,218,70,182,240,247,243,117,36,212,32,195,26,
+192,13,58,89,63,232,175,201,39,188,202,34,159,244,76,199,126,114,248,0,80,207,254,244,248,123,42,188,127,111,
+60,203,172,238,83,122,70,231,120,19,36,81,177,66,122,76,20,238,88,14,46,87,139,235,58,119,31,217,185,191,
+179,131,155,218,182,229,193,170,55,156,217,83,239,190,180,187,19,177,208,8,93,208,99,29,183,26,168,74,3,159,
+150,203,206,187,209,196,174,215,192,7,199,248,188,205,129,240,241,203,179,131,95,223,88,202,177,130,142,228,27,191,
+156,28,126,126,123,112,120,104,41,191,40,18,93,61,36,71,219,222,228,173,211,48,199,248,218,26,214,115,244,78,
+201,101,199,214,231,113,195,83,127,120,246,151,157,202,41,114,93,72,94,106,43,55,90,163,213,232,86,30,43,71,
+7,103,149,67,207,113,125,16,6,143,149,137,23,95,46,134,160,85,207,158,205,61,178,161,50,183,125,227,89,196,
+74,86,254,242,12,53,221,135,49,40,221,245,177,61,243,166,203,126,100,251,81,61,114,67,111,60,168,207,162,58,
+153,246,69,35,24,117,123,116,181,136,226,190,174,105,127,30,212,153,65,144,242,212,213,48,24,45,31,102,48,163,
+120,126,95,91,217,232,24,98,234,170,118,228,141,92,152,86,2,152,245,213,75,102,253,195,183,111,212,200,37,236,
+31,248,106,161,63,156,6,206,245,234,82,103,80,145,253,13,195,157,13,120,125,141,118,199,157,85,180,213,216,155,
+56,54,61,226,85,233,5,39,168,132,160,204,231,43,9,31,4,164,195,224,14,235,66,43,46,124,137,129,81,131,
+53,209,220,68,189,54,8,110,220,112,60,13,110,251,55,94,132,123,113,43,251,1,157,47,76,200,70,115,221,65,
+131,244,125,178,97,205,214,83,89,194,140,92,39,8,201,39,111,61,186,246,230,125,38,244,162,149,221,183,105,185,
+161,218,253,75,108,224,33,88,196,232,175,143,249,62,65,146,141,70,104,138,129,83,128,12,125,51,78,93,13,85,
+220,170,245,39,44,233,150,129,233,249,151,208,95,241,64,142,3,185,1,4,94,225,20,170,94,15,71,48,175,187,
+106,100,207,230,153,190,62,125,91,57,10,252,64,61,117,39,129,91,249,120,192,190,62,4,67,24,120,44,124,228,
+250,211,64,125,5,146,205,131,238,154,65,20,96,234,184,131,180,111,116,119,182,26,141,125,25,86,47,134,49,229,
+172,34,0,120,42,245,98,23,24,71,6,209,212,180,85,180,0,140,22,115,41,87,167,245,231,1,17,35,233,131,
+121,192,44,132,131,186,58,37,197,96,144,117,54,210,71,67,209,88,4,107,123,0,216,227,96,214,175,55,140,22,
+64,134,117,199,193,28,62,241,203,94,140,188,64,189,1,62,12,18,78,97,174,18,235,140,97,40,3,208,58,174,
+158,35,59,132,193,52,186,168,37,89,113,25,155,176,198,202,155,77,160,177,16,168,156,116,17,130,112,51,161,242,
+125,124,50,15,11,4,193,63,151,222,104,228,250,43,230,33,66,37,151,127,248,8,157,60,8,194,16,192,7,214,
+42,50,13,176,145,157,233,163,76,231,18,133,68,140,76,37,17,151,140,58,185,161,135,2,23,243,84,214,238,3,
+49,107,234,34,132,240,56,39,55,138,116,64,115,161,178,15,160,238,204,131,47,94,24,37,71,133,165,176,152,139,
+100,176,225,58,223,14,209,54,83,159,37,173,50,249,250,253,250,44,184,175,143,97,33,30,213,61,223,7,206,146,
+155,91,155,204,1,40,73,103,21,23,19,138,29,52,152,195,224,194,225,142,34,196,157,142,160,65,158,9,56,77,
+80,79,202,52,69,3,32,163,50,49,194,171,206,73,17,41,150,73,7,209,51,130,137,232,109,57,180,116,199,71,
+59,201,211,164,61,220,72,136,221,58,13,50,49,230,133,101,150,82,150,93,59,22,18,102,74,58,223,94,196,1,
+239,8,178,14,3,48,138,174,37,223,157,23,223,133,101,74,42,86,149,191,152,13,221,16,59,137,87,70,29,1,
+24,121,126,157,115,206,154,140,32,5,179,25,31,56,115,75,128,71,192,87,206,101,41,167,33,194,212,165,3,33,
+78,131,241,24,55,251,235,198,252,46,91,60,109,147,69,212,29,172,97,154,133,111,93,222,84,170,151,65,65,131,
+39,45,67,14,62,153,49,28,129,212,218,65,66,67,92,240,203,138,155,234,81,103,174,191,200,77,107,209,98,134,
+46,1,146,216,169,23,197,228,29,66,96,206,160,0,164,110,236,114,174,89,157,51,121,116,161,162,153,53,144,170,
+110,70,200,173,254,162,246,237,49,206,211,125,102,91,163,140,51,4,99,23,163,86,164,84,124,15,51,73,83,190,
+54,191,203,72,56,189,209,74,103,87,123,94,191,132,88,114,244,84,156,133,153,2,146,206,211,253,63,141,199,99,
+62,28,255,212,28,154,205,150,62,144,69,44,118,5,116,19,115,251,170,178,159,250,194,83,127,68,199,101,71,182,
+115,74,49,111,161,68,50,83,242,73,82,253,201,157,222,184,56,254,42,199,238,2,103,216,68,121,74,81,105,116,
+67,236,26,62,12,235,119,124,46,24,48,95,33,100,230,3,201,128,38,73,102,144,255,208,157,120,67,111,234,197,
+75,80,54,56,208,102,183,235,2,10,114,247,14,114,42,6,235,56,187,79,210,47,75,124,50,215,210,23,142,102,
+0,152,74,56,25,218,213,142,161,234,166,161,26,173,150,218,48,106,131,237,179,174,236,70,162,192,36,1,106,55,
+209,104,56,220,122,171,141,164,207,131,138,183,16,67,146,82,54,77,73,177,59,18,37,58,67,123,52,30,131,250,
+167,94,26,234,101,83,189,52,213,203,150,122,217,126,200,74,83,89,143,104,105,90,142,83,12,46,201,235,92,25,
+192,201,95,68,161,54,160,173,26,208,64,3,90,104,64,19,13,104,163,1,141,52,160,149,92,189,148,47,171,138,
+2,77,86,88,242,210,144,98,245,70,155,197,3,192,205,76,188,201,226,1,11,51,19,207,235,1,212,90,114,60,
+139,109,171,2,148,148,129,86,243,68,165,70,47,61,172,2,88,139,251,145,186,120,216,168,118,2,19,87,220,209,
+196,141,6,155,147,87,246,112,24,158,199,94,60,117,47,30,146,65,201,8,168,181,144,23,70,240,229,142,6,206,
+34,140,160,47,46,221,233,188,156,11,65,225,124,200,245,72,43,153,40,24,91,17,252,3,121,140,54,181,102,199,
+52,196,48,69,182,145,40,208,65,108,81,143,69,91,93,2,56,156,181,22,17,171,112,197,18,50,99,222,237,13,
+155,185,97,95,138,86,20,160,201,73,40,48,106,182,59,41,156,44,145,129,11,10,21,202,205,191,47,96,245,34,
+154,159,186,227,152,99,195,107,24,193,162,198,53,5,167,81,122,170,75,16,43,84,88,95,166,149,85,230,253,169,
+13,226,219,193,67,145,135,44,219,106,171,96,170,46,166,15,233,20,11,223,193,180,194,254,46,48,13,254,95,161,
+76,240,41,248,131,154,32,47,84,105,131,144,127,234,97,182,169,247,32,13,4,198,158,80,148,166,16,166,37,193,
+68,224,160,109,77,208,146,87,172,222,52,177,78,118,45,153,183,68,168,51,83,204,117,60,208,86,68,73,2,179,
+80,114,138,235,102,208,84,230,151,246,106,52,173,140,226,204,128,235,192,128,195,216,81,130,137,41,99,2,163,145,
+92,226,148,117,255,224,155,217,205,117,199,218,56,97,15,179,213,210,218,218,160,116,174,100,173,54,50,206,121,114,
+48,32,167,136,22,57,95,152,114,20,121,132,226,212,206,84,199,189,251,100,24,151,11,251,116,32,100,139,192,122,
+57,240,71,249,66,210,12,199,202,231,10,49,147,122,153,34,77,99,216,54,155,107,219,185,181,67,31,96,207,181,
+50,132,78,90,91,132,12,17,102,10,184,221,86,59,87,96,24,175,85,156,6,164,191,231,35,243,223,121,180,185,
+250,158,29,204,156,136,101,172,146,157,83,185,48,155,7,30,154,126,46,229,128,194,92,158,240,89,183,132,245,194,
+156,30,150,114,162,193,4,10,113,6,201,77,166,178,51,163,211,165,146,52,213,120,18,63,89,253,20,125,224,234,
+72,101,24,82,144,16,163,80,113,250,199,232,193,191,177,150,108,153,180,210,127,174,244,58,144,68,244,34,194,21,
+4,173,106,37,134,42,137,141,138,145,133,136,220,202,138,57,52,205,45,208,208,24,36,177,244,191,69,239,74,27,
+82,41,200,116,173,242,241,80,23,19,95,175,219,42,81,193,104,158,198,74,132,42,71,21,178,112,86,74,176,242,
+217,74,245,113,167,149,17,81,79,214,47,12,86,242,117,133,212,90,54,37,171,120,212,165,22,164,89,183,158,147,
+39,120,211,0,151,213,35,86,111,230,235,92,124,93,60,240,161,62,114,199,246,98,26,15,132,239,73,88,88,240,
+209,95,71,199,194,113,36,1,47,249,237,44,147,209,165,164,206,3,39,213,33,117,94,38,186,216,145,198,184,227,
+62,77,246,66,3,114,111,102,90,40,233,89,195,236,116,139,77,48,141,125,83,19,127,64,127,97,117,27,166,164,
+44,72,198,216,182,155,229,32,241,58,190,97,240,181,52,85,239,26,106,187,243,228,216,203,228,92,211,164,90,136,
+46,246,100,83,179,93,83,203,227,52,178,141,166,179,9,167,66,79,138,22,202,122,210,238,217,205,94,190,137,78,
+215,109,154,27,155,248,131,122,114,237,180,159,5,104,212,131,21,149,54,88,91,195,55,244,162,209,52,212,110,91,
+213,158,236,68,57,99,105,115,106,46,178,216,127,35,183,101,20,112,113,198,230,104,19,46,133,222,99,181,151,244,
+157,99,154,189,66,245,195,150,217,220,88,253,31,212,115,184,193,33,67,35,31,101,100,32,146,19,114,106,166,92,
+87,1,109,140,236,151,70,230,168,79,113,37,123,7,18,211,206,30,114,11,194,84,15,147,149,237,100,225,214,36,
+109,59,105,96,34,23,239,73,197,141,76,225,38,43,220,206,20,38,53,48,187,11,55,72,183,111,211,124,54,59,
+202,226,73,76,61,204,44,11,180,220,146,64,203,151,21,168,138,42,204,12,28,82,30,192,135,229,49,50,57,200,
+206,246,230,46,237,11,198,146,221,42,39,180,204,107,180,12,9,121,73,203,84,92,30,195,208,192,45,214,100,62,
+213,179,107,175,114,197,150,227,87,132,61,207,24,44,178,48,44,217,232,54,59,170,97,118,225,95,79,109,180,106,
+233,140,222,107,229,107,229,251,152,252,144,175,175,252,63,255,231,255,161,80,158,58,29,193,36,125,155,238,90,51,
+253,63,184,75,150,4,168,53,242,232,241,212,189,147,147,164,104,82,46,49,80,71,221,176,143,127,6,217,79,169,
+217,74,102,53,132,130,12,179,2,5,69,37,125,244,161,140,251,223,131,204,87,190,138,254,216,11,197,38,2,59,
+126,74,55,21,106,57,241,64,61,38,86,68,137,224,137,131,121,46,165,208,6,213,43,53,84,91,219,82,82,185,
+204,54,117,54,46,11,213,166,229,139,45,228,64,39,57,86,6,121,54,97,139,86,101,65,37,3,179,38,58,229,
+73,57,150,49,229,61,48,197,8,251,70,106,35,13,229,68,135,212,213,25,190,202,51,20,126,111,168,111,59,190,
+193,45,244,244,99,213,224,142,160,31,10,7,170,73,146,152,79,114,227,12,134,24,172,64,218,109,21,6,86,173,
+116,77,205,119,172,232,48,75,154,127,196,112,67,71,192,85,217,25,117,109,144,21,166,121,201,78,125,215,130,202,
+210,131,178,38,29,9,136,33,46,29,205,243,237,244,116,153,157,174,178,75,244,250,244,56,217,30,70,193,116,17,
+243,157,244,164,58,119,58,245,230,145,23,101,215,222,116,50,74,33,60,45,169,214,1,54,149,218,168,13,158,74,
+47,89,195,115,44,50,75,218,164,154,252,50,249,187,51,127,123,166,53,245,203,107,222,121,232,14,4,203,55,181,
+148,171,216,24,17,203,59,17,73,67,132,115,85,58,63,60,73,217,58,117,226,6,210,242,12,73,235,210,10,144,
+199,72,235,190,28,23,48,1,42,10,242,95,62,145,9,125,138,184,25,249,143,24,49,123,231,165,12,38,2,71,
+133,2,107,96,78,211,215,181,92,70,190,92,22,153,152,155,160,121,2,152,77,176,112,204,51,100,160,233,7,119,
+139,159,38,3,235,26,243,169,190,51,179,125,151,107,124,35,37,120,158,109,73,193,198,225,19,204,148,231,37,209,
+22,245,125,57,71,16,77,88,175,60,73,21,66,119,67,119,152,235,187,131,218,218,72,15,202,177,53,53,190,133,
+77,29,59,28,61,108,181,215,202,143,61,202,230,133,239,153,247,6,242,188,22,132,30,78,32,98,47,46,147,54,
+242,66,118,119,140,223,148,72,85,175,52,5,38,163,197,204,31,148,198,50,28,43,244,183,142,103,198,170,28,193,
+111,170,201,81,236,214,90,114,30,147,213,239,147,67,155,124,173,146,134,83,210,192,186,84,214,150,124,56,148,107,
+136,29,236,228,27,123,66,41,208,51,202,164,206,149,73,169,14,111,102,79,220,164,41,58,35,42,180,67,121,100,
+61,45,147,95,219,156,183,34,221,155,202,171,110,66,151,40,215,72,217,57,95,177,242,148,68,114,221,37,42,99,
+166,250,50,109,152,183,48,180,115,187,25,236,168,232,143,227,239,204,10,129,109,34,15,10,17,153,245,87,102,177,
+105,135,248,15,87,137,34,143,33,224,174,80,10,222,5,217,124,164,244,132,250,149,64,232,187,19,210,16,65,223,
+162,239,232,50,196,133,186,86,178,68,20,11,72,186,207,84,184,178,87,60,239,16,151,29,179,96,103,216,106,203,
+174,44,101,163,124,189,210,64,122,138,3,54,115,96,9,113,244,12,113,244,21,235,30,144,141,32,44,4,141,244,
+80,186,196,202,206,53,7,37,138,120,90,82,234,202,220,73,178,86,212,97,203,11,22,22,104,89,234,22,89,92,
+94,203,228,234,99,225,58,174,59,214,110,132,167,139,50,113,46,10,188,32,8,208,150,183,89,74,80,224,211,169,
+70,170,70,235,137,57,149,244,136,181,243,88,154,202,152,76,236,230,172,69,73,108,204,61,177,247,152,98,187,41,
+121,133,110,74,102,108,185,86,92,34,231,110,166,208,254,142,184,137,168,242,219,134,185,60,36,128,121,82,126,15,
+171,112,97,133,218,102,231,228,217,49,94,114,76,153,110,122,241,243,245,180,176,56,55,46,110,186,101,15,214,203,
+10,149,108,181,101,47,65,136,66,236,118,234,31,123,24,156,222,206,102,179,3,203,85,166,182,12,29,167,233,184,
+155,142,136,249,165,145,181,178,114,187,195,224,220,93,207,167,207,134,139,210,243,63,199,192,91,129,36,207,146,41,
+131,253,59,142,102,115,251,247,25,65,192,128,144,118,22,225,179,78,15,74,46,233,146,190,216,240,102,252,152,43,
+132,99,96,187,188,108,123,242,155,234,254,198,2,91,101,107,176,42,191,115,183,190,80,207,119,109,219,23,106,97,
+251,179,91,93,160,22,199,252,196,74,76,61,78,171,99,55,131,241,82,239,69,114,91,95,74,46,139,75,240,216,
+144,152,106,114,249,6,235,151,158,31,103,137,93,80,214,228,251,92,252,90,161,29,137,51,190,74,190,50,181,225,
+37,137,123,235,90,98,231,176,172,34,230,93,180,180,26,74,90,91,9,59,4,228,216,240,167,6,255,156,172,255,
+46,41,94,124,64,241,135,93,226,217,196,58,36,235,115,179,83,134,22,255,171,197,18,135,130,196,128,123,55,183,
+65,185,200,220,1,151,115,53,216,207,55,143,106,157,223,190,43,142,241,108,189,223,54,202,117,126,149,178,56,230,
+89,117,231,179,5,238,141,224,32,205,68,99,237,23,242,72,43,237,213,53,85,85,152,203,200,146,26,121,202,67,
+201,141,195,44,169,233,93,81,82,33,59,62,97,85,212,242,27,45,149,69,56,173,146,27,211,62,169,49,207,162,
+155,201,222,221,108,58,64,227,149,104,52,109,17,143,187,234,159,155,175,32,254,207,134,6,41,126,100,253,254,195,
+101,28,207,251,207,158,221,222,222,54,110,155,141,32,156,60,67,23,79,88,248,247,31,32,219,141,231,222,254,24,
+220,65,70,13,190,240,159,9,255,90,144,214,124,3,117,205,237,248,18,190,65,188,77,45,204,223,108,183,59,122,
+183,71,69,71,16,115,100,96,169,67,44,103,92,154,247,51,12,180,232,179,9,159,191,255,240,140,85,131,205,65,
+72,169,85,252,160,30,186,48,134,227,10,233,246,162,199,216,2,240,25,239,197,86,241,162,164,46,201,49,207,9,
+216,81,142,154,126,82,174,178,99,140,76,1,33,179,28,236,181,108,89,41,233,161,228,156,19,134,21,227,136,178,
+195,130,167,87,39,159,171,107,151,38,34,137,175,75,168,77,177,232,50,214,195,207,86,128,226,40,171,52,23,169,
+210,153,179,102,157,143,183,245,168,243,107,169,249,106,51,249,50,245,138,238,145,6,178,120,74,196,7,6,189,36,
+18,131,132,172,89,60,189,12,17,171,98,131,173,138,103,48,153,173,145,42,122,50,74,185,204,19,11,153,34,43,
+100,128,171,176,233,89,2,49,19,195,0,101,81,15,206,212,155,247,113,163,176,202,173,37,214,18,25,55,191,19,
+176,214,49,92,56,129,42,48,11,159,10,230,119,165,240,176,25,96,79,102,211,60,128,235,178,200,16,23,242,252,
+175,155,83,114,248,209,167,59,218,140,225,218,76,25,28,139,185,158,190,143,87,14,218,26,96,214,53,47,55,184,
+65,255,216,230,26,113,145,63,254,179,174,219,6,164,92,15,38,74,179,220,127,249,72,214,123,235,23,35,201,67,
+217,210,186,65,91,47,214,157,68,102,234,46,81,93,132,60,203,236,170,108,207,127,133,67,151,204,12,197,247,2,
+73,219,111,166,91,195,124,151,190,108,20,178,189,173,205,131,176,144,167,100,119,112,61,34,165,15,114,182,148,8,
+226,102,142,252,172,30,37,112,122,218,113,151,40,254,122,230,181,78,246,122,27,223,78,150,247,110,69,84,114,233,
+71,17,164,236,225,227,194,244,138,129,116,93,164,153,200,120,90,80,213,219,240,253,45,74,64,24,160,121,203,170,
+217,26,185,19,89,3,200,198,51,200,218,235,230,5,212,7,64,138,192,68,8,101,254,0,145,183,185,214,98,15,
+100,47,111,164,100,51,214,146,173,149,35,155,190,145,108,98,133,148,224,95,28,2,249,109,228,213,54,19,199,58,
+76,138,155,210,69,220,218,50,110,223,165,246,241,211,237,245,167,171,249,109,233,180,255,185,166,148,81,223,228,245,
+67,113,42,146,48,20,43,224,39,7,80,50,62,205,150,180,194,98,50,75,22,43,76,245,21,55,16,219,27,224,
+248,46,130,103,245,193,50,225,86,78,126,237,123,167,75,166,38,255,97,243,230,31,82,221,218,41,80,212,254,7,
+85,179,121,171,84,158,53,158,80,183,68,87,179,165,133,153,99,221,117,211,72,41,131,116,198,221,113,111,197,231,
+207,242,235,151,219,221,143,147,106,168,200,31,117,96,253,252,60,74,141,126,243,22,210,166,67,19,121,39,168,236,
+85,208,102,232,26,244,119,227,1,75,102,215,100,171,218,54,157,188,100,118,75,50,181,73,27,152,37,9,185,157,
+187,237,239,21,8,9,242,231,13,192,227,113,162,116,232,184,6,172,141,215,91,215,195,252,45,197,10,20,253,222,
+194,255,178,219,184,235,104,243,244,181,220,13,20,250,230,194,69,58,253,83,85,252,145,247,138,215,17,104,211,5,
+227,13,164,249,134,98,69,162,124,103,225,127,227,125,232,181,67,141,93,117,94,63,166,74,210,75,6,207,19,185,
+210,23,147,210,238,215,90,217,35,31,198,72,153,202,15,119,254,233,27,252,217,243,163,228,176,36,179,243,155,137,
+95,115,220,82,150,192,17,202,204,76,189,241,104,108,231,159,18,242,3,152,82,72,4,117,203,225,17,169,107,160,
+90,159,252,205,199,18,223,253,150,46,139,21,157,34,21,176,225,177,165,39,80,197,232,50,186,142,199,246,184,147,
+163,107,230,76,42,11,193,26,170,102,210,74,161,89,151,248,205,244,252,206,87,109,185,13,140,28,132,185,245,254,
+134,116,177,173,81,150,33,143,91,233,110,70,62,83,113,99,173,64,162,53,123,108,165,221,85,68,113,155,93,198,
+173,115,231,209,95,159,125,45,49,182,47,242,212,6,232,26,66,109,181,23,90,250,248,114,43,74,110,218,143,222,
+50,111,57,21,139,153,159,160,225,211,5,54,111,146,111,164,223,119,237,151,127,215,224,252,158,78,88,183,77,243,
+36,205,182,218,53,122,154,57,36,173,82,186,240,1,232,6,183,126,13,26,185,177,97,209,244,240,207,86,240,175,
+22,139,131,226,84,240,45,224,109,119,169,129,77,32,233,211,19,169,254,92,36,159,79,74,99,147,188,69,211,162,
+137,149,26,118,186,0,64,215,237,41,26,209,25,73,214,11,50,23,84,66,23,104,227,79,151,23,37,149,241,133,
+119,22,106,153,195,178,160,111,222,13,222,10,38,121,216,149,181,200,183,7,202,14,124,214,231,126,40,191,85,113,
+25,132,222,61,44,126,237,212,96,82,246,182,97,154,161,34,221,208,124,248,3,174,112,151,62,242,228,157,178,246,
+226,209,138,124,93,216,30,154,169,148,53,116,90,58,103,94,215,202,87,21,158,176,46,148,185,2,151,212,223,152,
+132,222,168,126,135,22,162,146,171,136,70,143,182,31,115,121,166,19,41,79,175,83,150,101,54,146,178,192,104,40,
+201,18,205,164,44,109,189,44,203,93,36,101,49,25,44,56,4,233,148,133,2,179,17,15,224,153,14,5,238,166,
+34,16,101,174,170,236,120,51,180,169,108,251,49,54,131,47,59,162,127,81,175,230,150,82,102,241,33,52,191,66,
+194,193,192,223,250,196,158,79,209,208,69,214,44,88,166,152,86,90,226,5,143,124,120,234,9,185,92,22,232,65,
+44,183,221,35,3,201,42,33,127,10,194,90,220,184,219,195,183,121,214,24,49,125,210,254,21,107,130,128,213,85,
+249,203,200,124,53,51,95,102,230,171,149,249,106,103,190,58,153,175,110,230,171,151,249,210,181,236,103,22,26,61,
+11,14,146,167,72,22,45,37,11,93,19,75,66,43,94,199,67,118,64,98,43,60,170,167,55,218,236,127,29,145,
+164,241,164,110,179,209,228,255,227,73,61,158,210,105,241,136,46,143,104,183,243,181,116,120,74,171,155,175,164,45,
+82,4,44,45,30,97,22,64,49,121,74,179,0,73,83,152,29,16,144,36,40,22,32,17,152,22,0,121,146,150,
+90,230,213,123,242,149,50,156,100,67,32,225,219,250,236,142,213,92,16,158,60,153,53,172,150,229,77,36,47,207,
+26,174,171,233,191,103,238,200,179,171,178,32,237,106,243,187,218,3,149,187,19,44,141,33,35,9,53,147,144,153,
+132,90,73,168,157,132,58,73,168,155,132,122,73,136,179,43,5,211,86,244,180,153,239,98,209,187,82,46,189,219,
+200,168,119,27,121,245,174,132,93,239,54,113,236,221,38,166,189,43,225,219,187,77,172,123,183,137,123,239,74,24,
+248,110,19,15,223,109,96,99,65,114,153,15,47,189,145,139,51,237,186,249,137,79,100,217,75,81,82,134,34,131,
+245,218,41,127,77,39,130,191,32,100,36,161,102,18,50,147,80,43,9,181,147,80,39,9,117,147,80,47,9,9,
+254,194,96,218,138,158,54,243,93,252,69,85,20,248,139,218,88,203,95,4,204,90,254,66,160,243,252,133,40,173,
+229,47,196,124,45,127,33,129,242,252,133,228,91,203,95,72,229,181,252,133,157,145,231,47,236,170,181,252,133,168,
+174,227,47,65,242,2,127,129,150,182,145,191,164,244,167,249,171,107,166,252,53,27,9,254,130,144,145,132,154,73,
+200,76,66,173,36,212,78,66,157,36,212,77,66,189,36,36,248,11,131,105,43,122,218,204,119,241,23,85,81,224,
+47,106,99,45,127,17,48,107,249,11,129,206,243,23,162,180,150,191,16,243,181,252,133,4,202,243,23,146,111,45,
+127,33,149,215,242,23,118,70,158,191,176,171,214,242,23,162,186,142,191,4,201,11,252,53,27,109,230,47,41,253,
+105,254,130,229,114,194,95,209,76,240,23,132,140,36,212,76,66,102,18,106,37,161,118,18,234,36,161,110,18,234,
+37,33,193,95,24,76,91,209,211,102,190,139,191,168,138,2,127,81,27,107,249,139,128,89,203,95,8,116,158,191,
+16,165,181,252,133,152,175,229,47,36,80,158,191,144,124,107,249,11,169,188,150,191,176,51,242,252,133,93,181,150,
+191,16,213,117,252,37,72,94,224,47,88,31,110,228,47,41,253,105,254,50,101,253,43,74,244,175,40,209,191,162,
+68,255,138,18,253,43,74,244,175,40,209,191,162,68,255,138,18,253,43,74,244,175,40,213,191,162,84,255,138,82,
+253,43,250,78,253,43,42,213,191,162,141,250,87,180,81,255,138,74,244,175,104,147,254,21,109,210,191,162,18,253,
+43,218,164,127,69,155,244,175,168,68,255,138,54,233,95,209,6,253,43,90,167,127,69,79,232,95,209,6,254,18,
+29,120,237,46,201,205,105,84,225,198,246,30,180,63,63,172,189,240,167,149,223,247,163,232,149,196,22,133,28,58,
+250,154,42,41,201,226,1,158,255,41,112,20,233,66,239,167,235,163,224,214,71,144,82,203,76,155,159,70,176,27,
+101,235,94,71,240,84,4,117,43,123,65,159,171,218,154,170,180,44,241,254,231,3,219,32,27,9,194,218,108,230,
+66,167,196,160,118,38,155,112,187,144,141,204,216,81,100,150,100,243,229,114,110,23,218,70,143,238,141,50,135,94,
+137,133,113,177,113,172,141,219,101,64,36,25,179,96,164,209,25,64,70,109,183,157,2,146,102,202,129,50,78,224,
+152,132,246,50,251,246,177,8,2,230,201,182,78,49,153,134,237,209,176,237,152,153,18,185,54,157,225,72,27,245,
+120,179,228,85,68,130,166,216,232,52,181,216,164,102,162,50,205,142,13,252,47,91,102,45,174,35,116,95,144,121,
+118,94,108,22,243,100,91,165,152,76,163,204,139,66,166,68,174,77,102,234,94,116,53,55,194,155,185,118,80,210,
+209,153,171,5,185,200,44,183,145,97,219,124,185,28,8,205,158,211,51,135,28,4,97,103,62,33,9,154,152,47,
+130,192,179,101,65,16,145,25,16,220,182,141,150,16,114,89,10,148,31,186,186,205,65,96,6,108,51,39,60,69,
+0,228,139,0,153,168,76,227,204,48,108,182,76,161,105,168,191,185,106,12,39,27,76,75,203,115,22,100,92,107,
+244,63,151,111,148,247,130,193,248,33,205,149,181,41,59,97,99,172,120,81,50,223,252,90,91,205,235,107,94,239,
+63,96,125,153,117,150,132,215,148,112,234,151,248,108,53,251,246,6,163,103,208,37,34,26,195,24,119,31,4,120,
+30,35,162,133,152,230,209,226,56,139,127,38,5,2,124,17,86,82,2,226,51,69,224,27,203,72,167,97,15,197,
+3,50,204,65,26,11,79,98,42,203,168,204,188,44,70,151,30,30,165,9,185,98,217,179,165,17,105,156,223,121,
+175,118,36,223,146,250,35,47,86,141,234,168,159,169,240,139,122,217,90,37,109,84,231,142,234,30,232,151,156,33,
+37,190,235,8,186,146,116,238,97,143,13,60,108,102,75,43,184,114,82,122,121,86,203,57,33,100,226,140,29,60,
+51,229,157,89,52,138,34,47,98,54,157,147,90,191,255,253,224,6,227,56,210,75,194,145,135,30,12,67,85,4,
+234,248,12,61,247,202,178,228,65,164,156,251,156,108,113,242,59,249,23,194,182,28,207,81,150,184,206,215,136,120,
+253,86,176,243,201,99,106,79,58,212,200,92,121,214,248,117,234,205,74,89,163,221,218,160,148,241,212,4,97,201,
+216,88,222,225,143,62,110,142,91,201,11,4,74,203,153,104,90,149,19,37,231,106,103,181,177,43,100,107,113,217,
+156,201,129,182,236,80,168,220,180,94,106,45,104,253,83,138,39,158,175,60,73,218,79,235,223,45,243,164,167,185,
+232,33,5,34,99,143,85,251,87,191,169,89,9,155,232,15,133,97,45,205,30,210,219,98,110,189,111,147,133,216,
+116,240,100,237,173,39,86,44,124,152,190,41,39,79,175,52,90,176,76,3,62,183,241,54,207,216,243,97,222,31,
+108,151,171,236,141,91,169,19,27,164,152,136,41,247,127,39,223,4,46,51,223,190,245,75,156,194,51,175,204,137,
+55,243,171,106,110,126,38,95,246,208,93,79,232,41,126,233,222,65,218,53,236,233,83,49,15,39,127,242,30,163,
+157,55,77,94,207,88,43,103,0,118,139,143,153,200,36,248,216,187,227,245,113,11,225,65,124,89,70,28,114,216,
+185,106,128,160,182,99,106,229,129,130,125,12,202,147,22,203,192,76,19,176,28,20,150,179,204,235,130,163,138,198,
+11,178,249,4,29,31,10,148,205,230,3,36,64,211,72,50,209,103,54,7,204,78,206,245,50,205,146,120,179,164,
+120,105,104,36,57,242,41,88,11,51,217,224,230,246,125,7,12,79,26,52,79,95,97,65,18,185,119,105,85,242,
+78,89,198,50,96,114,117,33,19,75,31,100,214,46,18,81,255,180,117,81,88,180,95,23,90,149,35,209,169,181,
+55,94,10,33,199,163,87,141,89,93,75,220,241,201,148,154,13,147,132,196,32,104,38,125,154,166,179,219,28,153,
+212,48,77,229,151,59,50,201,113,154,76,15,226,50,137,119,235,107,30,108,168,115,185,9,224,193,218,214,234,250,
+131,108,182,33,71,3,61,111,194,174,144,103,154,230,73,157,10,228,104,161,103,105,81,204,18,167,89,18,235,71,
+57,154,108,108,101,240,68,253,203,167,16,25,108,108,189,110,100,28,217,229,104,100,148,153,2,204,209,200,200,66,
+111,22,105,100,228,104,100,22,105,100,20,60,254,229,104,180,177,149,193,19,245,47,159,66,100,176,169,245,57,112,
+95,162,252,101,18,134,105,74,233,72,154,79,165,12,197,161,52,15,165,228,18,190,159,199,82,122,129,189,231,119,
+27,42,31,108,170,118,185,17,236,193,250,22,129,213,50,26,83,142,24,122,193,252,111,33,211,84,202,84,62,166,
+230,161,148,101,13,211,207,99,41,79,41,95,207,239,158,104,104,240,84,19,203,39,209,25,108,134,0,120,46,115,
+199,51,71,44,163,80,187,89,36,150,241,80,188,176,150,35,150,241,80,114,129,45,71,44,35,75,44,179,72,172,
+205,13,13,158,106,98,249,36,58,131,141,16,68,107,124,86,114,43,13,81,157,185,243,44,123,114,207,54,46,81,
+229,145,204,247,226,55,79,98,202,142,148,70,17,60,145,77,149,15,5,195,191,60,153,207,172,114,58,143,18,237,
+162,175,80,199,142,220,188,127,250,36,129,103,92,204,231,229,25,147,4,1,145,61,247,98,104,234,190,144,51,77,
+225,89,153,65,241,140,119,82,83,19,155,166,195,96,58,42,56,46,101,73,84,139,195,31,225,146,95,84,22,35,
+112,2,81,232,102,253,0,99,31,176,189,66,238,119,226,161,220,29,133,192,1,190,212,92,129,252,62,66,217,99,
+228,164,112,174,122,140,18,104,133,174,125,157,104,101,151,203,249,165,235,51,111,9,164,27,101,34,50,31,183,1,
+26,31,199,210,125,250,91,199,8,22,75,119,77,211,72,84,234,39,129,116,218,153,247,239,33,204,206,139,205,148,
+210,247,1,252,229,117,122,241,63,245,79,162,231,94,8,60,149,53,51,32,140,78,43,117,208,42,63,164,166,29,
+133,140,174,143,110,221,153,185,168,53,117,128,100,104,102,36,67,19,189,208,227,116,220,148,167,99,131,61,164,135,
+85,126,157,6,71,93,56,160,161,40,88,151,220,184,245,156,109,226,82,63,30,173,53,254,61,90,145,92,123,166,
+90,233,208,74,91,253,160,42,202,69,77,141,27,238,29,34,25,89,238,74,85,122,109,103,172,244,199,11,159,140,
+230,87,99,213,85,195,218,195,13,172,90,125,43,141,173,61,40,139,200,173,68,113,232,57,177,50,192,100,200,103,
+157,12,175,240,197,195,60,12,226,0,173,102,170,190,21,226,11,150,147,91,255,151,48,128,129,25,47,213,192,82,
+68,61,138,101,89,152,45,24,87,78,151,51,24,97,251,236,167,255,176,82,61,43,104,0,71,135,118,28,132,143,
+143,202,127,255,183,248,80,84,27,146,236,104,233,59,7,114,122,38,70,81,35,200,20,7,167,49,186,89,63,179,
+39,148,69,250,86,6,2,136,138,195,144,84,125,134,102,96,185,187,187,110,138,3,58,55,142,209,30,37,64,57,
+219,119,251,51,0,141,227,233,0,143,199,110,53,72,51,215,0,56,223,189,173,156,86,253,199,199,243,139,218,32,
+116,241,40,181,226,53,190,122,254,77,112,237,90,135,208,90,168,218,53,213,91,37,16,76,5,153,227,112,249,192,
+74,60,144,235,100,133,137,36,64,57,156,244,161,61,123,58,173,98,198,213,202,177,99,231,178,10,32,103,178,199,
+151,97,112,203,114,251,171,213,42,110,224,80,180,28,234,159,133,165,68,139,104,142,174,231,71,167,177,29,198,138,
+58,150,162,62,163,57,106,69,29,89,138,123,231,58,139,24,200,164,168,115,75,113,130,217,124,234,198,46,164,93,
+90,15,171,148,108,179,106,237,33,69,225,38,243,53,196,47,108,116,130,69,38,231,222,69,202,59,2,228,74,124,
+9,2,142,64,91,10,130,78,220,248,23,65,202,147,177,122,107,45,119,119,151,213,101,245,164,10,180,172,213,6,
+183,187,187,183,59,150,21,238,238,250,140,24,183,170,87,219,221,173,78,172,219,26,213,116,103,13,211,206,176,102,
+82,56,219,101,147,90,138,200,87,100,231,115,197,7,113,168,168,130,132,10,3,82,185,192,39,29,111,108,160,117,
+53,193,192,133,142,58,119,47,50,195,65,194,73,116,53,244,84,12,61,85,171,165,116,185,198,172,201,151,91,13,
+213,64,245,128,25,136,241,34,11,248,224,60,188,80,99,53,168,13,188,113,149,195,2,8,71,13,98,46,202,230,
+192,23,116,176,186,176,156,198,141,61,93,184,130,199,22,187,187,74,64,88,74,227,106,145,144,106,161,42,95,191,
+218,183,182,23,43,181,125,160,242,204,139,220,70,232,70,193,244,198,173,46,26,60,173,214,136,65,198,75,200,2,
+192,110,149,19,39,38,96,87,53,53,159,204,137,38,210,107,253,66,253,101,245,114,248,45,40,86,117,10,213,114,
+172,74,106,95,217,85,34,65,141,88,44,76,123,50,128,113,228,75,4,14,82,102,195,65,201,129,146,128,0,250,
+35,252,80,74,197,32,214,205,243,135,86,184,31,50,152,3,72,233,67,85,43,185,115,173,32,237,213,195,172,148,
+92,136,14,73,154,129,78,174,61,64,135,250,208,47,163,26,161,67,0,189,193,147,175,170,242,206,245,153,212,170,
+120,81,197,158,226,107,174,101,37,92,248,120,146,166,16,39,96,193,57,85,193,137,1,223,1,175,200,19,205,189,
+4,16,195,198,204,141,47,131,145,21,168,33,146,200,242,80,49,152,186,85,157,65,103,131,60,30,185,83,244,97,
+224,98,197,9,235,29,85,109,192,0,163,34,106,39,130,22,46,107,184,3,226,249,41,139,69,171,21,194,64,220,
+0,25,68,107,181,176,17,193,92,3,223,95,249,47,52,61,112,167,48,67,100,64,78,242,11,98,44,4,49,172,
+57,131,119,16,226,139,177,57,10,183,55,119,142,59,103,189,196,58,27,235,19,195,82,170,108,119,23,210,135,225,
+98,30,87,69,42,171,171,54,240,173,209,128,13,25,33,97,105,88,113,161,10,117,56,124,92,17,56,208,116,224,
+187,251,243,254,88,117,136,118,37,20,120,32,142,237,83,186,138,217,251,172,212,106,149,98,201,42,5,169,196,176,
+226,29,34,184,152,117,139,195,80,90,165,76,116,132,243,130,96,161,56,153,250,206,69,5,23,130,15,24,184,105,
+55,90,254,98,58,85,215,16,89,170,40,145,104,0,89,10,85,134,98,150,171,50,48,202,170,171,113,30,184,28,
+172,193,9,57,250,12,48,231,92,125,118,9,189,207,27,175,140,2,55,170,248,65,92,1,129,140,103,9,21,187,
+242,3,21,254,161,194,234,82,146,145,119,185,98,179,240,180,234,171,41,248,162,75,179,67,128,117,159,24,178,229,
+96,5,212,87,121,122,93,18,99,120,44,53,153,165,247,61,198,3,213,240,60,70,217,181,152,198,199,246,12,68,
+189,199,68,21,84,131,188,15,253,131,63,135,129,147,204,19,59,50,67,74,244,101,130,147,83,183,86,4,163,214,
+247,250,213,237,8,154,16,147,1,134,194,2,41,106,131,156,99,82,191,172,250,148,193,94,161,80,37,69,205,66,
+61,3,128,239,199,231,218,197,106,160,131,134,83,137,1,106,183,65,90,5,164,88,241,185,14,154,161,145,166,140,
+61,31,38,145,37,75,51,46,84,183,65,219,232,236,187,137,90,36,10,71,168,247,141,15,42,150,27,53,230,139,
+232,18,102,202,180,253,171,180,125,152,134,153,86,1,241,143,143,160,33,184,212,145,86,162,238,32,22,177,91,113,
+169,235,228,220,160,162,38,21,158,98,133,185,102,173,115,129,155,18,6,65,172,172,96,54,77,102,240,87,4,36,
+7,21,136,232,198,213,29,77,130,240,4,43,196,65,195,224,12,1,51,143,134,93,152,178,24,77,165,49,227,195,
+18,53,150,49,134,200,30,99,182,29,47,58,182,143,97,36,78,93,127,18,95,214,132,150,89,215,65,87,76,218,
+14,97,170,98,146,122,111,47,120,158,100,198,49,207,219,132,89,40,5,131,79,156,231,193,133,202,4,144,181,163,
+171,225,32,151,238,38,137,154,26,174,68,170,205,120,216,94,241,17,247,128,159,253,151,146,44,122,153,204,155,92,
+222,185,76,214,237,104,162,76,229,70,82,173,238,240,157,39,44,5,22,14,112,167,53,84,135,153,239,27,117,120,
+30,93,88,55,13,190,33,143,3,202,74,231,188,183,130,136,56,216,163,66,116,70,201,98,220,83,74,247,221,221,
+88,110,149,227,186,179,131,114,216,133,124,55,176,0,40,182,9,9,192,219,18,96,143,143,110,195,135,95,80,4,
+0,30,88,179,93,151,105,121,92,151,140,50,218,234,126,105,44,244,219,176,214,135,222,255,250,149,8,246,245,43,
+16,40,162,113,245,248,8,234,30,80,166,4,174,26,174,202,214,233,174,119,144,136,208,217,164,220,23,193,123,224,
+170,92,63,94,173,212,175,213,107,121,117,34,125,156,219,107,149,114,168,252,165,188,154,178,174,177,57,140,73,75,
+208,138,9,213,39,38,71,81,86,93,87,157,36,58,89,249,148,246,42,140,168,125,175,239,17,35,86,203,84,195,
+164,48,137,227,152,241,115,82,0,245,52,192,12,8,113,151,37,160,2,17,235,215,26,234,93,178,34,44,102,81,
+206,153,20,173,36,149,93,40,72,136,107,119,25,149,48,225,249,197,0,196,74,149,228,4,245,102,205,101,34,47,
+76,48,71,237,247,198,13,65,225,172,169,37,227,220,21,99,156,207,249,80,62,152,87,153,186,199,106,204,141,102,
+95,30,234,137,158,42,13,112,4,151,178,70,214,137,122,42,241,207,131,52,50,250,167,42,137,190,190,140,19,10,
+61,20,138,115,128,216,210,152,128,36,33,193,195,164,213,49,245,151,130,46,139,22,208,176,143,204,204,67,81,217,
+73,144,162,152,150,145,159,44,132,132,190,170,169,59,113,45,75,88,20,217,10,87,55,209,16,254,203,184,170,213,
+146,85,13,38,131,194,178,187,203,197,236,30,168,162,83,207,65,133,23,23,134,152,12,75,42,152,122,87,106,132,
+123,47,82,191,75,40,104,164,13,112,20,83,184,96,122,84,179,179,85,86,255,96,211,22,215,97,93,89,147,96,
+83,12,116,198,74,45,232,179,165,148,71,56,120,69,241,128,207,62,16,47,175,109,104,180,9,69,156,79,152,92,
+95,96,116,141,133,122,2,57,55,41,33,59,59,176,120,225,52,246,242,56,115,174,172,235,3,239,133,165,13,234,
+117,79,172,28,242,196,241,46,212,200,178,243,196,161,105,23,104,99,55,216,68,44,184,56,168,42,174,63,98,203,
+25,145,246,220,74,184,78,172,109,121,183,218,170,34,116,17,80,107,166,82,116,170,136,176,186,156,221,221,105,150,
+129,159,219,137,30,147,54,158,198,169,48,231,15,114,249,211,74,229,18,82,236,74,44,102,156,111,110,139,138,98,
+161,157,105,113,233,7,116,168,68,120,229,126,6,195,170,114,235,65,127,45,226,10,21,175,128,166,199,33,80,190,
+3,96,248,159,202,150,69,153,205,60,88,29,139,209,181,190,231,67,214,243,161,80,85,242,61,31,146,86,20,20,
+123,49,25,150,65,182,163,96,118,78,128,15,100,48,249,236,17,12,104,187,24,86,151,192,183,10,133,105,114,135,
+73,91,44,192,232,27,42,242,146,86,113,155,238,57,104,230,105,117,80,216,35,241,195,54,131,108,11,21,250,148,
+63,251,15,146,14,68,227,39,86,109,46,145,188,253,234,58,145,69,67,74,110,6,181,118,74,17,123,99,176,140,
+94,169,226,35,71,238,140,192,136,101,129,17,75,2,67,194,153,178,228,17,167,200,253,20,28,42,219,151,86,195,
+60,71,53,17,60,86,34,110,99,166,69,203,216,137,85,95,90,33,27,156,125,105,109,28,243,101,172,203,197,40,
+203,7,226,227,114,165,226,245,165,232,50,35,200,4,91,185,235,217,202,101,108,229,38,234,117,142,173,92,166,108,
+203,107,13,236,115,89,164,38,20,15,165,126,69,201,198,23,35,53,245,10,102,96,0,17,250,3,7,209,191,10,
+68,198,131,4,30,159,190,195,181,179,132,47,109,222,5,240,133,189,142,80,138,41,60,88,173,10,114,193,155,226,
+100,58,229,146,192,142,65,64,204,97,129,183,82,197,44,75,219,181,50,171,209,254,181,76,170,100,62,126,16,11,
+199,62,46,112,212,116,89,219,135,50,108,25,219,247,87,106,178,171,35,113,138,232,122,62,113,32,89,227,85,53,
+57,48,192,235,121,184,97,61,17,42,211,135,5,240,44,168,247,62,223,159,134,9,43,81,249,148,144,118,85,243,
+121,43,86,37,84,106,85,124,109,164,42,189,225,104,180,238,240,1,168,210,53,90,54,200,194,244,192,34,155,19,
+231,199,116,7,189,18,236,187,85,212,52,113,22,15,113,61,219,119,145,234,12,50,91,136,158,56,221,24,25,176,
+110,184,9,188,81,69,131,5,61,8,35,191,234,137,37,95,77,181,87,12,198,177,177,9,198,166,61,132,41,43,
+192,176,230,140,49,236,165,176,195,146,15,194,142,102,186,16,142,132,98,63,114,129,229,93,113,66,2,171,225,177,
+229,239,71,133,54,128,171,60,236,65,215,178,65,207,134,169,69,245,144,217,131,154,132,116,196,51,167,7,4,180,
+99,55,113,99,5,148,41,60,41,137,120,144,75,33,105,131,225,37,221,247,15,66,182,175,16,45,230,72,100,23,
+231,108,78,33,82,46,169,48,50,6,110,129,115,221,20,87,36,72,26,119,212,44,146,166,112,82,68,116,178,221,
+94,83,169,53,196,18,35,89,50,49,202,117,156,78,83,80,174,229,180,29,65,185,145,201,41,7,225,230,184,139,
+241,206,218,163,133,117,124,194,122,107,106,185,123,74,37,57,48,74,215,43,169,222,140,58,23,91,29,123,85,29,
+137,10,80,64,21,83,21,116,94,36,127,116,62,189,176,28,194,221,54,71,205,45,49,55,154,110,71,112,200,200,
+238,154,2,207,145,214,110,39,28,98,54,53,129,39,231,40,7,195,102,143,226,167,24,30,143,134,99,8,47,88,
+217,102,15,194,99,162,151,222,108,65,120,132,97,183,59,196,240,156,234,105,235,208,151,234,165,196,141,51,162,245,
+80,195,250,111,168,78,167,141,241,67,137,75,39,82,31,44,165,190,185,165,118,199,29,172,255,142,240,50,117,204,
+243,149,56,191,213,65,216,174,41,191,169,119,33,124,72,241,120,186,88,83,143,48,76,3,169,166,190,162,122,116,
+162,201,21,197,235,58,198,159,98,184,237,186,8,219,9,193,208,238,97,252,75,130,179,211,193,240,25,195,157,242,
+31,83,89,205,69,216,222,96,120,216,54,48,254,128,232,208,106,34,12,247,12,158,54,194,240,95,18,63,189,166,
+182,122,99,44,251,11,149,237,24,0,143,88,151,168,111,173,151,85,133,29,180,67,142,143,150,194,206,41,21,245,
+179,165,36,236,162,168,31,172,55,32,247,131,95,66,111,230,225,241,45,228,253,209,122,141,59,2,234,123,248,133,
+65,8,220,246,22,134,218,199,154,250,142,15,254,243,207,23,234,79,86,208,96,53,170,191,89,94,85,249,249,244,
+228,24,132,101,68,75,85,111,12,250,159,250,171,117,216,24,171,159,172,35,248,251,197,250,10,127,127,182,94,193,
+223,191,91,39,85,37,162,178,17,100,251,43,126,6,243,122,26,19,199,148,131,170,170,199,1,79,169,131,32,246,
+32,18,171,118,227,180,14,202,193,242,74,57,66,202,113,123,141,245,193,234,47,104,188,103,176,171,65,108,237,248,
+160,165,193,31,192,67,252,226,4,62,122,69,206,205,189,216,138,118,119,23,210,226,62,25,163,157,29,107,89,253,
+84,125,0,185,97,43,234,195,68,94,146,38,153,62,177,5,30,229,96,123,0,157,85,173,97,227,169,26,252,173,
+213,246,203,229,240,175,213,119,160,123,13,252,221,93,190,147,248,14,132,149,250,137,103,82,33,62,6,249,254,110,
+119,247,19,102,132,153,115,213,255,164,218,177,149,85,221,152,10,240,247,243,248,2,32,253,9,16,75,150,246,63,
+86,67,149,29,185,126,84,99,123,210,143,97,94,142,156,208,99,235,59,23,228,68,244,248,72,123,244,73,44,237,
+254,226,34,212,154,238,23,119,58,56,249,149,116,67,107,213,95,187,241,4,17,210,153,244,79,160,234,196,5,9,
+23,91,132,31,100,254,43,195,249,18,119,45,25,117,134,108,246,16,200,224,158,133,58,174,254,29,200,176,15,48,
+187,254,98,6,50,113,56,5,109,18,183,175,222,162,246,126,254,246,226,220,191,32,169,79,33,88,245,3,58,64,
+22,160,67,90,160,63,169,106,32,27,233,4,144,151,125,124,68,170,191,85,39,32,64,31,86,184,175,37,42,192,
+233,43,102,71,111,144,253,19,15,173,212,105,190,27,18,200,67,235,166,10,84,244,173,91,128,24,119,251,96,142,
+171,94,198,240,145,224,242,11,72,236,204,65,45,112,223,206,152,159,156,135,80,219,227,35,210,15,73,2,28,81,
+35,128,86,234,34,223,164,216,228,36,77,0,23,250,251,75,0,162,63,141,255,223,210,174,181,173,109,99,91,127,
+223,191,2,251,233,195,25,109,38,174,77,128,4,185,138,159,220,72,210,132,38,5,218,236,150,205,206,35,235,18,
+84,132,228,234,146,52,1,159,223,126,214,187,102,70,26,217,130,208,125,190,96,93,103,70,51,235,190,222,53,136,
+47,172,128,105,152,113,213,19,21,154,211,235,248,176,194,251,209,10,79,68,102,120,3,62,87,43,131,9,143,16,
+183,136,177,66,28,172,24,8,210,207,131,216,188,196,199,127,242,129,190,118,160,29,41,76,33,141,254,250,26,243,
+21,246,147,237,39,12,180,93,107,88,173,32,121,221,104,198,141,190,166,95,99,151,254,42,96,65,154,129,230,157,
+231,10,238,185,80,43,71,132,157,91,68,194,11,73,38,172,92,244,77,200,239,226,19,155,78,5,2,102,205,26,
+69,221,76,47,58,170,184,163,19,254,45,84,36,173,226,229,33,158,57,239,107,153,9,156,218,253,93,68,179,215,
+174,234,37,235,244,82,116,123,25,152,110,34,158,244,23,124,156,169,174,192,227,220,91,182,228,152,2,125,227,75,
+219,172,208,222,183,13,5,121,185,110,63,41,17,222,228,101,54,172,168,219,208,209,17,38,178,164,107,248,250,198,
+231,216,220,108,204,205,230,22,25,172,51,21,166,20,246,53,199,85,143,146,253,247,19,27,242,157,89,105,41,75,
+39,41,94,211,7,74,139,112,212,33,173,33,147,157,104,233,136,121,25,172,200,100,199,156,74,147,217,184,202,196,
+65,121,69,126,119,197,162,18,161,196,56,249,88,43,126,31,140,37,66,137,5,12,163,74,225,29,228,49,139,74,
+57,52,161,214,161,236,17,254,63,115,111,206,136,132,39,166,157,222,145,67,29,253,56,102,45,57,236,5,3,80,
+39,252,233,138,52,72,255,121,113,37,73,37,122,164,139,72,63,122,97,37,255,162,31,82,143,222,162,146,23,244,
+115,94,201,87,120,172,183,173,231,186,45,73,223,72,170,72,141,219,146,217,195,245,207,237,87,83,230,115,172,119,
+151,152,147,235,235,99,154,53,152,8,108,217,191,42,159,55,124,51,36,9,34,175,234,172,244,99,78,172,56,160,
+62,113,245,49,205,231,126,138,158,24,69,71,191,100,131,4,81,232,14,2,89,158,251,151,244,187,148,87,26,38,
+245,146,250,120,39,72,26,86,43,216,137,175,154,121,168,193,10,232,195,138,244,20,194,76,157,246,168,157,24,197,
+205,107,172,165,105,79,101,185,136,108,32,85,26,47,28,102,191,150,198,47,69,212,134,249,149,59,64,198,4,135,
+91,193,182,23,209,151,131,149,246,17,5,43,161,191,214,152,167,34,91,188,97,28,173,12,117,255,100,61,85,77,
+255,212,126,117,70,18,187,140,20,157,216,139,1,107,100,172,238,37,112,197,87,239,77,176,38,237,148,12,149,54,
+29,174,207,140,158,233,146,102,72,229,92,220,26,26,222,118,210,220,96,229,74,18,149,164,31,64,31,22,216,237,
+153,166,7,154,134,176,186,99,231,75,182,133,172,70,224,170,151,238,98,181,109,69,3,165,123,126,183,134,187,54,
+24,177,134,152,168,60,202,85,127,179,61,28,131,151,46,177,120,152,199,247,138,90,46,105,94,73,92,118,91,87,
+162,238,165,104,28,199,83,4,229,206,134,3,239,189,128,164,37,47,244,106,201,103,87,190,75,195,111,207,27,3,
+7,99,155,90,95,165,76,226,149,111,186,36,221,125,213,88,201,253,62,57,249,89,212,37,121,88,19,141,132,89,
+149,192,143,18,39,87,90,160,21,182,201,214,214,153,6,222,144,174,90,8,232,224,70,78,35,10,169,169,88,79,
+76,200,15,136,200,91,15,253,89,185,74,109,217,101,156,145,180,211,23,204,95,18,77,182,124,6,27,50,63,157,
+128,149,222,143,252,197,34,253,34,56,175,146,99,242,151,144,84,167,71,164,138,255,80,66,235,72,226,71,249,226,
+111,99,242,109,72,158,146,143,113,66,2,158,89,194,223,219,159,184,125,86,194,161,95,157,143,130,40,73,73,119,
+242,113,156,230,121,209,235,57,55,100,160,243,217,222,86,229,204,198,174,168,30,141,103,153,91,56,16,57,212,211,
+131,253,240,191,240,131,181,191,203,126,112,28,249,251,141,191,175,252,218,210,242,143,149,31,252,112,167,241,131,131,
+48,222,55,126,176,246,23,99,111,48,72,54,55,253,14,85,38,86,238,211,68,167,135,103,106,29,174,144,130,180,
+229,5,125,138,253,238,114,141,32,53,152,108,40,185,81,16,37,73,138,212,34,206,24,242,85,245,210,35,99,3,
+181,244,165,104,26,98,43,169,135,94,170,78,78,137,83,165,69,235,65,20,205,178,0,25,90,9,103,45,155,218,
+60,80,224,35,200,85,249,155,111,43,73,173,95,102,214,39,227,176,29,231,192,140,51,185,190,238,159,97,72,7,
+235,78,147,25,24,118,190,190,247,85,18,79,126,184,119,87,130,186,57,60,104,68,82,166,244,52,89,80,67,43,
+224,163,116,46,216,114,203,27,126,132,207,60,74,62,102,121,17,61,245,203,72,95,78,248,50,255,31,111,20,241,
+234,171,151,124,53,204,171,199,169,121,159,125,238,81,157,37,65,30,154,199,106,190,166,74,44,245,37,118,188,193,
+47,209,206,248,110,193,68,205,10,137,21,226,241,251,3,136,196,46,228,85,7,43,230,33,167,28,110,10,138,233,
+224,98,105,105,218,146,196,230,52,98,177,70,228,175,85,254,233,25,132,105,10,246,34,130,25,62,126,250,244,249,
+241,241,219,163,99,164,120,162,81,115,74,204,136,251,99,103,22,145,225,234,6,196,144,56,159,224,124,114,166,237,
+216,169,213,17,53,88,144,84,205,187,12,27,11,154,213,65,166,71,212,100,105,175,148,224,118,239,77,150,211,116,
+134,136,220,164,227,133,106,51,45,88,58,46,112,76,222,68,26,220,142,172,101,204,90,15,19,191,127,151,128,157,
+2,232,114,8,105,178,119,223,136,34,29,162,10,172,181,72,173,144,83,109,137,180,216,75,91,232,22,135,229,6,
+19,185,184,49,102,121,122,198,136,3,206,100,233,99,225,232,216,124,2,132,154,200,61,95,248,34,33,113,145,147,
+50,90,69,220,51,236,48,39,135,58,100,199,204,120,176,25,95,167,117,148,53,121,192,228,36,199,164,176,74,252,
+202,133,93,1,112,181,22,143,117,51,249,228,151,23,47,126,251,112,252,248,224,241,209,171,15,175,78,158,31,61,
+62,161,53,118,67,154,197,249,120,103,114,71,238,28,143,163,200,208,114,188,27,198,29,78,205,102,87,203,6,156,
+225,222,12,206,24,110,229,138,133,183,134,103,67,244,191,251,96,247,38,189,143,133,147,165,12,100,138,101,183,162,
+173,97,27,137,28,197,42,54,26,236,205,247,76,108,116,59,136,233,41,142,218,113,124,116,18,132,1,199,71,227,
+209,97,93,113,81,255,219,121,25,21,159,34,114,215,227,209,251,104,254,58,169,86,239,200,57,61,78,171,194,255,
+44,234,35,29,107,65,39,191,112,196,16,151,73,196,47,196,28,129,212,80,196,114,248,103,29,213,209,97,18,96,
+11,182,242,130,131,170,128,187,107,140,247,95,196,136,217,154,64,147,209,20,2,165,242,230,36,132,46,253,36,67,
+128,128,38,149,156,53,71,155,59,0,56,123,249,40,134,33,148,115,14,143,147,54,145,48,41,130,194,8,135,156,
+88,201,113,19,79,123,153,197,114,217,28,51,188,138,171,73,232,53,249,101,230,219,35,153,115,171,39,36,220,144,
+197,113,63,17,203,94,206,68,9,76,74,224,133,121,192,54,149,6,47,157,208,147,63,145,96,20,67,132,18,163,
+207,27,159,232,157,81,174,38,77,4,100,111,159,251,133,31,80,71,207,252,202,103,191,72,118,58,11,70,216,127,
+194,163,214,75,98,239,143,155,155,31,13,198,124,38,82,175,57,17,106,224,96,197,148,85,90,183,149,90,201,131,
+20,145,63,199,237,220,58,87,183,98,190,101,113,6,45,192,186,22,191,138,51,82,168,156,33,80,29,46,167,200,
+96,39,77,174,52,71,180,132,108,56,154,89,136,110,72,124,200,136,155,37,190,38,209,220,10,120,119,37,126,27,
+228,46,173,132,64,96,37,4,82,47,55,193,218,154,236,76,29,88,38,31,121,86,187,245,230,102,61,234,56,218,
+215,215,254,55,204,61,154,38,132,74,4,9,165,68,212,116,60,75,33,177,107,250,227,242,81,108,66,31,163,225,
+22,194,48,184,200,31,186,27,223,252,161,141,245,215,154,160,137,109,130,90,166,22,174,54,182,63,89,85,85,65,
+141,246,56,40,108,138,38,110,174,76,81,34,84,68,241,111,30,193,248,62,219,147,60,213,59,59,126,104,166,90,
+231,67,120,170,119,199,193,142,153,106,250,28,53,213,36,151,225,47,208,68,175,83,196,196,3,12,199,219,198,79,
+234,221,199,79,237,237,224,39,246,246,240,19,122,187,12,108,136,215,170,4,22,242,92,94,202,79,109,158,122,46,
+63,146,184,72,196,2,50,34,23,95,32,18,50,129,135,238,35,205,226,139,207,6,66,38,47,188,177,124,3,144,
+99,41,15,189,104,246,134,26,251,224,184,5,31,140,77,224,104,250,225,209,197,244,98,107,11,168,82,17,94,95,
+95,0,95,245,25,193,160,185,247,249,244,226,140,228,212,95,98,46,47,228,23,68,69,240,84,228,28,210,117,175,
+197,242,127,116,212,255,107,225,242,13,178,142,54,238,187,141,114,230,243,93,125,190,49,87,231,123,230,252,66,157,
+111,187,129,98,176,67,57,111,81,53,181,81,241,147,102,86,102,247,38,110,74,166,35,17,237,225,210,54,91,174,
+116,82,198,77,5,241,247,165,191,160,131,9,233,217,36,69,56,32,21,219,180,92,249,101,68,71,52,75,0,224,
+125,161,195,29,60,144,133,116,180,171,142,94,241,166,36,169,216,131,45,128,76,215,45,70,24,231,205,110,51,156,
+6,153,229,12,106,248,150,204,225,63,146,62,94,55,233,69,1,112,133,86,118,112,38,51,146,17,13,180,184,105,
+40,159,246,58,144,252,182,241,244,110,127,121,240,255,235,126,45,192,249,212,207,254,167,66,88,19,27,1,105,212,
+249,70,149,111,44,76,194,107,67,101,136,121,78,201,252,89,113,57,219,25,28,76,232,1,82,185,189,62,169,101,
+9,220,46,153,154,49,107,200,223,67,121,111,194,93,239,5,225,221,36,108,16,113,250,47,241,134,31,62,4,100,
+240,223,251,163,252,80,146,6,138,194,15,31,80,103,152,157,38,228,190,228,34,65,238,194,26,140,79,157,60,156,
+251,125,195,159,22,55,217,118,66,195,37,60,146,185,80,125,22,50,162,125,106,232,8,43,119,191,94,207,245,153,
+104,55,255,12,116,159,167,14,157,101,59,172,2,168,151,135,59,55,127,187,214,34,185,149,234,101,145,183,19,238,
+193,228,225,157,122,222,198,198,245,134,141,123,35,217,43,34,47,73,46,85,144,137,99,146,118,26,19,203,176,205,
+210,33,178,242,25,153,153,9,133,208,76,27,128,108,23,0,251,40,112,248,17,47,58,13,16,119,161,143,251,95,
+40,157,130,148,78,243,78,19,104,76,177,192,193,228,142,42,84,231,188,19,210,131,198,18,65,249,168,64,213,96,
+14,108,7,91,37,207,83,198,223,57,183,147,155,63,91,121,30,41,161,171,37,143,199,223,187,131,166,131,14,25,
+135,112,81,191,29,174,211,118,61,182,154,251,152,145,157,159,147,222,83,39,110,14,213,134,160,199,183,128,50,43,
+83,128,53,31,239,237,223,46,202,240,193,50,23,17,251,115,54,140,223,66,98,69,218,25,76,70,168,149,0,181,
+24,179,171,129,215,9,174,117,89,40,155,23,51,20,221,38,97,237,21,83,174,213,141,67,4,7,1,150,129,147,
+214,128,205,96,134,68,203,38,118,182,148,160,222,27,197,207,21,63,112,127,255,198,7,58,158,115,3,174,25,12,
+170,134,57,155,36,33,106,34,208,218,222,45,20,176,179,253,48,94,67,124,244,36,129,123,130,63,179,214,178,188,
+105,74,204,156,175,196,53,127,216,158,37,34,83,225,214,68,228,56,112,113,74,12,73,127,79,35,8,54,62,205,
+213,41,190,98,18,61,184,139,55,119,133,141,50,214,83,26,244,129,109,29,111,111,20,28,85,221,80,56,58,232,
+54,113,183,151,114,226,48,224,41,153,173,27,83,185,142,143,58,118,57,71,100,37,31,151,0,174,133,219,15,231,
+55,207,189,66,123,16,199,89,78,56,222,153,207,239,198,62,247,231,243,168,67,143,189,101,30,100,30,15,155,10,
+15,114,212,175,150,179,117,95,141,129,251,40,136,6,73,85,223,154,43,177,86,76,111,245,160,220,211,38,175,125,
+122,134,152,86,97,231,39,31,23,133,255,69,19,107,226,92,45,87,173,205,2,53,169,166,56,150,97,100,244,152,
+68,173,133,110,51,33,251,209,170,90,73,224,16,10,99,74,98,10,239,207,111,51,174,45,111,95,7,101,89,2,
+33,96,128,229,128,86,93,255,192,54,103,152,116,114,99,212,219,206,109,2,68,65,137,200,153,207,45,45,151,88,
+17,25,31,176,26,187,252,223,185,5,29,86,113,36,170,242,10,98,62,123,120,62,43,51,82,32,235,105,65,93,
+38,181,132,249,17,246,169,224,14,40,65,137,207,190,122,23,248,217,112,119,60,118,133,232,204,102,123,250,156,198,
+30,208,242,65,133,46,79,136,75,200,19,110,142,145,67,95,127,214,152,14,218,110,232,125,166,140,210,120,115,19,
+127,251,239,131,255,232,206,205,166,139,99,151,101,144,129,69,86,210,16,89,166,48,156,143,239,166,0,200,139,13,
+204,234,69,219,123,227,198,235,85,49,183,210,90,213,192,43,59,177,181,20,231,157,85,70,32,82,215,196,52,245,
+58,49,236,19,93,184,20,146,137,23,159,201,133,23,110,110,134,237,82,195,120,86,245,214,139,211,224,108,192,133,
+202,196,179,62,121,83,129,172,141,14,184,116,174,112,219,171,151,252,96,74,18,21,79,144,175,141,220,77,124,214,
+20,178,224,223,91,110,36,14,63,117,142,230,18,250,105,90,60,151,124,106,55,122,126,198,143,48,136,31,16,187,
+155,103,46,176,102,238,193,195,251,251,125,162,10,65,196,110,244,162,225,251,138,19,74,50,26,79,252,255,34,107,
+163,195,211,137,181,132,190,197,128,165,101,126,4,29,54,77,21,54,17,8,80,94,33,21,62,224,162,130,62,143,
+5,187,24,136,129,232,164,230,105,70,107,171,178,205,202,207,213,162,147,136,215,8,151,24,49,241,112,61,37,176,
+166,54,39,166,41,111,5,146,161,174,186,125,200,12,169,32,229,182,252,13,103,176,241,107,216,136,77,115,213,140,
+198,230,226,154,73,140,178,101,79,31,23,51,14,99,140,156,192,52,21,33,209,24,207,56,209,165,5,71,181,190,
+119,186,232,24,103,170,204,253,220,91,52,158,147,188,52,32,69,81,69,101,229,80,71,122,224,53,177,8,93,65,
+190,233,147,247,253,127,212,67,255,22,98,244,79,231,223,206,233,127,156,179,173,239,190,159,6,68,151,127,15,9,
+161,102,179,84,209,89,85,169,160,157,84,161,170,37,104,142,206,237,242,89,95,196,109,182,97,56,212,54,229,229,
+44,210,222,220,3,120,115,46,138,232,248,63,246,138,79,114,248,221,100,216,153,185,194,172,73,161,51,251,45,122,
+194,164,211,199,45,90,34,100,233,140,48,254,221,28,36,29,7,74,44,188,169,78,4,60,120,192,212,77,42,229,
+213,243,15,239,142,222,158,188,101,10,95,213,103,182,195,56,235,221,225,164,47,203,94,41,151,10,99,195,68,158,
+150,103,110,159,97,104,175,63,233,9,155,244,58,247,102,157,179,118,112,110,231,21,53,186,89,224,34,201,204,179,
+244,224,22,229,174,82,81,214,231,13,186,41,195,166,104,173,18,173,229,97,77,76,135,118,57,173,221,59,59,2,
+28,84,57,72,185,183,239,50,102,1,122,225,142,242,74,187,185,58,202,23,54,1,85,141,30,247,45,228,47,203,
+171,7,97,168,162,124,67,182,160,90,128,56,9,45,159,173,174,154,126,91,40,111,96,207,67,41,248,37,169,222,
+237,96,152,96,169,107,189,168,144,163,129,212,46,32,187,92,106,147,220,177,188,64,148,10,118,132,35,215,17,21,
+117,147,190,172,70,234,101,137,88,14,222,145,188,105,4,26,217,218,50,214,114,116,125,157,61,242,140,155,61,19,
+230,37,19,213,215,136,90,125,102,42,188,29,119,8,133,49,4,123,233,39,50,125,115,178,116,85,13,64,231,110,
+116,154,157,181,15,232,139,167,153,196,245,246,6,125,144,121,151,190,118,244,216,136,79,15,199,152,179,92,168,126,
+97,137,182,79,114,217,32,215,222,12,121,221,131,224,102,178,84,118,230,45,134,157,209,199,248,23,242,27,145,195,
+234,143,134,137,34,250,22,200,4,234,223,189,255,240,230,110,148,241,161,170,52,232,217,189,189,7,127,211,143,188,
+82,255,33,130,188,1,53,87,240,42,87,221,74,243,76,107,90,194,22,136,246,130,248,206,73,75,69,207,90,95,
+7,86,74,50,181,244,117,109,33,43,98,11,125,17,90,134,251,66,153,98,65,96,50,100,26,53,207,217,177,237,
+189,237,61,83,61,160,117,253,92,101,205,88,122,114,245,192,100,223,247,77,245,128,206,180,113,245,192,195,253,237,
+182,122,96,155,199,240,65,189,251,32,50,213,3,26,233,241,102,37,51,199,21,4,200,254,153,10,2,141,2,249,
+67,243,121,100,42,8,84,200,67,85,16,96,173,76,5,129,230,121,174,32,216,223,9,124,83,65,160,77,75,174,
+32,216,14,199,99,174,32,248,73,12,203,69,20,48,21,202,175,94,11,254,248,206,123,12,89,32,159,209,47,134,
+245,78,157,107,217,240,213,145,7,94,44,127,241,210,81,19,69,149,191,209,89,19,139,58,162,19,147,37,124,66,
+252,77,211,79,100,64,157,252,236,29,147,157,244,194,251,89,190,180,19,134,95,196,145,35,223,123,131,129,248,109,
+115,243,55,19,142,194,54,230,136,175,53,165,198,184,128,154,129,97,157,225,159,101,164,81,88,68,16,176,172,201,
+255,133,250,63,125,166,239,14,229,239,222,88,254,232,77,228,159,222,182,124,77,191,85,69,7,36,42,78,196,215,
+30,65,244,89,28,64,44,107,139,226,128,245,249,64,225,251,246,246,72,49,63,111,83,246,184,243,210,54,234,26,
+192,136,158,196,35,51,22,53,234,38,170,162,106,123,7,7,253,192,16,187,253,231,143,188,221,201,230,230,247,25,
+239,169,189,1,224,197,247,35,216,56,52,178,54,177,160,66,10,7,77,134,112,178,134,160,21,93,196,207,26,0,
+72,162,72,223,86,93,109,61,105,118,250,10,232,199,129,136,214,1,52,244,170,165,105,11,133,106,174,188,8,117,
+19,31,186,219,30,28,140,148,125,116,170,170,159,135,103,98,29,132,132,10,140,181,80,73,3,48,31,0,9,221,
+135,207,17,172,52,104,108,128,154,71,75,148,110,244,212,151,13,162,81,150,87,73,156,68,161,115,213,30,155,10,
+121,76,0,145,28,191,85,78,15,215,64,127,57,221,87,27,229,36,116,196,133,205,158,247,35,41,217,177,142,249,
+102,38,230,107,54,158,82,233,121,242,194,252,173,173,51,192,68,102,245,40,191,112,235,81,236,39,41,73,161,218,
+172,23,73,33,28,115,217,201,57,29,170,124,55,135,82,226,153,72,128,83,25,53,100,13,171,186,226,234,7,8,
+100,105,223,121,237,200,1,108,241,120,86,122,185,43,200,199,62,55,153,109,18,152,228,128,144,140,35,131,252,92,
+103,209,129,117,25,59,184,229,41,251,27,36,59,91,136,95,26,232,210,189,224,156,6,178,17,124,9,82,128,184,
+92,17,120,89,37,74,199,153,233,76,87,41,67,185,112,220,16,215,220,5,117,208,122,122,212,211,32,229,17,168,
+206,22,116,113,185,180,230,216,59,197,86,59,237,50,76,36,96,50,214,247,108,110,250,234,35,21,170,37,169,188,
+27,208,16,211,247,51,145,121,29,145,33,134,252,131,76,188,249,50,47,162,99,122,162,164,153,42,232,16,255,166,
+64,61,91,153,162,183,21,49,35,136,160,220,204,187,210,13,184,145,84,175,147,77,46,69,238,165,167,67,34,194,
+173,234,204,153,229,244,168,11,216,254,175,155,155,127,136,225,47,70,248,108,232,87,55,44,25,133,194,134,181,122,
+156,55,38,107,191,74,118,5,115,166,34,188,220,99,28,165,246,37,69,225,189,237,80,233,203,217,209,40,186,164,
+201,110,69,227,81,219,109,70,30,137,75,55,127,149,21,231,255,187,164,243,242,250,154,219,158,85,149,251,90,22,
+35,86,209,6,202,172,43,33,89,78,148,85,111,112,167,109,138,100,231,107,90,71,50,107,249,223,51,172,85,240,
+220,240,173,237,224,155,150,94,26,1,174,6,254,47,4,198,117,77,38,15,37,93,37,8,171,76,184,221,159,14,
+194,143,11,104,37,215,225,214,125,47,69,188,71,5,243,153,217,114,68,67,89,29,211,37,240,223,154,235,255,36,
+1,195,239,130,123,86,170,101,76,139,74,222,240,206,23,87,235,141,50,107,163,240,2,142,158,158,228,150,235,54,
+2,206,69,206,65,53,44,31,194,141,164,66,220,74,87,90,228,96,66,178,234,242,217,186,148,34,106,53,86,41,
+119,146,155,144,103,90,137,184,194,210,67,104,208,73,109,78,156,54,144,90,171,154,165,4,44,199,117,78,235,223,
+254,99,243,237,147,181,55,155,158,117,11,203,105,4,255,255,160,67,48,31,117,213,134,36,3,98,206,206,96,27,
+85,115,180,34,251,78,159,113,44,89,232,145,171,194,33,51,116,117,102,165,73,234,166,200,3,91,136,202,238,230,
+74,207,108,231,228,171,177,219,165,145,61,56,86,212,138,163,70,64,185,36,160,26,98,196,29,158,2,247,119,105,
+251,22,8,224,102,86,32,99,33,44,173,46,87,176,183,86,38,248,157,246,119,50,239,103,113,97,42,89,26,75,
+61,35,69,225,245,216,21,164,87,105,133,88,129,244,225,105,17,194,148,153,214,31,30,88,74,29,26,63,168,208,
+76,201,123,234,180,146,88,37,34,51,164,181,248,19,7,222,239,40,140,209,145,78,44,117,43,69,251,54,31,88,
+3,241,26,104,149,130,212,246,96,85,201,249,37,218,195,66,211,42,171,237,51,148,140,174,154,29,204,64,248,158,
+161,218,168,217,217,12,203,225,25,250,69,177,26,217,146,222,207,189,50,137,152,235,128,230,139,126,18,14,88,33,
+246,224,190,0,128,70,6,189,48,95,164,58,124,133,109,211,206,60,195,171,66,17,119,2,249,116,109,205,253,181,
+182,181,177,118,229,60,16,43,143,249,134,29,181,90,83,211,165,78,58,89,1,217,179,186,79,54,55,75,59,14,
+212,133,133,218,81,33,182,180,251,150,232,169,56,144,79,52,230,62,149,77,156,143,203,30,96,9,220,82,164,19,
+161,32,65,75,40,247,96,137,170,75,98,98,163,57,47,225,16,36,100,229,127,229,86,180,251,255,117,53,245,203,
+141,168,69,236,1,142,235,82,35,123,147,41,181,57,24,230,172,161,41,25,181,201,215,91,59,163,69,214,253,49,
+49,245,207,71,160,202,14,153,72,14,92,157,147,251,70,195,5,90,165,49,245,124,130,98,25,250,18,46,230,108,
+146,199,136,209,24,11,47,89,81,219,138,116,230,162,217,81,22,19,73,162,135,44,75,50,205,38,211,191,136,62,
+196,106,79,129,71,70,37,12,184,201,52,81,236,107,80,129,37,93,47,204,118,202,189,123,222,166,68,230,48,253,
+100,130,8,127,37,239,221,43,175,175,51,192,110,193,173,108,26,52,151,150,142,181,207,51,27,5,10,92,160,183,
+70,104,243,224,178,192,238,236,119,153,16,85,93,221,51,9,121,103,18,214,191,59,95,253,170,118,122,217,160,177,
+198,154,155,177,146,1,176,62,86,200,108,68,232,239,22,43,221,221,139,98,19,89,211,53,254,126,27,241,191,49,
+117,221,238,69,4,200,1,111,39,21,203,0,192,2,90,182,241,52,253,161,208,254,194,52,221,218,82,93,215,94,
+113,154,158,77,209,64,205,24,102,128,186,177,239,92,13,6,197,152,231,183,165,75,56,250,96,141,135,99,79,163,
+164,228,223,190,36,137,14,229,121,168,29,224,248,241,254,174,255,173,216,144,206,28,171,8,99,226,117,114,207,52,
+47,170,207,190,48,113,15,247,181,101,71,100,38,228,42,86,166,182,70,242,177,213,29,96,25,52,42,68,57,238,
+24,16,213,129,153,124,221,137,148,69,87,207,112,248,181,35,157,149,209,214,12,41,178,178,46,61,251,137,60,241,
+195,141,198,92,235,212,194,70,12,146,204,184,252,218,86,101,200,142,118,148,24,50,211,86,10,180,191,146,211,232,
+45,204,195,110,24,223,45,41,173,227,80,183,39,137,137,34,135,77,164,146,104,32,239,41,171,105,20,196,18,24,
+223,160,7,175,98,116,45,64,22,141,45,214,193,52,102,179,220,237,89,14,153,77,87,43,209,171,25,57,78,170,
+220,35,28,114,180,94,93,252,137,142,134,174,222,231,193,134,250,17,107,120,77,85,157,244,201,45,45,220,114,6,
+118,107,176,71,158,135,154,1,193,69,232,125,6,19,139,148,40,154,89,83,129,237,229,37,146,34,183,136,7,133,
+94,206,45,196,50,179,130,10,242,126,3,115,124,90,161,206,28,63,156,13,225,165,157,239,253,87,57,74,11,254,
+164,119,67,241,213,51,193,220,196,252,53,202,55,176,242,5,28,35,125,168,118,46,169,45,26,225,24,233,36,228,
+248,98,168,246,177,225,248,228,2,40,104,78,92,113,144,52,52,39,242,170,41,138,129,114,28,187,99,9,212,11,
+130,167,181,29,84,252,4,84,49,191,34,231,10,6,125,233,255,101,227,196,116,70,161,169,54,51,166,204,226,250,
+122,112,142,50,72,188,219,103,69,147,179,130,242,135,64,219,210,161,87,146,169,102,112,195,11,15,229,51,33,134,
+236,11,107,187,131,16,91,190,178,19,157,8,160,76,137,144,98,59,244,37,123,44,195,226,250,26,91,12,240,64,
+177,31,163,176,178,77,240,254,11,213,78,113,122,121,38,53,225,22,124,69,107,101,199,45,154,218,3,79,183,99,
+229,98,139,6,153,250,201,64,244,23,242,220,225,180,126,6,89,213,142,191,152,241,203,40,74,156,139,243,123,128,
+64,99,21,199,211,197,15,231,211,5,233,254,154,180,201,2,73,128,120,115,19,251,76,211,4,157,46,206,44,207,
+66,205,143,87,203,140,21,33,136,226,22,120,151,2,143,231,138,52,30,142,191,69,221,164,111,13,77,135,243,224,
+102,148,218,211,227,227,163,58,141,222,36,101,69,100,67,103,199,248,231,50,207,162,32,245,11,245,191,37,249,234,
+175,80,221,230,161,52,33,254,60,34,174,214,23,158,189,61,236,158,41,233,214,158,159,228,23,81,198,167,19,137,
+154,139,19,254,255,56,81,241,170,138,46,245,83,7,73,51,136,151,39,135,111,30,167,233,211,156,4,66,160,135,
+128,107,107,23,14,242,226,82,195,36,245,149,227,8,79,180,215,14,163,48,241,117,179,135,201,101,4,197,161,150,
+109,44,81,242,28,162,78,228,144,204,107,58,165,35,61,196,119,228,169,209,247,253,89,71,165,249,168,119,105,205,
+255,146,79,31,152,54,142,127,125,241,134,87,81,63,70,231,63,213,151,243,168,104,207,223,17,159,29,71,31,173,
+11,248,199,160,237,105,103,174,232,252,196,252,239,32,115,41,175,137,9,159,212,113,220,182,138,37,58,62,143,34,
+211,12,42,94,232,189,224,226,105,179,72,205,37,115,158,215,129,30,165,162,137,91,84,152,170,247,176,85,7,177,
+154,174,190,64,213,58,73,240,213,173,100,244,93,99,130,80,15,145,191,255,45,44,142,221,131,169,93,34,86,152,
+254,240,189,194,4,60,250,199,15,223,207,243,240,11,126,207,171,203,244,209,63,254,15,204,222,188,142,16,149,2,
+0,
+};
+const WebAsset_t WEB_ASSET_UPDATE = {"/update", "text/html", WEB_ASSET_UPDATE_DATA, 56041, "\"206cc4e4bde8291c\""};
+
+#endif  // WEB_ASSETS_H
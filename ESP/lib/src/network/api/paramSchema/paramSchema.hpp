@@ -0,0 +1,234 @@
+#pragma once
+#ifndef PARAM_SCHEMA_HPP
+#define PARAM_SCHEMA_HPP
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "data/utilities/string_view.hpp"
+
+/**
+ * @brief Declarative request parameter parsing
+ * @details Every endpoint describes its parameters as a table of fields, each
+ * pointing at a member of a plain struct by its offset. Parameters are then
+ * parsed in a single pass straight into that struct, without allocating
+ * anything. Fields that were not sent keep whatever the struct held before, so
+ * prefilling it with the current config turns every optional field into a
+ * "leave as is".
+ */
+namespace ParamSchema {
+  enum ParamType_e : uint8_t {
+    Param_UInt8,
+    Param_Int8,
+    Param_Int32,
+    Param_UInt32,
+    Param_Bool,
+    //! copied into a fixed size char array, always null terminated
+    Param_Text,
+  };
+
+  enum ParamFlags_e : uint8_t {
+    Param_Optional = 0,
+    Param_Required = 1 << 0,
+    //! text is lower cased while being copied
+    Param_Lowercase = 1 << 1,
+  };
+
+  enum ParamError_e : uint8_t {
+    Param_Ok,
+    Param_Missing,
+    Param_NotANumber,
+    Param_NotABool,
+    Param_OutOfRange,
+    Param_TooLong,
+  };
+
+  struct Field_t {
+    const char* name;
+    ParamType_e type;
+    uint8_t flags;
+    //! offset of the member in the target struct
+    size_t offset;
+    //! range for numbers, buffer size including the terminator for text
+    int64_t min;
+    int64_t max;
+  };
+
+  struct Result_t {
+    ParamError_e error;
+    //! the field the error is about, nullptr when everything went fine
+    const char* field;
+  };
+
+  //! at most this many fields per schema, presence is tracked in a bitmask
+  constexpr size_t MAX_FIELDS = 32;
+
+  constexpr Field_t number(const char* name,
+                           ParamType_e type,
+                           size_t offset,
+                           int64_t min,
+                           int64_t max,
+                           uint8_t flags = Param_Optional) {
+    return {name, type, flags, offset, min, max};
+  }
+
+  constexpr Field_t boolean(const char* name,
+                            size_t offset,
+                            uint8_t flags = Param_Optional) {
+    return {name, Param_Bool, flags, offset, 0, 1};
+  }
+
+  constexpr Field_t text(const char* name,
+                         size_t offset,
+                         size_t capacity,
+                         uint8_t flags = Param_Optional) {
+    return {name, Param_Text, flags, offset, 0, (int64_t)capacity};
+  }
+
+  inline const char* errorName(ParamError_e error) {
+    switch (error) {
+      case Param_Ok:
+        return "ok";
+      case Param_Missing:
+        return "missing";
+      case Param_NotANumber:
+        return "not_a_number";
+      case Param_NotABool:
+        return "not_a_bool";
+      case Param_OutOfRange:
+        return "out_of_range";
+      case Param_TooLong:
+        return "too_long";
+    }
+    return "invalid";
+  }
+
+  inline bool parseInteger(Helpers::string_view value, int64_t& result) {
+    size_t i = 0;
+    bool negative = false;
+    if (!value.empty() && (value[0] == '-' || value[0] == '+')) {
+      negative = value[0] == '-';
+      i++;
+    }
+    // anything longer could not be in range of any of our types anyway
+    if (i == value.size() || value.size() - i > 11)
+      return false;
+
+    result = 0;
+    for (; i < value.size(); i++) {
+      if (value[i] < '0' || value[i] > '9')
+        return false;
+      result = result * 10 + (value[i] - '0');
+    }
+    if (negative)
+      result = -result;
+    return true;
+  }
+
+  inline bool parseBool(Helpers::string_view value, bool& result) {
+    if (value == Helpers::string_view("1") ||
+        value == Helpers::string_view("true")) {
+      result = true;
+      return true;
+    }
+    if (value == Helpers::string_view("0") ||
+        value == Helpers::string_view("false")) {
+      result = false;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Parse a single value into its member of out
+   */
+  inline ParamError_e store(const Field_t& field,
+                            Helpers::string_view value,
+                            void* out) {
+    uint8_t* target = static_cast<uint8_t*>(out) + field.offset;
+
+    if (field.type == Param_Text) {
+      if (value.size() >= (size_t)field.max)
+        return Param_TooLong;
+      char* text = reinterpret_cast<char*>(target);
+      for (size_t i = 0; i < value.size(); i++) {
+        char c = value[i];
+        if ((field.flags & Param_Lowercase) && c >= 'A' && c <= 'Z')
+          c += 'a' - 'A';
+        text[i] = c;
+      }
+      text[value.size()] = '\0';
+      return Param_Ok;
+    }
+
+    if (field.type == Param_Bool) {
+      bool result;
+      if (!parseBool(value, result))
+        return Param_NotABool;
+      *reinterpret_cast<bool*>(target) = result;
+      return Param_Ok;
+    }
+
+    int64_t result;
+    if (!parseInteger(value, result))
+      return Param_NotANumber;
+    if (result < field.min || result > field.max)
+      return Param_OutOfRange;
+
+    switch (field.type) {
+      case Param_UInt8:
+        *reinterpret_cast<uint8_t*>(target) = (uint8_t)result;
+        break;
+      case Param_Int8:
+        *reinterpret_cast<int8_t*>(target) = (int8_t)result;
+        break;
+      case Param_Int32:
+        *reinterpret_cast<int32_t*>(target) = (int32_t)result;
+        break;
+      case Param_UInt32:
+        *reinterpret_cast<uint32_t*>(target) = (uint32_t)result;
+        break;
+      default:
+        break;
+    }
+    return Param_Ok;
+  }
+
+  /**
+   * @brief Apply one request parameter, parameters that are not part of the
+   * schema are ignored
+   * @param present bit n gets set once field n was parsed
+   */
+  inline Result_t apply(const Field_t* schema,
+                        size_t count,
+                        Helpers::string_view name,
+                        Helpers::string_view value,
+                        void* out,
+                        uint32_t& present) {
+    for (size_t i = 0; i < count; i++) {
+      if (name != Helpers::string_view(schema[i].name))
+        continue;
+
+      ParamError_e error = store(schema[i], value, out);
+      if (error != Param_Ok)
+        return {error, schema[i].name};
+      present |= 1u << i;
+      return {Param_Ok, nullptr};
+    }
+    return {Param_Ok, nullptr};
+  }
+
+  /**
+   * @brief Fail on the first required field that has not been parsed
+   */
+  inline Result_t checkRequired(const Field_t* schema,
+                                size_t count,
+                                uint32_t present) {
+    for (size_t i = 0; i < count; i++) {
+      if ((schema[i].flags & Param_Required) && !(present & (1u << i)))
+        return {Param_Missing, schema[i].name};
+    }
+    return {Param_Ok, nullptr};
+  }
+}  // namespace ParamSchema
+
+#endif  // PARAM_SCHEMA_HPP
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef API_ROUTES_HPP
+#define API_ROUTES_HPP
+#include "network/api/routeTable/routeTable.hpp"
+
+/**
+ * @brief The command API's routes, "<api url>/<map>/command/<command>"
+ * @details The one list both APIServer and the route table benchmark build
+ * their table from, so the benchmark times the firmware's table, the same
+ * size and seed. A route resolves to its Command_e, APIServer::handleRequest
+ * switches on it.
+ */
+namespace ApiRoutes {
+  enum Command_e {
+    Command_SetWiFi,
+    Command_FactoryReset,
+    Command_SetDevice,
+    Command_RebootDevice,
+    Command_GetStoredConfig,
+    Command_SetTxPower,
+#ifndef SIM_ENABLED
+    Command_SetCamera,
+    Command_RestartCamera,
+#endif  // SIM_ENABLED
+    Command_Ping,
+    Command_Save,
+    Command_WiFiStrength,
+    Command_SetIREmitter,
+    Command_SetHaptics,
+    Command_Profile,
+  };
+
+  //! the table is built at compile time, adding a route is adding a line here
+  //! and a case to APIServer::handleRequest
+  inline constexpr RouteTable::Route_t<Command_e> list[] = {
+      {"builtin", "wifi", Command_SetWiFi},
+      {"builtin", "resetConfig", Command_FactoryReset},
+      {"builtin", "setDevice", Command_SetDevice},
+      {"builtin", "rebootDevice", Command_RebootDevice},
+      {"builtin", "getStoredConfig", Command_GetStoredConfig},
+      {"builtin", "setTxPower", Command_SetTxPower},
+  // Camera Routes
+#ifndef SIM_ENABLED
+      {"builtin", "setCamera", Command_SetCamera},
+      {"builtin", "restartCamera", Command_RestartCamera},
+#endif  // SIM_ENABLED
+      {"builtin", "ping", Command_Ping},
+      {"builtin", "save", Command_Save},
+      {"builtin", "wifiStrength", Command_WiFiStrength},
+      {"builtin", "setIREmitter", Command_SetIREmitter},
+      {"builtin", "setHaptics", Command_SetHaptics},
+      {"builtin", "profile", Command_Profile},
+  };
+
+  inline constexpr auto table = RouteTable::make(list);
+  static_assert(table.valid(), "Could not find a perfect hash for the routes");
+}  // namespace ApiRoutes
+
+#endif  // API_ROUTES_HPP
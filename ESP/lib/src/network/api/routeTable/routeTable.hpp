@@ -0,0 +1,202 @@
+#pragma once
+#ifndef ROUTE_TABLE_HPP
+#define ROUTE_TABLE_HPP
+#include <stddef.h>
+#include <stdint.h>
+#include "data/utilities/string_view.hpp"
+
+/**
+ * @brief Compile time route table for the command API
+ * @details The routes are hashed into a table with a seed that is searched
+ * for at compile time, such that no two routes land in the same slot. Looking
+ * a command up is then a single hash of the path segments plus one string
+ * compare, without any heap allocation.
+ */
+namespace RouteTable {
+  constexpr uint32_t FNV_OFFSET = 2166136261u;
+  constexpr uint32_t FNV_PRIME = 16777619u;
+  //! gives up looking for a collision free seed after this many tries
+  constexpr uint32_t MAX_SEED = 100000;
+
+  constexpr uint32_t hashBytes(uint32_t hash, const char* data, size_t len) {
+    for (size_t i = 0; i < len; i++)
+      hash = (hash ^ (uint8_t)data[i]) * FNV_PRIME;
+    return hash;
+  }
+
+  //! hashes "<map>/<command>" without ever building that string
+  constexpr uint32_t hashRoute(uint32_t seed,
+                               const char* map,
+                               size_t mapLen,
+                               const char* command,
+                               size_t commandLen) {
+    uint32_t hash = hashBytes(FNV_OFFSET ^ seed, map, mapLen);
+    hash = (hash ^ '/') * FNV_PRIME;
+    hash = hashBytes(hash, command, commandLen);
+    return hash ^ (hash >> 16);
+  }
+
+  constexpr size_t length(const char* str) {
+    size_t len = 0;
+    while (str[len])
+      len++;
+    return len;
+  }
+
+  constexpr size_t slotsFor(size_t routes) {
+    size_t slots = 1;
+    while (slots < routes * 2)
+      slots <<= 1;
+    return slots;
+  }
+
+  template <typename Handler>
+  struct Route_t {
+    const char* map;
+    const char* command;
+    Handler handler;
+  };
+
+  template <typename Handler, size_t N>
+  class Table {
+   public:
+    static constexpr size_t slotCount = slotsFor(N);
+    static constexpr uint8_t EMPTY = 0xFF;
+    static_assert(N < EMPTY, "Too many routes for the route table");
+
+    constexpr explicit Table(const Route_t<Handler> (&list)[N]) {
+      for (size_t i = 0; i < N; i++) {
+        this->routes[i] = list[i];
+        this->mapLengths[i] = length(list[i].map);
+        this->commandLengths[i] = length(list[i].command);
+      }
+
+      for (uint32_t candidate = 1; candidate < MAX_SEED; candidate++) {
+        if (this->tryPlace(candidate)) {
+          this->seed = candidate;
+          return;
+        }
+      }
+    }
+
+    //! false if no seed was found, check it with a static_assert
+    constexpr bool valid() const { return this->seed != 0; }
+
+    constexpr size_t size() const { return N; }
+    const Route_t<Handler>& at(size_t index) const {
+      return this->routes[index];
+    }
+    //! position of a route find() returned, in the order the list had
+    size_t indexOf(const Route_t<Handler>* route) const {
+      return route - this->routes;
+    }
+
+    /**
+     * @brief Find the route for a map and command
+     * @return nullptr if there is no such route
+     */
+    const Route_t<Handler>* find(Helpers::string_view map,
+                                 Helpers::string_view command) const {
+      uint8_t index = this->slots[hashRoute(this->seed, map.data(), map.size(),
+                                            command.data(), command.size()) &
+                                  (slotCount - 1)];
+      if (index == EMPTY)
+        return nullptr;
+
+      // the slot only tells us where the route would be, it might still be
+      // a different one that happens to share the hash
+      if (map != Helpers::string_view(this->routes[index].map,
+                                      this->mapLengths[index]) ||
+          command != Helpers::string_view(this->routes[index].command,
+                                          this->commandLengths[index]))
+        return nullptr;
+
+      return &this->routes[index];
+    }
+
+    //! only used to tell an unknown map from an unknown command
+    bool hasMap(Helpers::string_view map) const {
+      for (size_t i = 0; i < N; i++) {
+        if (map == Helpers::string_view(this->routes[i].map,
+                                        this->mapLengths[i]))
+          return true;
+      }
+      return false;
+    }
+
+   private:
+    constexpr bool tryPlace(uint32_t candidate) {
+      for (size_t slot = 0; slot < slotCount; slot++)
+        this->slots[slot] = EMPTY;
+
+      for (size_t i = 0; i < N; i++) {
+        size_t slot = hashRoute(candidate, this->routes[i].map,
+                                this->mapLengths[i], this->routes[i].command,
+                                this->commandLengths[i]) &
+                      (slotCount - 1);
+        if (this->slots[slot] != EMPTY)
+          return false;
+        this->slots[slot] = i;
+      }
+      return true;
+    }
+
+    Route_t<Handler> routes[N] = {};
+    size_t mapLengths[N] = {};
+    size_t commandLengths[N] = {};
+    uint8_t slots[slotCount] = {};
+    uint32_t seed = 0;
+  };
+
+  template <typename Handler, size_t N>
+  constexpr Table<Handler, N> make(const Route_t<Handler> (&list)[N]) {
+    return Table<Handler, N>(list);
+  }
+
+  struct Path_t {
+    Helpers::string_view map;
+    Helpers::string_view command;
+  };
+
+  inline bool isSegment(Helpers::string_view segment) {
+    if (segment.empty())
+      return false;
+    for (char c : segment) {
+      if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9')))
+        return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Split "<prefix>/<map>/command/<command>" into its map and command
+   * @details The resulting views point into url, both segments have to be
+   * alphanumeric
+   */
+  inline bool parse(Helpers::string_view url,
+                    Helpers::string_view prefix,
+                    Path_t& path) {
+    if (url.size() <= prefix.size() || url.substr(0, prefix.size()) != prefix ||
+        url[prefix.size()] != '/')
+      return false;
+    url = url.substr(prefix.size() + 1);
+
+    size_t mapEnd = url.find('/');
+    if (mapEnd == Helpers::string_view::npos)
+      return false;
+    path.map = url.substr(0, mapEnd);
+    url = url.substr(mapEnd + 1);
+
+    static constexpr char keyword[] = "command/";
+    constexpr size_t keywordLength = sizeof(keyword) - 1;
+    if (url.size() <= keywordLength ||
+        url.substr(0, keywordLength) != Helpers::string_view(keyword))
+      return false;
+    path.command = url.substr(keywordLength);
+
+    return isSegment(path.map) && isSegment(path.command);
+  }
+}  // namespace RouteTable
+
+#endif  // ROUTE_TABLE_HPP
@@ -1,4 +1,18 @@
 #include "webserverHandler.hpp"
+#include <atomic>
+
+namespace {
+  //! indexed like the route table, see ApiRoutes::list
+  constexpr size_t MAX_COUNTED_ROUTES = 32;
+  std::atomic<uint32_t> routeRequests[MAX_COUNTED_ROUTES] = {};
+  Metrics::Counter unknownRequests("openiris_http_requests_total",
+                                   "Requests per route",
+                                   "route=\"unknown\"");
+  Metrics::Collector commandRequests("openiris_http_requests_total",
+                                     "Requests per route",
+                                     "counter",
+                                     &APIServer::writeRequestCounts);
+}  // namespace
 
 //*********************************************************************************************
 //!                                     API Server
@@ -18,97 +32,117 @@ APIServer::APIServer(ProjectConfig& projectConfig,
 
 APIServer::~APIServer() {}
 
-void APIServer::setup() {
+void APIServer::setup(HttpServer& httpServer) {
   log_d("Initializing REST API Server");
-  this->setupServer();
-  BaseAPI::begin();
-
-  char buffer[1000];
-  snprintf(buffer, sizeof(buffer),
-           "^\\%s\\/([a-zA-Z0-9]+)\\/command\\/([a-zA-Z0-9]+)$",
-           this->api_url.c_str());
-  log_d("API URL: %s", buffer);
-  server.on(buffer, 0b01111111, [&](AsyncWebServerRequest* request) {
-      handleRequest(request);
-  });
+  BaseAPI::begin(httpServer);
 #ifndef SIM_ENABLED
     //this->_authRequired = true;
 #endif  // SIM_ENABLED
-  beginOTA();
-  server.begin();
-}
+  beginOTA(httpServer);
 
-void APIServer::setupServer() {
-  routes.emplace("wifi", &APIServer::setWiFi);
-  routes.emplace("resetConfig", &APIServer::factoryReset);
-  routes.emplace("setDevice", &APIServer::setDeviceConfig);
-  routes.emplace("rebootDevice", &APIServer::rebootDevice);
-  routes.emplace("getStoredConfig", &APIServer::getJsonConfig);
-  routes.emplace("setTxPower", &APIServer::setWiFiTXPower);
-  // Camera Routes
-#ifndef SIM_ENABLED
-  routes.emplace("setCamera", &APIServer::setCamera);
-  routes.emplace("restartCamera", &APIServer::restartCamera);
-#endif  // SIM_ENABLED
-  routes.emplace("ping", &APIServer::ping);
-  routes.emplace("save", &APIServer::save);
-  routes.emplace("wifiStrength", &APIServer::rssi);
-
-  //! reserve enough memory for all routes - must be called after adding routes
-  //! and before adding routes to route_map
-  indexes.reserve(routes.size());  // this is done to avoid reallocation of
-                                   // memory and copying of data
-  addRouteMap("builtin", routes,
-              indexes);  // add new route map to the route_map
+  // everything under the API url ends up in handleRequest, which picks the
+  // command out of the path itself
+  constexpr esp_err_t (*handler)(httpd_req_t*) =
+      &HttpRequest::bind<APIServer, &APIServer::handleRequest>;
+  static const HttpServer::Route_t routes[] = {
+      {"/*", HTTP_GET, handler},
+      {"/*", HTTP_POST, handler},
+      {"/*", HTTP_PUT, handler},
+      {"/*", HTTP_DELETE, handler},
+  };
+  log_d("API URL: %s/*", this->api_url.c_str());
+  httpServer.addGroup(this->api_url.c_str(), routes, this);
 }
 
-/**
- * @brief Add a command handler to the API
- *
- * @param index
- * @param funct
- * @param indexes \c std::vector<std::string> a list of the routes of the
- * command handlers
- *
- * @return void
- *
- */
-void APIServer::addRouteMap(const std::string& index,
-                            route_t route,
-                            std::vector<std::string>& indexes) {
-  route_map.emplace(index, route);
+static_assert(ApiRoutes::table.size() <= MAX_COUNTED_ROUTES,
+              "Not enough request counters");
 
-  for (const auto& key : route) {
-    indexes.emplace_back(key.first);  // add the route to the list of routes -
-                                      // use emplace_back to avoid copying
+void APIServer::writeRequestCounts(Print& out, const char* name) {
+  const auto& routeTable = ApiRoutes::table;
+  for (size_t i = 0; i < routeTable.size(); i++) {
+    out.printf("%s{route=\"%s/%s\"} %u\n", name, routeTable.at(i).map,
+               routeTable.at(i).command,
+               (unsigned)routeRequests[i].load(std::memory_order_relaxed));
   }
 }
 
-void APIServer::handleRequest(AsyncWebServerRequest* request) {
-  try {
-    // Get the route
-    log_i("Request URL: %s", request->url().c_str());
-    log_i("Request: %s", request->pathArg(0).c_str());
-    log_i("Request: %s", request->pathArg(1).c_str());
+void APIServer::handleRequest(HttpRequest* request) {
+  const auto& routeTable = ApiRoutes::table;
 
-    auto it_map = route_map.find(request->pathArg(0).c_str());
-    auto it_method = it_map->second.find(request->pathArg(1).c_str());
+  Helpers::string_view url = request->url();
+  log_i("Request URL: %.*s", (int)url.size(), url.data());
 
-    if (it_map != route_map.end()) {
-      if (it_method != it_map->second.end()) {
-        log_d("We are trying to execute the function");
-        (*this.*(it_method->second))(request);
-      } else {
-        log_e("Invalid Command");
-        request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Command\"}");
-        return;
-      }
-    } else {
-      log_e("Invalid Map Index");
-      request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Map Index\"}");
-      return;
-    }
-  } catch (...) {
-    log_e("Error handling request");
+  RouteTable::Path_t path;
+  if (!RouteTable::parse(url, Helpers::string_view(this->api_url), path)) {
+    unknownRequests.add();
+    log_e("Invalid Path");
+    request->send(404, MIMETYPE_JSON, "{\"msg\":\"Invalid Path\"}");
+    return;
+  }
+
+  auto route = routeTable.find(path.map, path.command);
+  if (route) {
+    routeRequests[routeTable.indexOf(route)].fetch_add(
+        1, std::memory_order_relaxed);
+    log_d("We are trying to execute the function");
+    this->dispatch(route->handler, request);
+  } else if (routeTable.hasMap(path.map)) {
+    unknownRequests.add();
+    log_e("Invalid Command");
+    request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Command\"}");
+  } else {
+    unknownRequests.add();
+    log_e("Invalid Map Index");
+    request->send(400, MIMETYPE_JSON, "{\"msg\":\"Invalid Map Index\"}");
+  }
+}
+
+void APIServer::dispatch(ApiRoutes::Command_e command,
+                         HttpRequest* request) {
+  switch (command) {
+    case ApiRoutes::Command_SetWiFi:
+      this->setWiFi(request);
+      break;
+    case ApiRoutes::Command_FactoryReset:
+      this->factoryReset(request);
+      break;
+    case ApiRoutes::Command_SetDevice:
+      this->setDeviceConfig(request);
+      break;
+    case ApiRoutes::Command_RebootDevice:
+      this->rebootDevice(request);
+      break;
+    case ApiRoutes::Command_GetStoredConfig:
+      this->getJsonConfig(request);
+      break;
+    case ApiRoutes::Command_SetTxPower:
+      this->setWiFiTXPower(request);
+      break;
+#ifndef SIM_ENABLED
+    case ApiRoutes::Command_SetCamera:
+      this->setCamera(request);
+      break;
+    case ApiRoutes::Command_RestartCamera:
+      this->restartCamera(request);
+      break;
+#endif  // SIM_ENABLED
+    case ApiRoutes::Command_Ping:
+      this->ping(request);
+      break;
+    case ApiRoutes::Command_Save:
+      this->save(request);
+      break;
+    case ApiRoutes::Command_WiFiStrength:
+      this->rssi(request);
+      break;
+    case ApiRoutes::Command_SetIREmitter:
+      this->setIREmitter(request);
+      break;
+    case ApiRoutes::Command_SetHaptics:
+      this->setHaptics(request);
+      break;
+    case ApiRoutes::Command_Profile:
+      this->profile(request);
+      break;
   }
 }
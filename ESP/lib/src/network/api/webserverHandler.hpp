@@ -3,6 +3,8 @@
 #define XWEBSERVERHANDLER_HPP
 
 #include "network/api/baseAPI/baseAPI.hpp"
+#include "data/Metrics/Metrics.hpp"
+#include "network/api/routeTable/apiRoutes.hpp"
 
 class APIServer : public BaseAPI {
  public:
@@ -13,14 +15,12 @@ class APIServer : public BaseAPI {
             const std::string& api_url);
 
   virtual ~APIServer();
-  void setup();
-  void setupServer();
-  void addRouteMap(const std::string& index,
-                   route_t route,
-                   std::vector<std::string>& indexes);
-  void handleRequest(AsyncWebServerRequest* request);
+  void setup(HttpServer& httpServer);
+  void handleRequest(HttpRequest* request);
+  //! one openiris_http_requests_total sample per command
+  static void writeRequestCounts(Print& out, const char* name);
 
- public:
-  std::vector<std::string> indexes;
+ private:
+  void dispatch(ApiRoutes::Command_e command, HttpRequest* request);
 };
 #endif  // WEBSERVERHANDLER_HPP
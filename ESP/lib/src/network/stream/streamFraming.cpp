@@ -0,0 +1,61 @@
+#include "streamFraming.hpp"
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+  size_t writeHeader(char* buffer, size_t bufferSize, const char* type,
+                     size_t len, bool unchanged, int64_t timestampUs,
+                     int64_t hostTimestampUs, int32_t syncSeq) {
+    int written = snprintf(buffer, bufferSize,
+                           "Content-Type: %s\r\n"
+                           "Content-Length: %u\r\n"
+                           "X-Timestamp: %lld.%06lld\r\n",
+                           type, (unsigned)len,
+                           (long long)(timestampUs / 1000000),
+                           (long long)(timestampUs % 1000000));
+    if (written < 0 || (size_t)written >= bufferSize)
+      return 0;
+    if (hostTimestampUs >= 0) {
+      int host = snprintf(buffer + written, bufferSize - written,
+                          "X-Host-Timestamp: %lld.%06lld\r\n",
+                          (long long)(hostTimestampUs / 1000000),
+                          (long long)(hostTimestampUs % 1000000));
+      if (host < 0 || (size_t)(written + host) >= bufferSize)
+        return 0;
+      written += host;
+    }
+    if (syncSeq >= 0) {
+      int seq = snprintf(buffer + written, bufferSize - written,
+                         "X-Sync-Seq: %ld\r\n", (long)syncSeq);
+      if (seq < 0 || (size_t)(written + seq) >= bufferSize)
+        return 0;
+      written += seq;
+    }
+    if (unchanged) {
+      static const char MARK[] = "X-Unchanged: 1\r\n";
+      if ((size_t)written + sizeof(MARK) - 1 >= bufferSize)
+        return 0;
+      memcpy(buffer + written, MARK, sizeof(MARK) - 1);
+      written += sizeof(MARK) - 1;
+    }
+    if ((size_t)written + 2 >= bufferSize)
+      return 0;
+    memcpy(buffer + written, "\r\n", 3);
+    return written + 2;
+  }
+}  // namespace
+
+namespace StreamFraming {
+  size_t partHeader(char* buffer, size_t bufferSize, size_t len,
+                    int64_t timestampUs, int64_t hostTimestampUs,
+                    int32_t syncSeq) {
+    return writeHeader(buffer, bufferSize, "image/jpeg", len, false,
+                       timestampUs, hostTimestampUs, syncSeq);
+  }
+
+  size_t unchangedHeader(char* buffer, size_t bufferSize, int64_t timestampUs,
+                         int64_t hostTimestampUs, int32_t syncSeq) {
+    return writeHeader(buffer, bufferSize, UNCHANGED_TYPE, 0, true,
+                       timestampUs, hostTimestampUs, syncSeq);
+  }
+}  // namespace StreamFraming
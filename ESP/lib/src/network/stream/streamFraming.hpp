@@ -0,0 +1,53 @@
+#pragma once
+#ifndef STREAM_FRAMING_HPP
+#define STREAM_FRAMING_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+#define PART_BOUNDARY "123456789000000000000987654321"
+
+/**
+ * @brief The multipart/x-mixed-replace framing of the MJPEG stream
+ * @details Pure code, so the framing can be checked and benchmarked on the
+ * host
+ */
+namespace StreamFraming {
+  //! the response head, the stream never ends so the body simply runs until
+  //! either side closes the connection
+  constexpr const char* HEADER =
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: multipart/x-mixed-replace;boundary=" PART_BOUNDARY "\r\n"
+      "Access-Control-Allow-Origin: *\r\n"
+      "X-Framerate: 60\r\n"
+      "\r\n";
+  //! goes in front of every part
+  constexpr const char* BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
+  //! what unchanged parts are, the JPEG before them still stands
+  constexpr const char* UNCHANGED_TYPE = "application/x-openiris-unchanged";
+  //! room partHeader() needs at most
+  constexpr size_t PART_HEADER_SIZE = 192;
+
+  /**
+   * @brief The headers of one JPEG part
+   * @param timestampUs when the sensor took the frame, sent as X-Timestamp
+   * @param hostTimestampUs the same on the clock of the synced host, sent as
+   * X-Host-Timestamp, -1 leaves it out
+   * @param syncSeq the frame slot shared with the other eye, sent as
+   * X-Sync-Seq, -1 leaves it out
+   * @return the length written, 0 if buffer is too small
+   */
+  size_t partHeader(char* buffer, size_t bufferSize, size_t len,
+                    int64_t timestampUs, int64_t hostTimestampUs = -1,
+                    int32_t syncSeq = -1);
+
+  /**
+   * @brief The headers of an empty part that stands in for a frame that
+   * looked like the last one sent
+   * @details Typed UNCHANGED_TYPE and marked X-Unchanged, with the same
+   * timestamps a JPEG part would have had
+   */
+  size_t unchangedHeader(char* buffer, size_t bufferSize, int64_t timestampUs,
+                         int64_t hostTimestampUs = -1, int32_t syncSeq = -1);
+}  // namespace StreamFraming
+
+#endif  // STREAM_FRAMING_HPP
@@ -4,105 +4,528 @@
 #include <Arduino.h>
 #include <esp_http_server.h>
 #include <esp_timer.h>
-#include <esp_camera.h>
+#include <lwip/sockets.h>
+#include <atomic>
 
-// Boundary for multipart MJPEG stream
-#define PART_BOUNDARY "123456789000000000000987654321"
-constexpr static const char *STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
-constexpr static const char *STREAM_BOUNDARY      = "\r\n--" PART_BOUNDARY "\r\n";
-constexpr static const char *STREAM_PART          = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %lld.%06lld\r\n\r\n";
+static Metrics::Counter streamRequests("openiris_http_requests_total", "Requests per route", "route=\"/\"");
+static Metrics::Counter framesCaptured("openiris_frames_captured_total", "Frames taken from the camera", "transport=\"http\"");
+static Metrics::Counter framesSent("openiris_frames_sent_total", "Frames delivered to a client, once per client", "transport=\"http\"");
+static Metrics::Counter framesDropped("openiris_frames_dropped_total", "Frames that did not make it to a client", "transport=\"http\"");
+static Metrics::Counter captureFailures("openiris_camera_capture_failures_total", "Captures the camera driver failed", "transport=\"http\"");
+static Metrics::Histogram captureLatency("openiris_stage_latency_seconds", "Time spent per pipeline stage",
+                                         Metrics::latencyBoundsUs, 10, 1000000, "transport=\"http\",stage=\"capture\"");
+static Metrics::Histogram sendLatency("openiris_stage_latency_seconds", "Time spent per pipeline stage",
+                                      Metrics::latencyBoundsUs, 10, 1000000, "transport=\"http\",stage=\"send\"");
+static Metrics::Histogram jpegSize("openiris_jpeg_size_bytes", "Size of the captured JPEG frames",
+                                   Metrics::jpegBoundsBytes, 7, 1, "transport=\"http\"");
 
-// Forward‐declare the global server handle used in this file
-static httpd_handle_t camera_stream = nullptr;
+// how the frame sync is going, for /clock and the scrapes
+static std::atomic<int> syncState(FrameSync::State_Free);
+static std::atomic<int32_t> syncPhaseError(0);
+static const uint32_t skewBoundsUs[8] = {50, 100, 250, 500, 1000, 2500, 5000, 10000};
+static Metrics::Histogram syncSkew("openiris_sync_skew_seconds",
+                                   "How far frames started from their shared slot, the other eye adds its own",
+                                   skewBoundsUs, 8, 1000000, "transport=\"http\"");
+static Metrics::Collector syncLocked("openiris_sync_locked", "1 while frames are phase locked to the shared slots",
+                                     "gauge", [](Print &out, const char *name) {
+                                         out.printf("%s %d\n", name, syncState == FrameSync::State_Locked);
+                                     });
 
-//------------------------------------------------------------------------------
-// Stream handler (never returns)
-//------------------------------------------------------------------------------
-esp_err_t StreamHelpers::stream(httpd_req_t *req)
+#if MOTION_ENABLED
+static MotionGate::Config_t motionConfig()
+{
+    MotionGate::Config_t config;
+    config.threshold = MOTION_THRESHOLD;
+    config.stillFrames = MOTION_STILL_FRAMES;
+    config.idleFps = MOTION_IDLE_FPS;
+    return config;
+}
+
+// what holding frames back saves, the bytes outgrow 32 bits within hours
+static std::atomic<bool> motionMoving(true);
+static std::atomic<uint64_t> motionSavedBytes(0);
+static Metrics::Counter motionHeld("openiris_motion_frames_held_total", "Frames held back because nothing moved",
+                                   "transport=\"http\"");
+static Metrics::Collector motionSaved("openiris_motion_saved_bytes_total",
+                                      "JPEG bytes not sent because nothing moved, once per client", "counter",
+                                      [](Print &out, const char *name) {
+                                          out.printf("%s{transport=\"http\"} %llu\n", name,
+                                                     (unsigned long long)motionSavedBytes);
+                                      });
+static Metrics::Collector motionState("openiris_motion_moving", "1 while every frame goes out", "gauge",
+                                      [](Print &out, const char *name) {
+                                          out.printf("%s %d\n", name, (int)motionMoving);
+                                      });
+static Metrics::Histogram motionLatency("openiris_stage_latency_seconds", "Time spent per pipeline stage",
+                                        Metrics::latencyBoundsUs, 10, 1000000, "transport=\"http\",stage=\"motion\"");
+#endif
+
+static const char *syncStateName(int state)
 {
-    camera_fb_t *fb = nullptr;
-    struct timeval timestamp;
+    switch (state) {
+    case FrameSync::State_Calibrating:
+        return "calibrating";
+    case FrameSync::State_Locking:
+        return "locking";
+    case FrameSync::State_Locked:
+        return "locked";
+    case FrameSync::State_Unsupported:
+        return "unsupported";
+    default:
+        return "free";
+    }
+}
+
+StreamServer::StreamServer()
+  : clientsLock(xSemaphoreCreateMutex())
+#if MOTION_ENABLED
+  , motionGate(motionConfig())
+#endif
+{
+    for (auto &client : clients)
+        client = {this, -1, false, false};
+}
+
+esp_err_t StreamServer::stream_handler(httpd_req_t *req)
+{
+    auto *self = reinterpret_cast<StreamServer *>(req->user_ctx);
+    return self->addClient(req);
+}
+
+esp_err_t StreamServer::clock_handler(httpd_req_t *req)
+{
+    ClockSync::Status_t sync = clockSync.status();
+    char body[224];
+    // read as late as possible, the client takes the middle of its round trip
+    int len = snprintf(body, sizeof(body),
+                       "{\"synced\":%s,\"offset_us\":%lld,\"drift_ppm\":%.2f,"
+                       "\"delay_us\":%u,\"frame_sync\":\"%s\",\"phase_error_us\":%ld,"
+                       "\"us\":%lld}",
+                       sync.synced ? "true" : "false", (long long)sync.offsetUs,
+                       sync.driftPpm, sync.delayUs, syncStateName(syncState),
+                       (long)syncPhaseError, (long long)esp_timer_get_time());
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_send(req, body, len);
+}
+
+#if VISION_ENABLED || THUMBNAIL_ENABLED
+// the port of ?port=N, 0 if there is none
+static int queryPort(httpd_req_t *req)
+{
+    char query[32], value[8];
+    int port = 0;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "port", value, sizeof(value)) == ESP_OK)
+        port = atoi(value);
+    return port > 0 && port <= 65535 ? port : 0;
+}
+
+// the results go back to whoever asked, the server's sockets are IPv6 with
+// IPv4 addresses mapped into them
+static bool peerAddress(httpd_req_t *req, char *address, size_t size)
+{
+    sockaddr_in6 peer = {};
+    socklen_t peerLen = sizeof(peer);
+    if (getpeername(httpd_req_to_sockfd(req), (sockaddr *)&peer, &peerLen) < 0)
+        return false;
+    const void *ipv4 = peer.sin6_family == AF_INET
+                           ? (const void *)&((sockaddr_in *)&peer)->sin_addr
+                           : (const void *)&peer.sin6_addr.un.u32_addr[3];
+    return inet_ntop(AF_INET, ipv4, address, size);
+}
 
-    // tell client we're doing MJPEG over HTTP
-    esp_err_t res = httpd_resp_set_type(req, STREAM_CONTENT_TYPE);
-    if (res != ESP_OK) return res;
+static esp_err_t sendLease(httpd_req_t *req, int port, int leaseMs)
+{
+    char body[64];
+    int len = snprintf(body, sizeof(body), "{\"port\":%d,\"lease_ms\":%d}", port, leaseMs);
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, body, len);
+}
+#endif
+
+#if VISION_ENABLED
+esp_err_t StreamServer::vision_handler(httpd_req_t *req)
+{
+    auto *self = reinterpret_cast<StreamServer *>(req->user_ctx);
+    int port = queryPort(req);
+    if (!port) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        return httpd_resp_send(req, "port is missing", HTTPD_RESP_USE_STRLEN);
+    }
+
+    char address[16];
+    if (!peerAddress(req, address, sizeof(address)))
+        return httpd_resp_send_500(req);
+    if (!self->vision.subscribe(address, port)) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, "Too many vision subscribers", HTTPD_RESP_USE_STRLEN);
+    }
+    xTaskNotifyGive(self->task);
+    return sendLease(req, port, VISION_LEASE_MS);
+}
+#endif
+
+#if THUMBNAIL_ENABLED
+esp_err_t StreamServer::thumbnail_handler(httpd_req_t *req)
+{
+    auto *self = reinterpret_cast<StreamServer *>(req->user_ctx);
+    int port = queryPort(req);
+    if (port) {
+        char address[16];
+        if (!peerAddress(req, address, sizeof(address)))
+            return httpd_resp_send_500(req);
+        if (!self->thumbnail.subscribe(address, port)) {
+            httpd_resp_set_status(req, "503 Service Unavailable");
+            return httpd_resp_send(req, "Too many thumbnail subscribers", HTTPD_RESP_USE_STRLEN);
+        }
+        xTaskNotifyGive(self->task);
+        return sendLease(req, port, THUMBNAIL_LEASE_MS);
+    }
+
+    // the stream task may be asleep, the first poll wakes it up and gets
+    // nothing yet
+    auto *image = (uint8_t *)malloc(THUMBNAIL_BMP_SIZE);
+    if (!image)
+        return httpd_resp_send_500(req);
+    int64_t timestampUs;
+    size_t len = self->thumbnail.bmp(image, timestampUs);
+    xTaskNotifyGive(self->task);
+    esp_err_t result;
+    if (!len) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        result = httpd_resp_send(req, "No thumbnail yet", HTTPD_RESP_USE_STRLEN);
+    } else {
+        char stamp[32];
+        snprintf(stamp, sizeof(stamp), "%lld.%06lld", (long long)(timestampUs / 1000000),
+                 (long long)(timestampUs % 1000000));
+        httpd_resp_set_type(req, "image/bmp");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+        httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+        httpd_resp_set_hdr(req, "X-Timestamp", stamp);
+        result = httpd_resp_send(req, (const char *)image, len);
+    }
+    free(image);
+    return result;
+}
+#endif
+
+esp_err_t StreamServer::addClient(httpd_req_t *req)
+{
+    streamRequests.add();
+    int fd = httpd_req_to_sockfd(req);
+    Client_t *slot = nullptr;
+
+    xSemaphoreTake(clientsLock, portMAX_DELAY);
+    for (auto &client : clients) {
+        if (client.fd < 0) {
+            slot = &client;
+            server = req->handle;
+            slot->fd = fd;
+            slot->closing = false;
+            slot->sending = false;
+            break;
+        }
+    }
+    xSemaphoreGive(clientsLock);
+
+    if (!slot) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, "Too many stream clients", HTTPD_RESP_USE_STRLEN);
+    }
 
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    httpd_resp_set_hdr(req, "X-Framerate", "60");
+    // the session outlives this request, once the server closes it for
+    // whatever reason the slot is handed back
+    req->sess_ctx = slot;
+    req->free_ctx = &StreamServer::onClientClosed;
 
-    while (true)
-    {
-        fb = esp_camera_fb_get();
-        if (!fb) {
+    if (httpd_send(req, StreamFraming::HEADER, strlen(StreamFraming::HEADER)) < 0)
+        return ESP_FAIL;
+
+    xTaskNotifyGive(task);
+    return ESP_OK;
+}
+
+void StreamServer::onClientClosed(void *ctx)
+{
+    auto *client = static_cast<Client_t *>(ctx);
+    SemaphoreHandle_t lock = client->owner->clientsLock;
+    // the server hands the fd to the next session it accepts once we return,
+    // wait for a send in flight to fail on the closed socket first
+    while (true) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        if (!client->sending) {
+            client->fd = -1;
+            client->closing = false;
+            xSemaphoreGive(lock);
+            return;
+        }
+        client->closing = true;
+        xSemaphoreGive(lock);
+        vTaskDelay(1);
+    }
+}
+
+bool StreamServer::hasClients()
+{
+    bool any = false;
+    xSemaphoreTake(clientsLock, portMAX_DELAY);
+    for (auto &client : clients)
+        any |= client.fd >= 0 && !client.closing;
+    xSemaphoreGive(clientsLock);
+    return any;
+}
+
+bool StreamServer::sendAll(int fd, const char *data, size_t len)
+{
+    while (len) {
+        int sent = httpd_socket_send(server, fd, data, len, 0);
+        if (sent <= 0)
+            return false;
+        data += sent;
+        len -= sent;
+    }
+    return true;
+}
+
+int32_t StreamServer::syncFrame(const Hal::Frame_t &frame, int64_t hostTimestamp)
+{
+    int64_t epoch;
+    uint32_t period;
+    if (hostTimestamp >= 0 && clockSync.schedule(epoch, period))
+        frameSync.setSchedule(epoch, period);
+    else
+        frameSync.clearSchedule();
+
+    FrameSync::Result_t sync = frameSync.onFrame(frame.timestampUs, hostTimestamp);
+    if (sync.applyLines && !Hal::cameraSetExtraLines(sync.extraLines)) {
+        log_w("[StreamServer]: The camera can't stretch frames, they are only numbered");
+        frameSync.unsupported();
+    }
+    if (sync.seq >= 0 && frameSync.state() != FrameSync::State_Calibrating)
+        syncSkew.observe(sync.phaseErrorUs < 0 ? -sync.phaseErrorUs : sync.phaseErrorUs);
+    syncState = frameSync.state();
+    syncPhaseError = sync.phaseErrorUs;
+    return sync.seq;
+}
+
+#if MOTION_ENABLED
+bool StreamServer::motionSend(const Hal::Frame_t &frame)
+{
+    if (!motionLuma)
+        return true;
+    int64_t start = esp_timer_get_time();
+    uint16_t width, height;
+    // at an eighth only the DC coefficients are decoded, no IDCT
+    if (!Hal::jpegToLuma(frame.data, frame.len, 3, motionLuma, MOTION_MAX_LUMA_PIXELS, width, height))
+        return true;
+    MotionGate::Result_t result = motionGate.onFrame(motionLuma, width, height, frame.timestampUs);
+    motionLatency.observe(esp_timer_get_time() - start);
+    motionMoving = result.moving;
+    if (!result.send)
+        motionHeld.add();
+    return result.send;
+}
+#endif
+
+bool StreamServer::sendFrame(int fd, const char *header, size_t headerLen,
+                             const Hal::Frame_t &frame, int64_t &firstByte)
+{
+    if (!sendAll(fd, StreamFraming::BOUNDARY, strlen(StreamFraming::BOUNDARY)))
+        return false;
+    firstByte = esp_timer_get_time();
+    return sendAll(fd, header, headerLen) &&
+           sendAll(fd, (const char *)frame.data, frame.len);
+}
+
+//------------------------------------------------------------------------------
+// Stream task, sends every frame to every client (never returns)
+//------------------------------------------------------------------------------
+void StreamServer::run(void *arg)
+{
+    auto *self = static_cast<StreamServer *>(arg);
+    while (true) {
+#if VISION_ENABLED
+        bool vision = self->vision.active();
+#else
+        bool vision = false;
+#endif
+#if THUMBNAIL_ENABLED
+        bool thumbnails = self->thumbnail.active();
+#else
+        bool thumbnails = false;
+#endif
+        if (!vision && !thumbnails && !self->hasClients()) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#if MOTION_ENABLED
+            self->motionGate.reset();
+#endif
+            continue;
+        }
+#if MOTION_ENABLED
+        // someone new, they get the next frame whatever it shows
+        if (ulTaskNotifyTake(pdTRUE, 0))
+            self->motionGate.reset();
+#endif
+
+        int64_t captureStart = esp_timer_get_time();
+        Hal::Frame_t frame;
+        if (!Hal::cameraAcquire(frame)) {
             log_e("Camera capture failed");
-            res = ESP_FAIL;
-        } else {
-            timestamp.tv_sec  = fb->timestamp.tv_sec;
-            timestamp.tv_usec = fb->timestamp.tv_usec;
+            captureFailures.add();
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
         }
+        int64_t captured = esp_timer_get_time();
+        captureLatency.observe(captured - captureStart);
+        framesCaptured.add();
+        jpegSize.observe(frame.len);
 
-        if (res == ESP_OK) {
-            res = httpd_resp_send_chunk(req, STREAM_BOUNDARY, strlen(STREAM_BOUNDARY));
+        // the same for every client
+        int64_t hostTimestamp = clockSync.toHost(frame.timestampUs);
+        int32_t syncSeq = self->syncFrame(frame, hostTimestamp);
+#if THUMBNAIL_ENABLED
+        if (thumbnails)
+            self->thumbnail.process(frame, hostTimestamp, syncSeq);
+#endif
+#if VISION_ENABLED
+        if (vision) {
+            self->vision.process(frame, hostTimestamp, syncSeq);
+            if (!self->vision.previewDue(frame.timestampUs)) {
+                Hal::cameraRelease(frame);
+                continue;
+            }
         }
-        if (res == ESP_OK && fb) {
-            // header for this part
-            char hdr[128];
-            int hlen = snprintf(hdr, sizeof(hdr), STREAM_PART,
-                                fb->len,
-                                (long long)timestamp.tv_sec,
-                                (long long)timestamp.tv_usec);
-            res = httpd_resp_send_chunk(req, hdr, hlen);
+#endif
+        // only taken for the vision or the thumbnails
+        if ((vision || thumbnails) && !self->hasClients()) {
+            Hal::cameraRelease(frame);
+            continue;
+        }
+#if MOTION_ENABLED
+        bool unchanged = !self->motionSend(frame);
+#else
+        bool unchanged = false;
+#endif
+        char header[StreamFraming::PART_HEADER_SIZE];
+        size_t headerLen = unchanged
+                               ? StreamFraming::unchangedHeader(header, sizeof(header), frame.timestampUs,
+                                                                hostTimestamp, syncSeq)
+                               : StreamFraming::partHeader(header, sizeof(header), frame.len,
+                                                           frame.timestampUs, hostTimestamp, syncSeq);
+        // the header of an unchanged part, and nothing after it
+        Hal::Frame_t part = frame;
+        if (unchanged)
+            part.len = 0;
+
+        // finished once the buffer is back, one record per client
+        FrameTracer::Record_t traces[STREAM_MAX_CLIENTS];
+        size_t traceCount = 0;
+        FrameTracer::Record_t trace = {};
+        trace.frame = frameTracer.nextFrame();
+        trace.size = part.len;
+        trace.transport = FrameTracer::Transport_HTTP;
+        trace.vsync = frame.timestampUs;
+        trace.captured = captured;
+
+        // the sockets are taken under the lock and sent to without it, the
+        // server task adds and closes clients meanwhile, sending marks the
+        // ones it must not tear down yet
+        int fds[STREAM_MAX_CLIENTS];
+        xSemaphoreTake(self->clientsLock, portMAX_DELAY);
+        for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+            auto &client = self->clients[i];
+            fds[i] = -1;
+            if (client.fd < 0 || client.closing)
+                continue;
+#if MOTION_ENABLED
+            if (unchanged) {
+                motionSavedBytes += frame.len;
+                if (!MOTION_MARKERS)
+                    continue;
+            }
+#endif
+            fds[i] = client.fd;
+            client.sending = true;
         }
-        if (res == ESP_OK && fb) {
-            res = httpd_resp_send_chunk(req, (const char *)fb->buf, fb->len);
+        xSemaphoreGive(self->clientsLock);
+
+        for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+            if (fds[i] < 0)
+                continue;
+            auto &client = self->clients[i];
+            trace.client = i;
+            trace.firstByte = 0;
+            trace.lastByte = 0;
+            int64_t sendStart = esp_timer_get_time();
+            bool sent = self->sendFrame(fds[i], header, headerLen, part, trace.firstByte);
+            if (sent) {
+                trace.lastByte = esp_timer_get_time();
+                sendLatency.observe(trace.lastByte - sendStart);
+                if (!unchanged)
+                    framesSent.add();
+            } else {
+                framesDropped.add();
+            }
+            traces[traceCount++] = trace;
+
+            xSemaphoreTake(self->clientsLock, portMAX_DELAY);
+            // closing by now means the server is already closing the session
+            // and waits for us, the fd can't belong to another one yet
+            if (!sent && !client.closing)
+                httpd_sess_trigger_close(self->server, fds[i]);
+            client.sending = false;
+            client.closing |= !sent;
+            xSemaphoreGive(self->clientsLock);
         }
 
         // return the frame buffer
-        if (fb) {
-            esp_camera_fb_return(fb);
-            fb = nullptr;
+        Hal::cameraRelease(frame);
+        int64_t returned = esp_timer_get_time();
+        for (size_t i = 0; i < traceCount; i++) {
+            traces[i].returned = returned;
+            frameTracer.record(traces[i]);
         }
-
-        if (res != ESP_OK) break;
     }
-
-    return res;
 }
 
-StreamServer::StreamServer(const int STREAM_PORT)
-  : STREAM_SERVER_PORT(STREAM_PORT)
-{}
-
-int StreamServer::startStreamServer()
+int StreamServer::startStreamServer(HttpServer &httpServer)
 {
-    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.server_port      = STREAM_SERVER_PORT;
-    config.ctrl_port        = STREAM_SERVER_PORT;
-    config.core_id          = 1;      // pin stream server to core 1
-    config.stack_size       = 20480;
-    config.max_uri_handlers = 10;
+    static const HttpServer::Route_t routes[] = {
+        {"/", HTTP_GET, &StreamServer::stream_handler},
+        {"/clock", HTTP_GET, &StreamServer::clock_handler},
+#if VISION_ENABLED
+        {"/vision", HTTP_GET, &StreamServer::vision_handler},
+#endif
+#if THUMBNAIL_ENABLED
+        {"/thumbnail", HTTP_GET, &StreamServer::thumbnail_handler},
+#endif
+    };
+
+#if MOTION_ENABLED
+    // for good, frames are decoded one after the other
+    motionLuma = (uint8_t *)malloc(MOTION_MAX_LUMA_PIXELS);
+    if (!motionLuma)
+        log_e("[StreamServer]: Not enough memory to hold still frames back, sending them all");
+#endif
 
-    // Start the server
-    esp_err_t status = httpd_start(&camera_stream, &config);
-    if (status != ESP_OK) {
-        Serial.println("Failed to start stream server");
+    // same core as the server used to run the stream loop on
+    if (xTaskCreatePinnedToCore(&StreamServer::run, "StreamTask", STREAM_TASK_STACK_SIZE,
+                                this, 5, &task, 1) != pdPASS) {
+        Serial.println("Failed to start the stream task");
         return -1;
     }
 
-    // Register the stream handler on “/”
-    static httpd_uri_t stream_page = {
-        .uri      = "/",
-        .method   = HTTP_GET,
-        .handler  = &StreamHelpers::stream,
-        .user_ctx = nullptr
-    };
-    httpd_register_uri_handler(camera_stream, &stream_page);
+    if (!httpServer.addGroup("", routes, this)) {
+        Serial.println("Failed to register the stream route");
+        return -1;
+    }
 
-    Serial.println("Stream server initialized on port " + String(STREAM_SERVER_PORT));
     IPAddress ip = (wifiStateManager.getCurrentState() == WiFiState_e::WiFiState_ADHOC)
                    ? WiFi.softAPIP()
                    : WiFi.localIP();
-    Serial.printf("Stream available at http://%s:%d\n", ip.toString().c_str(), STREAM_SERVER_PORT);
+    Serial.printf("Stream available at http://%s:%d\n", ip.toString().c_str(), HTTP_SERVER_PORT);
 
     return 0;
 }
@@ -1,32 +1,142 @@
 #pragma once
 #ifndef STREAM_SERVER_HPP
 #define STREAM_SERVER_HPP
-#define PART_BOUNDARY "123456789000000000000987654321"
 #include <Arduino.h>
 #include <WiFi.h>
+#include "data/FrameTrace/FrameTrace.hpp"
+#include "data/Metrics/Metrics.hpp"
 #include "data/StateManager/StateManager.hpp"
+#include "hal/hal.hpp"
+#include "io/camera/frameSync.hpp"
+#include "network/ClockSync/ClockSync.hpp"
+#include "network/HttpServer/HttpServer.hpp"
+#include "streamFraming.hpp"
+#include "vision/motionGate.hpp"
+#include "vision/ThumbnailStage/ThumbnailStage.hpp"
+#include "vision/VisionStage/VisionStage.hpp"
 
-// Camera includes
-#include "esp_camera.h"
 #include "esp_http_server.h"
 #include "esp_timer.h"
 #include "fb_gfx.h"
 #include "img_converters.h"
 
-namespace StreamHelpers
-{
-	esp_err_t stream(httpd_req_t *req);
-}
+#define STREAM_MAX_CLIENTS 2
+//! 1 holds frames back while the eye keeps still, set in ini/user_config.ini
+#ifndef MOTION_ENABLED
+#define MOTION_ENABLED 0
+#endif
+//! mean difference per thumbnail pixel, in levels of 255, see MotionGate
+#ifndef MOTION_THRESHOLD
+#define MOTION_THRESHOLD 2.0f
+#endif
+#ifndef MOTION_STILL_FRAMES
+#define MOTION_STILL_FRAMES 6
+#endif
+#ifndef MOTION_IDLE_FPS
+#define MOTION_IDLE_FPS 2
+#endif
+//! 1 sends an empty X-Unchanged part in place of every frame held back
+#ifndef MOTION_MARKERS
+#define MOTION_MARKERS 0
+#endif
+//! 1600x1200 at an eighth
+#define MOTION_MAX_LUMA_PIXELS (200 * 150)
+#if VISION_ENABLED || MOTION_ENABLED || THUMBNAIL_ENABLED
+//! the JPEG decoder runs on it too
+#define STREAM_TASK_STACK_SIZE 6144
+#else
+#define STREAM_TASK_STACK_SIZE 4096
+#endif
+
+/**
+ * @brief MJPEG stream on "/" of the shared HTTP server
+ * @details The request handler only answers with the stream header and hands
+ * the socket over to the stream task, which pushes every frame to all
+ * clients. The server task stays free for the other routes, and no frame is
+ * captured while nobody watches.
+ *
+ * While the host sends frame slots through ClockSync, the task also phase
+ * locks the camera to them with a FrameSync, so both eyes take their frames
+ * together, and numbers the frames by slot.
+ *
+ * Built with VISION_ENABLED, the task also captures for the subscribers of
+ * the VisionStage, GET /vision?port=N, and sends them the pupil of every
+ * frame while the MJPEG clients get a preview.
+ *
+ * Built with MOTION_ENABLED, frames that look like the last one sent are held
+ * back by a MotionGate, on a thumbnail of the DC coefficients only, which
+ * decode quickly. Clients then get a few frames a second while the eye keeps
+ * still, or an empty X-Unchanged part for every frame with MOTION_MARKERS,
+ * and every frame again as soon as it moves.
+ *
+ * Built with THUMBNAIL_ENABLED, the task also captures for the ThumbnailStage,
+ * small grayscale copies of the frames on GET /thumbnail, for previews that
+ * don't need the full ones.
+ */
 class StreamServer
 {
-
 private:
-	httpd_handle_t camera_stream = nullptr;
-	int STREAM_SERVER_PORT;
+	struct Client_t {
+		StreamServer* owner;
+		//! -1 while the slot is free
+		int fd;
+		//! the socket failed, waiting for the server to close the session
+		bool closing;
+		//! the stream task is sending to fd without the lock, the slot is
+		//! only handed back once it's done
+		bool sending;
+	};
+
+	httpd_handle_t server = nullptr;
+	TaskHandle_t task = nullptr;
+	//! guards the clients, they are added and closed from the server task,
+	//! never held across a send
+	SemaphoreHandle_t clientsLock = nullptr;
+	Client_t clients[STREAM_MAX_CLIENTS];
+	//! only used by the stream task
+	FrameSync frameSync;
+#if VISION_ENABLED
+	VisionStage vision;
+#endif
+#if THUMBNAIL_ENABLED
+	ThumbnailStage thumbnail;
+#endif
+#if MOTION_ENABLED
+	//! only used by the stream task
+	MotionGate motionGate;
+	uint8_t *motionLuma = nullptr;
+#endif
+
+	static esp_err_t stream_handler(httpd_req_t *req);
+	//! the clock the X-Timestamp headers use, for clients to work out the
+	//! offset to theirs, and how the sync with the host is going
+	static esp_err_t clock_handler(httpd_req_t *req);
+#if VISION_ENABLED
+	//! subscribes the asking host to the pupil results
+	static esp_err_t vision_handler(httpd_req_t *req);
+#endif
+#if THUMBNAIL_ENABLED
+	//! the latest thumbnail as a BMP, or with ?port=N subscribes to them all
+	static esp_err_t thumbnail_handler(httpd_req_t *req);
+#endif
+	static void onClientClosed(void *ctx);
+	static void run(void *arg);
+	esp_err_t addClient(httpd_req_t *req);
+	bool hasClients();
+	//! the slot of the frame, -1 without a schedule, steers the camera
+	int32_t syncFrame(const Hal::Frame_t &frame, int64_t hostTimestamp);
+#if MOTION_ENABLED
+	//! whether the frame looks different enough to go out
+	bool motionSend(const Hal::Frame_t &frame);
+#endif
+	//! firstByte is set once the first part of the frame is on its way
+	bool sendFrame(int fd, const char *header, size_t headerLen,
+		       const Hal::Frame_t &frame, int64_t &firstByte);
+	bool sendAll(int fd, const char *data, size_t len);
 
 public:
-	StreamServer(const int STREAM_PORT = 80);
-	int startStreamServer();
+	StreamServer();
+	int startStreamServer(HttpServer &httpServer);
 };
 
 #endif // STREAM_SERVER_HPP
@@ -5,6 +5,7 @@
 
 #include <data/CommandManager/CommandManager.hpp>
 #include <data/config/project_config.hpp>
+#include <io/IREmitter/IREmitter.hpp>
 #include <io/LEDManager/LEDManager.hpp>
 #include <io/Serial/SerialManager.hpp>
 #include <io/camera/cameraHandler.hpp>
@@ -12,10 +13,13 @@
 
 #ifndef ETVR_EYE_TRACKER_USB_API
 #include <network/api/webserverHandler.hpp>
+#include <network/ClockSync/ClockSync.hpp>
+#include <network/HttpServer/HttpServer.hpp>
 #include <network/mDNS/MDNSManager.hpp>
 #include <network/stream/streamServer.hpp>
 #include "network/HapticEngine/HapticEngine.hpp"
 #include <network/wifihandler/wifihandler.hpp>
+#include <network/WiFiMonitor/WiFiMonitor.hpp>
 #endif  // ETVR_EYE_TRACKER_WEB_API
 
 #endif  // OPENIRIS_HPP
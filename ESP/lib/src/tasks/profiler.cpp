@@ -0,0 +1,247 @@
+#include "profiler.hpp"
+#include "data/Metrics/Metrics.hpp"
+
+Profiler profiler;
+
+namespace {
+  Metrics::Collector coreLoad("openiris_core_load_percent",
+                              "CPU load per core over the profiler window",
+                              "gauge",
+                              [](Print& out, const char* name) {
+                                for (int core = 0; core < portNUM_PROCESSORS;
+                                     core++) {
+                                  int load = profiler.coreLoad(core);
+                                  if (load >= 0)
+                                    out.printf("%s{core=\"%d\"} %d\n", name,
+                                               core, load);
+                                }
+                              });
+
+  char stateLetter(eTaskState state) {
+    switch (state) {
+      case eRunning:
+        return 'X';
+      case eReady:
+        return 'R';
+      case eBlocked:
+        return 'B';
+      case eSuspended:
+        return 'S';
+      default:
+        return 'D';
+    }
+  }
+}  // namespace
+
+Profiler::Profiler() {
+  this->lock = xSemaphoreCreateMutex();
+}
+
+void Profiler::begin() {
+  // the API and the serial console may both be first
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  if (this->task) {
+    xSemaphoreGive(this->lock);
+    return;
+  }
+
+  this->status = static_cast<TaskStatus_t*>(
+      malloc(sizeof(TaskStatus_t) * PROFILER_MAX_TASKS));
+  this->history = static_cast<Snapshot_t*>(
+      calloc(PROFILER_WINDOW + 1, sizeof(Snapshot_t)));
+  if (!this->status || !this->history) {
+    log_e("[Profiler]: Not enough memory for the task snapshots");
+    free(this->status);
+    this->status = nullptr;
+    free(this->history);
+    this->history = nullptr;
+    xSemaphoreGive(this->lock);
+    return;
+  }
+
+#if !configGENERATE_RUN_TIME_STATS
+  log_w("[Profiler]: No run time stats in this build, reporting stacks only");
+#endif
+  // priority 1, right above idle, the snapshots are never urgent
+  if (xTaskCreatePinnedToCore(&Profiler::run, "Profiler", 2560, this, 1,
+                              &this->task, tskNO_AFFINITY) != pdPASS) {
+    log_e("[Profiler]: Could not start the sampling task");
+    this->task = nullptr;
+  }
+  xSemaphoreGive(this->lock);
+}
+
+void Profiler::run(void* arg) {
+  auto* self = static_cast<Profiler*>(arg);
+  TickType_t lastWake = xTaskGetTickCount();
+  while (true) {
+    self->sample();
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(PROFILER_PERIOD_MS));
+  }
+}
+
+void Profiler::sample() {
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+
+  // nothing may be deleted between the snapshot and the affinity lookups
+  uint32_t totalRunTime = 0;
+  vTaskSuspendAll();
+  UBaseType_t count =
+      uxTaskGetSystemState(this->status, PROFILER_MAX_TASKS, &totalRunTime);
+  for (UBaseType_t i = 0; i < count; i++) {
+    BaseType_t core = xTaskGetAffinity(this->status[i].xHandle);
+    this->cores[i] = core == tskNO_AFFINITY ? -1 : core;
+  }
+  xTaskResumeAll();
+
+  if (count == 0) {
+    // the array was too small, keep the last good snapshot
+    log_w("[Profiler]: More than %d tasks, sample skipped", PROFILER_MAX_TASKS);
+    xSemaphoreGive(this->lock);
+    return;
+  }
+  this->statusCount = count;
+  this->statusRunTime = totalRunTime;
+
+  // the window is PROFILER_WINDOW periods, that takes one snapshot more
+  uint8_t slot = (this->head + this->historySize) % (PROFILER_WINDOW + 1);
+  if (this->historySize == PROFILER_WINDOW + 1)
+    this->head = (this->head + 1) % (PROFILER_WINDOW + 1);
+  else
+    this->historySize++;
+
+  Snapshot_t& snapshot = this->history[slot];
+  snapshot.totalRunTime = totalRunTime;
+  snapshot.taskCount = count;
+  for (UBaseType_t i = 0; i < count; i++) {
+    snapshot.tasks[i].number = this->status[i].xTaskNumber;
+    snapshot.tasks[i].runTime = this->status[i].ulRunTimeCounter;
+  }
+  xSemaphoreGive(this->lock);
+}
+
+int16_t Profiler::cpuPermille(UBaseType_t number, uint32_t runTime) {
+#if configGENERATE_RUN_TIME_STATS
+  if (this->historySize < 2)
+    return -1;
+  const Snapshot_t& oldest = this->history[this->head];
+  // unsigned differences survive the counters wrapping around
+  uint32_t elapsed = this->statusRunTime - oldest.totalRunTime;
+  if (elapsed == 0)
+    return -1;
+
+  // a task started within the window counts from zero
+  uint32_t before = 0;
+  for (uint8_t i = 0; i < oldest.taskCount; i++) {
+    if (oldest.tasks[i].number == number) {
+      before = oldest.tasks[i].runTime;
+      break;
+    }
+  }
+  uint64_t permille = (uint64_t)(runTime - before) * 1000 / elapsed;
+  return permille > 1000 ? 1000 : permille;
+#else
+  return -1;
+#endif
+}
+
+int Profiler::coreLoadLocked(int core) {
+  TaskHandle_t idle = xTaskGetIdleTaskHandleForCPU(core);
+  for (uint8_t i = 0; i < this->statusCount; i++) {
+    if (this->status[i].xHandle != idle)
+      continue;
+    int16_t idlePermille = this->cpuPermille(this->status[i].xTaskNumber,
+                                             this->status[i].ulRunTimeCounter);
+    return idlePermille < 0 ? -1 : (1000 - idlePermille + 5) / 10;
+  }
+  return -1;
+}
+
+int Profiler::coreLoad(int core) {
+  if (!this->task)
+    return -1;
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  int load = this->coreLoadLocked(core);
+  xSemaphoreGive(this->lock);
+  return load;
+}
+
+uint8_t Profiler::report(TaskReport_t* out) {
+  for (uint8_t i = 0; i < this->statusCount; i++) {
+    const TaskStatus_t& task = this->status[i];
+    out[i].name = task.pcTaskName;
+    out[i].core = this->cores[i];
+    out[i].priority = task.uxCurrentPriority;
+    out[i].state = stateLetter(task.eCurrentState);
+    out[i].cpuPermille = this->cpuPermille(task.xTaskNumber,
+                                           task.ulRunTimeCounter);
+    // stacks are counted in bytes on the ESP32
+    out[i].stackFreeMin = task.usStackHighWaterMark;
+  }
+  return this->statusCount;
+}
+
+void Profiler::writeJson(Print& out) {
+  this->begin();
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  out.printf("{\"windowMs\": %u, \"cores\": [",
+             (unsigned)(this->historySize > 1
+                            ? (this->historySize - 1) * PROFILER_PERIOD_MS
+                            : 0));
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    int load = this->coreLoadLocked(core);
+    if (core)
+      out.print(", ");
+    if (load < 0)
+      out.print("null");
+    else
+      out.print(load);
+  }
+  out.print("], \"tasks\": [");
+
+  TaskReport_t tasks[PROFILER_MAX_TASKS];
+  uint8_t count = this->report(tasks);
+  for (uint8_t i = 0; i < count; i++) {
+    out.printf(
+        "%s{\"name\": \"%s\", \"core\": %d, \"priority\": %u, "
+        "\"state\": \"%c\", \"cpu\": ",
+        i ? ", " : "", tasks[i].name, tasks[i].core, tasks[i].priority,
+        tasks[i].state);
+    if (tasks[i].cpuPermille < 0)
+      out.print("null");
+    else
+      out.printf("%d.%d", tasks[i].cpuPermille / 10,
+                 tasks[i].cpuPermille % 10);
+    out.printf(", \"stackFreeMin\": %u}", (unsigned)tasks[i].stackFreeMin);
+  }
+  out.print("]}");
+  xSemaphoreGive(this->lock);
+}
+
+void Profiler::writeText(Print& out) {
+  this->begin();
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  if (this->historySize < 2) {
+    xSemaphoreGive(this->lock);
+    out.println("[Profiler]: Sampling, ask again in a second");
+    return;
+  }
+
+  for (int core = 0; core < portNUM_PROCESSORS; core++)
+    out.printf("core %d: %d%%\r\n", core, this->coreLoadLocked(core));
+  out.printf("%-16s %4s %4s %5s %7s %6s\r\n", "task", "core", "prio", "state",
+             "cpu%", "stack");
+
+  TaskReport_t tasks[PROFILER_MAX_TASKS];
+  uint8_t count = this->report(tasks);
+  for (uint8_t i = 0; i < count; i++) {
+    char cpu[8] = "-";
+    if (tasks[i].cpuPermille >= 0)
+      snprintf(cpu, sizeof(cpu), "%d.%d", tasks[i].cpuPermille / 10,
+               tasks[i].cpuPermille % 10);
+    out.printf("%-16s %4d %4u %5c %7s %6u\r\n", tasks[i].name, tasks[i].core,
+               tasks[i].priority, tasks[i].state, cpu,
+               (unsigned)tasks[i].stackFreeMin);
+  }
+  xSemaphoreGive(this->lock);
+}
@@ -0,0 +1,82 @@
+#pragma once
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+#include <Arduino.h>
+
+#define PROFILER_PERIOD_MS 1000
+//! the report covers the last PROFILER_WINDOW samples, 10s
+#define PROFILER_WINDOW 10
+//! samples are skipped while there are more tasks than this
+#define PROFILER_MAX_TASKS 32
+
+/**
+ * @brief Where the CPU time and the stacks go, per task and per core
+ * @details Once enabled, a low priority task snapshots the FreeRTOS task list
+ * every PROFILER_PERIOD_MS and keeps the run time counters of the last
+ * PROFILER_WINDOW periods. A report compares the newest snapshot with the
+ * oldest, so the CPU shares cover a sliding window instead of the uptime.
+ * A snapshot walks the task list once, a few tens of microseconds every
+ * second, far below 1% of a core.
+ *
+ * The CPU shares need configGENERATE_RUN_TIME_STATS in the FreeRTOS config,
+ * without it only the stacks and task states are reported. FreeRTOS does not
+ * count context switches, so there are none in the report.
+ */
+class Profiler {
+ public:
+  Profiler();
+  //! start sampling, nothing runs until the profiler is first asked for
+  void begin();
+  bool isRunning() const { return this->task != nullptr; }
+
+  void writeJson(Print& out);
+  void writeText(Print& out);
+  //! load per core in percent over the window, -1 while unknown
+  int coreLoad(int core);
+
+ private:
+  struct TaskSample_t {
+    UBaseType_t number;
+    uint32_t runTime;
+  };
+  struct Snapshot_t {
+    uint32_t totalRunTime;
+    uint8_t taskCount;
+    TaskSample_t tasks[PROFILER_MAX_TASKS];
+  };
+  struct TaskReport_t {
+    const char* name;
+    //! -1 if the task may run on either core
+    int8_t core;
+    uint8_t priority;
+    char state;
+    //! share of one core in 1/10 percent, -1 while unknown
+    int16_t cpuPermille;
+    uint32_t stackFreeMin;
+  };
+
+  static void run(void* arg);
+  void sample();
+  //! CPU share of a task over the window, caller holds the lock
+  int16_t cpuPermille(UBaseType_t number, uint32_t runTime);
+  //! fills the per task view, caller holds the lock
+  uint8_t report(TaskReport_t* out);
+  int coreLoadLocked(int core);
+
+  TaskHandle_t task = nullptr;
+  SemaphoreHandle_t lock = nullptr;
+
+  //! the newest task list, kept whole for names and stacks
+  TaskStatus_t* status = nullptr;
+  int8_t cores[PROFILER_MAX_TASKS] = {};
+  uint8_t statusCount = 0;
+  uint32_t statusRunTime = 0;
+  //! ring of the run time counters, the oldest is at history[head]
+  Snapshot_t* history = nullptr;
+  uint8_t historySize = 0;
+  uint8_t head = 0;
+};
+
+extern Profiler profiler;
+
+#endif  // PROFILER_HPP
@@ -0,0 +1,135 @@
+#include "scheduler.hpp"
+
+Scheduler scheduler;
+
+void Scheduler::begin() {
+  if (this->started)
+    return;
+
+  // the jobs do the actual work of a restart or camera power cycle, they
+  // should not wait behind the samplers running at priority 1, nor hold up
+  // the other timers
+  if (!this->timer.beginTask(&Scheduler::onTimer, this, "Scheduler", 4096,
+                             2)) {
+    log_e("[Scheduler]: Could not start the scheduler task");
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(this->lock);
+  this->started = true;
+  // anything scheduled so far
+  this->arm(Hal::micros());
+}
+
+Scheduler::JobId Scheduler::scheduleAfter(uint32_t delayMs, Job job) {
+  return this->add(delayMs, 0, std::move(job));
+}
+
+Scheduler::JobId Scheduler::scheduleEvery(uint32_t periodMs, Job job) {
+  if (periodMs == 0)
+    return INVALID_JOB;
+  return this->add(periodMs, periodMs, std::move(job));
+}
+
+bool Scheduler::cancel(JobId id) {
+  if (id == INVALID_JOB)
+    return false;
+  uint32_t index = (id & 0xFFFF) - 1;
+  if (index >= SCHEDULER_MAX_JOBS)
+    return false;
+
+  std::lock_guard<std::mutex> guard(this->lock);
+  Slot_t& slot = this->slots[index];
+  if (!slot.used || slot.generation != (id >> 16))
+    return false;
+  // the timer finds nothing due and arms itself for the next one
+  slot.used = false;
+  slot.job = nullptr;
+  return true;
+}
+
+void Scheduler::restartAfter(uint32_t delayMs) {
+  if (this->scheduleAfter(delayMs, []() { Hal::restartNow(); }) ==
+      INVALID_JOB)
+    Hal::restartNow();
+}
+
+Scheduler::JobId Scheduler::add(uint32_t delayMs, uint32_t periodMs, Job job) {
+  std::lock_guard<std::mutex> guard(this->lock);
+  for (uint32_t i = 0; i < SCHEDULER_MAX_JOBS; i++) {
+    Slot_t& slot = this->slots[i];
+    if (slot.used)
+      continue;
+
+    slot.job = std::move(job);
+    slot.dueUs = Hal::micros() + (int64_t)delayMs * 1000;
+    slot.periodMs = periodMs;
+    // 0 would turn the first id of a slot into INVALID_JOB
+    if (++slot.generation == 0)
+      slot.generation = 1;
+    slot.used = true;
+    // the new job might be due before whatever the timer is armed for
+    if (slot.dueUs < this->armedUs)
+      this->arm(slot.dueUs);
+    return ((JobId)slot.generation << 16) | (i + 1);
+  }
+
+  log_e("[Scheduler]: No free slot, job dropped");
+  return INVALID_JOB;
+}
+
+void Scheduler::arm(int64_t dueUs) {
+  if (!this->started)
+    return;
+  this->armedUs = dueUs;
+  if (dueUs == INT64_MAX) {
+    this->timer.stop();
+    return;
+  }
+  int64_t now = Hal::micros();
+  this->timer.startOnce(dueUs > now ? dueUs - now : 0);
+}
+
+void Scheduler::onTimer(void* arg) {
+  static_cast<Scheduler*>(arg)->runDue();
+}
+
+void Scheduler::runDue() {
+  while (true) {
+    Job job;
+    {
+      std::lock_guard<std::mutex> guard(this->lock);
+      int64_t now = Hal::micros();
+      Slot_t* next = nullptr;
+      for (auto& slot : this->slots) {
+        if (slot.used && (!next || slot.dueUs < next->dueUs))
+          next = &slot;
+      }
+
+      if (!next || next->dueUs > now) {
+        this->arm(next ? next->dueUs : INT64_MAX);
+        return;
+      }
+
+      if (next->periodMs) {
+        // the slot keeps its copy, so cancelling the job while it runs is
+        // fine
+        job = next->job;
+        next->dueUs += (int64_t)next->periodMs * 1000;
+        if (next->dueUs <= now)
+          next->dueUs = now + (int64_t)next->periodMs * 1000;
+      } else {
+        job = std::move(next->job);
+        next->job = nullptr;
+        next->used = false;
+      }
+      // nothing can arm an earlier expiry than now while the job runs, add()
+      // would only start the timer for one that we pick up anyway
+      this->armedUs = now;
+    }
+
+    // outside the lock, jobs are free to schedule or cancel other jobs
+    if (job)
+      job();
+  }
+}
@@ -0,0 +1,74 @@
+#pragma once
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+#include <functional>
+#include <mutex>
+#include "hal/hal.hpp"
+
+#define SCHEDULER_MAX_JOBS 16
+
+/**
+ * @brief Deferred work, run on a timer instead of a busy-wait
+ * @details Jobs are kept in a fixed pool of slots and run one after another
+ * from a Hal::Timer with a task of its own, armed for the next one that is
+ * due. A job may schedule follow up jobs, so multi step sequences, like power
+ * cycling the camera, become a chain of callbacks that never block their
+ * caller. Only goes through the HAL, so it runs on the host's virtual clock.
+ */
+class Scheduler {
+ public:
+  using Job = std::function<void()>;
+  //! identifies a scheduled job, stays unique after the job has finished
+  using JobId = uint32_t;
+  static constexpr JobId INVALID_JOB = 0;
+
+  //! jobs scheduled before begin() wait for it
+  void begin();
+
+  /**
+   * @brief Run job once, delayMs from now
+   * @return INVALID_JOB if every slot is taken
+   */
+  JobId scheduleAfter(uint32_t delayMs, Job job);
+
+  /**
+   * @brief Run job every periodMs, starting periodMs from now
+   * @details Runs that were missed because the scheduler was busy are
+   * skipped, not run back to back
+   * @return INVALID_JOB if every slot is taken or periodMs is 0
+   */
+  JobId scheduleEvery(uint32_t periodMs, Job job);
+
+  //! false if the job has already finished or was never scheduled
+  bool cancel(JobId id);
+
+  //! restart the device delayMs from now, right away if no slot is free
+  void restartAfter(uint32_t delayMs);
+
+ private:
+  struct Slot_t {
+    Job job;
+    int64_t dueUs = 0;
+    uint32_t periodMs = 0;
+    uint16_t generation = 0;
+    bool used = false;
+  };
+
+  JobId add(uint32_t delayMs, uint32_t periodMs, Job job);
+  static void onTimer(void* arg);
+  //! runs every job that is due, then arms the timer for the next one
+  void runDue();
+  //! with the lock held
+  void arm(int64_t dueUs);
+
+  Hal::Timer timer;
+  bool started = false;
+  //! when the timer goes off, INT64_MAX while it doesn't
+  int64_t armedUs = INT64_MAX;
+  std::mutex lock;
+  Slot_t slots[SCHEDULER_MAX_JOBS];
+};
+
+extern Scheduler scheduler;
+
+#endif  // SCHEDULER_HPP
@@ -1,11 +1,7 @@
 #include "tasks.hpp"
 
 void OpenIrisTasks::ScheduleRestart(int milliseconds) {
-    yield();
-    int initialTime = millis();
-    while (millis() - initialTime <= milliseconds) {
-        continue;
-    }
-    yield();
-    ESP.restart();
+    log_i("[Tasks]: Restarting in %d ms", milliseconds);
+    // the delay lets the caller finish up, e.g. flush its HTTP response
+    scheduler.restartAfter(milliseconds);
 }
@@ -3,8 +3,11 @@
 #define TASKS_HPP
 
 #include <Arduino.h>
+#include "profiler.hpp"
+#include "scheduler.hpp"
 
 namespace OpenIrisTasks {
+//! returns right away, the restart happens milliseconds from now
 void ScheduleRestart(int milliseconds);
 }
 
@@ -0,0 +1,58 @@
+#include "Subscribers.hpp"
+
+Subscribers::Subscribers(uint32_t leaseMs) : leaseMs(leaseMs) {
+  this->lock = xSemaphoreCreateMutex();
+}
+
+bool Subscribers::subscribe(const char* address, uint16_t port) {
+  int64_t now = Hal::micros();
+  Subscriber_t* slot = nullptr;
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  for (auto& subscriber : this->subscribers) {
+    bool same = subscriber.expiresUs > now && subscriber.port == port &&
+                !strcmp(subscriber.address, address);
+    if (same || (!slot && subscriber.expiresUs <= now))
+      slot = &subscriber;
+    if (same)
+      break;
+  }
+  if (slot) {
+    strlcpy(slot->address, address, sizeof(slot->address));
+    slot->port = port;
+    slot->expiresUs = now + this->leaseMs * 1000LL;
+  }
+  xSemaphoreGive(this->lock);
+  return slot;
+}
+
+bool Subscribers::active() {
+  int64_t now = Hal::micros();
+  bool any = false;
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  for (auto& subscriber : this->subscribers)
+    any |= subscriber.expiresUs > now;
+  xSemaphoreGive(this->lock);
+  return any;
+}
+
+size_t Subscribers::send(const uint8_t* header,
+                         size_t headerLen,
+                         const uint8_t* payload,
+                         size_t payloadLen,
+                         size_t& failed) {
+  int64_t now = Hal::micros();
+  size_t sent = 0;
+  failed = 0;
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  for (auto& subscriber : this->subscribers) {
+    if (subscriber.expiresUs <= now)
+      continue;
+    if (this->socket.send(subscriber.address, subscriber.port, header,
+                          headerLen, payload, payloadLen))
+      sent++;
+    else
+      failed++;
+  }
+  xSemaphoreGive(this->lock);
+  return sent;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef SUBSCRIBERS_HPP
+#define SUBSCRIBERS_HPP
+#include <Arduino.h>
+#include "hal/hal.hpp"
+
+#define SUBSCRIBERS_MAX 2
+
+/**
+ * @brief Hosts that asked for datagrams, each for a lease
+ * @details A host subscribes with its address and a UDP port and gets
+ * everything send() sends until the lease runs out, it renews by subscribing
+ * again. Subscribed from the server task, sent to from the stream task.
+ */
+class Subscribers {
+ public:
+  explicit Subscribers(uint32_t leaseMs);
+  //! start or renew sending to address:port, false if there's no room
+  bool subscribe(const char* address, uint16_t port);
+  //! whether anyone has a lease
+  bool active();
+  //! header and payload as one datagram to everyone with a lease, returns
+  //! how many got it, failed how many it couldn't be sent to
+  size_t send(const uint8_t* header,
+              size_t headerLen,
+              const uint8_t* payload,
+              size_t payloadLen,
+              size_t& failed);
+
+ private:
+  struct Subscriber_t {
+    char address[16];
+    uint16_t port;
+    //! 0 while the slot is free
+    int64_t expiresUs;
+  };
+
+  uint32_t leaseMs;
+  //! guards the subscribers
+  SemaphoreHandle_t lock = nullptr;
+  Subscriber_t subscribers[SUBSCRIBERS_MAX] = {};
+  Hal::DatagramSocket socket;
+};
+
+#endif  // SUBSCRIBERS_HPP
@@ -0,0 +1,123 @@
+#include "ThumbnailStage.hpp"
+#include <algorithm>
+#include "data/Metrics/Metrics.hpp"
+
+namespace {
+  constexpr char MAGIC[4] = {'O', 'I', 'T', 'H'};
+  constexpr size_t THUMB_PIXELS = THUMBNAIL_SIZE * THUMBNAIL_SIZE;
+
+  Metrics::Histogram thumbnailLatency("openiris_stage_latency_seconds",
+                                      "Time spent per pipeline stage",
+                                      Metrics::latencyBoundsUs, 10, 1000000,
+                                      "transport=\"thumbnail\",stage=\"thumbnail\"");
+  Metrics::Counter thumbnailsSent("openiris_frames_sent_total",
+                                  "Frames delivered to a client, once per client",
+                                  "transport=\"thumbnail\"");
+  Metrics::Counter thumbnailsDropped("openiris_frames_dropped_total",
+                                     "Frames that did not make it to a client",
+                                     "transport=\"thumbnail\"");
+}  // namespace
+
+ThumbnailStage::ThumbnailStage() {
+  this->lock = xSemaphoreCreateMutex();
+}
+
+bool ThumbnailStage::active() {
+  int64_t now = Hal::micros();
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  bool polled = this->polledUntilUs > now;
+  xSemaphoreGive(this->lock);
+  return polled || this->subscribers.active();
+}
+
+void ThumbnailStage::process(const Hal::Frame_t& frame,
+                             int64_t hostTimestampUs,
+                             int32_t syncSeq) {
+  // on the frame clock, like the preview of the VisionStage
+  if (frame.timestampUs < this->nextUs)
+    return;
+  int64_t period = 1000000 / THUMBNAIL_FPS;
+  this->nextUs += period;
+  if (this->nextUs <= frame.timestampUs)
+    this->nextUs = frame.timestampUs + period;
+
+  int64_t start = Hal::micros();
+  // allocated once the first one is wanted, most never are
+  if (!this->luma) {
+    uint8_t* buffers =
+        (uint8_t*)malloc(THUMBNAIL_MAX_LUMA_PIXELS + 2 * THUMB_PIXELS);
+    if (!buffers) {
+      log_e("[ThumbnailStage]: Not enough memory for the thumbnails");
+      return;
+    }
+    this->luma = buffers;
+    this->thumb = buffers + THUMBNAIL_MAX_LUMA_PIXELS;
+    xSemaphoreTake(this->lock, portMAX_DELAY);
+    this->latest = this->thumb + THUMB_PIXELS;
+    xSemaphoreGive(this->lock);
+  }
+
+  uint16_t frameWidth, frameHeight, lumaWidth, lumaHeight, width, height;
+  if (!Thumbnail::jpegSize(frame.data, frame.len, frameWidth, frameHeight))
+    return;
+  Thumbnail::fit(frameWidth, frameHeight, THUMBNAIL_SIZE, width, height);
+  uint8_t shift =
+      Thumbnail::decodeShift(frameWidth, frameHeight, width, height);
+  if (!Hal::jpegToLuma(frame.data, frame.len, shift, this->luma,
+                       THUMBNAIL_MAX_LUMA_PIXELS, lumaWidth, lumaHeight))
+    return;
+  Thumbnail::boxFilter(this->luma, lumaWidth, lumaHeight, this->thumb, width,
+                       height);
+  thumbnailLatency.observe(Hal::micros() - start);
+
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  memcpy(this->latest, this->thumb, (size_t)width * height);
+  this->latestWidth = width;
+  this->latestHeight = height;
+  this->latestUs = frame.timestampUs;
+  xSemaphoreGive(this->lock);
+
+  // a few rows per datagram, a subscriber that missed one still gets the rest
+  Packet_t packet = {};
+  memcpy(packet.magic, MAGIC, sizeof(MAGIC));
+  packet.frame = ++this->frames;
+  packet.syncSeq = syncSeq;
+  packet.timestampUs = frame.timestampUs;
+  packet.hostTimestampUs = hostTimestampUs;
+  packet.width = width;
+  packet.height = height;
+  uint16_t rows = std::max<size_t>(1, PACKET_PIXELS / width);
+  size_t sent = SUBSCRIBERS_MAX, failed = 0;
+  for (uint16_t row = 0; row < height; row += rows) {
+    packet.firstRow = row;
+    packet.rows = std::min<uint16_t>(rows, height - row);
+    size_t packetFailed;
+    sent = std::min(sent, this->subscribers.send(
+                              (const uint8_t*)&packet, sizeof(packet),
+                              this->thumb + (size_t)row * width,
+                              (size_t)packet.rows * width, packetFailed));
+    failed = std::max(failed, packetFailed);
+  }
+  thumbnailsSent.add(sent);
+  thumbnailsDropped.add(failed);
+}
+
+size_t ThumbnailStage::bmp(uint8_t* out, int64_t& timestampUs) {
+  size_t len = 0;
+  xSemaphoreTake(this->lock, portMAX_DELAY);
+  this->polledUntilUs = Hal::micros() + THUMBNAIL_LEASE_MS * 1000LL;
+  if (this->latest && this->latestWidth) {
+    uint16_t width = this->latestWidth, height = this->latestHeight;
+    size_t stride = (width + 3) & ~3;
+    Thumbnail::bmpHeader(out, width, height);
+    uint8_t* rows = out + Thumbnail::BMP_HEADER_SIZE;
+    for (uint16_t y = 0; y < height; y++) {
+      memcpy(rows + y * stride, this->latest + (size_t)y * width, width);
+      memset(rows + y * stride + width, 0, stride - width);
+    }
+    timestampUs = this->latestUs;
+    len = Thumbnail::BMP_HEADER_SIZE + stride * height;
+  }
+  xSemaphoreGive(this->lock);
+  return len;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#ifndef THUMBNAIL_STAGE_HPP
+#define THUMBNAIL_STAGE_HPP
+#include <Arduino.h>
+#include "hal/hal.hpp"
+#include "vision/Subscribers/Subscribers.hpp"
+#include "vision/thumbnail.hpp"
+
+//! 1 serves small grayscale copies of the frames, set in ini/user_config.ini
+#ifndef THUMBNAIL_ENABLED
+#define THUMBNAIL_ENABLED 0
+#endif
+//! pixels along the longer side, at most 256
+#ifndef THUMBNAIL_SIZE
+#define THUMBNAIL_SIZE 64
+#endif
+//! thumbnails a second at most, previews don't need every frame
+#ifndef THUMBNAIL_FPS
+#define THUMBNAIL_FPS 15
+#endif
+//! 1600x1200 at an eighth
+#define THUMBNAIL_MAX_LUMA_PIXELS (200 * 150)
+//! subscribers and pollers have to ask again within this
+#define THUMBNAIL_LEASE_MS 10000
+//! a whole BMP of the largest thumbnail
+#define THUMBNAIL_BMP_SIZE \
+  (Thumbnail::BMP_HEADER_SIZE + ((THUMBNAIL_SIZE + 3) & ~3) * THUMBNAIL_SIZE)
+
+/**
+ * @brief Small grayscale copies of the frames, next to the full ones
+ * @details Up to THUMBNAIL_FPS times a second, decodes the brightness of the
+ * frame at the smallest JPEG scale that still has the pixels and box filters
+ * it down to THUMBNAIL_SIZE along the longer side, 64x64 for the usual
+ * 240x240 frames. Previews and dashboards take those instead of the full
+ * frames.
+ *
+ * Hosts subscribe with GET /thumbnail?port=N on the stream server and get
+ * every thumbnail on that UDP port for THUMBNAIL_LEASE_MS, in Packet_t
+ * datagrams of a few rows each, raw pixels. GET /thumbnail answers with the
+ * latest one as a BMP, which browsers show, and keeps them coming for as
+ * long. Called from the stream task only, but for subscribe() and bmp().
+ */
+class ThumbnailStage {
+ public:
+  //! little endian, followed by rows rows of width pixels
+  struct Packet_t {
+    //! "OITH"
+    char magic[4];
+    uint32_t frame;
+    //! the slot shared with the other eye, -1 without one, see FrameSync
+    int32_t syncSeq;
+    int64_t timestampUs;
+    //! -1 while not synced with the host
+    int64_t hostTimestampUs;
+    uint16_t width;
+    uint16_t height;
+    uint16_t firstRow;
+    uint16_t rows;
+  } __attribute__((packed));
+
+  //! pixels per datagram at most, well inside an Ethernet frame
+  static constexpr size_t PACKET_PIXELS = 1024;
+
+  ThumbnailStage();
+  //! start or renew sending to address:port, false if there's no room
+  bool subscribe(const char* address, uint16_t port) {
+    return this->subscribers.subscribe(address, port);
+  }
+  //! whether anyone wants thumbnails
+  bool active();
+  void process(const Hal::Frame_t& frame,
+               int64_t hostTimestampUs,
+               int32_t syncSeq);
+  //! the latest thumbnail as a BMP, out needs THUMBNAIL_BMP_SIZE bytes,
+  //! returns its length, 0 if there is none yet. Keeps thumbnails coming
+  //! for THUMBNAIL_LEASE_MS
+  size_t bmp(uint8_t* out, int64_t& timestampUs);
+
+ private:
+  Subscribers subscribers{THUMBNAIL_LEASE_MS};
+  //! guards latest and the poll time, read from the server task
+  SemaphoreHandle_t lock = nullptr;
+  uint8_t* luma = nullptr;
+  uint8_t* thumb = nullptr;
+  uint8_t* latest = nullptr;
+  uint16_t latestWidth = 0;
+  uint16_t latestHeight = 0;
+  int64_t latestUs = 0;
+  //! until when a BMP poll keeps the thumbnails coming, 0 never polled
+  int64_t polledUntilUs = 0;
+  uint32_t frames = 0;
+  int64_t nextUs = 0;
+};
+
+#endif  // THUMBNAIL_STAGE_HPP
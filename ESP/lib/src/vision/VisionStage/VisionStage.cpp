@@ -0,0 +1,92 @@
+#include "VisionStage.hpp"
+#include "data/Metrics/Metrics.hpp"
+
+namespace {
+  constexpr char MAGIC[4] = {'O', 'I', 'P', 'U'};
+
+  Metrics::Histogram visionLatency("openiris_stage_latency_seconds",
+                                   "Time spent per pipeline stage",
+                                   Metrics::latencyBoundsUs, 10, 1000000,
+                                   "transport=\"vision\",stage=\"pupil\"");
+  Metrics::Counter resultsSent("openiris_frames_sent_total",
+                               "Frames delivered to a client, once per client",
+                               "transport=\"vision\"");
+  Metrics::Counter resultsDropped("openiris_frames_dropped_total",
+                                  "Frames that did not make it to a client",
+                                  "transport=\"vision\"");
+  Metrics::Counter blinksSeen("openiris_blinks_total",
+                              "Blinks the vision stage saw");
+}  // namespace
+
+void VisionStage::process(const Hal::Frame_t& frame,
+                          int64_t hostTimestampUs,
+                          int32_t syncSeq) {
+  int64_t start = Hal::micros();
+  // allocated once the first subscriber shows up, most never have one
+  if (!this->luma) {
+    this->luma = (uint8_t*)malloc(VISION_MAX_LUMA_PIXELS);
+    if (!this->luma ||
+        !this->pupilFit.begin(VISION_MAX_LUMA_WIDTH, VISION_MAX_LUMA_HEIGHT) ||
+        !this->openness.begin(VISION_MAX_LUMA_HEIGHT)) {
+      log_e("[VisionStage]: Not enough memory for the pupil search");
+      free(this->luma);
+      this->luma = nullptr;
+      return;
+    }
+  }
+
+  Packet_t packet = {};
+  memcpy(packet.magic, MAGIC, sizeof(MAGIC));
+  packet.frame = ++this->frames;
+  packet.syncSeq = syncSeq;
+  packet.timestampUs = frame.timestampUs;
+  packet.hostTimestampUs = hostTimestampUs;
+
+  // a frame that can't be decoded goes out with a confidence of 0
+  uint16_t width, height;
+  PupilFit::Pupil_t pupil = {};
+  OpennessEstimator::Result_t eye = {-1, false, false};
+  bool decoded = Hal::jpegToLuma(frame.data, frame.len, VISION_LUMA_SCALE,
+                                 this->luma, VISION_MAX_LUMA_PIXELS, width,
+                                 height);
+  if (!decoded && !this->undecodable)
+    log_w("[VisionStage]: Could not decode a frame of %u bytes, larger than "
+          "%dx%d?",
+          (unsigned)frame.len, VISION_MAX_FRAME_WIDTH, VISION_MAX_FRAME_HEIGHT);
+  this->undecodable = !decoded;
+  if (decoded && this->openness.estimate(this->luma, width, height,
+                                         frame.timestampUs, eye) &&
+      eye.blinked)
+    blinksSeen.add();
+  packet.openness = eye.openness;
+  packet.blinks = this->openness.blinks();
+  packet.blinkStartUs = this->openness.lastBlink().startUs;
+  packet.blinkDurationUs = this->openness.lastBlink().durationUs;
+  if (decoded && this->pupilFit.fit(this->luma, width, height, pupil)) {
+    float scale = 1 << VISION_LUMA_SCALE;
+    packet.x = pupil.x * scale;
+    packet.y = pupil.y * scale;
+    packet.major = pupil.major * scale;
+    packet.minor = pupil.minor * scale;
+    packet.angle = pupil.angle;
+    packet.confidence = pupil.confidence;
+  }
+  visionLatency.observe(Hal::micros() - start);
+
+  size_t failed;
+  resultsSent.add(this->subscribers.send((const uint8_t*)&packet,
+                                         sizeof(packet), nullptr, 0, failed));
+  resultsDropped.add(failed);
+}
+
+bool VisionStage::previewDue(int64_t timestampUs) {
+  if (timestampUs < this->nextPreviewUs)
+    return false;
+  // on the frame clock, a late frame doesn't push the ones after it back,
+  // unless they fell behind by more than a frame
+  int64_t period = 1000000 / VISION_PREVIEW_FPS;
+  this->nextPreviewUs += period;
+  if (this->nextPreviewUs <= timestampUs)
+    this->nextPreviewUs = timestampUs + period;
+  return true;
+}
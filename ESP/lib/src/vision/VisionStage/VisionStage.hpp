@@ -0,0 +1,101 @@
+#pragma once
+#ifndef VISION_STAGE_HPP
+#define VISION_STAGE_HPP
+#include <Arduino.h>
+#include "hal/hal.hpp"
+#include "vision/openness.hpp"
+#include "vision/pupilFit.hpp"
+#include "vision/Subscribers/Subscribers.hpp"
+
+//! 1 to find the pupil on the device, set in ini/user_config.ini
+#ifndef VISION_ENABLED
+#define VISION_ENABLED 0
+#endif
+//! the MJPEG stream slows down to this while someone takes the pupil
+#ifndef VISION_PREVIEW_FPS
+#define VISION_PREVIEW_FPS 5
+#endif
+//! the pupil is found in an image 1 << this times smaller than the frame
+#ifndef VISION_LUMA_SCALE
+#define VISION_LUMA_SCALE 2
+#endif
+//! the largest frame the pupil is searched in, VGA
+#define VISION_MAX_FRAME_WIDTH 640
+#define VISION_MAX_FRAME_HEIGHT 480
+//! the largest frame decoded at VISION_LUMA_SCALE, the decoder rounds up
+#define VISION_MAX_LUMA_WIDTH                                  \
+  ((VISION_MAX_FRAME_WIDTH + (1 << VISION_LUMA_SCALE) - 1) >> \
+   VISION_LUMA_SCALE)
+#define VISION_MAX_LUMA_HEIGHT                                  \
+  ((VISION_MAX_FRAME_HEIGHT + (1 << VISION_LUMA_SCALE) - 1) >> \
+   VISION_LUMA_SCALE)
+#define VISION_MAX_LUMA_PIXELS (VISION_MAX_LUMA_WIDTH * VISION_MAX_LUMA_HEIGHT)
+static_assert(VISION_LUMA_SCALE >= 0 && VISION_LUMA_SCALE <= 3,
+              "the decoder scales down by 1, 2, 4 or 8");
+//! subscribers have to ask again within this
+#define VISION_LEASE_MS 10000
+
+/**
+ * @brief Finds the pupil in every frame and sends only where it is
+ * @details Decodes the brightness of every frame, scaled down, runs a
+ * PupilFit and an OpennessEstimator on it and sends the ellipse, how far open
+ * the eye is and the latest blink to every subscriber in a Packet_t, 72 bytes
+ * instead of a JPEG. Meant for the ESP32-S3, the decoding is what
+ * takes the time.
+ *
+ * Hosts subscribe with GET /vision?port=N on the stream server and get the
+ * results on that UDP port for VISION_LEASE_MS, they renew by asking again.
+ * Meanwhile the MJPEG clients only get VISION_PREVIEW_FPS frames a second.
+ * Called from the stream task only, but for subscribe().
+ */
+class VisionStage {
+ public:
+  //! little endian, coordinates in frame pixels
+  struct Packet_t {
+    //! "OIPU"
+    char magic[4];
+    uint32_t frame;
+    //! the slot shared with the other eye, -1 without one, see FrameSync
+    int32_t syncSeq;
+    int64_t timestampUs;
+    //! -1 while not synced with the host
+    int64_t hostTimestampUs;
+    float x;
+    float y;
+    float major;
+    float minor;
+    float angle;
+    float confidence;
+    //! 0 closed to 1 open, -1 if it couldn't tell
+    float openness;
+    //! since boot, the latest is repeated until the next, a lost packet
+    //! doesn't lose it
+    uint32_t blinks;
+    int64_t blinkStartUs;
+    uint32_t blinkDurationUs;
+  } __attribute__((packed));
+
+  //! start or renew sending to address:port, false if there's no room
+  bool subscribe(const char* address, uint16_t port) {
+    return this->subscribers.subscribe(address, port);
+  }
+  //! whether anyone wants the results
+  bool active() { return this->subscribers.active(); }
+  void process(const Hal::Frame_t& frame,
+               int64_t hostTimestampUs,
+               int32_t syncSeq);
+  //! whether the MJPEG clients get this frame too
+  bool previewDue(int64_t timestampUs);
+
+ private:
+  Subscribers subscribers{VISION_LEASE_MS};
+  PupilFit pupilFit;
+  OpennessEstimator openness;
+  uint8_t* luma = nullptr;
+  uint32_t frames = 0;
+  //! whether the last frame couldn't be decoded, only the first is logged
+  bool undecodable = false;
+  int64_t nextPreviewUs = 0;
+};
+
+#endif  // VISION_STAGE_HPP
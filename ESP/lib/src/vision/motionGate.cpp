@@ -0,0 +1,86 @@
+#include "motionGate.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+void MotionGate::reset() {
+  this->referencePixels = 0;
+  this->stillCount = 0;
+  this->moving = true;
+}
+
+size_t MotionGate::shrink(const uint8_t* luma,
+                          uint16_t width,
+                          uint16_t height) {
+  // whole blocks only, the few rows and columns left over don't matter
+  uint16_t block = std::max((width + THUMB_SIZE - 1) / THUMB_SIZE,
+                            (height + THUMB_SIZE - 1) / THUMB_SIZE);
+  this->thumbWidth = width / block;
+  this->thumbHeight = height / block;
+  uint32_t area = (uint32_t)block * block;
+  uint8_t* out = this->thumb;
+  for (uint16_t ty = 0; ty < this->thumbHeight; ty++) {
+    const uint8_t* rows = luma + (size_t)ty * block * width;
+    for (uint16_t tx = 0; tx < this->thumbWidth; tx++) {
+      uint32_t sum = 0;
+      for (uint16_t y = 0; y < block; y++) {
+        const uint8_t* row = rows + (size_t)y * width + tx * block;
+        for (uint16_t x = 0; x < block; x++)
+          sum += row[x];
+      }
+      *out++ = sum / area;
+    }
+  }
+  return out - this->thumb;
+}
+
+MotionGate::Result_t MotionGate::onFrame(const uint8_t* luma,
+                                         uint16_t width,
+                                         uint16_t height,
+                                         int64_t timestampUs) {
+  Result_t result = {true, true, -1};
+  uint16_t lastWidth = this->thumbWidth, lastHeight = this->thumbHeight;
+  size_t pixels = width && height ? this->shrink(luma, width, height) : 0;
+  if (!pixels)
+    return result;
+
+  // a new resolution starts over
+  if (this->referencePixels == pixels && lastWidth == this->thumbWidth &&
+      lastHeight == this->thumbHeight) {
+    // four pixels at a time, the compiler unrolls and vectorizes it where
+    // the target has the instructions
+    uint32_t sad = 0;
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+      sad += abs(this->thumb[i] - this->reference[i]) +
+             abs(this->thumb[i + 1] - this->reference[i + 1]) +
+             abs(this->thumb[i + 2] - this->reference[i + 2]) +
+             abs(this->thumb[i + 3] - this->reference[i + 3]);
+    }
+    for (; i < pixels; i++)
+      sad += abs(this->thumb[i] - this->reference[i]);
+    result.difference = (float)sad / pixels;
+
+    if (result.difference > this->config.threshold) {
+      this->stillCount = 0;
+      this->moving = true;
+    } else if (++this->stillCount >= this->config.stillFrames) {
+      this->moving = false;
+    }
+  } else {
+    this->moving = true;
+    this->stillCount = 0;
+  }
+
+  // while still a frame every so often, so the client sees we're alive
+  result.moving = this->moving;
+  result.send = this->moving || (this->config.idleFps &&
+                                 timestampUs >= this->nextIdleUs);
+  if (result.send) {
+    memcpy(this->reference, this->thumb, pixels);
+    this->referencePixels = pixels;
+    if (this->config.idleFps)
+      this->nextIdleUs = timestampUs + 1000000 / this->config.idleFps;
+  }
+  return result;
+}
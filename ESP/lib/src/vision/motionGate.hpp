@@ -0,0 +1,71 @@
+#pragma once
+#ifndef MOTION_GATE_HPP
+#define MOTION_GATE_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Holds frames back while the eye keeps still
+ * @details Every frame is shrunk to a thumbnail of at most THUMB_SIZE by
+ * THUMB_SIZE block averages and compared to the thumbnail of the last frame
+ * that went out, the mean absolute difference per pixel. Above the threshold
+ * the eye moves and every frame goes out, once stillFrames frames in a row
+ * stayed below it only idleFps frames a second do. Comparing to the last
+ * frame sent, not the one before, a slow drift still adds up to a change.
+ *
+ * The thumbnail is small enough that the comparison costs next to nothing,
+ * the decoding to get a thumbnail is what takes the time. No allocation.
+ * Pure code, so it can be checked on the host.
+ */
+class MotionGate {
+ public:
+  static constexpr uint16_t THUMB_SIZE = 32;
+
+  struct Config_t {
+    //! mean absolute difference per thumbnail pixel that counts as motion,
+    //! in levels of 255, sensor noise stays well below
+    float threshold = 2.0f;
+    //! frames below the threshold in a row before frames are held back
+    uint32_t stillFrames = 6;
+    //! frames a second that still go out while still, 0 for none
+    uint16_t idleFps = 2;
+  };
+
+  struct Result_t {
+    //! whether the frame goes out
+    bool send;
+    bool moving;
+    //! to the last frame sent, -1 if there's nothing to compare to
+    float difference;
+  };
+
+  MotionGate() = default;
+  explicit MotionGate(const Config_t& config) : config(config) {}
+
+  //! luma is the frame's brightness at any scale, timestampUs its timestamp
+  Result_t onFrame(const uint8_t* luma,
+                   uint16_t width,
+                   uint16_t height,
+                   int64_t timestampUs);
+  //! send the next frame whatever it shows, after a gap the client may have
+  //! missed the last one
+  void reset();
+
+ private:
+  //! block averages of the frame, returns how many pixels were written
+  size_t shrink(const uint8_t* luma, uint16_t width, uint16_t height);
+
+  Config_t config;
+  uint8_t thumb[THUMB_SIZE * THUMB_SIZE];
+  //! of the last frame sent
+  uint8_t reference[THUMB_SIZE * THUMB_SIZE];
+  uint16_t thumbWidth = 0;
+  uint16_t thumbHeight = 0;
+  //! 0 while there's no reference
+  size_t referencePixels = 0;
+  uint32_t stillCount = 0;
+  bool moving = true;
+  int64_t nextIdleUs = 0;
+};
+
+#endif  // MOTION_GATE_HPP
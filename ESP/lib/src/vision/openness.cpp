@@ -0,0 +1,133 @@
+#include "openness.hpp"
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+
+namespace {
+  //! the darkest this fraction of the image is the pupil, or the lashes of a
+  //! closed eye
+  constexpr float DARKEST_FRACTION = 0.01f;
+  //! how far from the darkest to the median the threshold sits
+  constexpr float THRESHOLD = 0.6f;
+  //! less than this between the darkest and the median and nothing's there
+  constexpr uint8_t MIN_CONTRAST = 20;
+  //! no eye is open less than this many rows
+  constexpr float MIN_REFERENCE_ROWS = 3;
+
+  //! the first level at or above which lie more than count pixels
+  uint8_t percentile(const uint32_t* histogram, uint32_t count) {
+    uint32_t sum = 0;
+    for (int level = 0; level < 256; level++) {
+      sum += histogram[level];
+      if (sum > count)
+        return level;
+    }
+    return 255;
+  }
+}  // namespace
+
+OpennessEstimator::~OpennessEstimator() {
+  free(this->rowDark);
+}
+
+bool OpennessEstimator::begin(uint16_t maxHeight) {
+  if (maxHeight <= this->rows)
+    return true;
+  this->rowDark =
+      (uint16_t*)realloc(this->rowDark, maxHeight * sizeof(uint16_t));
+  this->rows = this->rowDark ? maxHeight : 0;
+  return this->rowDark;
+}
+
+void OpennessEstimator::reset() {
+  this->reference = 0;
+  this->referenceUs = 0;
+  this->closed = false;
+  this->closingUs = -1;
+}
+
+bool OpennessEstimator::estimate(const uint8_t* image,
+                                 uint16_t width,
+                                 uint16_t height,
+                                 int64_t timestampUs,
+                                 Result_t& result) {
+  if (!width || !height || height > this->rows)
+    return false;
+  result = {-1, this->closed, false};
+
+  uint32_t histogram[256] = {};
+  size_t pixels = (size_t)width * height;
+  for (size_t i = 0; i < pixels; i++)
+    histogram[image[i]]++;
+  uint8_t darkest = percentile(histogram, pixels * DARKEST_FRACTION);
+  uint8_t median = percentile(histogram, pixels / 2);
+  if (median - darkest < MIN_CONTRAST)
+    return true;
+  uint8_t threshold = darkest + (median - darkest) * THRESHOLD;
+
+  for (uint16_t y = 0; y < height; y++) {
+    const uint8_t* row = image + (size_t)y * width;
+    uint16_t dark = 0;
+    for (uint16_t x = 0; x < width; x++)
+      dark += row[x] < threshold;
+    this->rowDark[y] = dark;
+  }
+
+  // the band of rows with the most dark pixels, a few rows without any may
+  // be the reflection or a gap between lashes and iris
+  uint16_t minDark = std::max(2, width / 20);
+  uint16_t maxGap = std::max(1, height / 40);
+  uint32_t bestDark = 0, runDark = 0;
+  uint16_t bestRows = 0, runFirst = 0, runLast = 0, gap = 0;
+  bool inRun = false;
+  for (uint16_t y = 0; y < height; y++) {
+    if (this->rowDark[y] >= minDark) {
+      if (!inRun || gap > maxGap) {
+        runFirst = y;
+        runDark = 0;
+      }
+      inRun = true;
+      gap = 0;
+      runLast = y;
+      runDark += this->rowDark[y];
+      if (runDark > bestDark) {
+        bestDark = runDark;
+        bestRows = runLast - runFirst + 1;
+      }
+    } else {
+      gap++;
+    }
+  }
+  if (!bestRows)
+    return true;
+
+  // the widest opening fades, so a camera that slipped further away doesn't
+  // leave the eye half closed for good
+  if (this->referenceUs && timestampUs > this->referenceUs)
+    this->reference *= expf(-(timestampUs - this->referenceUs) /
+                            (this->config.referenceDecayMs * 1000.0f));
+  this->referenceUs = timestampUs;
+  this->reference = std::max({this->reference, (float)bestRows,
+                              MIN_REFERENCE_ROWS});
+  result.openness = std::min(1.0f, bestRows / this->reference);
+
+  // hysteresis, a half open eye doesn't blink at every frame
+  if (result.openness < this->config.openAbove && this->closingUs < 0)
+    this->closingUs = timestampUs;
+  if (result.openness < this->config.closeBelow) {
+    this->closed = true;
+  } else if (result.openness > this->config.openAbove) {
+    if (this->closed) {
+      int64_t duration = timestampUs - this->closingUs;
+      if (duration >= BLINK_MIN_US && duration <= BLINK_MAX_US) {
+        this->last = {this->closingUs, (uint32_t)duration};
+        this->blinkCount++;
+        result.blinked = true;
+      }
+    }
+    this->closed = false;
+    this->closingUs = -1;
+  }
+  result.closed = this->closed;
+  return true;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#ifndef OPENNESS_HPP
+#define OPENNESS_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief How far open the eye is, and when it blinked, from a grayscale image
+ * @details Pupil, iris and lashes are the dark part of an IR eye image, the
+ * lids are skin. A histogram of the image gives a threshold between the two
+ * and the vertical profile of dark pixels how many rows the open eye covers,
+ * which shrinks to the lash line as the lid comes down. That's compared to
+ * the widest the eye was open lately, so it doesn't matter how close the
+ * camera sits. A few hundred microseconds per frame, a fraction of what
+ * finding the pupil takes.
+ *
+ * Blinks are the eye closing and opening again within BLINK_MIN_US to
+ * BLINK_MAX_US, longer is the eye shut. No allocation after begin(). Pure
+ * code, tools/blinkcheck scores it on recorded sequences on the host.
+ */
+class OpennessEstimator {
+ public:
+  static constexpr uint32_t BLINK_MIN_US = 40000;
+  static constexpr uint32_t BLINK_MAX_US = 700000;
+
+  struct Config_t {
+    //! below this the eye counts as closed, above open again
+    float closeBelow = 0.3f;
+    float openAbove = 0.6f;
+    //! how quickly the widest opening is forgotten, the eye may move away
+    uint32_t referenceDecayMs = 30000;
+  };
+
+  struct Blink_t {
+    //! when the eye started closing, timestamp of the frames
+    int64_t startUs;
+    uint32_t durationUs;
+  };
+
+  struct Result_t {
+    //! 0 closed to 1 as open as lately, -1 if it couldn't tell
+    float openness;
+    bool closed;
+    //! this frame finished a blink, see lastBlink()
+    bool blinked;
+  };
+
+  OpennessEstimator() = default;
+  explicit OpennessEstimator(const Config_t& config) : config(config) {}
+  ~OpennessEstimator();
+  OpennessEstimator(const OpennessEstimator&) = delete;
+  OpennessEstimator& operator=(const OpennessEstimator&) = delete;
+
+  //! room for images up to this many rows, false if it can't be had
+  bool begin(uint16_t maxHeight);
+  //! false if the image is taller than begin() made room for
+  bool estimate(const uint8_t* image,
+                uint16_t width,
+                uint16_t height,
+                int64_t timestampUs,
+                Result_t& result);
+  //! forget the eye, the next frames may show another one
+  void reset();
+  uint32_t blinks() const { return this->blinkCount; }
+  //! zeros before the first blink
+  Blink_t lastBlink() const { return this->last; }
+
+ private:
+  Config_t config;
+  //! dark pixels of every row
+  uint16_t* rowDark = nullptr;
+  uint16_t rows = 0;
+  //! the widest opening lately, rows
+  float reference = 0;
+  int64_t referenceUs = 0;
+  bool closed = false;
+  //! when the eye went below openAbove on its way to closing, -1 while open
+  int64_t closingUs = -1;
+  uint32_t blinkCount = 0;
+  Blink_t last = {};
+};
+
+#endif  // OPENNESS_HPP
@@ -0,0 +1,175 @@
+#include "pupilFit.hpp"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+namespace {
+  //! sum of x for x from first to last
+  double sumTo(double first, double last) {
+    return (first + last) * (last - first + 1) / 2;
+  }
+
+  //! sum of x squared for x from 0 to n
+  double squaresTo(double n) {
+    return n * (n + 1) * (2 * n + 1) / 6;
+  }
+}  // namespace
+
+PupilFit::~PupilFit() {
+  free(this->mask);
+  free(this->pending);
+  free(this->rowFirst);
+  free(this->rowLast);
+}
+
+bool PupilFit::begin(uint16_t maxWidth, uint16_t maxHeight) {
+  size_t pixels = (size_t)maxWidth * maxHeight;
+  if (pixels <= this->capacity && maxHeight <= this->rows)
+    return true;
+  this->mask = (uint8_t*)realloc(this->mask, pixels);
+  this->pending = (uint32_t*)realloc(this->pending, pixels * sizeof(uint32_t));
+  this->rowFirst = (uint16_t*)realloc(this->rowFirst, maxHeight * sizeof(uint16_t));
+  this->rowLast = (uint16_t*)realloc(this->rowLast, maxHeight * sizeof(uint16_t));
+  if (!this->mask || !this->pending || !this->rowFirst || !this->rowLast) {
+    this->capacity = 0;
+    this->rows = 0;
+    return false;
+  }
+  this->capacity = pixels;
+  this->rows = maxHeight;
+  return true;
+}
+
+bool PupilFit::fit(const uint8_t* image,
+                   uint16_t width,
+                   uint16_t height,
+                   Pupil_t& pupil) {
+  size_t pixels = (size_t)width * height;
+  if (!pixels || pixels > this->capacity || height > this->rows)
+    return false;
+  pupil = {width / 2.0f, height / 2.0f, 0, 0, 0, 0};
+
+  // the darkest patch, a twelfth of the image wide, in half patch steps
+  uint16_t patch = std::max<uint16_t>(2, std::min(width, height) / 12);
+  uint16_t step = std::max<uint16_t>(1, patch / 2);
+  uint32_t darkest = UINT32_MAX;
+  uint16_t seedX = 0, seedY = 0;
+  for (uint16_t y = 0; y + patch <= height; y += step) {
+    for (uint16_t x = 0; x + patch <= width; x += step) {
+      uint32_t sum = 0;
+      for (uint16_t py = 0; py < patch; py++) {
+        const uint8_t* row = image + (size_t)(y + py) * width + x;
+        for (uint16_t px = 0; px < patch; px++)
+          sum += row[px];
+      }
+      if (sum < darkest) {
+        darkest = sum;
+        seedX = x;
+        seedY = y;
+      }
+    }
+  }
+  uint64_t total = 0;
+  for (size_t i = 0; i < pixels; i++)
+    total += image[i];
+  float dark = (float)darkest / (patch * patch);
+  float mean = (float)total / pixels;
+  uint8_t threshold = (uint8_t)(dark + this->config.threshold * (mean - dark));
+
+  // the fill starts from the darkest pixel of the patch
+  size_t seed = (size_t)seedY * width + seedX;
+  for (uint16_t py = 0; py < patch; py++) {
+    for (uint16_t px = 0; px < patch; px++) {
+      size_t i = (size_t)(seedY + py) * width + seedX + px;
+      if (image[i] < image[seed])
+        seed = i;
+    }
+  }
+  if (image[seed] > threshold)
+    return true;
+
+  memset(this->mask, 0, pixels);
+  for (uint16_t y = 0; y < height; y++) {
+    this->rowFirst[y] = UINT16_MAX;
+    this->rowLast[y] = 0;
+  }
+  size_t count = 0, area = 0;
+  bool border = false;
+  this->pending[count++] = seed;
+  this->mask[seed] = 1;
+  while (count) {
+    uint32_t i = this->pending[--count];
+    uint16_t x = i % width, y = i / width;
+    area++;
+    this->rowFirst[y] = std::min(this->rowFirst[y], x);
+    this->rowLast[y] = std::max(this->rowLast[y], x);
+    border |= x == 0 || y == 0 || x == width - 1 || y == height - 1;
+    // 4 connected, every pixel goes on the stack at most once
+    uint32_t next[4];
+    size_t n = 0;
+    if (x > 0)
+      next[n++] = i - 1;
+    if (x + 1 < width)
+      next[n++] = i + 1;
+    if (y > 0)
+      next[n++] = i - width;
+    if (y + 1 < height)
+      next[n++] = i + width;
+    for (size_t k = 0; k < n; k++) {
+      if (!this->mask[next[k]] && image[next[k]] <= threshold) {
+        this->mask[next[k]] = 1;
+        this->pending[count++] = next[k];
+      }
+    }
+  }
+  if (area < this->config.minArea ||
+      area > this->config.maxAreaFraction * pixels)
+    return true;
+
+  // moments of the rows' spans, pixel centres at +0.5
+  double m0 = 0, mx = 0, my = 0, mxx = 0, myy = 0, mxy = 0;
+  for (uint16_t y = 0; y < height; y++) {
+    if (this->rowFirst[y] > this->rowLast[y])
+      continue;
+    double first = this->rowFirst[y], last = this->rowLast[y];
+    double n = last - first + 1;
+    double cy = y + 0.5;
+    double sx = sumTo(first, last) + n / 2;
+    double sxx = squaresTo(last) - (first > 0 ? squaresTo(first - 1) : 0) +
+                 sumTo(first, last) + n / 4;
+    m0 += n;
+    mx += sx;
+    my += n * cy;
+    mxx += sxx;
+    myy += n * cy * cy;
+    mxy += sx * cy;
+  }
+  double x = mx / m0, y = my / m0;
+  // a solid pixel adds 1/12 of its own to the spread
+  double vxx = mxx / m0 - x * x + 1.0 / 12;
+  double vyy = myy / m0 - y * y + 1.0 / 12;
+  double vxy = mxy / m0 - x * y;
+  double mid = (vxx + vyy) / 2;
+  double spread = sqrt((vxx - vyy) * (vxx - vyy) / 4 + vxy * vxy);
+  // a filled ellipse has a variance of a quarter semi axis squared
+  double major = 2 * sqrt(std::max(0.0, mid + spread));
+  double minor = 2 * sqrt(std::max(0.0, mid - spread));
+
+  pupil.x = x;
+  pupil.y = y;
+  pupil.major = major;
+  pupil.minor = minor;
+  pupil.angle = 0.5 * atan2(2 * vxy, vxx - vyy);
+
+  // how much of the ellipse is filled, how round it is, even looking far to
+  // the side pupils are no flatter than 2:1 while lids and lashes are, and
+  // how much darker than the rest, pupils are close to black under IR
+  double fill = minor > 0 ? m0 / (M_PI * major * minor) : 0;
+  double shape = std::max(0.0, 1 - 2 * fabs(1 - fill));
+  double roundness = std::min(1.0, minor / major / 0.4);
+  double contrast = mean > 0 ? (1 - dark / mean - 0.3) / 0.4 : 0;
+  contrast = std::min(1.0, std::max(0.0, contrast));
+  pupil.confidence = shape * roundness * contrast * (border ? 0.5 : 1);
+  return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#ifndef PUPIL_FIT_HPP
+#define PUPIL_FIT_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Finds the pupil in a grayscale eye image and fits an ellipse to it
+ * @details Under IR the pupil is the darkest thing in the image. The darkest
+ * patch seeds a flood fill of everything darker than a threshold between it
+ * and the average brightness, and the ellipse comes from the moments of what
+ * got filled. Every row of the blob counts from its first to its last pixel,
+ * which closes the hole the IR LED's reflection leaves.
+ *
+ * No allocation after begin(). Pure code, tools/pupilcheck scores it on
+ * labelled images on the host.
+ */
+class PupilFit {
+ public:
+  struct Config_t {
+    //! how far from the darkest patch to the average the threshold sits
+    float threshold = 0.3f;
+    //! blobs smaller than this, in pixels, are noise or lashes
+    uint32_t minArea = 6;
+    //! blobs covering more of the image than this are shadows
+    float maxAreaFraction = 0.25f;
+  };
+
+  //! image pixels, the top left corner of the image is 0, 0
+  struct Pupil_t {
+    float x;
+    float y;
+    //! semi axes, major >= minor
+    float major;
+    float minor;
+    //! of the major axis, radians clockwise from the x axis, -pi/2 to pi/2
+    float angle;
+    //! 0 for no pupil, 1 for a dark, well filled ellipse
+    float confidence;
+  };
+
+  PupilFit() = default;
+  explicit PupilFit(const Config_t& config) : config(config) {}
+  ~PupilFit();
+  PupilFit(const PupilFit&) = delete;
+  PupilFit& operator=(const PupilFit&) = delete;
+
+  //! room for images up to this size, false if it can't be had
+  bool begin(uint16_t maxWidth, uint16_t maxHeight);
+  //! false if the image is larger than begin() made room for, a closed eye
+  //! still gives true with a confidence of 0
+  bool fit(const uint8_t* image,
+           uint16_t width,
+           uint16_t height,
+           Pupil_t& pupil);
+
+ private:
+  Config_t config;
+  size_t capacity = 0;
+  //! 1 for pixels in the blob
+  uint8_t* mask = nullptr;
+  //! the flood fill's pixels to visit
+  uint32_t* pending = nullptr;
+  //! first and last blob pixel of every row
+  uint16_t* rowFirst = nullptr;
+  uint16_t* rowLast = nullptr;
+  uint16_t rows = 0;
+};
+
+#endif  // PUPIL_FIT_HPP
@@ -0,0 +1,122 @@
+#include "thumbnail.hpp"
+#include <string.h>
+#include <algorithm>
+
+namespace {
+  void put16(uint8_t* out, uint16_t value) {
+    out[0] = value;
+    out[1] = value >> 8;
+  }
+
+  void put32(uint8_t* out, uint32_t value) {
+    put16(out, value);
+    put16(out + 2, value >> 16);
+  }
+}  // namespace
+
+namespace Thumbnail {
+  bool jpegSize(const uint8_t* jpeg, size_t len, uint16_t& width,
+                uint16_t& height) {
+    if (len < 4 || jpeg[0] != 0xff || jpeg[1] != 0xd8)
+      return false;
+    size_t i = 2;
+    while (i + 4 <= len) {
+      if (jpeg[i] != 0xff)
+        return false;
+      uint8_t marker = jpeg[i + 1];
+      // fill bytes, and markers without a length
+      if (marker == 0xff || marker == 0x01 ||
+          (marker >= 0xd0 && marker <= 0xd7)) {
+        i += marker == 0xff ? 1 : 2;
+        continue;
+      }
+      size_t segment = (jpeg[i + 2] << 8) | jpeg[i + 3];
+      // every start of frame but the tables that share the range
+      if (marker >= 0xc0 && marker <= 0xcf && marker != 0xc4 &&
+          marker != 0xc8 && marker != 0xcc) {
+        if (i + 9 > len)
+          return false;
+        height = (jpeg[i + 5] << 8) | jpeg[i + 6];
+        width = (jpeg[i + 7] << 8) | jpeg[i + 8];
+        return width && height;
+      }
+      // the image data comes after the frame header, it's too late then
+      if (marker == 0xda || marker == 0xd9 || segment < 2)
+        return false;
+      i += 2 + segment;
+    }
+    return false;
+  }
+
+  uint8_t decodeShift(uint16_t frameWidth, uint16_t frameHeight,
+                      uint16_t width, uint16_t height) {
+    uint8_t shift = 0;
+    // the decoder rounds up
+    while (shift < 3 &&
+           (frameWidth + (2 << shift) - 1) >> (shift + 1) >= width &&
+           (frameHeight + (2 << shift) - 1) >> (shift + 1) >= height)
+      shift++;
+    return shift;
+  }
+
+  void fit(uint16_t frameWidth, uint16_t frameHeight, uint16_t size,
+           uint16_t& width, uint16_t& height) {
+    if (frameWidth >= frameHeight) {
+      width = std::min(size, frameWidth);
+      height = std::max<uint32_t>(1, (uint32_t)frameHeight * width / frameWidth);
+    } else {
+      height = std::min(size, frameHeight);
+      width = std::max<uint32_t>(1, (uint32_t)frameWidth * height / frameHeight);
+    }
+  }
+
+  void boxFilter(const uint8_t* in, uint16_t inWidth, uint16_t inHeight,
+                 uint8_t* out, uint16_t width, uint16_t height) {
+    // the columns every thumbnail pixel covers, the same for every row
+    uint16_t first[256], last[256];
+    width = std::min<uint16_t>(width, 256);
+    for (uint16_t x = 0; x < width; x++) {
+      first[x] = (uint32_t)x * inWidth / width;
+      last[x] = std::max<uint32_t>(first[x] + 1,
+                                   (uint32_t)(x + 1) * inWidth / width);
+    }
+    for (uint16_t y = 0; y < height; y++) {
+      uint16_t top = (uint32_t)y * inHeight / height;
+      uint16_t bottom =
+          std::max<uint32_t>(top + 1, (uint32_t)(y + 1) * inHeight / height);
+      for (uint16_t x = 0; x < width; x++) {
+        uint32_t sum = 0;
+        for (uint16_t row = top; row < bottom; row++) {
+          const uint8_t* pixel = in + (size_t)row * inWidth + first[x];
+          for (uint16_t column = first[x]; column < last[x]; column++)
+            sum += *pixel++;
+        }
+        uint32_t area = (uint32_t)(bottom - top) * (last[x] - first[x]);
+        *out++ = (sum + area / 2) / area;
+      }
+    }
+  }
+
+  void bmpHeader(uint8_t* out, uint16_t width, uint16_t height) {
+    uint32_t stride = (width + 3) & ~3u;
+    memset(out, 0, BMP_HEADER_SIZE);
+    out[0] = 'B';
+    out[1] = 'M';
+    put32(out + 2, BMP_HEADER_SIZE + stride * height);
+    put32(out + 10, BMP_HEADER_SIZE);
+    put32(out + 14, 40);
+    put32(out + 18, width);
+    // negative, top row first
+    put32(out + 22, (uint32_t)-(int32_t)height);
+    put16(out + 26, 1);
+    put16(out + 28, 8);
+    put32(out + 34, stride * height);
+    put32(out + 46, 256);
+    uint8_t* palette = out + 54;
+    for (int level = 0; level < 256; level++) {
+      palette[level * 4] = level;
+      palette[level * 4 + 1] = level;
+      palette[level * 4 + 2] = level;
+    }
+  }
+}  // namespace Thumbnail
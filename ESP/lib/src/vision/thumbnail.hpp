@@ -0,0 +1,36 @@
+#pragma once
+#ifndef THUMBNAIL_HPP
+#define THUMBNAIL_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Small grayscale copies of the frames
+ * @details Pure code, so it can be checked on the host. The frame's
+ * brightness is decoded at the smallest JPEG scale that still has enough
+ * pixels, decodeShift(), and box filtered down from there, every thumbnail
+ * pixel the mean of the frame pixels it covers.
+ */
+namespace Thumbnail {
+  //! the size of a BMP header, palette included
+  constexpr size_t BMP_HEADER_SIZE = 14 + 40 + 256 * 4;
+
+  //! the size a baseline JPEG says it is, false if it says nothing
+  bool jpegSize(const uint8_t* jpeg, size_t len, uint16_t& width,
+                uint16_t& height);
+  //! the largest shift, up to 3, that decodes to at least width x height
+  uint8_t decodeShift(uint16_t frameWidth, uint16_t frameHeight,
+                      uint16_t width, uint16_t height);
+  //! size pixels along the longer side, the same aspect as the frame
+  void fit(uint16_t frameWidth, uint16_t frameHeight, uint16_t size,
+           uint16_t& width, uint16_t& height);
+  //! from any size down to width x height, at most 256 wide, the mean of the
+  //! covered pixels
+  void boxFilter(const uint8_t* in, uint16_t inWidth, uint16_t inHeight,
+                 uint8_t* out, uint16_t width, uint16_t height);
+  //! the header of an 8 bit gray BMP, top row first, BMP_HEADER_SIZE bytes
+  //! long, the rows follow it padded to 4 bytes
+  void bmpHeader(uint8_t* out, uint16_t width, uint16_t height);
+}  // namespace Thumbnail
+
+#endif  // THUMBNAIL_HPP
@@ -23,8 +23,15 @@ LEDManager ledManager(33);
 CameraHandler cameraHandler(deviceConfig);
 #endif  // SIM_ENABLED
 
+#ifdef IR_EMITTER_GPIO_NUM
+IREmitter irEmitter(deviceConfig,
+                    cameraHandler,
+                    IR_EMITTER_GPIO_NUM,
+                    VSYNC_GPIO_NUM);
+#endif  // IR_EMITTER_GPIO_NUM
+
 #ifndef ETVR_EYE_TRACKER_USB_API
-HapticEngine hapticEngine;
+HapticEngine hapticEngine(deviceConfig);
 #endif  // ETVR_EYE_TRACKER_WEB_API
 
 
@@ -36,17 +43,22 @@ WiFiHandler wifiHandler(deviceConfig,
                         ENABLE_ADHOC);
 MDNSHandler mdnsHandler(deviceConfig);
 #ifdef SIM_ENABLED
-APIServer apiServer(deviceConfig, wifiStateManager, "/control");
+APIServer apiServer(deviceConfig, "/control");
 #else
 APIServer apiServer(deviceConfig, cameraHandler, "/control");
-StreamServer streamServer;
 #endif  // SIM_ENABLED
+// fed by the synthetic camera in the simulator
+StreamServer streamServer;
 
 void etvr_eye_tracker_web_init() {
   log_d("[SETUP]: Starting Network Handler");
   deviceConfig.attach(mdnsHandler);
   log_d("[SETUP]: Starting WiFi Handler");
   wifiHandler.begin();
+  log_d("[SETUP]: Starting WiFi Monitor");
+  wifiMonitor.begin();
+  log_d("[SETUP]: Starting Clock Sync");
+  clockSync.begin();
   log_d("[SETUP]: Starting MDNS Handler");
   mdnsHandler.startMDNS();
 
@@ -56,12 +68,14 @@ void etvr_eye_tracker_web_init() {
       break;
     }
     case WiFiState_e::WiFiState_ADHOC: {
-#ifndef SIM_ENABLED
       log_d("[SETUP]: Starting Stream Server");
-      streamServer.startStreamServer();
-#endif  // SIM_ENABLED
+      streamServer.startStreamServer(httpServer);
+      httpServer.begin();
       log_d("[SETUP]: Starting API Server");
-      apiServer.setup();
+      apiServer.setup(httpServer);
+#ifndef SIM_ENABLED
+      cameraHandler.checkFrameBuffers();
+#endif  // SIM_ENABLED
       break;
     }
     case WiFiState_e::WiFiState_Connected: {
@@ -71,18 +85,23 @@ void etvr_eye_tracker_web_init() {
           auto* engine = reinterpret_cast<HapticEngine*>(param);
           engine->runTask(param);
         },
-        "PingTask",
+        "HapticTask",
         4096,        // stack size
         &hapticEngine,
-        1,           // priority
+        5,           // priority, above the idle work so datagrams apply right away
         nullptr,
         0            // core 0
       );
-      log_d("[SETUP]: Starting Stream Server");
-      streamServer.startStreamServer();
+      hapticEngine.attachRoutes(httpServer);
 #endif  // SIM_ENABLED
+      log_d("[SETUP]: Starting Stream Server");
+      streamServer.startStreamServer(httpServer);
+      httpServer.begin();
       log_d("[SETUP]: Starting API Server");
-      apiServer.setup();
+      apiServer.setup(httpServer);
+#ifndef SIM_ENABLED
+      cameraHandler.checkFrameBuffers();
+#endif  // SIM_ENABLED
       break;
     }
     case WiFiState_e::WiFiState_Connecting: {
@@ -101,23 +120,21 @@ void setup() {
   setCpuFrequencyMhz(240);
   Serial.begin(115200);
   Logo::printASCII();
+  scheduler.begin();
   ledManager.begin();
 
-  #ifdef CONFIG_CAMERA_MODULE_SWROOM_BABBLE_S3  // Set IR emitter strength to 100%.  
-    const int ledPin = 1;                       // Replace this with a command endpoint eventually.
-    const int freq = 5000;
-    const int ledChannel = 0;
-    const int resolution = 8;
-    const int dutyCycle = 255;
-    ledcSetup(ledChannel, freq, resolution);
-    ledcAttachPin(1, ledChannel);
-    ledcWrite(ledChannel, dutyCycle); 
-  #endif
-
 #ifndef SIM_ENABLED
   deviceConfig.attach(cameraHandler);
 #endif  // SIM_ENABLED
+#ifdef IR_EMITTER_GPIO_NUM
+  deviceConfig.attach(irEmitter);
+#endif  // IR_EMITTER_GPIO_NUM
+#ifndef ETVR_EYE_TRACKER_USB_API
+  deviceConfig.attach(hapticEngine);
+#endif  // ETVR_EYE_TRACKER_USB_API
   deviceConfig.load();
+  // after the camera took its frame buffers
+  frameTracer.begin();
 
   serialManager.init();
 
@@ -129,6 +146,6 @@ void setup() {
 }
 
 void loop() {
-  ledManager.handleLED();
+  ledManager.postState(ledStateManager.getCurrentState());
   serialManager.run();
 }
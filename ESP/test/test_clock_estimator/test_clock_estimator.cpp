@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "network/ClockSync/clockEstimator.hpp"
+
+namespace {
+  //! the defaults of PythonExamples/clocksync.py simulate
+  struct Simulation_t {
+    double seconds = 300;
+    double driftPpm = 40;
+    //! one way, without queueing
+    double baseDelayUs = 1500;
+    //! mean queueing, each way
+    double jitterUs = 500;
+    //! extra on the way to the host
+    double asymmetryUs = 100;
+    double loss = 0.02;
+    uint64_t seed = 1;
+  };
+
+  constexpr int64_t HOST_OFFSET_US = 1700000000000000;
+  constexpr int64_t INTERVAL_US = 500000;
+  //! half a minute to settle before the error counts
+  constexpr int64_t SETTLE_US = 30000000;
+
+  /**
+   * @brief The errors of toHost() between exchanges
+   * @details Virtual time, ours is the true clock and the host's drifts. A
+   * frame is probed halfway between two exchanges, where the estimate is
+   * furthest from the last one.
+   */
+  std::vector<int64_t> simulate(const Simulation_t& simulation,
+                                ClockEstimator& estimator) {
+    std::mt19937_64 rng(simulation.seed);
+    std::exponential_distribution<double> queueing(1 / simulation.jitterUs);
+    std::uniform_real_distribution<double> chance(0, 1);
+    auto host = [&](double trueUs) {
+      return (int64_t)(HOST_OFFSET_US +
+                       trueUs * (1 + simulation.driftPpm * 1e-6));
+    };
+
+    std::vector<int64_t> errors;
+    int64_t exchanges = simulation.seconds * 1e6 / INTERVAL_US;
+    for (int64_t i = 0; i < exchanges; i++) {
+      int64_t t = i * INTERVAL_US + 12345;
+      double up = simulation.baseDelayUs + simulation.asymmetryUs + queueing(rng);
+      double down = simulation.baseDelayUs + queueing(rng);
+      if (chance(rng) < simulation.loss)
+        continue;
+      estimator.add({t, host(t + up), host(t + up + 50),
+                     (int64_t)(t + up + 50 + down)});
+      if (t > SETTLE_US && estimator.synced()) {
+        int64_t probe = t + INTERVAL_US / 2;
+        errors.push_back(llabs(estimator.toHost(probe) - host(probe)));
+      }
+    }
+    std::sort(errors.begin(), errors.end());
+    return errors;
+  }
+
+  int64_t p99(const std::vector<int64_t>& errors) {
+    return errors[errors.size() * 99 / 100];
+  }
+}  // namespace
+
+TEST(ClockEstimatorTest, StaysWithinAMillisecondOfADriftingClock) {
+  Simulation_t simulation;
+  // a few seeds, the bound has to hold for more than one lucky draw
+  for (uint64_t seed = 1; seed <= 5; seed++) {
+    SCOPED_TRACE(seed);
+    simulation.seed = seed;
+    ClockEstimator estimator;
+    std::vector<int64_t> errors = simulate(simulation, estimator);
+    ASSERT_GT(errors.size(), 400u);
+    EXPECT_LE(p99(errors), 1000);
+    EXPECT_NEAR(estimator.driftPpm(), simulation.driftPpm, 5);
+  }
+}
+
+TEST(ClockEstimatorTest, NeedsAFewExchangesBeforeItIsSynced) {
+  ClockEstimator estimator;
+  for (size_t i = 0; i < ClockEstimator::MIN_SAMPLES; i++) {
+    EXPECT_FALSE(estimator.synced());
+    int64_t t = i * INTERVAL_US;
+    estimator.add({t, HOST_OFFSET_US + t + 1000, HOST_OFFSET_US + t + 1050,
+                   t + 2050});
+  }
+  EXPECT_TRUE(estimator.synced());
+  EXPECT_EQ(estimator.offsetUs(0), HOST_OFFSET_US);
+  EXPECT_EQ(estimator.delayUs(), 2000u);
+  EXPECT_EQ(estimator.lastUs(), 3 * INTERVAL_US + 2050);
+}
+
+TEST(ClockEstimatorTest, StartsOverWhenTheHostClockIsSet) {
+  ClockEstimator estimator;
+  for (int64_t i = 0; i < 20; i++) {
+    int64_t t = i * INTERVAL_US;
+    estimator.add({t, HOST_OFFSET_US + t + 1000, HOST_OFFSET_US + t + 1050,
+                   t + 2050});
+  }
+  // a second later than it was, a quick exchange can't be off that far
+  int64_t t = 20 * INTERVAL_US;
+  int64_t setUs = HOST_OFFSET_US + 1000000;
+  estimator.add({t, setUs + t + 1000, setUs + t + 1050, t + 2050});
+  EXPECT_FALSE(estimator.synced());
+  for (int64_t i = 21; i < 24; i++) {
+    t = i * INTERVAL_US;
+    estimator.add({t, setUs + t + 1000, setUs + t + 1050, t + 2050});
+  }
+  EXPECT_TRUE(estimator.synced());
+  EXPECT_EQ(estimator.offsetUs(t), setUs);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <ArduinoJson.h>
+#include "data/CommandManager/CommandManager.hpp"
+
+namespace {
+  class CommandManagerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+      Hal::Host::reset();
+      this->config.load();
+    }
+
+    void handle(const char* json) {
+      CommandsPayload payload;
+      ASSERT_FALSE(deserializeJson(payload.data, json)) << json;
+      this->commands.handleCommands(payload);
+    }
+
+    std::string stored(const char* key) {
+      Hal::Storage storage;
+      storage.begin("openiris", true);
+      return storage.getString(key, "");
+    }
+
+    ProjectConfig config{"openiris", "openiristracker"};
+    CommandManager commands{&config};
+  };
+}  // namespace
+
+TEST_F(CommandManagerTest, PingAnswersWithoutSaving) {
+  this->handle(R"({"commands": [{"command": "ping"}]})");
+  EXPECT_NE(Hal::Host::consoleOutput().find("PONG"), std::string::npos);
+  EXPECT_EQ(Hal::Host::restartRequested(), -1);
+}
+
+TEST_F(CommandManagerTest, SetWifiSavesAndRestarts) {
+  this->handle(R"({"commands": [{"command": "set_wifi", "data": {
+      "network_name": "home", "ssid": "Home", "password": "secret"}}]})");
+
+  ASSERT_EQ(this->config.getWifiConfigs().size(), 1u);
+  EXPECT_EQ(this->config.getWifiConfigs()[0].name, "home");
+  EXPECT_EQ(this->config.getWifiConfigs()[0].ssid, "Home");
+  EXPECT_EQ(this->stored("ssid0"), "Home");
+  EXPECT_EQ(this->stored("pass0"), "secret");
+  EXPECT_EQ(Hal::Host::restartRequested(), 2000);
+}
+
+TEST_F(CommandManagerTest, SetWifiWithoutAPasswordIsIgnored) {
+  this->handle(R"({"commands": [{"command": "set_wifi", "data": {
+      "ssid": "Home"}}]})");
+  EXPECT_TRUE(this->config.getWifiConfigs().empty());
+  EXPECT_EQ(Hal::Host::restartRequested(), -1);
+}
+
+TEST_F(CommandManagerTest, SetMdns) {
+  this->handle(R"({"commands": [{"command": "set_mdns", "data": {
+      "hostname": ""}}]})");
+  EXPECT_EQ(Hal::Host::restartRequested(), -1);
+
+  this->handle(R"({"commands": [{"command": "set_mdns", "data": {
+      "hostname": "lefteye"}}]})");
+  EXPECT_EQ(this->config.getMDNSConfig().hostname, "lefteye");
+  EXPECT_EQ(this->stored("hostname"), "lefteye");
+  EXPECT_EQ(Hal::Host::restartRequested(), 2000);
+}
+
+TEST_F(CommandManagerTest, UnknownAndMalformedCommandsAreIgnored) {
+  this->handle(R"({"command": "ping"})");
+  this->handle(R"({"commands": [{"command": "reboot"}, {"data": {}},
+      {"command": "set_wifi"}]})");
+  EXPECT_EQ(Hal::Host::consoleOutput(), "");
+  EXPECT_EQ(Hal::Host::restartRequested(), -1);
+}
+
+TEST_F(CommandManagerTest, SeveralCommandsInOnePayload) {
+  this->handle(R"({"commands": [
+      {"command": "ping"},
+      {"command": "set_mdns", "data": {"hostname": "righteye"}},
+      {"command": "set_wifi", "data": {"ssid": "Home", "password": "pw"}}]})");
+  EXPECT_NE(Hal::Host::consoleOutput().find("PONG"), std::string::npos);
+  EXPECT_EQ(this->config.getMDNSConfig().hostname, "righteye");
+  EXPECT_EQ(this->config.getWifiConfigs()[0].name, "main");
+  EXPECT_EQ(Hal::Host::restartRequested(), 2000);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include "hal/syntheticCamera.hpp"
+#include "io/camera/frameSync.hpp"
+
+namespace {
+  //! slots a little slower than the cameras, they can only be stretched
+  constexpr int64_t EPOCH_US = 1000;
+  constexpr uint32_t PERIOD_US = 1000000 / 58;
+  //! where the host's clock is, as ClockSync would put it
+  constexpr int64_t HOST_OFFSET_US = 1700000000000000;
+
+  Hal::SyntheticCamera::Config_t cameraConfig(uint32_t lineUs,
+                                              int32_t clockPpm,
+                                              uint32_t seed) {
+    Hal::SyntheticCamera::Config_t config = {
+        64, 64, 60, Hal::SyntheticCamera::Jitter_None, 0, 1500, 0, seed};
+    config.lineUs = lineUs;
+    config.clockPpm = clockPpm;
+    return config;
+  }
+
+  //! a camera and the FrameSync steering it, what the stream server does
+  struct Eye_t {
+    explicit Eye_t(const Hal::SyntheticCamera::Config_t& config)
+        : camera(config) {
+      this->sync.setSchedule(EPOCH_US + HOST_OFFSET_US, PERIOD_US);
+    }
+
+    void capture() {
+      Hal::Frame_t frame;
+      ASSERT_TRUE(this->camera.acquire(frame));
+      this->frames++;
+      int64_t hostUs = frame.timestampUs + HOST_OFFSET_US;
+      FrameSync::Result_t result = this->sync.onFrame(frame.timestampUs, hostUs);
+      if (result.applyLines) {
+        this->lines.push_back(result.extraLines);
+        if (this->obeys && !this->camera.setExtraLines(result.extraLines))
+          this->sync.unsupported();
+      }
+      if (this->sync.state() == FrameSync::State_Locked && !this->lockedAfter)
+        this->lockedAfter = this->frames;
+      if (this->lockedAfter && result.seq >= 0)
+        this->slots[result.seq] = hostUs;
+      this->camera.release(frame);
+    }
+
+    Hal::SyntheticCamera camera;
+    FrameSync sync;
+    //! a sensor that takes the lines but doesn't get slower when false
+    bool obeys = true;
+    uint32_t frames = 0;
+    //! frames until it first locked, 0 if it hasn't
+    uint32_t lockedAfter = 0;
+    //! every extraLines it was told
+    std::vector<uint16_t> lines;
+    //! when every slot's frame started since the lock, host clock
+    std::map<int32_t, int64_t> slots;
+  };
+
+  //! both cameras on the one virtual clock, frames in the order they come
+  void run(Eye_t& left, Eye_t& right, uint32_t frames) {
+    while (left.frames < frames || right.frames < frames) {
+      Eye_t& next = left.camera.nextFrameUs() <= right.camera.nextFrameUs()
+                        ? left
+                        : right;
+      Hal::Host::advance(
+          std::max<int64_t>(next.camera.nextFrameUs() - Hal::micros(), 0));
+      next.capture();
+    }
+  }
+
+  //! how far apart the frames of the slots both eyes took, sorted
+  std::vector<int64_t> skews(const Eye_t& left, const Eye_t& right) {
+    std::vector<int64_t> skews;
+    for (const auto& slot : left.slots) {
+      auto other = right.slots.find(slot.first);
+      if (other != right.slots.end())
+        skews.push_back(llabs(slot.second - other->second));
+    }
+    std::sort(skews.begin(), skews.end());
+    return skews;
+  }
+
+  class FrameSyncTest : public ::testing::Test {
+   protected:
+    void SetUp() override { Hal::Host::reset(); }
+  };
+}  // namespace
+
+TEST_F(FrameSyncTest, CalibratesTheLineBeforeSteering) {
+  Eye_t eye(cameraConfig(25, 0, 1));
+  EXPECT_EQ(eye.sync.state(), FrameSync::State_Calibrating);
+  // the sensor's own frames, then a few with the calibration lines
+  while (eye.lines.empty()) {
+    eye.capture();
+    EXPECT_EQ(eye.sync.state(), FrameSync::State_Calibrating);
+    ASSERT_LT(eye.frames, 30u);
+  }
+  EXPECT_EQ(eye.lines[0], 64u);
+  while (eye.sync.state() == FrameSync::State_Calibrating) {
+    eye.capture();
+    ASSERT_LT(eye.frames, 60u);
+  }
+  EXPECT_EQ(eye.sync.state(), FrameSync::State_Locking);
+}
+
+TEST_F(FrameSyncTest, LocksTwoCamerasToTheSameSlots) {
+  // different crystals and line times, both a little faster than the slots
+  Eye_t left(cameraConfig(25, 300, 1));
+  Eye_t right(cameraConfig(31, -250, 2));
+  run(left, right, 1000);
+
+  ASSERT_EQ(left.sync.state(), FrameSync::State_Locked);
+  ASSERT_EQ(right.sync.state(), FrameSync::State_Locked);
+  EXPECT_GT(left.lockedAfter, 0u);
+  EXPECT_LE(left.lockedAfter, 80u);
+  EXPECT_GT(right.lockedAfter, 0u);
+  EXPECT_LE(right.lockedAfter, 80u);
+
+  std::vector<int64_t> skew = skews(left, right);
+  ASSERT_GT(skew.size(), 800u);
+  EXPECT_LE(skew[skew.size() * 99 / 100], 100);
+}
+
+TEST_F(FrameSyncTest, StaysLockedThroughFrameJitter) {
+  auto leftConfig = cameraConfig(25, 300, 1);
+  auto rightConfig = cameraConfig(31, -250, 2);
+  for (auto* config : {&leftConfig, &rightConfig}) {
+    config->jitter = Hal::SyntheticCamera::Jitter_Uniform;
+    config->jitterUs = 300;
+  }
+  Eye_t left(leftConfig);
+  Eye_t right(rightConfig);
+  run(left, right, 1000);
+
+  EXPECT_GT(left.lockedAfter, 0u);
+  EXPECT_GT(right.lockedAfter, 0u);
+  std::vector<int64_t> skew = skews(left, right);
+  ASSERT_GT(skew.size(), 800u);
+  EXPECT_LE(skew[skew.size() * 99 / 100], 1000);
+}
+
+TEST_F(FrameSyncTest, GivesUpOnASensorThatDoesNotStretch) {
+  Eye_t eye(cameraConfig(25, 0, 1));
+  eye.obeys = false;
+  while (eye.sync.state() != FrameSync::State_Unsupported) {
+    eye.capture();
+    ASSERT_LT(eye.frames, 60u);
+  }
+  // back to its own length, and the frames are still numbered
+  EXPECT_EQ(eye.lines.back(), 0u);
+  Hal::Frame_t frame;
+  ASSERT_TRUE(eye.camera.acquire(frame));
+  FrameSync::Result_t result =
+      eye.sync.onFrame(frame.timestampUs, frame.timestampUs + HOST_OFFSET_US);
+  eye.camera.release(frame);
+  EXPECT_GE(result.seq, 0);
+  EXPECT_FALSE(result.applyLines);
+}
+
+TEST_F(FrameSyncTest, FramesGoBackToTheirOwnLengthWithoutSlots) {
+  Eye_t left(cameraConfig(25, 300, 1));
+  Eye_t right(cameraConfig(31, -250, 2));
+  run(left, right, 200);
+  ASSERT_EQ(left.sync.state(), FrameSync::State_Locked);
+
+  left.sync.clearSchedule();
+  EXPECT_EQ(left.sync.state(), FrameSync::State_Free);
+  left.capture();
+  EXPECT_EQ(left.lines.back(), 0u);
+  // a new schedule needs no new calibration
+  left.sync.setSchedule(EPOCH_US + HOST_OFFSET_US + 5000, PERIOD_US);
+  EXPECT_EQ(left.sync.state(), FrameSync::State_Locking);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
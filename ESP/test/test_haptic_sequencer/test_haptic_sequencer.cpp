@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "hal/hal.hpp"
+#include "network/HapticEngine/HapticPacket.hpp"
+#include "network/HapticEngine/HapticSequencer.hpp"
+
+namespace {
+  constexpr int64_t MS = 1000;
+  //! HAPTIC_SEQUENCER_TICK_MS, what the engine's timer ticks with
+  constexpr uint32_t TICK_MS = 5;
+
+  struct Level_t {
+    int64_t us;
+    uint8_t motor;
+    uint16_t level;
+  };
+
+  //! the motor PWM, noting every level and when it was written
+  class RecordingSink : public HapticPwmSink {
+   public:
+    void setLevel(uint8_t motor, uint16_t level) override {
+      this->levels.push_back({Hal::micros(), motor, level});
+    }
+
+    //! the levels one motor was given, in order
+    std::vector<uint16_t> of(uint8_t motor) const {
+      std::vector<uint16_t> levels;
+      for (const Level_t& level : this->levels) {
+        if (level.motor == motor)
+          levels.push_back(level.level);
+      }
+      return levels;
+    }
+
+    std::vector<Level_t> levels;
+  };
+
+  //! a HapticSequencer on a Hal::Timer, the way HapticEngine drives it
+  struct Driver {
+    Driver() { this->timer.begin(&Driver::onTimer, this, "haptic_test"); }
+
+    void play(uint8_t preset, uint8_t intensity, uint16_t motorMask) {
+      if (this->sequencer.play(preset, intensity, motorMask) && !this->running) {
+        this->sequencer.tick(0);
+        this->timer.startOnce(TICK_MS * MS);
+        this->running = true;
+      }
+    }
+
+    static void onTimer(void* arg) {
+      auto* self = static_cast<Driver*>(arg);
+      if (self->sequencer.tick(TICK_MS))
+        self->timer.startOnce(TICK_MS * MS);
+      else
+        self->running = false;
+    }
+
+    RecordingSink sink;
+    HapticSequencer sequencer{sink};
+    Hal::Timer timer;
+    bool running = false;
+  };
+
+  uint32_t durationMs(const HapticEffects::Preset_t& preset) {
+    uint32_t duration = 0;
+    for (uint8_t i = 0; i < preset.length; i++)
+      duration += preset.segments[i].durationMs;
+    return duration;
+  }
+
+  std::vector<uint8_t> header(uint8_t type, uint32_t sequence) {
+    return {'O', 'H', HAPTIC_PACKET_VERSION, type,
+            (uint8_t)sequence, (uint8_t)(sequence >> 8),
+            (uint8_t)(sequence >> 16), (uint8_t)(sequence >> 24)};
+  }
+
+  class HapticSequencerTest : public ::testing::Test {
+   protected:
+    void SetUp() override { Hal::Host::reset(); }
+  };
+}  // namespace
+
+TEST_F(HapticSequencerTest, PlaysATapOnTheClock) {
+  Driver driver;
+  driver.play(HapticEffects::findPreset("tap"), 100, 0b1);
+  Hal::Host::advance(200 * MS);
+
+  // ramp up over 10ms, hold for 30, ramp down over 40, a level every tick
+  std::vector<Level_t> expected = {
+      {0, 0, 0},           {5 * MS, 0, 500},  {10 * MS, 0, 1000},
+      {15 * MS, 0, 1000},  {20 * MS, 0, 1000}, {25 * MS, 0, 1000},
+      {30 * MS, 0, 1000},  {35 * MS, 0, 1000}, {40 * MS, 0, 1000},
+      {45 * MS, 0, 875},   {50 * MS, 0, 750},  {55 * MS, 0, 625},
+      {60 * MS, 0, 500},   {65 * MS, 0, 375},  {70 * MS, 0, 250},
+      {75 * MS, 0, 125},   {80 * MS, 0, 0},
+  };
+  ASSERT_EQ(driver.sink.levels.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    SCOPED_TRACE(i);
+    EXPECT_EQ(driver.sink.levels[i].us, expected[i].us);
+    EXPECT_EQ(driver.sink.levels[i].motor, expected[i].motor);
+    EXPECT_EQ(driver.sink.levels[i].level, expected[i].level);
+  }
+  EXPECT_FALSE(driver.running);
+  EXPECT_FALSE(driver.sequencer.isActive());
+}
+
+TEST_F(HapticSequencerTest, EveryPresetRunsItsLengthAndEndsSilent) {
+  for (size_t id = 0; id < HapticEffects::presetCount; id++) {
+    const HapticEffects::Preset_t& preset = HapticEffects::presets[id];
+    SCOPED_TRACE(preset.name);
+    Hal::Host::reset();
+    Driver driver;
+    driver.play(id, 100, 0b1);
+    Hal::Host::advance(5000 * MS);
+
+    ASSERT_FALSE(driver.sink.levels.empty());
+    const Level_t& last = driver.sink.levels.back();
+    EXPECT_EQ(last.level, 0);
+    // the segments are whole ticks long, the motor is off right at the end
+    EXPECT_EQ(last.us, (int64_t)durationMs(preset) * MS);
+    uint16_t peak = 0;
+    for (const Level_t& level : driver.sink.levels)
+      peak = std::max(peak, level.level);
+    EXPECT_EQ(peak, HAPTIC_LEVEL_MAX);
+    EXPECT_EQ(HapticEffects::findPreset(preset.name), (int)id);
+  }
+  EXPECT_EQ(HapticEffects::findPreset("nothing"), -1);
+}
+
+TEST_F(HapticSequencerTest, IntensityScalesTheWholeEffect) {
+  Driver driver;
+  driver.play(HapticEffects::findPreset("buzz"), 40, 0b1);
+  Hal::Host::advance(1000 * MS);
+  std::vector<uint16_t> levels = driver.sink.of(0);
+  ASSERT_FALSE(levels.empty());
+  for (uint16_t level : levels)
+    EXPECT_TRUE(level == 0 || level == 400) << level;
+  EXPECT_EQ(levels.front(), 400);
+
+  // more than 100 percent is full intensity
+  Hal::Host::reset();
+  Driver full;
+  full.play(HapticEffects::findPreset("buzz"), 250, 0b1);
+  Hal::Host::advance(1000 * MS);
+  EXPECT_EQ(full.sink.of(0).front(), HAPTIC_LEVEL_MAX);
+}
+
+TEST_F(HapticSequencerTest, PlaysOnEveryMotorOfTheMask) {
+  Driver driver;
+  driver.play(HapticEffects::findPreset("tap"), 100, 0b1010);
+  Hal::Host::advance(200 * MS);
+  EXPECT_TRUE(driver.sink.of(0).empty());
+  EXPECT_TRUE(driver.sink.of(2).empty());
+  EXPECT_EQ(driver.sink.of(1), driver.sink.of(3));
+  EXPECT_EQ(driver.sink.of(1).size(), 17u);
+}
+
+TEST_F(HapticSequencerTest, RejectsAnUnknownPreset) {
+  Driver driver;
+  EXPECT_FALSE(driver.sequencer.play(HapticEffects::presetCount, 100, 0b1));
+  EXPECT_FALSE(driver.sequencer.isPlaying(0));
+}
+
+TEST_F(HapticSequencerTest, StopSilencesOnlyTheMask) {
+  Driver driver;
+  driver.play(HapticEffects::findPreset("swell"), 100, 0b101);
+  Hal::Host::advance(100 * MS);
+  driver.sink.levels.clear();
+
+  driver.sequencer.stop(0b001);
+  ASSERT_EQ(driver.sink.levels.size(), 1u);
+  EXPECT_EQ(driver.sink.levels[0].motor, 0);
+  EXPECT_EQ(driver.sink.levels[0].level, 0);
+  EXPECT_FALSE(driver.sequencer.isPlaying(0));
+  EXPECT_TRUE(driver.sequencer.isPlaying(2));
+
+  // motor 0 gets nothing more, motor 2 plays on
+  Hal::Host::advance(100 * MS);
+  EXPECT_EQ(driver.sink.of(0).size(), 1u);
+  EXPECT_GT(driver.sink.of(2).size(), 10u);
+
+  // a motor that plays nothing isn't written
+  driver.sink.levels.clear();
+  driver.sequencer.stop(0b010);
+  EXPECT_TRUE(driver.sink.levels.empty());
+}
+
+TEST_F(HapticSequencerTest, StrengthsCancelAnEffect) {
+  Driver driver;
+  driver.play(HapticEffects::findPreset("swell"), 100, 0b11);
+  Hal::Host::advance(100 * MS);
+  driver.sink.levels.clear();
+
+  const uint8_t strengths[] = {30};
+  driver.sequencer.setStrengths(strengths, 1);
+  ASSERT_EQ(driver.sink.levels.size(), 1u);
+  EXPECT_EQ(driver.sink.levels[0].motor, 0);
+  EXPECT_EQ(driver.sink.levels[0].level, 300);
+  EXPECT_FALSE(driver.sequencer.isPlaying(0));
+  EXPECT_TRUE(driver.sequencer.isPlaying(1));
+
+  // the effect doesn't come back on motor 0, the strength stays
+  Hal::Host::advance(2000 * MS);
+  EXPECT_EQ(driver.sink.of(0), std::vector<uint16_t>({300}));
+  EXPECT_FALSE(driver.sequencer.isActive());
+}
+
+TEST_F(HapticSequencerTest, StrengthsOnlyWriteWhatChanged) {
+  RecordingSink sink;
+  HapticSequencer sequencer(sink);
+  const uint8_t first[] = {50, 0, 200};
+  sequencer.setStrengths(first, 3);
+  // motor 1 was off already, more than 100 percent is full strength
+  ASSERT_EQ(sink.levels.size(), 2u);
+  EXPECT_EQ(sink.of(0), std::vector<uint16_t>({500}));
+  EXPECT_EQ(sink.of(2), std::vector<uint16_t>({HAPTIC_LEVEL_MAX}));
+
+  sink.levels.clear();
+  const uint8_t second[] = {50, 10, 100};
+  sequencer.setStrengths(second, 3);
+  ASSERT_EQ(sink.levels.size(), 1u);
+  EXPECT_EQ(sink.of(1), std::vector<uint16_t>({100}));
+
+  // the same strength after an effect is written again, the effect moved
+  // the motor
+  sink.levels.clear();
+  sequencer.play(HapticEffects::findPreset("tap"), 100, 0b1);
+  sequencer.tick(20);
+  sequencer.setStrengths(second, 1);
+  EXPECT_EQ(sink.of(0), std::vector<uint16_t>({HAPTIC_LEVEL_MAX, 500}));
+}
+
+TEST_F(HapticSequencerTest, ParsesEveryPacketType) {
+  HapticPacket_t packet;
+  uint8_t strengths[] = {10, 20, 30};
+  uint8_t buffer[32];
+  size_t len = HapticPacket::build(buffer, sizeof(buffer), 0x01020304, strengths, 3);
+  ASSERT_EQ(len, 12u);
+  ASSERT_EQ(HapticPacket::parse(buffer, len, packet), HapticPacket_Ok);
+  EXPECT_EQ(packet.type, HapticPacket_Strengths);
+  EXPECT_EQ(packet.sequence, 0x01020304u);
+  ASSERT_EQ(packet.count, 3);
+  EXPECT_EQ(packet.strengths[2], 30);
+  EXPECT_EQ(HapticPacket::build(buffer, 11, 1, strengths, 3), 0u);
+
+  std::vector<uint8_t> play = header(HapticPacket_Play, 7);
+  play.insert(play.end(), {3, 60, 0x05, 0x80});
+  ASSERT_EQ(HapticPacket::parse(play.data(), play.size(), packet), HapticPacket_Ok);
+  EXPECT_EQ(packet.type, HapticPacket_Play);
+  EXPECT_EQ(packet.preset, 3);
+  EXPECT_EQ(packet.intensity, 60);
+  EXPECT_EQ(packet.motorMask, 0x8005);
+
+  std::vector<uint8_t> stop = header(HapticPacket_Stop, 8);
+  stop.insert(stop.end(), {0xff, 0x00});
+  ASSERT_EQ(HapticPacket::parse(stop.data(), stop.size(), packet), HapticPacket_Ok);
+  EXPECT_EQ(packet.type, HapticPacket_Stop);
+  EXPECT_EQ(packet.motorMask, 0x00ff);
+}
+
+TEST_F(HapticSequencerTest, ClampsThePlayIntensity) {
+  HapticPacket_t packet;
+  for (uint8_t intensity : {101, 200, 255}) {
+    SCOPED_TRACE(intensity);
+    std::vector<uint8_t> play = header(HapticPacket_Play, 1);
+    play.insert(play.end(), {0, intensity, 0x01, 0x00});
+    ASSERT_EQ(HapticPacket::parse(play.data(), play.size(), packet), HapticPacket_Ok);
+    EXPECT_EQ(packet.intensity, 100);
+  }
+}
+
+TEST_F(HapticSequencerTest, RejectsMalformedPackets) {
+  HapticPacket_t packet;
+  std::vector<uint8_t> data = header(HapticPacket_Strengths, 1);
+  EXPECT_EQ(HapticPacket::parse(data.data(), 7, packet), HapticPacket_TooShort);
+  EXPECT_EQ(HapticPacket::parse(data.data(), data.size(), packet),
+            HapticPacket_Truncated);
+  // says 4 motors, carries 3
+  data.insert(data.end(), {4, 10, 20, 30});
+  EXPECT_EQ(HapticPacket::parse(data.data(), data.size(), packet),
+            HapticPacket_Truncated);
+
+  std::vector<uint8_t> play = header(HapticPacket_Play, 1);
+  play.insert(play.end(), {0, 100, 0x01});
+  EXPECT_EQ(HapticPacket::parse(play.data(), play.size(), packet),
+            HapticPacket_Truncated);
+  std::vector<uint8_t> stop = header(HapticPacket_Stop, 1);
+  stop.push_back(0x01);
+  EXPECT_EQ(HapticPacket::parse(stop.data(), stop.size(), packet),
+            HapticPacket_Truncated);
+
+  std::vector<uint8_t> other = header(3, 1);
+  EXPECT_EQ(HapticPacket::parse(other.data(), other.size(), packet),
+            HapticPacket_UnknownType);
+  other[2] = HAPTIC_PACKET_VERSION + 1;
+  EXPECT_EQ(HapticPacket::parse(other.data(), other.size(), packet),
+            HapticPacket_BadVersion);
+  other[0] = 'X';
+  EXPECT_EQ(HapticPacket::parse(other.data(), other.size(), packet),
+            HapticPacket_BadMagic);
+}
+
+TEST_F(HapticSequencerTest, SequenceFilterDropsStalePackets) {
+  HapticPacket::SequenceFilter filter;
+  EXPECT_TRUE(filter.accept(100, 0));
+  EXPECT_FALSE(filter.accept(100, 10));
+  EXPECT_FALSE(filter.accept(99, 20));
+  EXPECT_TRUE(filter.accept(102, 30));
+}
+
+TEST_F(HapticSequencerTest, SequenceFilterWrapsAround) {
+  HapticPacket::SequenceFilter filter;
+  EXPECT_TRUE(filter.accept(0xfffffffe, 0));
+  EXPECT_TRUE(filter.accept(0xffffffff, 10));
+  EXPECT_TRUE(filter.accept(1, 20));
+  EXPECT_FALSE(filter.accept(0xffffffff, 30));
+  EXPECT_TRUE(filter.accept(2, 40));
+}
+
+TEST_F(HapticSequencerTest, SequenceFilterStartsOverAfterASecond) {
+  HapticPacket::SequenceFilter filter;
+  EXPECT_TRUE(filter.accept(5000, 1000));
+  // a restarted sender counts from the start again
+  EXPECT_FALSE(filter.accept(1, 1000 + HAPTIC_SEQUENCE_RESET_MS - 1));
+  EXPECT_TRUE(filter.accept(1, 1000 + HAPTIC_SEQUENCE_RESET_MS));
+  EXPECT_FALSE(filter.accept(1, 1000 + HAPTIC_SEQUENCE_RESET_MS + 5));
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
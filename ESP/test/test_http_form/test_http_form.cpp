@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "network/HttpServer/httpForm.hpp"
+
+namespace {
+  std::string str(Helpers::string_view view) {
+    return std::string(view.data(), view.size());
+  }
+
+  std::vector<std::pair<std::string, std::string>> parse(std::string text) {
+    HttpForm::Param_t params[8];
+    size_t count = HttpForm::parse(&text[0], text.size(), params, 8);
+    std::vector<std::pair<std::string, std::string>> result;
+    for (size_t i = 0; i < count; i++)
+      result.emplace_back(str(params[i].name), str(params[i].value));
+    return result;
+  }
+
+  //! writes down what the reader hands it
+  class Recorder : public HttpForm::MultipartReader::Handler {
+   public:
+    struct Part_t {
+      std::string name;
+      std::string filename;
+      std::string data;
+      bool ended = false;
+    };
+
+    bool onPart(const HttpForm::MultipartReader::Part_t& part) override {
+      this->parts.push_back({part.name, part.filename, "", false});
+      return true;
+    }
+    bool onData(const uint8_t* data, size_t len) override {
+      EXPECT_FALSE(this->parts.empty());
+      EXPECT_GT(len, 0u);
+      this->parts.back().data.append((const char*)data, len);
+      return this->maxData < 0 ||
+             this->parts.back().data.size() <= (size_t)this->maxData;
+    }
+    bool onPartEnd() override {
+      this->parts.back().ended = true;
+      return true;
+    }
+
+    std::vector<Part_t> parts;
+    //! stops the reader once a part grew beyond it
+    int maxData = -1;
+  };
+
+  const char* BOUNDARY = "----WebKitFormBoundary7MA4YWxkTrZu0gW";
+
+  std::string part(const std::string& disposition, const std::string& data) {
+    return std::string("--") + BOUNDARY +
+           "\r\n"
+           "Content-Disposition: form-data; " +
+           disposition +
+           "\r\n"
+           "Content-Type: application/octet-stream\r\n"
+           "\r\n" +
+           data + "\r\n";
+  }
+
+  std::string upload(const std::string& image) {
+    return part("name=\"MD5\"", "0123456789abcdef0123456789abcdef") +
+           part("name=\"firmware\"; filename=\"firmware\"", image) + "--" +
+           BOUNDARY + "--\r\n";
+  }
+
+  //! every byte sequence that looks like the start of the delimiter, and
+  //! some that almost are
+  std::string trickyImage() {
+    std::string image;
+    for (int i = 0; i < 256; i++)
+      image += (char)i;
+    image += "\r\n-";
+    image += "\r\r\n--";
+    image += std::string("\r\n--") + std::string(BOUNDARY).substr(0, 20);
+    image += "\r\n\r\n--x";
+    image += std::string(BOUNDARY) + "\r\n";
+    image += "\r";
+    return image;
+  }
+}  // namespace
+
+TEST(HttpForm, ParsesAQuery) {
+  auto params = parse("ssid=home&password=a%20b+c&channel=6");
+  ASSERT_EQ(params.size(), 3u);
+  EXPECT_EQ(params[0], std::make_pair(std::string("ssid"), std::string("home")));
+  EXPECT_EQ(params[1].second, "a b c");
+  EXPECT_EQ(params[2].second, "6");
+}
+
+TEST(HttpForm, DecodesEscapesInNamesAndValues) {
+  auto params = parse("a%5Bb%5D=%26%3D%25&pct=100%25");
+  ASSERT_EQ(params.size(), 2u);
+  EXPECT_EQ(params[0].first, "a[b]");
+  EXPECT_EQ(params[0].second, "&=%");
+  EXPECT_EQ(params[1].second, "100%");
+}
+
+TEST(HttpForm, KeepsBrokenEscapes) {
+  auto params = parse("a=%zz&b=%4&c=%");
+  ASSERT_EQ(params.size(), 3u);
+  EXPECT_EQ(params[0].second, "%zz");
+  EXPECT_EQ(params[1].second, "%4");
+  EXPECT_EQ(params[2].second, "%");
+}
+
+TEST(HttpForm, EmptyPairsAndMissingValues) {
+  auto params = parse("&&flag&name=&=value&");
+  ASSERT_EQ(params.size(), 3u);
+  EXPECT_EQ(params[0], std::make_pair(std::string("flag"), std::string()));
+  EXPECT_EQ(params[1], std::make_pair(std::string("name"), std::string()));
+  EXPECT_EQ(params[2], std::make_pair(std::string(), std::string("value")));
+  EXPECT_TRUE(parse("").empty());
+}
+
+TEST(HttpForm, DropsParamsBeyondTheLimit) {
+  std::string text = "a=1&b=2&c=3";
+  HttpForm::Param_t params[2];
+  ASSERT_EQ(HttpForm::parse(&text[0], text.size(), params, 2), 2u);
+  EXPECT_EQ(str(params[1].name), "b");
+}
+
+TEST(HttpForm, Boundary) {
+  EXPECT_EQ(str(HttpForm::boundary(
+                "multipart/form-data; boundary=----WebKitFormBoundaryAbC")),
+            "----WebKitFormBoundaryAbC");
+  EXPECT_EQ(str(HttpForm::boundary("multipart/form-data; BOUNDARY=\"a b\"; x=1")),
+            "a b");
+  EXPECT_TRUE(HttpForm::boundary("application/json").empty());
+}
+
+TEST(MultipartReader, ReadsFieldsAndAFile) {
+  std::string image = trickyImage();
+  std::string body = upload(image);
+  Recorder recorder;
+  HttpForm::MultipartReader reader(BOUNDARY, recorder);
+  ASSERT_TRUE(reader.feed((const uint8_t*)body.data(), body.size()));
+  EXPECT_TRUE(reader.done());
+
+  ASSERT_EQ(recorder.parts.size(), 2u);
+  EXPECT_EQ(recorder.parts[0].name, "MD5");
+  EXPECT_EQ(recorder.parts[0].filename, "");
+  EXPECT_EQ(recorder.parts[0].data, "0123456789abcdef0123456789abcdef");
+  EXPECT_TRUE(recorder.parts[0].ended);
+  EXPECT_EQ(recorder.parts[1].name, "firmware");
+  EXPECT_EQ(recorder.parts[1].filename, "firmware");
+  EXPECT_EQ(recorder.parts[1].data, image);
+  EXPECT_TRUE(recorder.parts[1].ended);
+}
+
+TEST(MultipartReader, ChunksOfAnySizeReadTheSame) {
+  std::string image = trickyImage();
+  std::string body = upload(image);
+  for (size_t chunk = 1; chunk <= 64; chunk++) {
+    Recorder recorder;
+    HttpForm::MultipartReader reader(BOUNDARY, recorder);
+    for (size_t i = 0; i < body.size(); i += chunk) {
+      ASSERT_TRUE(reader.feed((const uint8_t*)body.data() + i,
+                              std::min(chunk, body.size() - i)))
+          << "chunk " << chunk;
+    }
+    EXPECT_TRUE(reader.done()) << "chunk " << chunk;
+    ASSERT_EQ(recorder.parts.size(), 2u) << "chunk " << chunk;
+    EXPECT_EQ(recorder.parts[1].data, image) << "chunk " << chunk;
+  }
+}
+
+TEST(MultipartReader, SkipsThePreambleAndEpilogue) {
+  std::string body = "ignore me\r\n" + part("name=\"a\"", "1") + "--" +
+                     BOUNDARY + "--\r\nand me too";
+  Recorder recorder;
+  HttpForm::MultipartReader reader(BOUNDARY, recorder);
+  ASSERT_TRUE(reader.feed((const uint8_t*)body.data(), body.size()));
+  EXPECT_TRUE(reader.done());
+  ASSERT_EQ(recorder.parts.size(), 1u);
+  EXPECT_EQ(recorder.parts[0].data, "1");
+}
+
+TEST(MultipartReader, ACutOffBodyIsNotDone) {
+  std::string body = upload("image");
+  body.resize(body.size() - 8);
+  Recorder recorder;
+  HttpForm::MultipartReader reader(BOUNDARY, recorder);
+  EXPECT_TRUE(reader.feed((const uint8_t*)body.data(), body.size()));
+  EXPECT_FALSE(reader.done());
+  ASSERT_EQ(recorder.parts.size(), 2u);
+  EXPECT_FALSE(recorder.parts[1].ended);
+}
+
+TEST(MultipartReader, RefusesAnOverlongHeader) {
+  std::string body = std::string("--") + BOUNDARY + "\r\nX-Long: " +
+                     std::string(300, 'x') + "\r\n\r\ndata";
+  Recorder recorder;
+  HttpForm::MultipartReader reader(BOUNDARY, recorder);
+  EXPECT_FALSE(reader.feed((const uint8_t*)body.data(), body.size()));
+  EXPECT_TRUE(recorder.parts.empty());
+  // and stays that way
+  EXPECT_FALSE(reader.feed((const uint8_t*)"x", 1));
+}
+
+TEST(MultipartReader, RefusesGarbageAfterADelimiter) {
+  std::string body = std::string("--") + BOUNDARY + "xx";
+  Recorder recorder;
+  HttpForm::MultipartReader reader(BOUNDARY, recorder);
+  EXPECT_FALSE(reader.feed((const uint8_t*)body.data(), body.size()));
+}
+
+TEST(MultipartReader, RefusesABadBoundary) {
+  Recorder recorder;
+  HttpForm::MultipartReader empty("", recorder);
+  EXPECT_FALSE(empty.feed((const uint8_t*)"--\r\n", 4));
+  HttpForm::MultipartReader tooLong(std::string(71, 'b').c_str(), recorder);
+  EXPECT_FALSE(tooLong.feed((const uint8_t*)"--\r\n", 4));
+}
+
+TEST(MultipartReader, TheHandlerCanStopIt) {
+  std::string body = upload(std::string(1000, 'x'));
+  Recorder recorder;
+  recorder.maxData = 100;
+  HttpForm::MultipartReader reader(BOUNDARY, recorder);
+  bool ok = true;
+  for (size_t i = 0; i < body.size() && ok; i += 50)
+    ok = reader.feed((const uint8_t*)body.data() + i,
+                     std::min<size_t>(50, body.size() - i));
+  EXPECT_FALSE(ok);
+  EXPECT_FALSE(reader.done());
+  EXPECT_LE(recorder.parts.back().data.size(), 150u);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
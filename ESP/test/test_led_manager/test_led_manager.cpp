@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "io/LEDManager/LEDManager.hpp"
+
+namespace {
+  constexpr uint8_t LED_PIN = 4;
+  constexpr int64_t MS = 1000;
+
+  class LEDManagerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+      Hal::Host::reset();
+      ledStateManager.setState(LEDStates_e::_LedStateNone);
+    }
+  };
+}  // namespace
+
+TEST_F(LEDManagerTest, GoesIdleAfterTheNoneTimeline) {
+  LEDManager led(LED_PIN);
+  led.begin();
+  EXPECT_FALSE(Hal::Host::pinLevel(LED_PIN));
+
+  Hal::Host::advance(500 * MS);
+  uint32_t writes = Hal::Host::pinWrites(LED_PIN);
+  // idle, nothing moves however long we wait
+  Hal::Host::advance(60000 * MS);
+  EXPECT_EQ(Hal::Host::pinWrites(LED_PIN), writes);
+}
+
+TEST_F(LEDManagerTest, PostedStateWakesTheTimer) {
+  LEDManager led(LED_PIN);
+  led.begin();
+  Hal::Host::advance(1000 * MS);
+
+  led.postState(LEDStates_e::_WiFiState_Connecting);
+  Hal::Host::advance(0);
+  EXPECT_TRUE(Hal::Host::pinLevel(LED_PIN));
+  Hal::Host::advance(100 * MS - 1);
+  EXPECT_TRUE(Hal::Host::pinLevel(LED_PIN));
+  Hal::Host::advance(1);
+  EXPECT_FALSE(Hal::Host::pinLevel(LED_PIN));
+
+  // played once, then idle with the LED off
+  Hal::Host::advance(100 * MS);
+  uint32_t writes = Hal::Host::pinWrites(LED_PIN);
+  Hal::Host::advance(10000 * MS);
+  EXPECT_FALSE(Hal::Host::pinLevel(LED_PIN));
+  EXPECT_EQ(Hal::Host::pinWrites(LED_PIN), writes);
+}
+
+TEST_F(LEDManagerTest, PostingTheSameStateAgainDoesNothing) {
+  LEDManager led(LED_PIN);
+  led.begin();
+  Hal::Host::advance(1000 * MS);
+  uint32_t writes = Hal::Host::pinWrites(LED_PIN);
+
+  for (int i = 0; i < 100; i++)
+    led.postState(LEDStates_e::_LedStateNone);
+  Hal::Host::advance(1000 * MS);
+  EXPECT_EQ(Hal::Host::pinWrites(LED_PIN), writes);
+}
+
+TEST_F(LEDManagerTest, ErrorsRepeatUntilTheStateChanges) {
+  LEDManager led(LED_PIN);
+  led.begin();
+  led.postState(LEDStates_e::_Camera_Error);
+  Hal::Host::advance(500 * MS);
+
+  uint32_t writes = Hal::Host::pinWrites(LED_PIN);
+  Hal::Host::advance(20000 * MS);
+  EXPECT_TRUE(Hal::Host::pinLevel(LED_PIN));
+  EXPECT_EQ(Hal::Host::pinWrites(LED_PIN), writes + 4);
+
+  // the error step runs out before the new state shows
+  led.postState(LEDStates_e::_WiFiState_Connected);
+  Hal::Host::advance(5000 * MS);
+  EXPECT_TRUE(Hal::Host::pinLevel(LED_PIN));
+  Hal::Host::advance(100 * MS);
+  EXPECT_FALSE(Hal::Host::pinLevel(LED_PIN));
+  Hal::Host::advance(2000 * MS);
+  EXPECT_FALSE(Hal::Host::pinLevel(LED_PIN));
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
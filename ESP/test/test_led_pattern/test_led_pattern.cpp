@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+#include "hal/hal.hpp"
+#include "io/LEDManager/LEDPattern.hpp"
+
+namespace {
+  constexpr int64_t MS = 1000;
+
+  //! a Player on a Hal::Timer, the way LEDManager drives it, noting when
+  //! every step started and what it showed
+  struct Driver {
+    Driver() { this->timer.begin(&Driver::onTimer, this, "led_test"); }
+
+    void start(LEDStates_e state) {
+      this->state = state;
+      this->timer.startOnce(0);
+      Hal::Host::advance(0);
+    }
+
+    static void onTimer(void* arg) {
+      auto* self = static_cast<Driver*>(arg);
+      bool level;
+      uint32_t delay = self->player.advance(self->state, level);
+      self->steps.emplace_back(Hal::micros(), level);
+      if (delay)
+        self->timer.startOnce((uint64_t)delay * MS);
+      else
+        self->idle = true;
+    }
+
+    Hal::Timer timer;
+    LEDPattern::Player player;
+    LEDStates_e state = LEDStates_e::_LedStateNone;
+    std::vector<std::pair<int64_t, bool>> steps;
+    bool idle = false;
+  };
+
+  class LEDPatternTest : public ::testing::Test {
+   protected:
+    void SetUp() override { Hal::Host::reset(); }
+  };
+}  // namespace
+
+TEST_F(LEDPatternTest, WifiConnectingOnTheClock) {
+  Driver driver;
+  driver.start(LEDStates_e::_WiFiState_Connecting);
+  Hal::Host::advance(10000 * MS);
+
+  // the none step the player boots into, then ON(100) OFF(100), then idle
+  std::vector<std::pair<int64_t, bool>> expected = {
+      {0, false}, {500 * MS, true}, {600 * MS, false}, {700 * MS, false}};
+  EXPECT_EQ(driver.steps, expected);
+  EXPECT_TRUE(driver.idle);
+}
+
+TEST_F(LEDPatternTest, EveryTimelineKeepsItsStepTimes) {
+  for (size_t state = 1; state < LEDPattern::timelineCount; state++) {
+    const LEDPattern::Timeline_t& timeline = LEDPattern::timelines[state];
+    if (timeline.keepAlive)
+      continue;
+    Hal::Host::reset();
+    Driver driver;
+    driver.start((LEDStates_e)state);
+    Hal::Host::advance(60000 * MS);
+
+    ASSERT_EQ(driver.steps.size(), 1u + timeline.length + 1) << state;
+    int64_t start = 500 * MS;
+    for (size_t i = 0; i < timeline.length; i++) {
+      EXPECT_EQ(driver.steps[i + 1].first, start) << state << " step " << i;
+      EXPECT_EQ(driver.steps[i + 1].second,
+                LEDPattern::level(timeline.steps[i]))
+          << state << " step " << i;
+      start += LEDPattern::duration(timeline.steps[i]) * MS;
+    }
+    // off once it's over
+    EXPECT_EQ(driver.steps.back(), std::make_pair(start, false)) << state;
+    EXPECT_TRUE(driver.idle) << state;
+  }
+}
+
+TEST_F(LEDPatternTest, KeepAliveTimelinesRepeat) {
+  Driver driver;
+  driver.start(LEDStates_e::_Camera_Error);
+  Hal::Host::advance(20500 * MS);
+
+  ASSERT_EQ(driver.steps.size(), 6u);
+  for (size_t i = 1; i < driver.steps.size(); i++) {
+    EXPECT_EQ(driver.steps[i].first, 500 * MS + (int64_t)(i - 1) * 5000 * MS);
+    EXPECT_TRUE(driver.steps[i].second);
+  }
+  EXPECT_FALSE(driver.idle);
+}
+
+TEST_F(LEDPatternTest, NewStateWaitsForTheTimelineToFinish) {
+  Driver driver;
+  driver.start(LEDStates_e::_Improv_Start);
+  Hal::Host::advance(600 * MS);
+  driver.state = LEDStates_e::_WiFiState_Connecting;
+  Hal::Host::advance(10000 * MS);
+
+  // improvStart is 1900ms long and started at 500ms
+  std::vector<std::pair<int64_t, bool>> tail(driver.steps.end() - 3,
+                                             driver.steps.end());
+  std::vector<std::pair<int64_t, bool>> expected = {
+      {2400 * MS, true}, {2500 * MS, false}, {2600 * MS, false}};
+  EXPECT_EQ(tail, expected);
+}
+
+TEST_F(LEDPatternTest, AnErrorCutsAKeepAliveTimelineShort) {
+  Driver driver;
+  driver.start(LEDStates_e::_Camera_Error);
+  Hal::Host::advance(1000 * MS);
+  // another keepAlive state takes over once the running step ends
+  driver.state = LEDStates_e::_WebServerState_Error;
+  Hal::Host::advance(5000 * MS);
+
+  ASSERT_GE(driver.steps.size(), 3u);
+  EXPECT_EQ(driver.steps[2], std::make_pair(5500 * MS, true));
+  EXPECT_EQ(driver.player.currentState(),
+            LEDStates_e::_WebServerState_Error);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
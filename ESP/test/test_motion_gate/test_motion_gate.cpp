@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "vision/motionGate.hpp"
+
+namespace {
+  constexpr uint16_t WIDTH = 160;
+  constexpr uint16_t HEIGHT = 120;
+  //! 60 fps
+  constexpr int64_t FRAME_US = 16667;
+
+  /**
+   * @brief Eye frames of a synthetic sequence
+   * @details A dark pupil on a lighter iris, with a level or two of sensor
+   * noise in every pixel, the same noise for the same seed
+   */
+  class Sequence {
+   public:
+    explicit Sequence(uint32_t seed = 1) : state(seed) {}
+
+    const std::vector<uint8_t>& draw(float pupilX,
+                                     float pupilY,
+                                     int brightness = 0) {
+      for (uint16_t y = 0; y < HEIGHT; y++) {
+        for (uint16_t x = 0; x < WIDTH; x++) {
+          float dx = x - pupilX, dy = y - pupilY;
+          int level = dx * dx + dy * dy < 20 * 20 ? 30 : 140;
+          // -1 to 1
+          this->state = this->state * 1103515245 + 12345;
+          level += (int)((this->state >> 16) % 3) - 1 + brightness;
+          this->luma[y * WIDTH + x] = std::max(0, std::min(255, level));
+        }
+      }
+      return this->luma;
+    }
+
+   private:
+    uint32_t state;
+    std::vector<uint8_t> luma = std::vector<uint8_t>(WIDTH * HEIGHT);
+  };
+
+  MotionGate::Result_t feed(MotionGate& gate,
+                            const std::vector<uint8_t>& luma,
+                            int64_t timestampUs) {
+    return gate.onFrame(luma.data(), WIDTH, HEIGHT, timestampUs);
+  }
+}  // namespace
+
+TEST(MotionGateTest, SendsTheFirstFrame) {
+  MotionGate gate;
+  Sequence sequence;
+  MotionGate::Result_t result = feed(gate, sequence.draw(80, 60), 0);
+  EXPECT_TRUE(result.send);
+  EXPECT_TRUE(result.moving);
+  EXPECT_EQ(result.difference, -1);
+}
+
+TEST(MotionGateTest, SendsEveryFrameOfAMovingEye) {
+  MotionGate gate;
+  Sequence sequence;
+  // a saccade back and forth, a few pixels a frame
+  for (int i = 0; i < 120; i++) {
+    float x = 50 + (i % 30 < 15 ? i % 15 : 15 - i % 15) * 4;
+    MotionGate::Result_t result = feed(gate, sequence.draw(x, 60), i * FRAME_US);
+    SCOPED_TRACE(i);
+    EXPECT_TRUE(result.send);
+    EXPECT_TRUE(result.moving);
+  }
+}
+
+TEST(MotionGateTest, HoldsBackAStillEye) {
+  MotionGate::Config_t config;
+  MotionGate gate(config);
+  Sequence sequence;
+  int sent = 0;
+  for (int i = 0; i < 60; i++) {
+    MotionGate::Result_t result = feed(gate, sequence.draw(80, 60), i * FRAME_US);
+    SCOPED_TRACE(i);
+    // the noise stays under the threshold
+    if (i > 0) {
+      EXPECT_LT(result.difference, config.threshold);
+    }
+    // still only after stillFrames frames in a row
+    EXPECT_EQ(result.moving, i < (int)config.stillFrames);
+    sent += result.send;
+  }
+  // the first stillFrames frames, and one idle frame after half a second
+  EXPECT_EQ(sent, (int)config.stillFrames + 1);
+}
+
+TEST(MotionGateTest, ReleasesIdleFramesAtIdleFps) {
+  MotionGate::Config_t config;
+  config.idleFps = 4;
+  MotionGate gate(config);
+  Sequence sequence;
+  std::vector<int64_t> sentUs;
+  for (int i = 0; i < 600; i++) {
+    int64_t timestampUs = i * FRAME_US;
+    if (feed(gate, sequence.draw(80, 60), timestampUs).send)
+      sentUs.push_back(timestampUs);
+  }
+  // past the still frames, a frame every quarter second, on the first frame
+  // that's due
+  ASSERT_GT(sentUs.size(), config.stillFrames + 30);
+  for (size_t i = config.stillFrames + 1; i < sentUs.size(); i++) {
+    int64_t gapUs = sentUs[i] - sentUs[i - 1];
+    SCOPED_TRACE(i);
+    EXPECT_GE(gapUs, 250000);
+    EXPECT_LT(gapUs, 250000 + FRAME_US);
+  }
+}
+
+TEST(MotionGateTest, SendsNothingWhileStillWithoutIdleFps) {
+  MotionGate::Config_t config;
+  config.idleFps = 0;
+  MotionGate gate(config);
+  Sequence sequence;
+  int sent = 0;
+  for (int i = 0; i < 300; i++)
+    sent += feed(gate, sequence.draw(80, 60), i * FRAME_US).send;
+  EXPECT_EQ(sent, (int)config.stillFrames);
+}
+
+TEST(MotionGateTest, SendsAgainAsSoonAsTheEyeMoves) {
+  MotionGate gate;
+  Sequence sequence;
+  int i = 0;
+  for (; i < 30; i++)
+    feed(gate, sequence.draw(80, 60), i * FRAME_US);
+  EXPECT_FALSE(feed(gate, sequence.draw(80, 60), i++ * FRAME_US).send);
+  MotionGate::Result_t result = feed(gate, sequence.draw(100, 60), i * FRAME_US);
+  EXPECT_TRUE(result.send);
+  EXPECT_TRUE(result.moving);
+}
+
+TEST(MotionGateTest, ASlowDriftAddsUp) {
+  MotionGate gate;
+  Sequence sequence;
+  int i = 0;
+  for (; i < 30; i++)
+    feed(gate, sequence.draw(80, 60), i * FRAME_US);
+  // half a level a frame is below the threshold from frame to frame, not
+  // from the last frame sent
+  bool sent = false;
+  for (int step = 1; step <= 10 && !sent; step++, i++) {
+    MotionGate::Result_t result =
+        feed(gate, sequence.draw(80, 60, step / 2), i * FRAME_US);
+    sent = result.send && result.moving;
+  }
+  EXPECT_TRUE(sent);
+}
+
+TEST(MotionGateTest, StartsOverAtANewResolution) {
+  MotionGate gate;
+  Sequence sequence;
+  for (int i = 0; i < 30; i++)
+    feed(gate, sequence.draw(80, 60), i * FRAME_US);
+  // the same pixels read as a different size
+  const std::vector<uint8_t>& luma = sequence.draw(80, 60);
+  MotionGate::Result_t result =
+      gate.onFrame(luma.data(), WIDTH / 2, HEIGHT, 30 * FRAME_US);
+  EXPECT_TRUE(result.send);
+  EXPECT_EQ(result.difference, -1);
+}
+
+TEST(MotionGateTest, ResetSendsTheNextFrame) {
+  MotionGate gate;
+  Sequence sequence;
+  int i = 0;
+  for (; i < 30; i++)
+    feed(gate, sequence.draw(80, 60), i * FRAME_US);
+  gate.reset();
+  MotionGate::Result_t result = feed(gate, sequence.draw(80, 60), i * FRAME_US);
+  EXPECT_TRUE(result.send);
+  EXPECT_TRUE(result.moving);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,783 @@
+// Generated by tools/otafixtures.py, do not edit.
+#ifndef OTA_FIXTURES_H
+#define OTA_FIXTURES_H
+
+#include <stdint.h>
+
+//! the image as it lands in flash
+const uint8_t OTA_FIXTURE_IMAGE[] = {
+233,3,2,32,52,18,8,64,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,2,8,64,48,12,
+8,64,172,8,8,64,64,11,8,64,40,5,8,64,172,8,8,64,164,1,8,64,4,11,8,64,76,14,8,64,
+64,11,8,64,240,0,8,64,60,0,8,64,204,6,8,64,216,9,8,64,0,0,8,64,164,1,8,64,12,3,
+8,64,128,7,8,64,115,116,114,101,97,109,180,0,8,64,124,11,8,64,116,4,8,64,148,2,8,64,148,2,
+8,64,252,3,8,64,172,8,8,64,144,6,8,64,220,5,8,64,180,0,8,64,68,7,8,64,80,10,8,64,
+36,9,8,64,124,11,8,64,4,11,8,64,56,4,8,64,200,10,8,64,244,11,8,64,124,11,8,64,48,12,
+8,64,116,4,8,64,32,13,8,64,160,5,8,64,236,4,8,64,252,3,8,64,244,11,8,64,156,9,8,64,
+20,10,8,64,48,12,8,64,220,5,8,64,176,4,8,64,128,7,8,64,56,4,8,64,64,11,8,64,200,10,
+8,64,44,1,8,64,120,0,8,64,240,0,8,64,228,12,8,64,148,2,8,64,200,10,8,64,56,4,8,64,
+124,11,8,64,112,8,8,64,20,10,8,64,228,12,8,64,208,2,8,64,200,10,8,64,68,7,8,64,40,5,
+8,64,248,7,8,64,44,1,8,64,252,3,8,64,115,116,114,101,97,109,104,1,8,64,192,3,8,64,52,8,
+8,64,60,0,8,64,120,0,8,64,168,12,8,64,244,11,8,64,172,8,8,64,255,255,255,255,88,2,8,64,
+111,112,101,110,105,114,105,115,184,11,8,64,228,12,8,64,184,11,8,64,128,7,8,64,148,2,8,64,176,4,
+8,64,100,5,8,64,216,9,8,64,140,10,8,64,36,9,8,64,255,255,255,255,184,11,8,64,144,6,8,64,
+52,8,8,64,140,10,8,64,156,9,8,64,152,13,8,64,48,12,8,64,176,4,8,64,132,3,8,64,4,11,
+8,64,96,9,8,64,216,9,8,64,36,9,8,64,240,0,8,64,180,0,8,64,92,13,8,64,232,8,8,64,
+56,4,8,64,196,14,8,64,28,2,8,64,136,14,8,64,24,6,8,64,115,116,114,101,97,109,60,0,8,64,
+136,14,8,64,156,9,8,64,200,10,8,64,20,10,8,64,52,8,8,64,36,9,8,64,44,1,8,64,220,5,
+8,64,24,6,8,64,172,8,8,64,220,5,8,64,144,6,8,64,128,7,8,64,184,11,8,64,224,1,8,64,
+200,10,8,64,208,2,8,64,111,112,101,110,105,114,105,115,152,13,8,64,80,10,8,64,4,11,8,64,124,11,
+8,64,204,6,8,64,255,255,255,255,244,11,8,64,44,1,8,64,76,14,8,64,184,11,8,64,152,13,8,64,
+216,9,8,64,8,7,8,64,204,6,8,64,16,14,8,64,64,11,8,64,112,8,8,64,140,10,8,64,168,12,
+8,64,92,13,8,64,76,14,8,64,108,12,8,64,28,2,8,64,220,5,8,64,108,12,8,64,144,6,8,64,
+28,2,8,64,32,13,8,64,160,5,8,64,180,0,8,64,220,5,8,64,0,0,0,0,0,0,0,0,172,8,
+8,64,156,9,8,64,0,0,0,0,0,0,0,0,111,112,101,110,105,114,105,115,228,12,8,64,176,4,8,64,
+116,4,8,64,64,11,8,64,56,4,8,64,36,9,8,64,132,3,8,64,56,4,8,64,40,5,8,64,252,3,
+8,64,132,3,8,64,172,8,8,64,148,2,8,64,52,8,8,64,72,3,8,64,99,97,109,101,114,97,184,11,
+8,64,88,2,8,64,99,97,109,101,114,97,99,97,109,101,114,97,72,3,8,64,68,7,8,64,208,2,8,64,
+24,6,8,64,120,0,8,64,88,2,8,64,16,14,8,64,132,3,8,64,68,7,8,64,84,6,8,64,164,1,
+8,64,52,8,8,64,16,14,8,64,232,8,8,64,92,13,8,64,188,7,8,64,124,11,8,64,112,8,8,64,
+99,97,109,101,114,97,236,4,8,64,128,7,8,64,188,7,8,64,112,8,8,64,96,9,8,64,192,3,8,64,
+232,8,8,64,84,6,8,64,140,10,8,64,224,1,8,64,0,0,8,64,76,14,8,64,188,7,8,64,36,9,
+8,64,52,8,8,64,76,14,8,64,96,9,8,64,84,6,8,64,204,6,8,64,176,4,8,64,228,12,8,64,
+44,1,8,64,16,14,8,64,52,8,8,64,112,8,8,64,12,3,8,64,164,1,8,64,124,11,8,64,144,6,
+8,64,148,2,8,64,80,10,8,64,64,11,8,64,172,8,8,64,136,14,8,64,255,255,255,255,180,0,8,64,
+115,116,114,101,97,109,244,11,8,64,8,7,8,64,100,5,8,64,20,10,8,64,80,10,8,64,76,14,8,64,
+76,14,8,64,148,2,8,64,0,0,0,0,0,0,0,0,76,14,8,64,160,5,8,64,140,10,8,64,104,1,
+8,64,72,3,8,64,28,2,8,64,120,0,8,64,72,3,8,64,252,3,8,64,44,1,8,64,92,13,8,64,
+40,5,8,64,128,7,8,64,224,1,8,64,255,255,255,255,252,3,8,64,156,9,8,64,4,11,8,64,12,3,
+8,64,68,7,8,64,36,9,8,64,48,12,8,64,44,1,8,64,236,4,8,64,0,0,8,64,44,1,8,64,
+140,10,8,64,92,13,8,64,76,14,8,64,96,9,8,64,180,0,8,64,176,4,8,64,192,3,8,64,0,0,
+8,64,124,11,8,64,224,1,8,64,144,6,8,64,115,116,114,101,97,109,132,3,8,64,168,12,8,64,208,2,
+8,64,68,7,8,64,232,8,8,64,8,7,8,64,244,11,8,64,252,3,8,64,60,0,8,64,108,12,8,64,
+0,0,8,64,228,12,8,64,44,1,8,64,244,11,8,64,248,7,8,64,120,0,8,64,72,3,8,64,36,9,
+8,64,144,6,8,64,136,14,8,64,8,7,8,64,168,12,8,64,132,3,8,64,72,3,8,64,128,7,8,64,
+172,8,8,64,100,5,8,64,192,3,8,64,236,4,8,64,228,12,8,64,16,14,8,64,99,97,109,101,114,97,
+136,14,8,64,36,9,8,64,8,7,8,64,180,0,8,64,188,7,8,64,0,0,8,64,140,10,8,64,196,14,
+8,64,208,2,8,64,120,0,8,64,152,13,8,64,136,14,8,64,116,4,8,64,68,7,8,64,28,2,8,64,
+84,6,8,64,32,13,8,64,60,0,8,64,72,3,8,64,132,3,8,64,76,14,8,64,32,13,8,64,204,6,
+8,64,144,6,8,64,184,11,8,64,192,3,8,64,68,7,8,64,0,0,8,64,204,6,8,64,104,1,8,64,
+132,3,8,64,115,116,114,101,97,109,100,5,8,64,144,6,8,64,104,1,8,64,124,11,8,64,0,0,0,0,
+0,0,0,0,255,255,255,255,60,0,8,64,140,10,8,64,116,4,8,64,4,11,8,64,172,8,8,64,255,255,
+255,255,16,14,8,64,208,2,8,64,56,4,8,64,40,5,8,64,144,6,8,64,104,1,8,64,28,2,8,64,
+248,7,8,64,96,9,8,64,224,1,8,64,116,4,8,64,88,2,8,64,224,1,8,64,148,2,8,64,115,116,
+114,101,97,109,196,14,8,64,244,11,8,64,164,1,8,64,16,14,8,64,176,4,8,64,60,0,8,64,168,12,
+8,64,20,10,8,64,72,3,8,64,16,14,8,64,4,11,8,64,132,3,8,64,144,6,8,64,148,2,8,64,
+111,112,101,110,105,114,105,115,8,7,8,64,120,0,8,64,240,0,8,64,148,2,8,64,212,13,8,64,80,10,
+8,64,116,4,8,64,120,0,8,64,164,1,8,64,68,7,8,64,64,11,8,64,232,8,8,64,136,14,8,64,
+12,3,8,64,0,0,0,0,0,0,0,0,124,11,8,64,216,9,8,64,180,0,8,64,56,4,8,64,200,10,
+8,64,111,112,101,110,105,114,105,115,28,2,8,64,40,5,8,64,100,5,8,64,36,9,8,64,168,12,8,64,
+156,9,8,64,111,112,101,110,105,114,105,115,96,9,8,64,192,3,8,64,228,12,8,64,116,4,8,64,200,10,
+8,64,48,12,8,64,168,12,8,64,16,14,8,64,24,6,8,64,188,7,8,64,76,14,8,64,160,5,8,64,
+84,6,8,64,0,0,8,64,228,12,8,64,176,4,8,64,96,9,8,64,124,11,8,64,124,11,8,64,20,10,
+8,64,176,4,8,64,112,8,8,64,140,10,8,64,20,10,8,64,40,5,8,64,208,2,8,64,136,14,8,64,
+84,6,8,64,60,0,8,64,40,5,8,64,136,14,8,64,124,11,8,64,0,0,8,64,56,4,8,64,152,13,
+8,64,248,7,8,64,176,4,8,64,192,3,8,64,128,7,8,64,20,10,8,64,44,1,8,64,4,11,8,64,
+255,255,255,255,48,12,8,64,32,13,8,64,208,2,8,64,192,3,8,64,115,116,114,101,97,109,28,2,8,64,
+255,255,255,255,112,8,8,64,255,255,255,255,172,8,8,64,184,11,8,64,148,2,8,64,216,9,8,64,152,13,
+8,64,240,0,8,64,12,3,8,64,248,7,8,64,0,0,8,64,248,7,8,64,128,7,8,64,92,13,8,64,
+116,4,8,64,108,12,8,64,40,5,8,64,240,0,8,64,216,9,8,64,100,5,8,64,0,0,8,64,8,7,
+8,64,132,3,8,64,232,8,8,64,212,13,8,64,184,11,8,64,224,1,8,64,164,1,8,64,112,8,8,64,
+188,7,8,64,252,3,8,64,100,5,8,64,44,1,8,64,144,6,8,64,216,9,8,64,111,112,101,110,105,114,
+105,115,96,9,8,64,132,3,8,64,196,14,8,64,96,9,8,64,108,12,8,64,244,11,8,64,72,3,8,64,
+248,7,8,64,255,255,255,255,92,13,8,64,104,1,8,64,8,7,8,64,88,2,8,64,216,9,8,64,128,7,
+8,64,244,11,8,64,16,14,8,64,204,6,8,64,232,8,8,64,64,11,8,64,72,3,8,64,152,13,8,64,
+176,4,8,64,120,0,8,64,111,112,101,110,105,114,105,115,188,7,8,64,144,6,8,64,8,7,8,64,124,11,
+8,64,216,9,8,64,232,8,8,64,120,0,8,64,255,255,255,255,99,97,109,101,114,97,99,97,109,101,114,97,
+228,12,8,64,176,4,8,64,176,4,8,64,100,5,8,64,40,5,8,64,72,3,8,64,96,9,8,64,80,10,
+8,64,140,10,8,64,24,6,8,64,84,6,8,64,108,12,8,64,140,10,8,64,104,1,8,64,232,8,8,64,
+212,13,8,64,8,7,8,64,36,9,8,64,100,5,8,64,0,0,8,64,124,11,8,64,100,5,8,64,68,7,
+8,64,111,112,101,110,105,114,105,115,120,0,8,64,111,112,101,110,105,114,105,115,208,2,8,64,172,8,8,64,
+248,7,8,64,28,2,8,64,176,4,8,64,111,112,101,110,105,114,105,115,184,11,8,64,192,3,8,64,88,2,
+8,64,188,7,8,64,24,6,8,64,180,0,8,64,144,6,8,64,72,3,8,64,24,6,8,64,99,97,109,101,
+114,97,228,12,8,64,48,12,8,64,244,11,8,64,176,4,8,64,124,11,8,64,232,8,8,64,232,8,8,64,
+200,10,8,64,96,9,8,64,152,13,8,64,248,7,8,64,99,97,109,101,114,97,115,116,114,101,97,109,140,10,
+8,64,196,14,8,64,236,4,8,64,20,10,8,64,200,10,8,64,172,8,8,64,232,8,8,64,96,9,8,64,
+140,10,8,64,80,10,8,64,220,5,8,64,36,9,8,64,99,97,109,101,114,97,255,255,255,255,240,0,8,64,
+152,13,8,64,96,9,8,64,232,8,8,64,136,14,8,64,16,14,8,64,120,0,8,64,184,11,8,64,68,7,
+8,64,80,10,8,64,76,14,8,64,196,14,8,64,72,3,8,64,200,10,8,64,212,13,8,64,24,6,8,64,
+156,9,8,64,220,5,8,64,216,9,8,64,88,2,8,64,176,4,8,64,176,4,8,64,180,0,8,64,240,0,
+8,64,32,13,8,64,104,1,8,64,184,11,8,64,208,2,8,64,116,4,8,64,44,1,8,64,112,8,8,64,
+240,0,8,64,24,6,8,64,208,2,8,64,140,10,8,64,24,6,8,64,176,4,8,64,16,14,8,64,8,7,
+8,64,216,9,8,64,192,3,8,64,255,255,255,255,196,14,8,64,140,10,8,64,48,12,8,64,152,13,8,64,
+40,5,8,64,28,2,8,64,124,11,8,64,111,112,101,110,105,114,105,115,252,3,8,64,99,97,109,101,114,97,
+52,8,8,64,140,10,8,64,192,3,8,64,52,8,8,64,52,8,8,64,184,11,8,64,244,11,8,64,92,13,
+8,64,152,13,8,64,64,11,8,64,136,14,8,64,240,0,8,64,200,10,8,64,64,11,8,64,64,11,8,64,
+0,0,0,0,0,0,0,0,176,4,8,64,4,11,8,64,240,0,8,64,252,3,8,64,244,11,8,64,128,7,
+8,64,84,6,8,64,32,13,8,64,88,2,8,64,48,12,8,64,108,12,8,64,28,2,8,64,104,1,8,64,
+108,12,8,64,115,116,114,101,97,109,96,9,8,64,200,10,8,64,80,10,8,64,244,11,8,64,0,0,8,64,
+220,5,8,64,92,13,8,64,108,12,8,64,160,5,8,64,200,10,8,64,212,13,8,64,8,7,8,64,72,3,
+8,64,255,255,255,255,84,6,8,64,44,1,8,64,48,12,8,64,99,97,109,101,114,97,8,7,8,64,40,5,
+8,64,56,4,8,64,156,9,8,64,188,7,8,64,196,14,8,64,152,13,8,64,104,1,8,64,20,10,8,64,
+196,14,8,64,144,6,8,64,72,3,8,64,164,1,8,64,60,0,8,64,4,11,8,64,236,4,8,64,64,11,
+8,64,180,0,8,64,24,6,8,64,0,0,8,64,44,1,8,64,32,13,8,64,80,10,8,64,232,8,8,64,
+172,8,8,64,36,9,8,64,24,6,8,64,240,0,8,64,112,8,8,64,16,14,8,64,248,7,8,64,8,7,
+8,64,216,9,8,64,32,13,8,64,156,9,8,64,180,0,8,64,8,7,8,64,48,12,8,64,28,2,8,64,
+220,5,8,64,44,1,8,64,240,0,8,64,172,8,8,64,255,255,255,255,115,116,114,101,97,109,208,2,8,64,
+16,14,8,64,12,3,8,64,248,7,8,64,60,0,8,64,104,1,8,64,148,2,8,64,36,9,8,64,232,8,
+8,64,136,14,8,64,220,5,8,64,99,97,109,101,114,97,60,0,8,64,224,1,8,64,104,1,8,64,136,14,
+8,64,212,13,8,64,32,13,8,64,99,97,109,101,114,97,176,4,8,64,36,9,8,64,104,1,8,64,48,12,
+8,64,32,13,8,64,132,3,8,64,172,8,8,64,92,13,8,64,16,14,8,64,156,9,8,64,0,0,0,0,
+0,0,0,0,99,97,109,101,114,97,44,1,8,64,132,3,8,64,0,0,0,0,0,0,0,0,196,14,8,64,
+252,3,8,64,172,8,8,64,116,4,8,64,68,7,8,64,212,13,8,64,140,10,8,64,192,3,8,64,99,97,
+109,101,114,97,96,9,8,64,76,14,8,64,204,6,8,64,115,116,114,101,97,109,248,7,8,64,96,9,8,64,
+52,8,8,64,32,13,8,64,32,13,8,64,152,13,8,64,100,5,8,64,28,2,8,64,232,8,8,64,28,2,
+8,64,200,10,8,64,236,4,8,64,80,10,8,64,120,0,8,64,216,9,8,64,148,2,8,64,68,7,8,64,
+124,11,8,64,92,13,8,64,116,4,8,64,20,10,8,64,116,4,8,64,244,11,8,64,0,0,0,0,0,0,
+0,0,228,12,8,64,40,5,8,64,148,2,8,64,224,1,8,64,140,10,8,64,68,7,8,64,252,3,8,64,
+228,12,8,64,44,1,8,64,204,6,8,64,76,14,8,64,148,2,8,64,115,116,114,101,97,109,0,0,0,0,
+0,0,0,0,116,4,8,64,16,14,8,64,136,14,8,64,252,3,8,64,156,9,8,64,32,13,8,64,196,14,
+8,64,128,7,8,64,164,1,8,64,164,1,8,64,184,11,8,64,228,12,8,64,168,12,8,64,164,1,8,64,
+156,9,8,64,20,10,8,64,92,13,8,64,132,3,8,64,152,13,8,64,4,11,8,64,0,0,8,64,212,13,
+8,64,36,9,8,64,116,4,8,64,0,0,8,64,112,8,8,64,148,2,8,64,244,11,8,64,76,14,8,64,
+176,4,8,64,111,112,101,110,105,114,105,115,120,0,8,64,184,11,8,64,72,3,8,64,76,14,8,64,240,0,
+8,64,160,5,8,64,72,3,8,64,99,97,109,101,114,97,12,3,8,64,228,12,8,64,16,14,8,64,232,8,
+8,64,140,10,8,64,0,0,8,64,88,2,8,64,248,7,8,64,20,10,8,64,140,10,8,64,148,2,8,64,
+52,8,8,64,232,8,8,64,64,11,8,64,136,14,8,64,160,5,8,64,236,4,8,64,168,12,8,64,204,6,
+8,64,172,8,8,64,116,4,8,64,148,2,8,64,172,8,8,64,160,5,8,64,32,13,8,64,88,2,8,64,
+12,3,8,64,232,8,8,64,228,12,8,64,40,5,8,64,40,5,8,64,116,4,8,64,36,9,8,64,200,10,
+8,64,255,255,255,255,8,7,8,64,120,0,8,64,180,0,8,64,12,3,8,64,148,2,8,64,232,8,8,64,
+104,1,8,64,140,10,8,64,12,3,8,64,108,12,8,64,255,255,255,255,112,8,8,64,44,1,8,64,140,10,
+8,64,144,6,8,64,160,5,8,64,232,8,8,64,136,14,8,64,111,112,101,110,105,114,105,115,220,5,8,64,
+176,4,8,64,136,14,8,64,36,9,8,64,164,1,8,64,232,8,8,64,128,7,8,64,212,13,8,64,116,4,
+8,64,60,0,8,64,204,6,8,64,252,3,8,64,32,13,8,64,136,14,8,64,200,10,8,64,116,4,8,64,
+72,3,8,64,228,12,8,64,212,13,8,64,160,5,8,64,96,9,8,64,208,2,8,64,216,9,8,64,196,14,
+8,64,188,7,8,64,128,7,8,64,92,13,8,64,84,6,8,64,48,12,8,64,140,10,8,64,240,0,8,64,
+44,1,8,64,115,116,114,101,97,109,44,1,8,64,228,12,8,64,200,10,8,64,48,12,8,64,64,11,8,64,
+0,0,8,64,140,10,8,64,0,0,0,0,0,0,0,0,128,7,8,64,60,0,8,64,92,13,8,64,168,12,
+8,64,224,1,8,64,92,13,8,64,124,11,8,64,120,0,8,64,0,0,8,64,40,5,8,64,36,9,8,64,
+212,13,8,64,140,10,8,64,204,6,8,64,200,10,8,64,115,116,114,101,97,109,108,12,8,64,20,10,8,64,
+108,12,8,64,112,8,8,64,104,1,8,64,0,0,8,64,204,6,8,64,32,13,8,64,204,6,8,64,36,9,
+8,64,76,14,8,64,212,13,8,64,48,12,8,64,0,0,0,0,0,0,0,0,144,6,8,64,172,8,8,64,
+100,5,8,64,232,8,8,64,84,6,8,64,132,3,8,64,96,9,8,64,212,13,8,64,28,2,8,64,188,7,
+8,64,16,14,8,64,240,0,8,64,172,8,8,64,216,9,8,64,108,12,8,64,104,1,8,64,216,9,8,64,
+196,14,8,64,100,5,8,64,212,13,8,64,24,6,8,64,40,5,8,64,148,2,8,64,115,116,114,101,97,109,
+228,12,8,64,68,7,8,64,92,13,8,64,12,3,8,64,252,3,8,64,88,2,8,64,88,2,8,64,92,13,
+8,64,120,0,8,64,120,0,8,64,240,0,8,64,108,12,8,64,204,6,8,64,196,14,8,64,192,3,8,64,
+248,7,8,64,172,8,8,64,48,12,8,64,16,14,8,64,56,4,8,64,52,8,8,64,52,8,8,64,128,7,
+8,64,172,8,8,64,224,1,8,64,68,7,8,64,132,3,8,64,111,112,101,110,105,114,105,115,128,7,8,64,
+111,112,101,110,105,114,105,115,255,255,255,255,96,9,8,64,172,8,8,64,40,5,8,64,4,11,8,64,100,5,
+8,64,248,7,8,64,12,3,8,64,160,5,8,64,80,10,8,64,248,7,8,64,80,10,8,64,60,0,8,64,
+96,9,8,64,252,3,8,64,0,0,8,64,40,5,8,64,200,10,8,64,100,5,8,64,64,11,8,64,20,10,
+8,64,48,12,8,64,112,8,8,64,136,14,8,64,168,12,8,64,224,1,8,64,16,14,8,64,48,12,8,64,
+112,8,8,64,40,5,8,64,12,3,8,64,196,14,8,64,8,7,8,64,156,9,8,64,76,14,8,64,228,12,
+8,64,28,2,8,64,168,12,8,64,0,0,0,0,0,0,0,0,44,1,8,64,212,13,8,64,40,5,8,64,
+208,2,8,64,100,5,8,64,100,5,8,64,28,2,8,64,200,10,8,64,160,5,8,64,4,11,8,64,111,112,
+101,110,105,114,105,115,108,12,8,64,100,5,8,64,216,9,8,64,176,4,8,64,100,5,8,64,216,9,8,64,
+8,7,8,64,84,6,8,64,96,9,8,64,76,14,8,64,148,2,8,64,180,0,8,64,132,3,8,64,204,6,
+8,64,156,9,8,64,68,7,8,64,176,4,8,64,232,8,8,64,200,10,8,64,144,6,8,64,244,11,8,64,
+40,5,8,64,108,12,8,64,16,14,8,64,252,3,8,64,24,6,8,64,128,7,8,64,196,14,8,64,144,6,
+8,64,236,4,8,64,40,5,8,64,84,6,8,64,8,7,8,64,108,12,8,64,236,4,8,64,164,1,8,64,
+236,4,8,64,99,97,109,101,114,97,72,3,8,64,144,6,8,64,128,7,8,64,104,1,8,64,88,2,8,64,
+12,3,8,64,60,0,8,64,255,255,255,255,236,4,8,64,24,6,8,64,204,6,8,64,224,1,8,64,104,1,
+8,64,200,10,8,64,56,4,8,64,28,2,8,64,24,6,8,64,36,9,8,64,248,7,8,64,240,0,8,64,
+148,2,8,64,212,13,8,64,188,7,8,64,64,11,8,64,152,13,8,64,204,6,8,64,120,0,8,64,44,1,
+8,64,212,13,8,64,140,10,8,64,236,4,8,64,48,12,8,64,200,10,8,64,164,1,8,64,160,5,8,64,
+172,8,8,64,224,1,8,64,120,0,8,64,248,7,8,64,244,11,8,64,164,1,8,64,236,4,8,64,152,13,
+8,64,60,0,8,64,140,10,8,64,72,3,8,64,224,1,8,64,104,1,8,64,108,12,8,64,124,11,8,64,
+160,5,8,64,84,6,8,64,168,12,8,64,152,13,8,64,212,13,8,64,120,0,8,64,224,1,8,64,216,9,
+8,64,220,5,8,64,236,4,8,64,32,13,8,64,48,12,8,64,164,1,8,64,188,7,8,64,144,6,8,64,
+164,1,8,64,80,10,8,64,80,10,8,64,212,13,8,64,24,6,8,64,112,8,8,64,24,6,8,64,111,112,
+101,110,105,114,105,115,99,97,109,101,114,97,184,11,8,64,0,0,8,64,120,0,8,64,32,13,8,64,104,1,
+8,64,252,3,8,64,0,0,8,64,156,9,8,64,16,14,8,64,92,13,8,64,244,11,8,64,192,3,8,64,
+115,116,114,101,97,109,180,0,8,64,184,11,8,64,168,12,8,64,112,8,8,64,140,10,8,64,108,12,8,64,
+160,5,8,64,196,14,8,64,120,0,8,64,212,13,8,64,212,13,8,64,228,12,8,64,204,6,8,64,136,14,
+8,64,208,2,8,64,100,5,8,64,224,1,8,64,44,1,8,64,92,13,8,64,104,1,8,64,48,12,8,64,
+252,3,8,64,184,11,8,64,16,14,8,64,112,8,8,64,228,12,8,64,76,14,8,64,196,14,8,64,156,9,
+8,64,160,5,8,64,4,11,8,64,44,1,8,64,236,4,8,64,164,1,8,64,116,4,8,64,80,10,8,64,
+192,3,8,64,116,4,8,64,212,13,8,64,184,11,8,64,136,14,8,64,128,7,8,64,228,12,8,64,192,3,
+8,64,144,6,8,64,168,12,8,64,244,11,8,64,196,14,8,64,36,9,8,64,88,2,8,64,188,7,8,64,
+72,3,8,64,168,12,8,64,152,13,8,64,204,6,8,64,212,13,8,64,136,14,8,64,12,3,8,64,116,4,
+8,64,4,11,8,64,164,1,8,64,111,112,101,110,105,114,105,115,28,2,8,64,180,0,8,64,124,11,8,64,
+96,9,8,64,144,6,8,64,99,97,109,101,114,97,84,6,8,64,76,14,8,64,32,13,8,64,192,3,8,64,
+224,1,8,64,8,7,8,64,48,12,8,64,212,13,8,64,136,14,8,64,32,13,8,64,20,10,8,64,60,0,
+8,64,44,1,8,64,144,6,8,64,228,12,8,64,236,4,8,64,255,255,255,255,124,11,8,64,52,8,8,64,
+76,14,8,64,160,5,8,64,64,11,8,64,252,3,8,64,172,8,8,64,172,8,8,64,132,3,8,64,244,11,
+8,64,116,4,8,64,99,97,109,101,114,97,64,11,8,64,104,1,8,64,0,0,0,0,0,0,0,0,116,4,
+8,64,124,11,8,64,120,0,8,64,96,9,8,64,120,0,8,64,16,14,8,64,80,10,8,64,24,6,8,64,
+28,2,8,64,156,9,8,64,52,8,8,64,152,13,8,64,144,6,8,64,192,3,8,64,124,11,8,64,12,3,
+8,64,120,0,8,64,240,0,8,64,104,1,8,64,232,8,8,64,164,1,8,64,164,1,8,64,0,0,0,0,
+0,0,0,0,228,12,8,64,204,6,8,64,124,11,8,64,115,116,114,101,97,109,92,13,8,64,115,116,114,101,
+97,109,232,8,8,64,28,2,8,64,24,6,8,64,148,2,8,64,116,4,8,64,48,12,8,64,76,14,8,64,
+196,14,8,64,0,0,0,0,0,0,0,0,44,1,8,64,120,0,8,64,200,10,8,64,136,14,8,64,232,8,
+8,64,160,5,8,64,16,14,8,64,48,12,8,64,120,0,8,64,236,4,8,64,108,12,8,64,80,10,8,64,
+8,7,8,64,132,3,8,64,16,14,8,64,228,12,8,64,144,6,8,64,252,3,8,64,164,1,8,64,180,0,
+8,64,204,6,8,64,124,11,8,64,12,3,8,64,72,3,8,64,28,2,8,64,60,0,8,64,160,5,8,64,
+128,7,8,64,24,6,8,64,36,9,8,64,208,2,8,64,216,9,8,64,144,6,8,64,99,97,109,101,114,97,
+228,12,8,64,236,4,8,64,252,3,8,64,176,4,8,64,220,5,8,64,224,1,8,64,99,97,109,101,114,97,
+108,12,8,64,0,0,8,64,232,8,8,64,56,4,8,64,64,11,8,64,148,2,8,64,192,3,8,64,40,5,
+8,64,20,10,8,64,240,0,8,64,148,2,8,64,160,5,8,64,100,5,8,64,120,0,8,64,108,12,8,64,
+84,6,8,64,80,10,8,64,56,4,8,64,128,7,8,64,20,10,8,64,76,14,8,64,224,1,8,64,184,11,
+8,64,92,13,8,64,68,7,8,64,164,1,8,64,8,7,8,64,224,1,8,64,111,112,101,110,105,114,105,115,
+164,1,8,64,72,3,8,64,16,14,8,64,160,5,8,64,52,8,8,64,204,6,8,64,88,2,8,64,232,8,
+8,64,108,12,8,64,16,14,8,64,236,4,8,64,32,13,8,64,48,12,8,64,36,9,8,64,196,14,8,64,
+216,9,8,64,99,97,109,101,114,97,56,4,8,64,99,97,109,101,114,97,36,9,8,64,88,2,8,64,28,2,
+8,64,248,7,8,64,196,14,8,64,208,2,8,64,240,0,8,64,148,2,8,64,120,0,8,64,88,2,8,64,
+200,10,8,64,208,2,8,64,28,2,8,64,44,1,8,64,212,13,8,64,32,13,8,64,188,7,8,64,252,3,
+8,64,0,0,0,0,0,0,0,0,36,9,8,64,148,2,8,64,44,1,8,64,92,13,8,64,64,11,8,64,
+0,0,8,64,152,13,8,64,116,4,8,64,20,10,8,64,36,9,8,64,208,2,8,64,68,7,8,64,212,13,
+8,64,111,112,101,110,105,114,105,115,84,6,8,64,20,10,8,64,40,5,8,64,255,255,255,255,124,11,8,64,
+68,7,8,64,40,5,8,64,8,7,8,64,40,5,8,64,84,6,8,64,216,9,8,64,96,9,8,64,212,13,
+8,64,28,2,8,64,232,8,8,64,100,5,8,64,88,2,8,64,112,8,8,64,216,9,8,64,56,4,8,64,
+224,1,8,64,204,6,8,64,36,9,8,64,176,4,8,64,64,11,8,64,232,8,8,64,80,10,8,64,8,7,
+8,64,100,5,8,64,240,0,8,64,244,11,8,64,240,0,8,64,172,8,8,64,252,3,8,64,200,10,8,64,
+84,6,8,64,144,6,8,64,176,4,8,64,156,9,8,64,172,8,8,64,88,2,8,64,32,13,8,64,99,97,
+109,101,114,97,128,7,8,64,132,3,8,64,248,7,8,64,216,9,8,64,248,7,8,64,60,0,8,64,0,0,
+8,64,252,3,8,64,68,7,8,64,204,6,8,64,128,7,8,64,16,14,8,64,252,3,8,64,111,112,101,110,
+105,114,105,115,164,1,8,64,152,13,8,64,128,7,8,64,124,11,8,64,168,12,8,64,0,0,0,0,0,0,
+0,0,244,11,8,64,99,97,109,101,114,97,148,2,8,64,116,4,8,64,224,1,8,64,24,6,8,64,116,4,
+8,64,52,8,8,64,72,3,8,64,24,6,8,64,28,2,8,64,44,1,8,64,4,11,8,64,32,13,8,64,
+216,9,8,64,100,5,8,64,8,7,8,64,0,0,8,64,160,5,8,64,24,6,8,64,60,0,8,64,228,12,
+8,64,28,2,8,64,252,3,8,64,100,5,8,64,208,2,8,64,212,13,8,64,124,11,8,64,72,3,8,64,
+12,3,8,64,132,3,8,64,115,116,114,101,97,109,52,8,8,64,104,1,8,64,20,10,8,64,40,5,8,64,
+232,8,8,64,172,8,8,64,228,12,8,64,99,97,109,101,114,97,232,8,8,64,232,8,8,64,236,4,8,64,
+76,14,8,64,152,13,8,64,232,8,8,64,164,1,8,64,115,116,114,101,97,109,56,4,8,64,44,1,8,64,
+208,2,8,64,88,2,8,64,232,8,8,64,115,116,114,101,97,109,72,3,8,64,148,2,8,64,132,3,8,64,
+240,0,8,64,36,9,8,64,0,0,8,64,132,3,8,64,152,13,8,64,48,12,8,64,4,11,8,64,220,5,
+8,64,4,11,8,64,56,4,8,64,72,3,8,64,136,14,8,64,132,3,8,64,224,1,8,64,184,11,8,64,
+115,116,114,101,97,109,116,4,8,64,84,6,8,64,76,14,8,64,148,2,8,64,28,2,8,64,176,4,8,64,
+100,5,8,64,200,10,8,64,28,2,8,64,248,7,8,64,192,3,8,64,16,14,8,64,0,0,0,0,0,0,
+0,0,112,8,8,64,152,13,8,64,255,255,255,255,176,4,8,64,28,2,8,64,228,12,8,64,128,7,8,64,
+184,11,8,64,152,13,8,64,92,13,8,64,56,4,8,64,44,1,8,64,144,6,8,64,124,11,8,64,44,1,
+8,64,28,2,8,64,128,7,8,64,184,11,8,64,115,116,114,101,97,109,100,5,8,64,56,4,8,64,36,9,
+8,64,68,7,8,64,172,8,8,64,156,9,8,64,148,2,8,64,16,14,8,64,220,5,8,64,36,9,8,64,
+248,7,8,64,255,255,255,255,100,5,8,64,244,11,8,64,56,4,8,64,204,6,8,64,52,8,8,64,64,11,
+8,64,148,2,8,64,48,12,8,64,115,116,114,101,97,109,152,13,8,64,148,2,8,64,112,8,8,64,212,13,
+8,64,232,8,8,64,140,10,8,64,248,7,8,64,20,10,8,64,44,1,8,64,120,0,8,64,111,112,101,110,
+105,114,105,115,176,4,8,64,228,12,8,64,60,0,8,64,24,6,8,64,160,5,8,64,72,3,8,64,60,0,
+8,64,104,1,8,64,99,97,109,101,114,97,72,3,8,64,136,14,8,64,184,11,8,64,192,3,8,64,220,5,
+8,64,100,5,8,64,196,14,8,64,188,7,8,64,132,3,8,64,244,11,8,64,252,3,8,64,244,11,8,64,
+108,12,8,64,16,14,8,64,236,4,8,64,244,11,8,64,156,9,8,64,24,6,8,64,84,6,8,64,92,13,
+8,64,16,14,8,64,240,0,8,64,212,13,8,64,148,2,8,64,8,7,8,64,176,4,8,64,115,116,114,101,
+97,109,196,14,8,64,116,4,8,64,115,116,114,101,97,109,152,13,8,64,108,12,8,64,204,6,8,64,60,0,
+8,64,112,8,8,64,84,6,8,64,0,0,8,64,248,7,8,64,124,11,8,64,0,0,8,64,64,11,8,64,
+52,8,8,64,208,2,8,64,88,2,8,64,212,13,8,64,100,5,8,64,24,6,8,64,144,6,8,64,255,255,
+255,255,144,6,8,64,84,6,8,64,76,14,8,64,152,13,8,64,108,12,8,64,172,8,8,64,8,7,8,64,
+240,0,8,64,92,13,8,64,208,2,8,64,228,12,8,64,16,14,8,64,208,2,8,64,64,11,8,64,208,2,
+8,64,164,1,8,64,84,6,8,64,216,9,8,64,115,116,114,101,97,109,115,116,114,101,97,109,236,4,8,64,
+208,2,8,64,48,12,8,64,64,11,8,64,144,6,8,64,60,0,8,64,52,8,8,64,104,1,8,64,72,3,
+8,64,224,1,8,64,24,6,8,64,112,8,8,64,248,7,8,64,208,2,8,64,180,0,8,64,76,14,8,64,
+152,13,8,64,120,0,8,64,12,3,8,64,212,13,8,64,232,8,8,64,36,9,8,64,56,4,8,64,152,13,
+8,64,8,7,8,64,116,4,8,64,204,6,8,64,111,112,101,110,105,114,105,115,115,116,114,101,97,109,108,12,
+8,64,216,9,8,64,124,11,8,64,200,10,8,64,116,4,8,64,64,11,8,64,88,2,8,64,32,13,8,64,
+40,5,8,64,111,112,101,110,105,114,105,115,160,5,8,64,128,7,8,64,36,9,8,64,128,7,8,64,72,3,
+8,64,152,13,8,64,168,12,8,64,96,9,8,64,48,12,8,64,168,12,8,64,64,11,8,64,240,0,8,64,
+96,9,8,64,128,7,8,64,28,2,8,64,0,0,8,64,72,3,8,64,248,7,8,64,200,10,8,64,232,8,
+8,64,160,5,8,64,60,0,8,64,68,7,8,64,124,11,8,64,236,4,8,64,184,11,8,64,112,8,8,64,
+200,10,8,64,96,9,8,64,232,8,8,64,76,14,8,64,64,11,8,64,204,6,8,64,188,7,8,64,36,9,
+8,64,68,7,8,64,228,12,8,64,4,11,8,64,0,0,0,0,0,0,0,0,248,7,8,64,164,1,8,64,
+180,0,8,64,228,12,8,64,0,0,0,0,0,0,0,0,176,4,8,64,244,11,8,64,92,13,8,64,100,5,
+8,64,4,11,8,64,112,8,8,64,124,11,8,64,136,14,8,64,40,5,8,64,240,0,8,64,124,11,8,64,
+0,0,8,64,255,255,255,255,104,1,8,64,104,1,8,64,172,8,8,64,112,8,8,64,96,9,8,64,128,7,
+8,64,116,4,8,64,240,0,8,64,248,7,8,64,56,4,8,64,0,0,8,64,116,4,8,64,92,13,8,64,
+88,2,8,64,20,10,8,64,188,7,8,64,216,9,8,64,60,0,8,64,228,12,8,64,144,6,8,64,88,2,
+8,64,240,0,8,64,224,1,8,64,212,13,8,64,168,12,8,64,32,13,8,64,184,11,8,64,152,13,8,64,
+0,0,0,0,0,0,0,0,220,5,8,64,64,11,8,64,4,11,8,64,176,4,8,64,0,0,8,64,164,1,
+8,64,220,5,8,64,120,0,8,64,40,5,8,64,108,12,8,64,255,255,255,255,4,11,8,64,60,0,8,64,
+196,14,8,64,0,0,0,0,0,0,0,0,224,1,8,64,128,7,8,64,168,12,8,64,144,6,8,64,100,5,
+8,64,111,112,101,110,105,114,105,115,156,9,8,64,48,12,8,64,204,6,8,64,111,112,101,110,105,114,105,115,
+64,11,8,64,52,8,8,64,132,3,8,64,100,5,8,64,204,6,8,64,36,9,8,64,140,10,8,64,108,12,
+8,64,212,13,8,64,100,5,8,64,68,7,8,64,172,8,8,64,248,7,8,64,156,9,8,64,68,7,8,64,
+24,6,8,64,228,12,8,64,20,10,8,64,228,12,8,64,12,3,8,64,224,1,8,64,184,11,8,64,92,13,
+8,64,140,10,8,64,200,10,8,64,116,4,8,64,0,0,8,64,204,6,8,64,176,4,8,64,124,11,8,64,
+76,14,8,64,252,3,8,64,152,13,8,64,196,14,8,64,156,9,8,64,156,9,8,64,236,4,8,64,232,8,
+8,64,96,9,8,64,99,97,109,101,114,97,108,12,8,64,136,14,8,64,168,12,8,64,208,2,8,64,20,10,
+8,64,44,1,8,64,4,11,8,64,40,5,8,64,204,6,8,64,24,6,8,64,188,7,8,64,68,7,8,64,
+128,7,8,64,244,11,8,64,236,4,8,64,104,1,8,64,68,7,8,64,24,6,8,64,0,0,0,0,0,0,
+0,0,172,8,8,64,168,12,8,64,136,14,8,64,152,13,8,64,232,8,8,64,255,255,255,255,20,10,8,64,
+220,5,8,64,188,7,8,64,168,12,8,64,132,3,8,64,220,5,8,64,32,13,8,64,236,4,8,64,255,255,
+255,255,104,1,8,64,52,8,8,64,248,7,8,64,128,7,8,64,244,11,8,64,40,5,8,64,24,6,8,64,
+108,12,8,64,104,1,8,64,52,8,8,64,124,11,8,64,184,11,8,64,112,8,8,64,136,14,8,64,152,13,
+8,64,228,12,8,64,144,6,8,64,8,7,8,64,148,2,8,64,68,7,8,64,104,1,8,64,92,13,8,64,
+56,4,8,64,152,13,8,64,212,13,8,64,124,11,8,64,28,2,8,64,84,6,8,64,180,0,8,64,200,10,
+8,64,60,0,8,64,220,5,8,64,255,255,255,255,176,4,8,64,28,2,8,64,176,4,8,64,44,1,8,64,
+128,7,8,64,168,12,8,64,92,13,8,64,0,0,0,0,0,0,0,0,100,5,8,64,180,0,8,64,172,8,
+8,64,172,8,8,64,124,11,8,64,0,0,0,0,0,0,0,0,76,14,8,64,68,7,8,64,188,7,8,64,
+172,8,8,64,212,13,8,64,80,10,8,64,212,13,8,64,76,14,8,64,92,13,8,64,88,2,8,64,40,5,
+8,64,196,14,8,64,148,2,8,64,140,10,8,64,68,7,8,64,184,11,8,64,68,7,8,64,16,14,8,64,
+24,6,8,64,64,11,8,64,76,14,8,64,144,6,8,64,88,2,8,64,172,8,8,64,99,97,109,101,114,97,
+16,14,8,64,115,116,114,101,97,109,208,2,8,64,4,11,8,64,156,9,8,64,212,13,8,64,216,9,8,64,
+24,6,8,64,16,14,8,64,44,1,8,64,115,116,114,101,97,109,60,0,8,64,228,12,8,64,0,0,0,0,
+0,0,0,0,115,116,114,101,97,109,244,11,8,64,28,2,8,64,8,7,8,64,80,10,8,64,40,5,8,64,
+64,11,8,64,0,0,8,64,164,1,8,64,92,13,8,64,16,14,8,64,152,13,8,64,208,2,8,64,111,112,
+101,110,105,114,105,115,128,7,8,64,48,12,8,64,16,14,8,64,240,0,8,64,124,11,8,64,200,10,8,64,
+192,3,8,64,44,1,8,64,40,5,8,64,188,7,8,64,224,1,8,64,204,6,8,64,164,1,8,64,76,14,
+8,64,156,9,8,64,176,4,8,64,180,0,8,64,8,7,8,64,180,0,8,64,52,8,8,64,84,6,8,64,
+144,6,8,64,4,11,8,64,196,14,8,64,60,0,8,64,36,9,8,64,88,2,8,64,76,14,8,64,99,97,
+109,101,114,97,196,14,8,64,152,13,8,64,252,3,8,64,140,10,8,64,28,2,8,64,8,7,8,64,44,1,
+8,64,99,97,109,101,114,97,124,11,8,64,208,2,8,64,168,12,8,64,216,9,8,64,192,3,8,64,12,3,
+8,64,184,11,8,64,20,10,8,64,244,11,8,64,112,8,8,64,160,5,8,64,84,6,8,64,32,13,8,64,
+12,3,8,64,240,0,8,64,100,5,8,64,96,9,8,64,48,12,8,64,192,3,8,64,20,10,8,64,72,3,
+8,64,100,5,8,64,92,13,8,64,92,13,8,64,60,0,8,64,48,12,8,64,188,7,8,64,236,4,8,64,
+168,12,8,64,184,11,8,64,180,0,8,64,168,12,8,64,64,11,8,64,104,1,8,64,64,11,8,64,48,12,
+8,64,24,6,8,64,252,3,8,64,44,1,8,64,232,8,8,64,20,10,8,64,99,97,109,101,114,97,40,5,
+8,64,92,13,8,64,128,7,8,64,111,112,101,110,105,114,105,115,116,4,8,64,164,1,8,64,184,11,8,64,
+252,3,8,64,176,4,8,64,92,13,8,64,4,11,8,64,111,112,101,110,105,114,105,115,152,13,8,64,104,1,
+8,64,20,10,8,64,72,3,8,64,40,5,8,64,192,3,8,64,111,112,101,110,105,114,105,115,204,6,8,64,
+184,11,8,64,188,7,8,64,84,6,8,64,240,0,8,64,140,10,8,64,192,3,8,64,104,1,8,64,28,2,
+8,64,99,97,109,101,114,97,20,10,8,64,36,9,8,64,104,1,8,64,244,11,8,64,92,13,8,64,52,8,
+8,64,248,7,8,64,136,14,8,64,92,13,8,64,52,8,8,64,76,14,8,64,236,4,8,64,56,4,8,64,
+44,1,8,64,220,5,8,64,60,0,8,64,120,0,8,64,8,7,8,64,236,4,8,64,0,0,0,0,0,0,
+0,0,80,10,8,64,8,7,8,64,88,2,8,64,80,10,8,64,212,13,8,64,112,8,8,64,72,3,8,64,
+72,3,8,64,80,10,8,64,152,13,8,64,132,3,8,64,224,1,8,64,32,13,8,64,136,14,8,64,72,3,
+8,64,156,9,8,64,0,0,8,64,20,10,8,64,188,7,8,64,112,8,8,64,132,3,8,64,0,0,8,64,
+56,4,8,64,228,12,8,64,136,14,8,64,140,10,8,64,60,0,8,64,52,8,8,64,80,10,8,64,252,3,
+8,64,144,6,8,64,72,3,8,64,80,10,8,64,152,13,8,64,244,11,8,64,216,9,8,64,172,8,8,64,
+208,2,8,64,36,9,8,64,252,3,8,64,180,0,8,64,111,112,101,110,105,114,105,115,128,7,8,64,111,112,
+101,110,105,114,105,115,204,6,8,64,0,0,0,0,0,0,0,0,36,9,8,64,224,1,8,64,248,7,8,64,
+164,1,8,64,164,1,8,64,228,12,8,64,32,13,8,64,60,0,8,64,60,0,8,64,180,0,8,64,4,11,
+8,64,152,13,8,64,24,6,8,64,99,97,109,101,114,97,0,0,8,64,164,1,8,64,152,13,8,64,104,1,
+8,64,120,0,8,64,84,6,8,64,36,9,8,64,196,14,8,64,120,0,8,64,188,7,8,64,112,8,8,64,
+120,0,8,64,212,13,8,64,8,7,8,64,236,4,8,64,92,13,8,64,4,11,8,64,84,6,8,64,248,7,
+8,64,88,2,8,64,204,6,8,64,0,0,0,0,0,0,0,0,44,1,8,64,104,1,8,64,32,13,8,64,
+28,2,8,64,16,14,8,64,8,7,8,64,176,4,8,64,120,0,8,64,16,14,8,64,160,5,8,64,188,7,
+8,64,72,3,8,64,196,14,8,64,152,13,8,64,172,8,8,64,108,12,8,64,20,10,8,64,12,3,8,64,
+220,5,8,64,108,12,8,64,28,2,8,64,132,3,8,64,20,10,8,64,0,0,8,64,212,13,8,64,32,13,
+8,64,48,12,8,64,16,14,8,64,160,5,8,64,76,14,8,64,100,5,8,64,16,14,8,64,80,10,8,64,
+108,12,8,64,36,9,8,64,188,7,8,64,204,6,8,64,196,14,8,64,8,7,8,64,224,1,8,64,88,2,
+8,64,160,5,8,64,140,10,8,64,32,13,8,64,196,14,8,64,172,8,8,64,172,8,8,64,36,9,8,64,
+248,7,8,64,80,10,8,64,48,12,8,64,188,7,8,64,184,11,8,64,76,14,8,64,192,3,8,64,184,11,
+8,64,128,7,8,64,84,6,8,64,100,5,8,64,100,5,8,64,112,8,8,64,152,13,8,64,224,1,8,64,
+72,3,8,64,36,9,8,64,72,3,8,64,48,12,8,64,140,10,8,64,80,10,8,64,20,10,8,64,0,0,
+8,64,48,12,8,64,232,8,8,64,20,10,8,64,184,11,8,64,160,5,8,64,148,2,8,64,220,5,8,64,
+100,5,8,64,152,13,8,64,100,5,8,64,128,7,8,64,136,14,8,64,220,5,8,64,204,6,8,64,216,9,
+8,64,152,13,8,64,184,11,8,64,132,3,8,64,220,5,8,64,240,0,8,64,16,14,8,64,40,5,8,64,
+255,255,255,255,92,13,8,64,111,112,101,110,105,114,105,115,56,4,8,64,68,7,8,64,164,1,8,64,52,8,
+8,64,116,4,8,64,204,6,8,64,144,6,8,64,88,2,8,64,16,14,8,64,36,9,8,64,80,10,8,64,
+156,9,8,64,236,4,8,64,120,0,8,64,32,13,8,64,52,8,8,64,188,7,8,64,16,14,8,64,40,5,
+8,64,44,1,8,64,200,10,8,64,224,1,8,64,92,13,8,64,36,9,8,64,168,12,8,64,136,14,8,64,
+100,5,8,64,140,10,8,64,116,4,8,64,156,9,8,64,115,116,114,101,97,109,156,9,8,64,204,6,8,64,
+80,10,8,64,164,1,8,64,212,13,8,64,60,0,8,64,220,5,8,64,164,1,8,64,56,4,8,64,144,6,
+8,64,92,13,8,64,116,4,8,64,12,3,8,64,20,10,8,64,156,9,8,64,108,12,8,64,16,14,8,64,
+132,3,8,64,32,13,8,64,40,5,8,64,36,9,8,64,152,13,8,64,99,97,109,101,114,97,115,116,114,101,
+97,109,220,5,8,64,236,4,8,64,152,13,8,64,176,4,8,64,60,0,8,64,212,13,8,64,156,9,8,64,
+111,112,101,110,105,114,105,115,188,7,8,64,36,9,8,64,108,12,8,64,16,14,8,64,36,9,8,64,108,12,
+8,64,32,13,8,64,224,1,8,64,184,11,8,64,72,3,8,64,36,9,8,64,255,255,255,255,120,0,8,64,
+64,11,8,64,232,8,8,64,228,12,8,64,252,3,8,64,224,1,8,64,56,4,8,64,72,3,8,64,240,0,
+8,64,88,2,8,64,20,10,8,64,176,4,8,64,104,1,8,64,236,4,8,64,111,112,101,110,105,114,105,115,
+152,13,8,64,144,6,8,64,112,8,8,64,148,2,8,64,115,116,114,101,97,109,20,10,8,64,188,7,8,64,
+244,11,8,64,216,9,8,64,0,0,0,0,0,0,0,0,24,6,8,64,136,14,8,64,52,8,8,64,216,9,
+8,64,188,7,8,64,164,1,8,64,252,3,8,64,24,6,8,64,120,0,8,64,48,12,8,64,116,4,8,64,
+56,4,8,64,204,6,8,64,88,2,8,64,140,10,8,64,4,11,8,64,44,1,8,64,40,5,8,64,115,116,
+114,101,97,109,236,4,8,64,88,2,8,64,136,14,8,64,228,12,8,64,96,9,8,64,108,12,8,64,108,12,
+8,64,120,0,8,64,112,8,8,64,244,11,8,64,160,5,8,64,0,0,8,64,68,7,8,64,76,14,8,64,
+196,14,8,64,96,9,8,64,136,14,8,64,100,5,8,64,232,8,8,64,132,3,8,64,100,5,8,64,240,0,
+8,64,112,8,8,64,148,2,8,64,160,5,8,64,244,11,8,64,104,1,8,64,128,7,8,64,0,0,0,0,
+0,0,0,0,0,0,8,64,80,10,8,64,140,10,8,64,236,4,8,64,40,5,8,64,160,5,8,64,140,10,
+8,64,8,7,8,64,224,1,8,64,36,9,8,64,16,14,8,64,232,8,8,64,224,1,8,64,252,3,8,64,
+232,8,8,64,24,6,8,64,148,2,8,64,24,6,8,64,116,4,8,64,88,2,8,64,88,2,8,64,120,0,
+8,64,140,10,8,64,144,6,8,64,8,7,8,64,96,9,8,64,188,7,8,64,232,8,8,64,220,5,8,64,
+32,13,8,64,148,2,8,64,144,6,8,64,172,8,8,64,100,5,8,64,72,3,8,64,244,11,8,64,72,3,
+8,64,108,12,8,64,20,10,8,64,184,11,8,64,40,5,8,64,136,14,8,64,208,2,8,64,8,7,8,64,
+220,5,8,64,164,1,8,64,48,12,8,64,100,5,8,64,164,1,8,64,200,10,8,64,144,6,8,64,232,8,
+8,64,120,0,8,64,52,8,8,64,176,4,8,64,164,1,8,64,244,11,8,64,240,0,8,64,212,13,8,64,
+92,13,8,64,0,0,0,0,0,0,0,0,196,14,8,64,228,12,8,64,20,10,8,64,196,14,8,64,0,0,
+0,0,0,0,0,0,4,11,8,64,204,6,8,64,232,8,8,64,140,10,8,64,32,13,8,64,16,14,8,64,
+196,14,8,64,96,9,8,64,111,112,101,110,105,114,105,115,16,14,8,64,176,4,8,64,8,7,8,64,64,11,
+8,64,40,5,8,64,152,13,8,64,208,2,8,64,72,3,8,64,196,14,8,64,204,6,8,64,108,12,8,64,
+64,11,8,64,88,2,8,64,4,11,8,64,248,7,8,64,76,14,8,64,192,3,8,64,180,0,8,64,48,12,
+8,64,4,11,8,64,184,11,8,64,136,14,8,64,208,2,8,64,52,8,8,64,160,5,8,64,64,11,8,64,
+148,2,8,64,0,0,8,64,99,97,109,101,114,97,216,9,8,64,92,13,8,64,140,10,8,64,208,2,8,64,
+156,9,8,64,168,12,8,64,252,3,8,64,192,3,8,64,84,6,8,64,60,0,8,64,24,6,8,64,244,11,
+8,64,248,7,8,64,140,10,8,64,196,14,8,64,220,5,8,64,16,14,8,64,20,10,8,64,172,8,8,64,
+28,2,8,64,100,5,8,64,136,14,8,64,176,4,8,64,200,10,8,64,99,97,109,101,114,97,0,0,0,0,
+0,0,0,0,8,7,8,64,100,5,8,64,52,8,8,64,184,11,8,64,136,14,8,64,96,9,8,64,0,0,
+8,64,132,3,8,64,228,12,8,64,115,116,114,101,97,109,160,5,8,64,192,3,8,64,72,3,8,64,44,1,
+8,64,244,11,8,64,252,3,8,64,200,10,8,64,252,3,8,64,64,11,8,64,32,13,8,64,44,1,8,64,
+76,14,8,64,180,0,8,64,180,0,8,64,208,2,8,64,120,0,8,64,148,2,8,64,52,8,8,64,248,7,
+8,64,36,9,8,64,96,9,8,64,148,2,8,64,116,4,8,64,164,1,8,64,208,2,8,64,188,7,8,64,
+136,14,8,64,116,4,8,64,32,13,8,64,111,112,101,110,105,114,105,115,248,7,8,64,255,255,255,255,44,1,
+8,64,208,2,8,64,92,13,8,64,236,4,8,64,115,116,114,101,97,109,255,255,255,255,56,4,8,64,160,5,
+8,64,220,5,8,64,115,116,114,101,97,109,111,112,101,110,105,114,105,115,136,14,8,64,16,14,8,64,56,4,
+8,64,160,5,8,64,144,6,8,64,204,6,8,64,228,12,8,64,96,9,8,64,168,12,8,64,188,7,8,64,
+172,8,8,64,112,8,8,64,128,7,8,64,92,13,8,64,252,3,8,64,116,4,8,64,108,12,8,64,228,12,
+8,64,192,3,8,64,4,11,8,64,176,4,8,64,44,1,8,64,228,12,8,64,184,11,8,64,72,3,8,64,
+160,5,8,64,88,2,8,64,24,6,8,64,236,4,8,64,0,0,8,64,84,6,8,64,224,1,8,64,216,9,
+8,64,252,3,8,64,172,8,8,64,184,11,8,64,88,2,8,64,248,7,8,64,76,14,8,64,216,9,8,64,
+76,14,8,64,100,5,8,64,232,8,8,64,68,7,8,64,248,7,8,64,108,12,8,64,132,3,8,64,92,13,
+8,64,0,0,8,64,152,13,8,64,44,1,8,64,0,0,8,64,196,14,8,64,120,0,8,64,240,0,8,64,
+80,10,8,64,160,5,8,64,180,0,8,64,236,4,8,64,32,13,8,64,68,7,8,64,16,14,8,64,184,11,
+8,64,115,116,114,101,97,109,20,10,8,64,212,13,8,64,8,7,8,64,140,10,8,64,104,1,8,64,52,8,
+8,64,4,11,8,64,96,9,8,64,232,8,8,64,200,10,8,64,136,14,8,64,120,0,8,64,20,10,8,64,
+255,255,255,255,104,1,8,64,8,7,8,64,28,2,8,64,216,9,8,64,140,10,8,64,116,4,8,64,28,2,
+8,64,164,1,8,64,16,14,8,64,172,8,8,64,36,9,8,64,0,0,8,64,232,8,8,64,248,7,8,64,
+8,7,8,64,124,11,8,64,28,2,8,64,156,9,8,64,156,9,8,64,68,7,8,64,92,13,8,64,144,6,
+8,64,204,6,8,64,108,12,8,64,116,4,8,64,192,3,8,64,112,8,8,64,84,6,8,64,136,14,8,64,
+160,5,8,64,228,12,8,64,99,97,109,101,114,97,124,11,8,64,36,9,8,64,24,6,8,64,115,116,114,101,
+97,109,184,11,8,64,236,4,8,64,192,3,8,64,255,255,255,255,176,4,8,64,60,0,8,64,244,11,8,64,
+108,12,8,64,192,3,8,64,4,11,8,64,32,13,8,64,244,11,8,64,212,13,8,64,115,116,114,101,97,109,
+100,5,8,64,44,1,8,64,72,3,8,64,216,9,8,64,12,3,8,64,220,5,8,64,204,6,8,64,120,0,
+};
+
+//! gzip -9, no optional header fields
+const uint8_t OTA_FIXTURE_GZIP[] = {
+31,139,8,0,0,0,0,0,2,3,109,154,45,76,163,91,30,198,11,45,237,11,180,132,108,16,8,68,5,2,
+129,64,32,70,84,84,32,16,35,16,8,4,130,155,229,38,220,132,221,109,238,34,16,35,42,16,136,17,8,4,
+2,129,64,32,16,8,4,2,129,24,129,64,32,16,8,4,2,193,38,100,131,64,84,144,236,246,151,243,60,253,
+31,54,59,73,135,246,125,207,199,255,251,227,57,231,95,229,225,230,226,95,138,246,191,75,95,255,205,12,23,237,
+133,122,209,62,47,138,118,123,188,104,207,141,164,239,167,67,69,187,210,255,253,125,34,61,127,47,21,237,86,255,
+115,87,45,218,143,163,69,187,84,74,99,234,229,162,221,173,21,237,127,238,252,249,251,111,127,187,236,63,253,209,
+31,189,83,41,218,135,195,233,243,89,78,43,30,244,103,62,245,87,103,204,82,127,198,202,88,209,158,29,77,227,
+217,233,91,127,206,109,255,217,199,120,122,6,85,172,211,108,20,237,147,254,188,183,74,90,139,247,199,253,121,83,
+99,105,12,107,94,84,18,21,172,1,181,172,51,223,167,110,183,148,40,127,169,39,90,120,206,24,214,239,20,105,
+13,222,221,235,29,116,33,129,94,45,205,103,191,196,217,86,255,215,77,255,215,98,145,228,192,202,103,245,68,13,
+220,253,167,255,111,173,191,202,63,58,191,255,253,143,63,255,248,231,213,120,90,153,191,80,198,238,80,185,57,146,
+228,247,83,220,51,143,49,72,135,181,121,14,119,71,141,196,29,115,246,202,73,66,27,163,105,46,243,224,10,73,
+174,247,199,189,22,137,171,95,125,93,161,207,253,254,223,233,170,41,135,90,158,176,42,60,194,51,59,177,10,60,
+34,63,70,195,5,223,161,4,138,161,234,121,40,205,185,207,56,131,50,116,87,145,158,176,8,184,64,18,172,135,
+197,48,151,113,80,91,212,210,152,73,89,82,71,92,34,61,168,103,252,118,61,81,206,254,124,135,6,126,91,247,
+112,202,59,91,45,180,30,143,198,111,211,246,34,137,237,200,14,144,10,124,34,65,190,163,91,116,186,39,155,68,
+43,200,98,185,255,251,175,191,253,237,247,63,127,131,114,244,152,126,165,255,121,139,101,32,5,36,133,238,25,3,
+71,123,122,183,90,77,254,192,106,60,71,39,112,119,93,11,107,75,171,189,201,86,121,195,83,180,138,101,49,131,
+85,144,13,114,199,195,144,13,227,224,129,149,249,205,120,198,33,83,120,133,103,228,206,174,140,97,77,188,18,106,
+126,200,178,224,19,157,181,101,173,216,3,58,67,174,201,74,208,30,154,194,62,177,16,70,179,27,31,102,91,210,
+252,70,35,80,137,79,32,27,52,133,76,248,142,116,161,6,222,145,54,156,194,13,187,241,14,173,97,57,117,201,
+13,206,22,196,1,146,129,107,190,179,190,173,3,142,161,20,110,145,84,73,81,134,117,15,6,118,142,38,206,228,
+203,172,140,60,225,8,206,216,25,63,192,182,74,165,144,25,239,240,117,83,15,53,172,136,124,152,203,122,172,187,
+172,40,135,236,144,16,84,188,73,246,200,61,105,150,89,179,178,120,232,69,115,236,6,47,248,230,189,228,132,103,
+48,22,43,133,82,228,135,70,177,246,150,40,97,87,120,231,25,154,134,42,108,243,70,114,43,41,22,163,131,189,
+65,148,218,148,255,110,73,247,214,26,210,111,137,18,118,173,100,81,107,82,148,217,63,60,31,170,144,13,210,71,
+210,204,195,234,249,142,69,164,29,225,11,41,158,202,2,209,81,75,177,17,59,130,23,158,179,35,116,218,26,237,
+177,69,45,162,52,207,31,20,93,216,109,87,57,6,126,177,220,87,89,110,189,28,156,193,229,163,236,195,25,196,
+107,195,1,28,33,21,244,2,77,216,159,223,219,243,94,148,105,110,149,81,206,164,85,124,29,29,218,230,209,145,
+173,7,62,55,148,189,248,192,43,207,28,221,248,205,222,247,138,199,204,69,46,60,227,119,210,78,162,25,123,64,
+210,182,111,44,109,74,25,12,185,161,37,232,194,22,88,239,102,160,111,56,228,109,71,186,68,167,88,9,146,124,
+84,22,65,178,72,172,39,171,225,47,59,224,93,112,141,79,64,21,227,152,179,57,146,198,161,153,61,197,37,180,
+226,124,128,70,216,15,201,224,87,140,159,151,39,62,254,143,116,153,255,75,30,188,173,108,185,44,90,160,23,26,
+176,53,246,90,19,205,93,249,44,26,192,194,95,85,153,48,15,126,46,100,25,222,7,58,216,187,80,164,101,13,
+230,48,134,61,242,72,110,205,57,19,195,55,235,66,31,86,135,230,208,58,218,130,94,71,57,203,160,80,196,178,
+140,216,143,239,88,168,233,201,105,67,91,232,164,39,47,103,223,188,66,64,147,240,13,15,236,139,21,195,11,52,
+241,59,168,94,144,244,46,84,189,64,17,31,108,118,99,52,108,40,205,72,214,225,184,67,164,194,158,24,123,174,
+121,27,170,65,224,250,73,254,145,230,34,179,119,69,169,141,209,240,58,244,1,111,208,237,250,13,207,96,7,232,
+101,117,100,4,221,120,217,147,42,157,181,225,144,249,165,60,189,41,189,179,22,50,194,14,231,101,87,188,103,13,
+158,91,31,204,157,84,76,126,148,215,66,39,123,255,148,215,30,41,227,32,103,36,100,57,127,14,114,187,235,43,
+215,113,139,242,22,228,138,37,178,2,150,6,183,80,113,171,140,217,206,34,233,133,162,39,239,93,141,118,107,17,
+191,215,84,79,187,162,129,75,190,39,141,108,168,6,91,81,157,91,82,93,195,238,140,34,202,88,142,240,186,44,
+62,89,29,249,176,114,226,165,80,165,74,252,64,218,88,16,210,56,146,100,167,164,123,91,19,94,75,252,129,246,
+55,85,71,151,146,180,115,110,83,177,23,141,159,171,66,228,61,188,118,84,215,96,99,214,2,227,143,21,123,121,
+182,144,85,113,172,199,60,103,153,196,255,189,170,38,199,35,40,218,82,62,153,205,108,141,21,18,159,140,32,234,
+48,138,55,72,134,125,211,219,11,213,119,91,146,13,111,92,219,33,211,201,137,175,117,98,154,53,175,156,233,167,
+200,201,93,138,115,50,251,216,86,210,44,116,247,93,49,41,113,227,236,136,29,53,69,23,242,223,148,21,194,205,
+140,58,11,100,142,108,119,21,101,15,85,165,252,24,143,72,60,165,188,247,145,217,219,139,162,243,161,50,239,79,
+117,41,159,229,168,98,160,200,117,90,162,204,179,119,228,55,251,226,240,88,90,131,99,172,246,84,241,220,221,10,
+153,143,223,238,175,214,37,79,184,170,200,94,145,12,50,223,81,181,214,81,29,253,161,110,49,143,113,142,23,203,
+170,102,176,136,147,145,188,222,174,151,163,138,122,149,127,150,84,95,247,148,7,121,230,74,221,217,96,127,34,186,
+66,168,190,171,134,254,14,21,117,121,111,159,172,43,147,89,158,124,118,100,61,232,7,27,117,45,114,169,140,121,
+40,29,110,73,238,60,195,75,157,113,93,167,226,99,236,101,235,53,247,238,76,93,23,158,42,147,116,101,95,59,
+149,232,169,209,78,83,117,225,173,236,96,89,178,121,80,23,132,173,221,43,75,254,82,103,224,76,78,132,88,80,
+198,122,151,63,39,91,224,27,171,184,186,105,143,71,85,106,59,233,202,23,89,9,105,62,171,130,199,58,145,72,
+73,149,11,92,216,51,160,154,53,211,46,219,170,247,248,219,145,204,92,163,186,134,157,149,7,61,168,183,245,238,
+7,213,168,172,221,5,237,41,43,51,118,70,25,114,114,34,98,202,163,42,10,246,177,60,152,239,12,100,159,73,
+212,193,255,146,36,85,87,151,130,85,240,225,217,110,41,170,208,109,89,19,43,222,40,78,177,227,130,172,148,136,
+235,236,225,158,224,89,85,42,84,91,251,221,172,38,192,98,224,134,177,80,86,81,221,192,218,208,131,118,137,14,
+61,229,85,116,193,248,207,114,200,30,89,51,167,61,30,216,71,71,22,103,157,65,159,159,51,167,174,250,11,203,
+62,150,244,95,20,165,207,50,13,96,35,15,141,168,88,55,71,34,138,177,239,137,104,54,63,200,200,72,70,142,
+106,20,202,132,142,149,104,0,111,66,46,119,170,11,150,84,233,186,122,65,251,31,66,158,182,37,227,79,213,63,
+221,90,100,177,55,245,39,171,170,245,24,203,179,83,117,142,209,171,27,193,192,54,236,251,45,85,131,140,156,86,
+247,236,188,98,84,104,70,253,61,118,138,38,242,158,228,90,61,200,145,108,121,87,62,102,111,96,221,5,121,25,
+20,157,140,132,101,236,170,234,118,159,244,166,154,223,29,25,52,155,22,184,194,235,220,111,156,169,178,121,144,149,
+62,203,222,159,20,251,154,242,37,214,117,37,204,247,21,85,25,246,7,44,130,191,214,96,160,29,37,217,190,107,
+50,219,28,186,66,23,248,199,199,120,222,117,92,42,170,159,213,163,223,113,245,242,75,85,226,131,104,126,145,55,
+237,79,132,101,193,131,49,2,103,110,118,189,82,213,223,81,156,118,117,9,37,182,64,227,4,167,234,72,87,148,
+163,249,238,46,101,95,217,141,53,110,100,15,198,234,126,41,22,187,234,94,46,135,140,161,243,161,17,61,166,59,
+101,246,202,123,74,163,156,27,66,11,146,44,87,171,209,177,223,72,163,174,138,188,42,239,166,228,223,238,153,94,
+100,199,88,39,171,26,231,57,145,175,187,50,225,179,167,138,115,103,96,239,140,72,177,54,50,190,163,54,244,241,
+23,153,174,168,146,134,254,99,213,44,240,12,5,80,251,67,152,140,163,160,187,30,87,8,121,61,130,156,24,159,
+172,1,45,166,111,174,119,166,213,227,239,200,39,172,199,60,218,236,170,190,222,87,222,135,91,71,47,222,189,169,
+51,133,110,119,162,147,138,94,7,202,151,208,117,89,10,122,234,229,192,163,90,170,52,186,181,240,105,231,206,131,
+47,157,149,113,101,98,210,147,172,51,189,53,90,100,124,181,173,206,26,121,205,9,39,115,140,56,81,196,220,85,
+6,193,26,86,20,87,220,207,35,135,103,85,91,72,109,73,21,88,33,140,204,54,118,58,20,184,9,235,162,43,
+120,92,83,61,226,40,153,251,255,172,114,224,227,160,143,251,54,176,17,219,187,17,29,99,81,166,221,120,166,145,
+94,198,57,182,53,27,209,233,91,127,179,170,95,237,195,174,40,142,178,58,214,242,118,45,109,222,144,139,177,17,
+91,188,81,119,247,52,171,66,18,242,252,255,170,250,0,58,59,202,255,112,248,60,20,181,197,69,37,112,34,219,
+205,166,144,141,143,241,168,29,62,213,173,174,10,87,187,80,15,197,187,181,225,188,191,232,202,242,122,234,120,220,
+179,148,212,253,45,9,219,238,214,34,111,229,90,68,34,93,85,249,121,190,133,154,180,131,253,4,62,176,211,157,
+74,32,210,246,87,227,64,205,70,32,52,133,208,156,19,161,247,173,82,100,118,163,50,247,202,93,63,84,129,215,
+203,57,86,184,88,68,167,56,55,18,93,223,203,160,199,52,198,128,157,125,87,111,233,152,144,214,248,166,190,253,
+126,56,172,51,189,89,86,253,204,126,200,125,86,103,70,238,38,176,89,120,122,26,137,211,31,230,236,11,83,183,
+159,164,213,144,202,106,214,229,204,100,167,41,104,210,150,125,35,175,177,156,59,138,114,88,218,133,50,60,252,249,
+124,131,119,88,176,249,56,80,36,153,23,254,233,113,129,174,250,68,97,73,149,223,177,124,97,114,34,112,20,163,
+91,140,255,16,111,119,58,223,113,12,89,24,96,2,208,112,40,171,126,104,68,23,212,203,80,192,28,83,50,230,
+223,82,247,238,126,202,189,116,212,65,251,19,129,25,63,41,62,185,111,112,38,49,134,145,199,20,159,176,25,9,
+115,39,253,174,188,14,181,133,170,184,64,129,119,42,57,71,174,162,91,234,16,141,157,246,106,129,125,182,149,237,
+108,61,15,234,157,167,229,151,200,240,160,26,154,247,186,231,66,246,223,213,177,220,15,71,15,201,247,182,80,37,
+236,212,177,36,81,150,254,135,199,251,225,232,134,14,68,167,61,194,245,152,235,166,158,206,126,46,75,65,199,174,
+122,68,107,108,118,52,176,92,104,219,145,206,173,181,232,146,30,133,26,187,203,107,143,71,212,193,15,61,195,217,
+107,86,152,168,241,79,226,200,198,104,32,213,62,157,221,208,184,153,225,36,93,227,172,183,99,145,97,91,165,64,
+29,144,194,149,78,166,140,34,190,22,113,226,123,87,141,179,167,37,85,83,149,12,153,232,213,34,3,191,212,191,
+34,100,70,212,54,229,221,236,241,67,149,153,177,102,91,1,90,222,82,245,123,94,196,153,88,87,82,124,151,213,
+124,19,222,192,179,117,117,245,248,199,181,98,179,35,224,129,50,229,187,170,229,7,201,172,217,8,159,55,173,79,
+170,177,42,66,86,125,170,253,164,76,238,158,4,26,25,195,30,121,37,195,250,93,157,19,177,239,102,166,191,99,
+233,40,183,2,91,252,158,34,180,51,151,43,104,123,128,163,75,175,22,61,211,180,106,69,159,89,215,203,95,171,
+137,159,99,97,83,238,188,141,22,127,87,110,58,106,68,69,205,231,173,18,104,112,212,60,238,40,239,135,191,158,
+67,204,137,98,159,139,44,213,2,173,103,165,173,161,160,52,63,169,61,211,154,206,31,72,115,74,184,243,117,118,
+202,246,36,188,198,213,240,150,206,83,123,217,62,115,138,15,238,253,23,101,89,182,100,239,99,75,40,106,129,181,
+109,13,69,180,119,79,197,92,159,191,93,170,38,109,9,149,205,179,198,133,50,132,181,189,158,89,209,166,78,168,
+93,165,231,39,111,72,126,73,167,189,231,69,156,111,61,232,108,211,150,60,167,216,124,56,28,24,159,145,118,159,
+69,181,165,73,91,248,249,224,76,153,17,129,176,86,20,191,31,84,47,76,235,244,61,48,161,214,255,248,108,156,
+1,207,40,182,175,168,42,112,109,119,58,20,121,224,168,241,245,70,64,183,22,232,136,61,251,86,125,25,123,206,
+73,207,174,213,78,117,75,224,120,52,78,5,124,102,186,88,68,93,86,81,191,214,42,69,207,246,125,112,218,106,
+180,27,187,254,57,22,148,207,15,114,224,15,229,129,179,122,156,26,212,213,103,78,9,129,239,20,209,107,55,133,
+14,193,195,230,72,68,89,230,249,44,115,83,104,253,186,250,119,222,195,155,113,200,43,225,234,142,204,216,92,91,
+183,89,166,171,113,62,254,170,219,39,137,210,57,173,154,99,70,59,149,192,102,221,159,172,55,190,226,48,57,218,
+191,172,174,228,38,171,65,239,116,106,124,45,92,230,189,20,168,182,207,120,19,5,174,217,183,134,34,122,219,247,
+246,39,226,247,119,213,8,174,152,158,70,226,62,76,81,243,25,126,250,231,26,124,109,56,108,190,163,218,150,15,
+207,142,26,81,239,25,255,92,46,27,181,143,8,223,41,140,217,167,189,95,20,83,126,142,69,238,102,189,207,114,
+156,121,120,253,15,157,10,158,171,214,152,21,178,118,89,250,255,104,221,93,245,107,175,3,109,189,12,45,127,169,
+199,89,125,75,120,113,69,153,37,78,237,236,53,214,17,18,90,173,70,167,182,91,10,206,140,152,88,130,214,51,
+227,123,146,96,78,213,188,242,101,83,221,145,207,198,124,54,234,206,209,8,135,125,229,92,221,227,148,208,108,223,
+183,153,81,165,62,53,22,24,191,59,75,175,245,93,8,171,209,132,109,117,157,215,181,192,75,221,201,174,13,199,
+45,17,159,55,156,103,167,74,198,57,237,61,87,138,108,55,229,184,49,181,90,13,28,210,117,252,243,80,220,211,
+224,175,17,239,149,177,160,157,103,246,174,43,33,105,135,195,81,1,251,132,166,91,139,179,38,223,106,59,82,141,
+224,108,244,46,89,186,91,93,207,58,217,111,149,232,224,23,139,168,248,28,157,39,133,52,173,140,69,174,53,206,
+182,88,4,162,61,167,211,178,219,177,192,221,125,91,97,95,50,247,189,141,227,65,37,203,183,59,97,12,167,170,
+114,156,183,248,13,117,7,213,56,91,170,75,187,199,163,81,235,239,149,163,234,156,21,247,249,249,177,49,70,159,
+186,183,100,25,249,29,10,87,136,94,211,223,155,141,168,78,172,49,36,184,91,138,30,253,69,184,223,243,80,244,
+127,239,165,168,236,46,84,83,188,85,190,70,188,131,106,156,58,37,74,29,37,236,233,246,147,105,33,143,139,66,
+12,174,165,47,227,203,187,165,184,103,232,46,109,77,25,216,104,35,210,137,190,97,77,247,57,94,234,113,171,97,
+91,152,21,52,125,200,226,74,170,180,141,125,49,214,218,124,205,42,192,247,236,4,237,68,253,226,150,234,140,184,
+165,25,183,19,140,130,219,187,236,113,179,163,113,134,246,44,14,95,139,192,226,140,45,248,212,99,183,20,103,87,
+133,206,49,175,117,107,202,117,24,243,242,179,153,229,114,220,224,112,20,185,26,143,59,45,247,202,192,182,193,5,
+157,18,156,14,5,210,239,155,25,104,228,66,25,206,216,204,67,227,107,93,245,107,34,42,222,188,234,174,140,199,
+205,16,71,152,201,76,206,182,21,223,71,42,106,113,183,213,181,139,163,226,157,106,73,119,97,21,221,8,115,52,
+186,44,5,86,97,108,249,94,103,145,70,104,15,213,113,37,223,193,206,92,143,223,11,109,61,147,165,179,162,111,
+2,77,87,227,254,153,111,106,60,41,190,78,233,166,198,140,16,243,125,113,114,59,22,217,69,150,33,140,203,119,
+25,246,37,3,99,45,47,3,156,225,68,181,193,114,57,238,190,25,9,227,111,91,8,147,239,112,94,42,179,249,
+214,154,79,96,123,242,248,141,209,64,121,79,133,1,93,215,226,102,91,51,139,149,70,68,140,21,173,171,202,79,
+148,241,6,239,131,194,167,129,183,121,174,239,158,120,196,129,78,111,236,129,103,245,168,174,59,69,156,136,126,150,
+227,126,147,79,2,220,231,249,76,212,209,233,68,200,226,116,53,110,33,174,86,227,180,197,24,188,111,135,218,66,
+30,71,35,47,98,141,120,124,79,103,83,72,63,89,115,178,186,121,157,136,58,247,191,203,171,125,191,213,104,174,
+43,254,192,157,166,178,27,33,190,145,132,38,124,39,216,39,105,251,90,121,106,44,250,167,66,136,128,239,28,239,
+168,159,241,125,61,103,100,227,220,190,223,225,190,200,157,162,79,79,45,253,109,69,77,164,106,124,199,103,242,129,
+32,178,138,111,145,36,94,174,212,43,250,6,143,243,138,49,40,107,169,169,186,237,161,145,163,111,243,202,255,112,
+227,250,37,157,198,253,23,1,162,82,159,224,46,0,0,
+};
+
+//! gzip with every optional header field
+const uint8_t OTA_FIXTURE_GZIP_FIELDS[] = {
+31,139,8,30,0,241,83,101,2,3,10,0,79,73,6,0,97,98,99,100,101,102,102,105,114,109,119,97,114,101,
+46,98,105,110,0,98,117,105,108,116,32,102,111,114,32,116,104,101,32,79,84,65,87,114,105,116,101,114,32,116,
+101,115,116,0,41,158,109,154,45,76,163,91,30,198,11,45,237,11,180,132,108,16,8,68,5,2,129,64,32,70,
+84,84,32,16,35,16,8,4,130,155,229,38,220,132,221,109,238,34,16,35,42,16,136,17,8,4,2,129,64,32,
+16,8,4,2,129,24,129,64,32,16,8,4,2,193,38,100,131,64,84,144,236,246,151,243,60,253,31,54,59,73,
+135,246,125,207,199,255,251,227,57,231,95,229,225,230,226,95,138,246,191,75,95,255,205,12,23,237,133,122,209,62,
+47,138,118,123,188,104,207,141,164,239,167,67,69,187,210,255,253,125,34,61,127,47,21,237,86,255,115,87,45,218,
+143,163,69,187,84,74,99,234,229,162,221,173,21,237,127,238,252,249,251,111,127,187,236,63,253,209,31,189,83,41,
+218,135,195,233,243,89,78,43,30,244,103,62,245,87,103,204,82,127,198,202,88,209,158,29,77,227,217,233,91,127,
+206,109,255,217,199,120,122,6,85,172,211,108,20,237,147,254,188,183,74,90,139,247,199,253,121,83,99,105,12,107,
+94,84,18,21,172,1,181,172,51,223,167,110,183,148,40,127,169,39,90,120,206,24,214,239,20,105,13,222,221,235,
+29,116,33,129,94,45,205,103,191,196,217,86,255,215,77,255,215,98,145,228,192,202,103,245,68,13,220,253,167,255,
+111,173,191,202,63,58,191,255,253,143,63,255,248,231,213,120,90,153,191,80,198,238,80,185,57,146,228,247,83,220,
+51,143,49,72,135,181,121,14,119,71,141,196,29,115,246,202,73,66,27,163,105,46,243,224,10,73,174,247,199,189,
+22,137,171,95,125,93,161,207,253,254,223,233,170,41,135,90,158,176,42,60,194,51,59,177,10,60,34,63,70,195,
+5,223,161,4,138,161,234,121,40,205,185,207,56,131,50,116,87,145,158,176,8,184,64,18,172,135,197,48,151,113,
+80,91,212,210,152,73,89,82,71,92,34,61,168,103,252,118,61,81,206,254,124,135,6,126,91,247,112,202,59,91,
+45,180,30,143,198,111,211,246,34,137,237,200,14,144,10,124,34,65,190,163,91,116,186,39,155,68,43,200,98,185,
+255,251,175,191,253,237,247,63,127,131,114,244,152,126,165,255,121,139,101,32,5,36,133,238,25,3,71,123,122,183,
+90,77,254,192,106,60,71,39,112,119,93,11,107,75,171,189,201,86,121,195,83,180,138,101,49,131,85,144,13,114,
+199,195,144,13,227,224,129,149,249,205,120,198,33,83,120,133,103,228,206,174,140,97,77,188,18,106,126,200,178,224,
+19,157,181,101,173,216,3,58,67,174,201,74,208,30,154,194,62,177,16,70,179,27,31,102,91,210,252,70,35,80,
+137,79,32,27,52,133,76,248,142,116,161,6,222,145,54,156,194,13,187,241,14,173,97,57,117,201,13,206,22,196,
+1,146,129,107,190,179,190,173,3,142,161,20,110,145,84,73,81,134,117,15,6,118,142,38,206,228,203,172,140,60,
+225,8,206,216,25,63,192,182,74,165,144,25,239,240,117,83,15,53,172,136,124,152,203,122,172,187,172,40,135,236,
+144,16,84,188,73,246,200,61,105,150,89,179,178,120,232,69,115,236,6,47,248,230,189,228,132,103,48,22,43,133,
+82,228,135,70,177,246,150,40,97,87,120,231,25,154,134,42,108,243,70,114,43,41,22,163,131,189,65,148,218,148,
+255,110,73,247,214,26,210,111,137,18,118,173,100,81,107,82,148,217,63,60,31,170,144,13,210,71,210,204,195,234,
+249,142,69,164,29,225,11,41,158,202,2,209,81,75,177,17,59,130,23,158,179,35,116,218,26,237,177,69,45,162,
+52,207,31,20,93,216,109,87,57,6,126,177,220,87,89,110,189,28,156,193,229,163,236,195,25,196,107,195,1,28,
+33,21,244,2,77,216,159,223,219,243,94,148,105,110,149,81,206,164,85,124,29,29,218,230,209,145,173,7,62,55,
+148,189,248,192,43,207,28,221,248,205,222,247,138,199,204,69,46,60,227,119,210,78,162,25,123,64,210,182,111,44,
+109,74,25,12,185,161,37,232,194,22,88,239,102,160,111,56,228,109,71,186,68,167,88,9,146,124,84,22,65,178,
+72,172,39,171,225,47,59,224,93,112,141,79,64,21,227,152,179,57,146,198,161,153,61,197,37,180,226,124,128,70,
+216,15,201,224,87,140,159,151,39,62,254,143,116,153,255,75,30,188,173,108,185,44,90,160,23,26,176,53,246,90,
+19,205,93,249,44,26,192,194,95,85,153,48,15,126,46,100,25,222,7,58,216,187,80,164,101,13,230,48,134,61,
+242,72,110,205,57,19,195,55,235,66,31,86,135,230,208,58,218,130,94,71,57,203,160,80,196,178,140,216,143,239,
+88,168,233,201,105,67,91,232,164,39,47,103,223,188,66,64,147,240,13,15,236,139,21,195,11,52,241,59,168,94,
+144,244,46,84,189,64,17,31,108,118,99,52,108,40,205,72,214,225,184,67,164,194,158,24,123,174,121,27,170,65,
+224,250,73,254,145,230,34,179,119,69,169,141,209,240,58,244,1,111,208,237,250,13,207,96,7,232,101,117,100,4,
+221,120,217,147,42,157,181,225,144,249,165,60,189,41,189,179,22,50,194,14,231,101,87,188,103,13,158,91,31,204,
+157,84,76,126,148,215,66,39,123,255,148,215,30,41,227,32,103,36,100,57,127,14,114,187,235,43,215,113,139,242,
+22,228,138,37,178,2,150,6,183,80,113,171,140,217,206,34,233,133,162,39,239,93,141,118,107,17,191,215,84,79,
+187,162,129,75,190,39,141,108,168,6,91,81,157,91,82,93,195,238,140,34,202,88,142,240,186,44,62,89,29,249,
+176,114,226,165,80,165,74,252,64,218,88,16,210,56,146,100,167,164,123,91,19,94,75,252,129,246,55,85,71,151,
+146,180,115,110,83,177,23,141,159,171,66,228,61,188,118,84,215,96,99,214,2,227,143,21,123,121,182,144,85,113,
+172,199,60,103,153,196,255,189,170,38,199,35,40,218,82,62,153,205,108,141,21,18,159,140,32,234,48,138,55,72,
+134,125,211,219,11,213,119,91,146,13,111,92,219,33,211,201,137,175,117,98,154,53,175,156,233,167,200,201,93,138,
+115,50,251,216,86,210,44,116,247,93,49,41,113,227,236,136,29,53,69,23,242,223,148,21,194,205,140,58,11,100,
+142,108,119,21,101,15,85,165,252,24,143,72,60,165,188,247,145,217,219,139,162,243,161,50,239,79,117,41,159,229,
+168,98,160,200,117,90,162,204,179,119,228,55,251,226,240,88,90,131,99,172,246,84,241,220,221,10,153,143,223,238,
+175,214,37,79,184,170,200,94,145,12,50,223,81,181,214,81,29,253,161,110,49,143,113,142,23,203,170,102,176,136,
+147,145,188,222,174,151,163,138,122,149,127,150,84,95,247,148,7,121,230,74,221,217,96,127,34,186,66,168,190,171,
+134,254,14,21,117,121,111,159,172,43,147,89,158,124,118,100,61,232,7,27,117,45,114,169,140,121,40,29,110,73,
+238,60,195,75,157,113,93,167,226,99,236,101,235,53,247,238,76,93,23,158,42,147,116,101,95,59,149,232,169,209,
+78,83,117,225,173,236,96,89,178,121,80,23,132,173,221,43,75,254,82,103,224,76,78,132,88,80,198,122,151,63,
+39,91,224,27,171,184,186,105,143,71,85,106,59,233,202,23,89,9,105,62,171,130,199,58,145,72,73,149,11,92,
+216,51,160,154,53,211,46,219,170,247,248,219,145,204,92,163,186,134,157,149,7,61,168,183,245,238,7,213,168,172,
+221,5,237,41,43,51,118,70,25,114,114,34,98,202,163,42,10,246,177,60,152,239,12,100,159,73,212,193,255,146,
+36,85,87,151,130,85,240,225,217,110,41,170,208,109,89,19,43,222,40,78,177,227,130,172,148,136,235,236,225,158,
+224,89,85,42,84,91,251,221,172,38,192,98,224,134,177,80,86,81,221,192,218,208,131,118,137,14,61,229,85,116,
+193,248,207,114,200,30,89,51,167,61,30,216,71,71,22,103,157,65,159,159,51,167,174,250,11,203,62,150,244,95,
+20,165,207,50,13,96,35,15,141,168,88,55,71,34,138,177,239,137,104,54,63,200,200,72,70,142,106,20,202,132,
+142,149,104,0,111,66,46,119,170,11,150,84,233,186,122,65,251,31,66,158,182,37,227,79,213,63,221,90,100,177,
+55,245,39,171,170,245,24,203,179,83,117,142,209,171,27,193,192,54,236,251,45,85,131,140,156,86,247,236,188,98,
+84,104,70,253,61,118,138,38,242,158,228,90,61,200,145,108,121,87,62,102,111,96,221,5,121,25,20,157,140,132,
+101,236,170,234,118,159,244,166,154,223,29,25,52,155,22,184,194,235,220,111,156,169,178,121,144,149,62,203,222,159,
+20,251,154,242,37,214,117,37,204,247,21,85,25,246,7,44,130,191,214,96,160,29,37,217,190,107,50,219,28,186,
+66,23,248,199,199,120,222,117,92,42,170,159,213,163,223,113,245,242,75,85,226,131,104,126,145,55,237,79,132,101,
+193,131,49,2,103,110,118,189,82,213,223,81,156,118,117,9,37,182,64,227,4,167,234,72,87,148,163,249,238,46,
+101,95,217,141,53,110,100,15,198,234,126,41,22,187,234,94,46,135,140,161,243,161,17,61,166,59,101,246,202,123,
+74,163,156,27,66,11,146,44,87,171,209,177,223,72,163,174,138,188,42,239,166,228,223,238,153,94,100,199,88,39,
+171,26,231,57,145,175,187,50,225,179,167,138,115,103,96,239,140,72,177,54,50,190,163,54,244,241,23,153,174,168,
+146,134,254,99,213,44,240,12,5,80,251,67,152,140,163,160,187,30,87,8,121,61,130,156,24,159,172,1,45,166,
+111,174,119,166,213,227,239,200,39,172,199,60,218,236,170,190,222,87,222,135,91,71,47,222,189,169,51,133,110,119,
+162,147,138,94,7,202,151,208,117,89,10,122,234,229,192,163,90,170,52,186,181,240,105,231,206,131,47,157,149,113,
+101,98,210,147,172,51,189,53,90,100,124,181,173,206,26,121,205,9,39,115,140,56,81,196,220,85,6,193,26,86,
+20,87,220,207,35,135,103,85,91,72,109,73,21,88,33,140,204,54,118,58,20,184,9,235,162,43,120,92,83,61,
+226,40,153,251,255,172,114,224,227,160,143,251,54,176,17,219,187,17,29,99,81,166,221,120,166,145,94,198,57,182,
+53,27,209,233,91,127,179,170,95,237,195,174,40,142,178,58,214,242,118,45,109,222,144,139,177,17,91,188,81,119,
+247,52,171,66,18,242,252,255,170,250,0,58,59,202,255,112,248,60,20,181,197,69,37,112,34,219,205,166,144,141,
+143,241,168,29,62,213,173,174,10,87,187,80,15,197,187,181,225,188,191,232,202,242,122,234,120,220,179,148,212,253,
+45,9,219,238,214,34,111,229,90,68,34,93,85,249,121,190,133,154,180,131,253,4,62,176,211,157,74,32,210,246,
+87,227,64,205,70,32,52,133,208,156,19,161,247,173,82,100,118,163,50,247,202,93,63,84,129,215,203,57,86,184,
+88,68,167,56,55,18,93,223,203,160,199,52,198,128,157,125,87,111,233,152,144,214,248,166,190,253,126,56,172,51,
+189,89,86,253,204,126,200,125,86,103,70,238,38,176,89,120,122,26,137,211,31,230,236,11,83,183,159,164,213,144,
+202,106,214,229,204,100,167,41,104,210,150,125,35,175,177,156,59,138,114,88,218,133,50,60,252,249,124,131,119,88,
+176,249,56,80,36,153,23,254,233,113,129,174,250,68,97,73,149,223,177,124,97,114,34,112,20,163,91,140,255,16,
+111,119,58,223,113,12,89,24,96,2,208,112,40,171,126,104,68,23,212,203,80,192,28,83,50,230,223,82,247,238,
+126,202,189,116,212,65,251,19,129,25,63,41,62,185,111,112,38,49,134,145,199,20,159,176,25,9,115,39,253,174,
+188,14,181,133,170,184,64,129,119,42,57,71,174,162,91,234,16,141,157,246,106,129,125,182,149,237,108,61,15,234,
+157,167,229,151,200,240,160,26,154,247,186,231,66,246,223,213,177,220,15,71,15,201,247,182,80,37,236,212,177,36,
+81,150,254,135,199,251,225,232,134,14,68,167,61,194,245,152,235,166,158,206,126,46,75,65,199,174,122,68,107,108,
+118,52,176,92,104,219,145,206,173,181,232,146,30,133,26,187,203,107,143,71,212,193,15,61,195,217,107,86,152,168,
+241,79,226,200,198,104,32,213,62,157,221,208,184,153,225,36,93,227,172,183,99,145,97,91,165,64,29,144,194,149,
+78,166,140,34,190,22,113,226,123,87,141,179,167,37,85,83,149,12,153,232,213,34,3,191,212,191,34,100,70,212,
+54,229,221,236,241,67,149,153,177,102,91,1,90,222,82,245,123,94,196,153,88,87,82,124,151,213,124,19,222,192,
+179,117,117,245,248,199,181,98,179,35,224,129,50,229,187,170,229,7,201,172,217,8,159,55,173,79,170,177,42,66,
+86,125,170,253,164,76,238,158,4,26,25,195,30,121,37,195,250,93,157,19,177,239,102,166,191,99,233,40,183,2,
+91,252,158,34,180,51,151,43,104,123,128,163,75,175,22,61,211,180,106,69,159,89,215,203,95,171,137,159,99,97,
+83,238,188,141,22,127,87,110,58,106,68,69,205,231,173,18,104,112,212,60,238,40,239,135,191,158,67,204,137,98,
+159,139,44,213,2,173,103,165,173,161,160,52,63,169,61,211,154,206,31,72,115,74,184,243,117,118,202,246,36,188,
+198,213,240,150,206,83,123,217,62,115,138,15,238,253,23,101,89,182,100,239,99,75,40,106,129,181,109,13,69,180,
+119,79,197,92,159,191,93,170,38,109,9,149,205,179,198,133,50,132,181,189,158,89,209,166,78,168,93,165,231,39,
+111,72,126,73,167,189,231,69,156,111,61,232,108,211,150,60,167,216,124,56,28,24,159,145,118,159,69,181,165,73,
+91,248,249,224,76,153,17,129,176,86,20,191,31,84,47,76,235,244,61,48,161,214,255,248,108,156,1,207,40,182,
+175,168,42,112,109,119,58,20,121,224,168,241,245,70,64,183,22,232,136,61,251,86,125,25,123,206,73,207,174,213,
+78,117,75,224,120,52,78,5,124,102,186,88,68,93,86,81,191,214,42,69,207,246,125,112,218,106,180,27,187,254,
+57,22,148,207,15,114,224,15,229,129,179,122,156,26,212,213,103,78,9,129,239,20,209,107,55,133,14,193,195,230,
+72,68,89,230,249,44,115,83,104,253,186,250,119,222,195,155,113,200,43,225,234,142,204,216,92,91,183,89,166,171,
+113,62,254,170,219,39,137,210,57,173,154,99,70,59,149,192,102,221,159,172,55,190,226,48,57,218,191,172,174,228,
+38,171,65,239,116,106,124,45,92,230,189,20,168,182,207,120,19,5,174,217,183,134,34,122,219,247,246,39,226,247,
+119,213,8,174,152,158,70,226,62,76,81,243,25,126,250,231,26,124,109,56,108,190,163,218,150,15,207,142,26,81,
+239,25,255,92,46,27,181,143,8,223,41,140,217,167,189,95,20,83,126,142,69,238,102,189,207,114,156,121,120,253,
+15,157,10,158,171,214,152,21,178,118,89,250,255,104,221,93,245,107,175,3,109,189,12,45,127,169,199,89,125,75,
+120,113,69,153,37,78,237,236,53,214,17,18,90,173,70,167,182,91,10,206,140,152,88,130,214,51,227,123,146,96,
+78,213,188,242,101,83,221,145,207,198,124,54,234,206,209,8,135,125,229,92,221,227,148,208,108,223,183,153,81,165,
+62,53,22,24,191,59,75,175,245,93,8,171,209,132,109,117,157,215,181,192,75,221,201,174,13,199,45,17,159,55,
+156,103,167,74,198,57,237,61,87,138,108,55,229,184,49,181,90,13,28,210,117,252,243,80,220,211,224,175,17,239,
+149,177,160,157,103,246,174,43,33,105,135,195,81,1,251,132,166,91,139,179,38,223,106,59,82,141,224,108,244,46,
+89,186,91,93,207,58,217,111,149,232,224,23,139,168,248,28,157,39,133,52,173,140,69,174,53,206,182,88,4,162,
+61,167,211,178,219,177,192,221,125,91,97,95,50,247,189,141,227,65,37,203,183,59,97,12,167,170,114,156,183,248,
+13,117,7,213,56,91,170,75,187,199,163,81,235,239,149,163,234,156,21,247,249,249,177,49,70,159,186,183,100,25,
+249,29,10,87,136,94,211,223,155,141,168,78,172,49,36,184,91,138,30,253,69,184,223,243,80,244,127,239,165,168,
+236,46,84,83,188,85,190,70,188,131,106,156,58,37,74,29,37,236,233,246,147,105,33,143,139,66,12,174,165,47,
+227,203,187,165,184,103,232,46,109,77,25,216,104,35,210,137,190,97,77,247,57,94,234,113,171,97,91,152,21,52,
+125,200,226,74,170,180,141,125,49,214,218,124,205,42,192,247,236,4,237,68,253,226,150,234,140,184,165,25,183,19,
+140,130,219,187,236,113,179,163,113,134,246,44,14,95,139,192,226,140,45,248,212,99,183,20,103,87,133,206,49,175,
+117,107,202,117,24,243,242,179,153,229,114,220,224,112,20,185,26,143,59,45,247,202,192,182,193,5,157,18,156,14,
+5,210,239,155,25,104,228,66,25,206,216,204,67,227,107,93,245,107,34,42,222,188,234,174,140,199,205,16,71,152,
+201,76,206,182,21,223,71,42,106,113,183,213,181,139,163,226,157,106,73,119,97,21,221,8,115,52,186,44,5,86,
+97,108,249,94,103,145,70,104,15,213,113,37,223,193,206,92,143,223,11,109,61,147,165,179,162,111,2,77,87,227,
+254,153,111,106,60,41,190,78,233,166,198,140,16,243,125,113,114,59,22,217,69,150,33,140,203,119,25,246,37,3,
+99,45,47,3,156,225,68,181,193,114,57,238,190,25,9,227,111,91,8,147,239,112,94,42,179,249,214,154,79,96,
+123,242,248,141,209,64,121,79,133,1,93,215,226,102,91,51,139,149,70,68,140,21,173,171,202,79,148,241,6,239,
+131,194,167,129,183,121,174,239,158,120,196,129,78,111,236,129,103,245,168,174,59,69,156,136,126,150,227,126,147,79,
+2,220,231,249,76,212,209,233,68,200,226,116,53,110,33,174,86,227,180,197,24,188,111,135,218,66,30,71,35,47,
+98,141,120,124,79,103,83,72,63,89,115,178,186,121,157,136,58,247,191,203,171,125,191,213,104,174,43,254,192,157,
+166,178,27,33,190,145,132,38,124,39,216,39,105,251,90,121,106,44,250,167,66,136,128,239,28,239,168,159,241,125,
+61,103,100,227,220,190,223,225,190,200,157,162,79,79,45,253,109,69,77,164,106,124,199,103,242,129,32,178,138,111,
+145,36,94,174,212,43,250,6,143,243,138,49,40,107,169,169,186,237,161,145,163,111,243,202,255,112,227,250,37,157,
+198,253,23,1,162,82,159,224,46,0,0,
+};
+
+//! the first half of OTA_FIXTURE_GZIP
+const uint8_t OTA_FIXTURE_GZIP_TRUNCATED[] = {
+31,139,8,0,0,0,0,0,2,3,109,154,45,76,163,91,30,198,11,45,237,11,180,132,108,16,8,68,5,2,
+129,64,32,70,84,84,32,16,35,16,8,4,130,155,229,38,220,132,221,109,238,34,16,35,42,16,136,17,8,4,
+2,129,64,32,16,8,4,2,129,24,129,64,32,16,8,4,2,193,38,100,131,64,84,144,236,246,151,243,60,253,
+31,54,59,73,135,246,125,207,199,255,251,227,57,231,95,229,225,230,226,95,138,246,191,75,95,255,205,12,23,237,
+133,122,209,62,47,138,118,123,188,104,207,141,164,239,167,67,69,187,210,255,253,125,34,61,127,47,21,237,86,255,
+115,87,45,218,143,163,69,187,84,74,99,234,229,162,221,173,21,237,127,238,252,249,251,111,127,187,236,63,253,209,
+31,189,83,41,218,135,195,233,243,89,78,43,30,244,103,62,245,87,103,204,82,127,198,202,88,209,158,29,77,227,
+217,233,91,127,206,109,255,217,199,120,122,6,85,172,211,108,20,237,147,254,188,183,74,90,139,247,199,253,121,83,
+99,105,12,107,94,84,18,21,172,1,181,172,51,223,167,110,183,148,40,127,169,39,90,120,206,24,214,239,20,105,
+13,222,221,235,29,116,33,129,94,45,205,103,191,196,217,86,255,215,77,255,215,98,145,228,192,202,103,245,68,13,
+220,253,167,255,111,173,191,202,63,58,191,255,253,143,63,255,248,231,213,120,90,153,191,80,198,238,80,185,57,146,
+228,247,83,220,51,143,49,72,135,181,121,14,119,71,141,196,29,115,246,202,73,66,27,163,105,46,243,224,10,73,
+174,247,199,189,22,137,171,95,125,93,161,207,253,254,223,233,170,41,135,90,158,176,42,60,194,51,59,177,10,60,
+34,63,70,195,5,223,161,4,138,161,234,121,40,205,185,207,56,131,50,116,87,145,158,176,8,184,64,18,172,135,
+197,48,151,113,80,91,212,210,152,73,89,82,71,92,34,61,168,103,252,118,61,81,206,254,124,135,6,126,91,247,
+112,202,59,91,45,180,30,143,198,111,211,246,34,137,237,200,14,144,10,124,34,65,190,163,91,116,186,39,155,68,
+43,200,98,185,255,251,175,191,253,237,247,63,127,131,114,244,152,126,165,255,121,139,101,32,5,36,133,238,25,3,
+71,123,122,183,90,77,254,192,106,60,71,39,112,119,93,11,107,75,171,189,201,86,121,195,83,180,138,101,49,131,
+85,144,13,114,199,195,144,13,227,224,129,149,249,205,120,198,33,83,120,133,103,228,206,174,140,97,77,188,18,106,
+126,200,178,224,19,157,181,101,173,216,3,58,67,174,201,74,208,30,154,194,62,177,16,70,179,27,31,102,91,210,
+252,70,35,80,137,79,32,27,52,133,76,248,142,116,161,6,222,145,54,156,194,13,187,241,14,173,97,57,117,201,
+13,206,22,196,1,146,129,107,190,179,190,173,3,142,161,20,110,145,84,73,81,134,117,15,6,118,142,38,206,228,
+203,172,140,60,225,8,206,216,25,63,192,182,74,165,144,25,239,240,117,83,15,53,172,136,124,152,203,122,172,187,
+172,40,135,236,144,16,84,188,73,246,200,61,105,150,89,179,178,120,232,69,115,236,6,47,248,230,189,228,132,103,
+48,22,43,133,82,228,135,70,177,246,150,40,97,87,120,231,25,154,134,42,108,243,70,114,43,41,22,163,131,189,
+65,148,218,148,255,110,73,247,214,26,210,111,137,18,118,173,100,81,107,82,148,217,63,60,31,170,144,13,210,71,
+210,204,195,234,249,142,69,164,29,225,11,41,158,202,2,209,81,75,177,17,59,130,23,158,179,35,116,218,26,237,
+177,69,45,162,52,207,31,20,93,216,109,87,57,6,126,177,220,87,89,110,189,28,156,193,229,163,236,195,25,196,
+107,195,1,28,33,21,244,2,77,216,159,223,219,243,94,148,105,110,149,81,206,164,85,124,29,29,218,230,209,145,
+173,7,62,55,148,189,248,192,43,207,28,221,248,205,222,247,138,199,204,69,46,60,227,119,210,78,162,25,123,64,
+210,182,111,44,109,74,25,12,185,161,37,232,194,22,88,239,102,160,111,56,228,109,71,186,68,167,88,9,146,124,
+84,22,65,178,72,172,39,171,225,47,59,224,93,112,141,79,64,21,227,152,179,57,146,198,161,153,61,197,37,180,
+226,124,128,70,216,15,201,224,87,140,159,151,39,62,254,143,116,153,255,75,30,188,173,108,185,44,90,160,23,26,
+176,53,246,90,19,205,93,249,44,26,192,194,95,85,153,48,15,126,46,100,25,222,7,58,216,187,80,164,101,13,
+230,48,134,61,242,72,110,205,57,19,195,55,235,66,31,86,135,230,208,58,218,130,94,71,57,203,160,80,196,178,
+140,216,143,239,88,168,233,201,105,67,91,232,164,39,47,103,223,188,66,64,147,240,13,15,236,139,21,195,11,52,
+241,59,168,94,144,244,46,84,189,64,17,31,108,118,99,52,108,40,205,72,214,225,184,67,164,194,158,24,123,174,
+121,27,170,65,224,250,73,254,145,230,34,179,119,69,169,141,209,240,58,244,1,111,208,237,250,13,207,96,7,232,
+101,117,100,4,221,120,217,147,42,157,181,225,144,249,165,60,189,41,189,179,22,50,194,14,231,101,87,188,103,13,
+158,91,31,204,157,84,76,126,148,215,66,39,123,255,148,215,30,41,227,32,103,36,100,57,127,14,114,187,235,43,
+215,113,139,242,22,228,138,37,178,2,150,6,183,80,113,171,140,217,206,34,233,133,162,39,239,93,141,118,107,17,
+191,215,84,79,187,162,129,75,190,39,141,108,168,6,91,81,157,91,82,93,195,238,140,34,202,88,142,240,186,44,
+62,89,29,249,176,114,226,165,80,165,74,252,64,218,88,16,210,56,146,100,167,164,123,91,19,94,75,252,129,246,
+55,85,71,151,146,180,115,110,83,177,23,141,159,171,66,228,61,188,118,84,215,96,99,214,2,227,143,21,123,121,
+182,144,85,113,172,199,60,103,153,196,255,189,170,38,199,35,40,218,82,62,153,205,108,141,21,18,159,140,32,234,
+48,138,55,72,134,125,211,219,11,213,119,91,146,13,111,92,219,33,211,201,137,175,117,98,154,53,175,156,233,167,
+200,201,93,138,115,50,251,216,86,210,44,116,247,93,49,41,113,227,236,136,29,53,69,23,242,223,148,21,194,205,
+140,58,11,100,142,108,119,21,101,15,85,165,252,24,143,72,60,165,188,247,145,217,219,139,162,243,161,50,239,79,
+117,41,159,229,168,98,160,200,117,90,162,204,179,119,228,55,251,226,240,88,90,131,99,172,246,84,241,220,221,10,
+153,143,223,238,175,214,37,79,184,170,200,94,145,12,50,223,81,181,214,81,29,253,161,110,49,143,113,142,23,203,
+170,102,176,136,147,145,188,222,174,151,163,138,122,149,127,150,84,95,247,148,7,121,230,74,221,217,96,127,34,186,
+66,168,190,171,134,254,14,21,117,121,111,159,172,43,147,89,158,124,118,100,61,232,7,27,117,45,114,169,140,121,
+40,29,110,73,238,60,195,75,157,113,93,167,226,99,236,101,235,53,247,238,76,93,23,158,42,147,116,101,95,59,
+149,232,169,209,78,83,117,225,173,236,96,89,178,121,80,23,132,173,221,43,75,254,82,103,224,76,78,132,88,80,
+198,122,151,63,39,91,224,27,171,184,186,105,143,71,85,106,59,233,202,23,89,9,105,62,171,130,199,58,145,72,
+73,149,11,92,216,51,160,154,53,211,46,219,170,247,248,219,145,204,92,163,186,134,157,149,7,61,168,183,245,238,
+7,213,168,172,221,5,237,41,43,51,118,70,25,114,114,34,98,202,163,42,10,246,177,60,152,239,12,100,159,73,
+212,193,255,146,36,85,87,151,130,85,240,225,217,110,41,170,208,109,89,19,43,222,40,78,177,227,130,172,148,136,
+235,236,225,158,224,89,85,42,84,91,251,221,172,38,192,98,224,134,177,80,86,81,221,192,218,208,131,118,137,14,
+61,229,85,116,193,248,207,114,200,30,89,51,167,61,30,216,71,71,22,103,157,65,159,159,51,167,174,250,11,203,
+62,150,244,95,20,165,207,50,13,96,35,15,141,168,88,55,71,34,138,177,239,137,104,54,63,200,200,72,70,142,
+106,20,202,132,142,149,104,0,111,66,46,119,170,11,150,84,233,186,122,65,251,31,66,158,182,37,227,79,213,63,
+221,90,100,177,55,245,39,171,170,245,24,203,179,83,117,142,209,171,27,193,192,54,236,251,45,85,131,140,156,86,
+247,236,188,98,84,104,70,253,61,118,138,38,242,158,228,90,61,200,145,108,121,87,62,102,111,96,221,5,121,25,
+20,157,140,132,101,236,170,234,118,159,244,166,154,223,29,25,52,155,22,184,194,235,220,111,156,169,178,121,144,149,
+62,203,222,159,20,251,154,242,37,214,117,37,204,247,21,85,25,246,7,44,130,191,214,96,160,29,37,217,190,107,
+50,219,28,186,66,23,248,199,199,120,222,117,92,42,170,159,213,163,223,113,245,242,75,85,226,131,104,126,145,55,
+237,79,132,101,193,131,49,2,103,110,118,189,82,213,223,81,156,118,117,9,37,182,64,227,4,167,234,72,87,148,
+163,249,238,46,101,95,217,141,53,110,100,15,198,234,126,41,22,187,234,94,46,135,140,161,243,161,17,61,166,59,
+101,246,202,123,74,163,156,27,66,11,146,44,87,171,209,177,223,72,163,174,138,188,
+};
+
+#define OTA_FIXTURE_IMAGE_SHA256 "68a6c3e3c8cdbf0f6e3eff2e1cfc29ba18aec727bed5ef1a01bc677097a08dac"
+#define OTA_FIXTURE_IMAGE_MD5 "e589830756fd7a92b1366ddad59bd84a"
+#define OTA_FIXTURE_GZIP_MD5 "619b24907b3f655894e95d8b94ed06e1"
+#define OTA_FIXTURE_GZIP_FIELDS_MD5 "bedd63348d28ff8098a7068a14b722fc"
+#define OTA_FIXTURE_GZIP_TRUNCATED_MD5 "0db6e7996202f22a72e8bb37c5cdeb57"
+#define OTA_FIXTURE_WRONG_SHA256 "56a37f7b1902fef94e07c21c24d158e01c5c9f885c00b89f13865dcaf5628cdf"
+#define OTA_FIXTURE_WRONG_MD5 "34ae2006f3fc5bba6098149c56abf379"
+
+#endif  // OTA_FIXTURES_H
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "network/OTAWriter/OTAWriter.hpp"
+#include "otaFixtures.h"
+
+namespace {
+  //! a byte at a time, odd splits, a TCP segment, and more than any fixture
+  constexpr size_t CHUNK_SIZES[] = {1, 7, 1460, 65535};
+
+  std::vector<uint8_t> bytes(const uint8_t* data, size_t len) {
+    return std::vector<uint8_t>(data, data + len);
+  }
+
+  class OTAWriterTest : public ::testing::Test {
+   protected:
+    void SetUp() override { Hal::Host::reset(); }
+
+    //! the whole upload in chunks of chunkSize, false at the first failure
+    bool upload(const std::vector<uint8_t>& data,
+                size_t chunkSize,
+                const char* md5,
+                const char* sha256) {
+      if (!this->writer.begin(U_FLASH, md5, sha256))
+        return false;
+      for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+        size_t len = std::min(chunkSize, data.size() - offset);
+        if (!this->writer.write(data.data() + offset, len))
+          return false;
+      }
+      return this->writer.end();
+    }
+
+    void expectFlashed() {
+      EXPECT_EQ(this->writer.getError(), nullptr);
+      EXPECT_TRUE(Hal::Host::ota().ended);
+      EXPECT_FALSE(Hal::Host::ota().aborted);
+      EXPECT_EQ(Hal::Host::ota().image, bytes(OTA_FIXTURE_IMAGE,
+                                              sizeof(OTA_FIXTURE_IMAGE)));
+    }
+
+    void expectRejected(const char* error) {
+      ASSERT_NE(this->writer.getError(), nullptr);
+      EXPECT_STREQ(this->writer.getError(), error);
+      EXPECT_FALSE(Hal::Host::ota().ended);
+      EXPECT_TRUE(Hal::Host::ota().aborted);
+    }
+
+    OTAWriter writer;
+    const std::vector<uint8_t> raw =
+        bytes(OTA_FIXTURE_IMAGE, sizeof(OTA_FIXTURE_IMAGE));
+    const std::vector<uint8_t> gzip =
+        bytes(OTA_FIXTURE_GZIP, sizeof(OTA_FIXTURE_GZIP));
+  };
+}  // namespace
+
+TEST_F(OTAWriterTest, WritesARawImageAtEveryChunkSize) {
+  for (size_t chunkSize : CHUNK_SIZES) {
+    SCOPED_TRACE(chunkSize);
+    Hal::Host::reset();
+    EXPECT_TRUE(this->upload(this->raw, chunkSize, OTA_FIXTURE_IMAGE_MD5,
+                             OTA_FIXTURE_IMAGE_SHA256));
+    this->expectFlashed();
+    EXPECT_EQ(Hal::Host::ota().command, U_FLASH);
+  }
+}
+
+TEST_F(OTAWriterTest, InflatesGzipAtEveryChunkSize) {
+  for (size_t chunkSize : CHUNK_SIZES) {
+    SCOPED_TRACE(chunkSize);
+    Hal::Host::reset();
+    // the MD5 covers the upload, the SHA-256 the image
+    EXPECT_TRUE(this->upload(this->gzip, chunkSize, OTA_FIXTURE_GZIP_MD5,
+                             OTA_FIXTURE_IMAGE_SHA256));
+    this->expectFlashed();
+  }
+}
+
+TEST_F(OTAWriterTest, SkipsEveryOptionalGzipHeaderField) {
+  auto fields = bytes(OTA_FIXTURE_GZIP_FIELDS, sizeof(OTA_FIXTURE_GZIP_FIELDS));
+  for (size_t chunkSize : CHUNK_SIZES) {
+    SCOPED_TRACE(chunkSize);
+    Hal::Host::reset();
+    EXPECT_TRUE(this->upload(fields, chunkSize, OTA_FIXTURE_GZIP_FIELDS_MD5,
+                             OTA_FIXTURE_IMAGE_SHA256));
+    this->expectFlashed();
+  }
+}
+
+TEST_F(OTAWriterTest, EitherDigestIsEnough) {
+  EXPECT_TRUE(this->upload(this->gzip, 1460, "", OTA_FIXTURE_IMAGE_SHA256));
+  this->expectFlashed();
+  Hal::Host::reset();
+  EXPECT_TRUE(this->upload(this->gzip, 1460, OTA_FIXTURE_GZIP_MD5, nullptr));
+  this->expectFlashed();
+}
+
+TEST_F(OTAWriterTest, RejectsATruncatedUpload) {
+  auto truncated =
+      bytes(OTA_FIXTURE_GZIP_TRUNCATED, sizeof(OTA_FIXTURE_GZIP_TRUNCATED));
+  for (size_t chunkSize : CHUNK_SIZES) {
+    SCOPED_TRACE(chunkSize);
+    Hal::Host::reset();
+    EXPECT_FALSE(this->upload(truncated, chunkSize,
+                              OTA_FIXTURE_GZIP_TRUNCATED_MD5,
+                              OTA_FIXTURE_IMAGE_SHA256));
+    this->expectRejected("Upload ended in the middle of the image");
+  }
+}
+
+TEST_F(OTAWriterTest, RejectsAMissingTrailer) {
+  // the deflate stream is whole, the size in the trailer isn't
+  std::vector<uint8_t> cut(this->gzip.begin(), this->gzip.end() - 2);
+  EXPECT_FALSE(this->upload(cut, 1460, nullptr, OTA_FIXTURE_IMAGE_SHA256));
+  this->expectRejected("Upload ended in the middle of the image");
+}
+
+TEST_F(OTAWriterTest, RejectsATrailerOfAnotherSize) {
+  std::vector<uint8_t> other = this->gzip;
+  other.back() ^= 1;
+  EXPECT_FALSE(this->upload(other, 1460, nullptr, OTA_FIXTURE_IMAGE_SHA256));
+  this->expectRejected("Inflated size does not match the gzip trailer");
+}
+
+TEST_F(OTAWriterTest, RejectsAWrongSha256) {
+  EXPECT_FALSE(this->upload(this->raw, 1460, nullptr, OTA_FIXTURE_WRONG_SHA256));
+  this->expectRejected("SHA256 mismatch");
+  Hal::Host::reset();
+  EXPECT_FALSE(
+      this->upload(this->gzip, 7, OTA_FIXTURE_GZIP_MD5, OTA_FIXTURE_WRONG_SHA256));
+  this->expectRejected("SHA256 mismatch");
+}
+
+TEST_F(OTAWriterTest, RejectsAWrongMd5) {
+  EXPECT_FALSE(this->upload(this->raw, 1460, OTA_FIXTURE_WRONG_MD5,
+                            OTA_FIXTURE_IMAGE_SHA256));
+  this->expectRejected("MD5 mismatch");
+  Hal::Host::reset();
+  // the image's MD5 isn't the upload's once it's compressed
+  EXPECT_FALSE(this->upload(this->gzip, 1460, OTA_FIXTURE_IMAGE_MD5, nullptr));
+  this->expectRejected("MD5 mismatch");
+}
+
+TEST_F(OTAWriterTest, RejectsCorruptDeflateData) {
+  // the header of OTA_FIXTURE_GZIP, then a final block of the reserved type
+  std::vector<uint8_t> corrupt(this->gzip.begin(), this->gzip.begin() + 10);
+  corrupt.insert(corrupt.end(), {0x07, 0x00, 0x00, 0x00});
+  EXPECT_FALSE(this->upload(corrupt, 1460, nullptr, OTA_FIXTURE_IMAGE_SHA256));
+  this->expectRejected("Corrupt gzip data");
+}
+
+TEST_F(OTAWriterTest, RejectsAnUnsupportedGzipHeader) {
+  std::vector<uint8_t> other = this->gzip;
+  // compression method 7 is reserved
+  other[2] = 7;
+  EXPECT_FALSE(this->upload(other, 1460, nullptr, OTA_FIXTURE_IMAGE_SHA256));
+  this->expectRejected("Unsupported gzip header");
+}
+
+TEST_F(OTAWriterTest, RejectsDataAfterTheImage) {
+  std::vector<uint8_t> longer = this->gzip;
+  longer.push_back(0);
+  EXPECT_FALSE(this->upload(longer, 65535, nullptr, OTA_FIXTURE_IMAGE_SHA256));
+  this->expectRejected("Data after the end of the image");
+}
+
+TEST_F(OTAWriterTest, DropsTheChunksAfterAnError) {
+  std::vector<uint8_t> other = this->gzip;
+  other[2] = 7;
+  ASSERT_TRUE(this->writer.begin(U_FLASH, nullptr, OTA_FIXTURE_IMAGE_SHA256));
+  EXPECT_FALSE(this->writer.write(other.data(), 1460));
+  EXPECT_FALSE(this->writer.write(other.data() + 1460, 1460));
+  EXPECT_FALSE(this->writer.end());
+  EXPECT_STREQ(this->writer.getError(), "Unsupported gzip header");
+  EXPECT_TRUE(Hal::Host::ota().image.empty());
+  EXPECT_FALSE(Hal::Host::ota().ended);
+}
+
+TEST_F(OTAWriterTest, NeedsAWellFormedDigest) {
+  EXPECT_FALSE(this->writer.begin(U_FLASH, "", ""));
+  EXPECT_STREQ(this->writer.getError(), "MD5 or SHA256 parameter missing");
+  EXPECT_FALSE(this->writer.begin(U_FLASH, "e589830756fd7a92", nullptr));
+  EXPECT_STREQ(this->writer.getError(), "MD5 parameter invalid");
+  EXPECT_FALSE(this->writer.begin(U_FLASH, nullptr, "not hex"));
+  EXPECT_STREQ(this->writer.getError(), "SHA256 parameter invalid");
+  // nothing was started
+  EXPECT_EQ(Hal::Host::ota().command, -1);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "data/config/project_config.hpp"
+
+namespace {
+  class Recorder : public IObserver<ConfigState_e> {
+   public:
+    void update(ConfigState_e event) override { this->events.push_back(event); }
+    std::string getName() override { return "recorder"; }
+    std::vector<ConfigState_e> events;
+  };
+
+  class ProjectConfigTest : public ::testing::Test {
+   protected:
+    void SetUp() override { Hal::Host::reset(); }
+  };
+}  // namespace
+
+TEST_F(ProjectConfigTest, DefaultsWhenNothingIsStored) {
+  ProjectConfig config("openiris", "eye");
+  config.load();
+
+  EXPECT_EQ(config.getDeviceConfig().OTAPort, 3232);
+  EXPECT_EQ(config.getMDNSConfig().hostname, "eye");
+  EXPECT_TRUE(config.getWifiConfigs().empty());
+  EXPECT_EQ(config.getWiFiTxPowerConfig().power, 78);
+  EXPECT_EQ(config.getCameraConfig().framesize, CAM_RESOLUTION);
+  EXPECT_EQ(config.getIREmitterConfig().intensity, 100);
+  EXPECT_EQ(config.getIREmitterConfig().duty, 100);
+
+  // the layout the haptic engine used to have hardcoded
+  auto& haptics = config.getHapticsConfig();
+  ASSERT_EQ(haptics.size(), 4u);
+  for (size_t i = 0; i < haptics.size(); i++) {
+    EXPECT_EQ(haptics[i].pin, (int8_t)(i + 2));
+    EXPECT_EQ(haptics[i].frequency, 20000u);
+  }
+}
+
+TEST_F(ProjectConfigTest, SaveRestartsAndLoadReadsItBack) {
+  {
+    ProjectConfig config("openiris", "eye");
+    config.load();
+    config.setMDNSConfig("left", "openiristracker", false);
+    config.setWifiConfig("main", "home", "secret", 6, 52, false, false);
+    config.setWifiConfig("second", "office", "hunter2", 11, 60, false, false);
+    config.setCameraConfig(1, 5, 1, 12, 3, false);
+    config.setIREmitterConfig(1, 80, 25, false);
+    config.setWiFiTxPower(44, false);
+    config.deleteHapticChannelConfig(3, false);
+    config.setHapticChannelConfig(0, 7, "Chin", 25000, 8,
+                                  ProjectConfig::HapticCurve_Quadratic, false);
+    config.save();
+  }
+  EXPECT_EQ(Hal::Host::restartRequested(), 2000);
+
+  ProjectConfig config("openiris", "eye");
+  config.load();
+  EXPECT_EQ(config.getMDNSConfig().hostname, "left");
+
+  auto& networks = config.getWifiConfigs();
+  ASSERT_EQ(networks.size(), 2u);
+  EXPECT_EQ(networks[0].ssid, "home");
+  EXPECT_EQ(networks[0].password, "secret");
+  EXPECT_EQ(networks[0].channel, 6);
+  EXPECT_EQ(networks[1].name, "second");
+  EXPECT_EQ(networks[1].ssid, "office");
+  EXPECT_EQ(networks[1].power, 60);
+
+  EXPECT_EQ(config.getCameraConfig().vflip, 1);
+  EXPECT_EQ(config.getCameraConfig().framesize, 5);
+  EXPECT_EQ(config.getCameraConfig().quality, 12);
+  EXPECT_EQ(config.getIREmitterConfig().mode, 1);
+  EXPECT_EQ(config.getIREmitterConfig().intensity, 80);
+  EXPECT_EQ(config.getIREmitterConfig().duty, 25);
+  EXPECT_EQ(config.getWiFiTxPowerConfig().power, 44);
+
+  auto& haptics = config.getHapticsConfig();
+  ASSERT_EQ(haptics.size(), 3u);
+  EXPECT_EQ(haptics[0].pin, 7);
+  EXPECT_EQ(haptics[0].name, "Chin");
+  EXPECT_EQ(haptics[0].frequency, 25000u);
+  EXPECT_EQ(haptics[0].resolution, 8);
+  EXPECT_EQ(haptics[0].curve, ProjectConfig::HapticCurve_Quadratic);
+  EXPECT_EQ(haptics[2].pin, 4);
+}
+
+TEST_F(ProjectConfigTest, UpdatesAnExistingNetworkByName) {
+  ProjectConfig config("openiris", "eye");
+  config.load();
+  config.setWifiConfig("main", "home", "secret", 6, 52, false, false);
+  config.setWifiConfig("main", "home", "changed", 1, 52, false, false);
+
+  ASSERT_EQ(config.getWifiConfigs().size(), 1u);
+  EXPECT_EQ(config.getWifiConfigs()[0].password, "changed");
+
+  config.deleteWifiConfig("main", false);
+  EXPECT_TRUE(config.getWifiConfigs().empty());
+}
+
+TEST_F(ProjectConfigTest, ClampsTheIREmitter) {
+  ProjectConfig config("openiris", "eye");
+  config.load();
+  config.setIREmitterConfig(1, 250, 0, false);
+  EXPECT_EQ(config.getIREmitterConfig().intensity, 100);
+  EXPECT_EQ(config.getIREmitterConfig().duty, 1);
+
+  config.setIREmitterConfig(1, 40, 200, false);
+  EXPECT_EQ(config.getIREmitterConfig().intensity, 40);
+  EXPECT_EQ(config.getIREmitterConfig().duty, 100);
+}
+
+TEST_F(ProjectConfigTest, HapticChannelsAppendOnlyAtTheEnd) {
+  ProjectConfig config("openiris", "eye");
+  config.load();
+  auto& haptics = config.getHapticsConfig();
+
+  // past the end is refused, one past it appends
+  EXPECT_FALSE(config.setHapticChannelConfig(5, 9, "Gap", 20000, 10, 0, false));
+  while (haptics.size() < ProjectConfig::maxHapticChannels) {
+    EXPECT_TRUE(config.setHapticChannelConfig(haptics.size(), 9, "More", 20000,
+                                              10, 0, false));
+  }
+  EXPECT_FALSE(config.setHapticChannelConfig(haptics.size(), 9, "Full", 20000,
+                                             10, 0, false));
+  EXPECT_EQ(haptics.size(), ProjectConfig::maxHapticChannels);
+
+  // an unknown curve falls back to the last one there is
+  EXPECT_TRUE(config.setHapticChannelConfig(0, 9, "Curve", 20000, 10, 77, false));
+  EXPECT_EQ(haptics[0].curve, ProjectConfig::HapticCurve_SquareRoot);
+}
+
+TEST_F(ProjectConfigTest, LoadKeepsStoredHapticsWithinTheLimit) {
+  Hal::Storage storage;
+  storage.begin("openiris");
+  storage.putInt("hapticCount", 40);
+  storage.end();
+
+  ProjectConfig config("openiris", "eye");
+  config.load();
+  EXPECT_EQ(config.getHapticsConfig().size(), ProjectConfig::maxHapticChannels);
+  // nothing stored for the channels themselves
+  EXPECT_EQ(config.getHapticsConfig()[0].pin, -1);
+}
+
+TEST_F(ProjectConfigTest, CommitStoresAndNotifiesOnlyTouchedSections) {
+  ProjectConfig config("openiris", "eye");
+  Recorder recorder;
+  config.attach(recorder);
+  config.load();
+  ASSERT_EQ(recorder.events.size(), 1u);
+  EXPECT_EQ(recorder.events[0], ConfigState_e::configLoaded);
+  recorder.events.clear();
+
+  ProjectConfig::TrackerConfig_t staged = config.getTrackerConfig();
+  staged.irEmitter.intensity = 30;
+  staged.mdns.hostname = "staged";
+  config.commitTrackerConfig(staged,
+                             1u << ConfigState_e::irEmitterConfigUpdated);
+
+  ASSERT_EQ(recorder.events.size(), 1u);
+  EXPECT_EQ(recorder.events[0], ConfigState_e::irEmitterConfigUpdated);
+  EXPECT_EQ(config.getMDNSConfig().hostname, "staged");
+  EXPECT_EQ(config.getInt("irIntensity", -1), 30);
+  // not touched, so not stored
+  EXPECT_FALSE(config.isKey("hostname"));
+  EXPECT_EQ(Hal::Host::restartRequested(), -1);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
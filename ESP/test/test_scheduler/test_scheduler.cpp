@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "tasks/scheduler.hpp"
+
+namespace {
+  constexpr int64_t MS = 1000;
+
+  class SchedulerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+      Hal::Host::reset();
+      this->scheduler.begin();
+    }
+
+    //! a job that notes when it ran
+    Scheduler::Job note(int id) {
+      return [this, id]() { this->runs.push_back({id, Hal::micros()}); };
+    }
+
+    struct Run_t {
+      int id;
+      int64_t atUs;
+      bool operator==(const Run_t& other) const {
+        return id == other.id && atUs == other.atUs;
+      }
+    };
+
+    Scheduler scheduler;
+    std::vector<Run_t> runs;
+  };
+}  // namespace
+
+TEST_F(SchedulerTest, RunsOnceWhenDue) {
+  this->scheduler.scheduleAfter(100, this->note(1));
+  Hal::Host::advance(100 * MS - 1);
+  EXPECT_TRUE(this->runs.empty());
+  Hal::Host::advance(1);
+  Hal::Host::advance(1000 * MS);
+  EXPECT_EQ(this->runs, (std::vector<Run_t>{{1, 100 * MS}}));
+}
+
+TEST_F(SchedulerTest, RunsInTheOrderTheyAreDue) {
+  this->scheduler.scheduleAfter(300, this->note(3));
+  this->scheduler.scheduleAfter(100, this->note(1));
+  this->scheduler.scheduleAfter(200, this->note(2));
+  Hal::Host::advance(1000 * MS);
+  EXPECT_EQ(this->runs, (std::vector<Run_t>{
+                            {1, 100 * MS}, {2, 200 * MS}, {3, 300 * MS}}));
+}
+
+TEST_F(SchedulerTest, JobsScheduledBeforeBeginWaitForIt) {
+  Scheduler later;
+  later.scheduleAfter(10, this->note(1));
+  Hal::Host::advance(50 * MS);
+  EXPECT_TRUE(this->runs.empty());
+  later.begin();
+  Hal::Host::advance(0);
+  EXPECT_EQ(this->runs, (std::vector<Run_t>{{1, 50 * MS}}));
+}
+
+TEST_F(SchedulerTest, Periodic) {
+  Scheduler::JobId id = this->scheduler.scheduleEvery(10, this->note(1));
+  EXPECT_EQ(this->scheduler.scheduleEvery(0, this->note(2)),
+            Scheduler::INVALID_JOB);
+  Hal::Host::advance(35 * MS);
+  EXPECT_EQ(this->runs, (std::vector<Run_t>{
+                            {1, 10 * MS}, {1, 20 * MS}, {1, 30 * MS}}));
+
+  EXPECT_TRUE(this->scheduler.cancel(id));
+  Hal::Host::advance(100 * MS);
+  EXPECT_EQ(this->runs.size(), 3u);
+}
+
+TEST_F(SchedulerTest, CancelledJobsNeverRun) {
+  Scheduler::JobId id = this->scheduler.scheduleAfter(100, this->note(1));
+  this->scheduler.scheduleAfter(200, this->note(2));
+  EXPECT_TRUE(this->scheduler.cancel(id));
+  EXPECT_FALSE(this->scheduler.cancel(id));
+  EXPECT_FALSE(this->scheduler.cancel(Scheduler::INVALID_JOB));
+  Hal::Host::advance(1000 * MS);
+  EXPECT_EQ(this->runs, (std::vector<Run_t>{{2, 200 * MS}}));
+}
+
+TEST_F(SchedulerTest, IdsStayUniqueWhenASlotIsReused) {
+  Scheduler::JobId first = this->scheduler.scheduleAfter(10, this->note(1));
+  Hal::Host::advance(20 * MS);
+  Scheduler::JobId second = this->scheduler.scheduleAfter(10, this->note(2));
+  EXPECT_NE(first, second);
+  // the first one finished, its id must not cancel the job in its slot now
+  EXPECT_FALSE(this->scheduler.cancel(first));
+  Hal::Host::advance(20 * MS);
+  EXPECT_EQ(this->runs.size(), 2u);
+}
+
+TEST_F(SchedulerTest, JobsScheduleFollowUps) {
+  // the way the camera power cycle chains its steps
+  this->scheduler.scheduleAfter(300, [this]() {
+    this->runs.push_back({1, Hal::micros()});
+    this->scheduler.scheduleAfter(300, [this]() {
+      this->runs.push_back({2, Hal::micros()});
+      this->scheduler.scheduleAfter(0, this->note(3));
+    });
+  });
+  Hal::Host::advance(1000 * MS);
+  EXPECT_EQ(this->runs, (std::vector<Run_t>{
+                            {1, 300 * MS}, {2, 600 * MS}, {3, 600 * MS}}));
+}
+
+TEST_F(SchedulerTest, AnEarlierJobWakesTheTimerSooner) {
+  this->scheduler.scheduleAfter(1000, this->note(2));
+  Hal::Host::advance(100 * MS);
+  this->scheduler.scheduleAfter(50, this->note(1));
+  Hal::Host::advance(2000 * MS);
+  EXPECT_EQ(this->runs, (std::vector<Run_t>{{1, 150 * MS}, {2, 1000 * MS}}));
+}
+
+TEST_F(SchedulerTest, FullPoolDropsTheJob) {
+  std::vector<Scheduler::JobId> ids;
+  for (int i = 0; i < SCHEDULER_MAX_JOBS; i++) {
+    ids.push_back(this->scheduler.scheduleAfter(100 + i, this->note(i)));
+    EXPECT_NE(ids.back(), Scheduler::INVALID_JOB);
+  }
+  EXPECT_EQ(this->scheduler.scheduleAfter(10, this->note(99)),
+            Scheduler::INVALID_JOB);
+  EXPECT_EQ(this->scheduler.scheduleEvery(10, this->note(99)),
+            Scheduler::INVALID_JOB);
+
+  // a slot frees up once its job has run
+  Hal::Host::advance(100 * MS + 500);
+  EXPECT_NE(this->scheduler.scheduleAfter(10, this->note(99)),
+            Scheduler::INVALID_JOB);
+  Hal::Host::advance(1000 * MS);
+  EXPECT_EQ(this->runs.size(), (size_t)SCHEDULER_MAX_JOBS + 1);
+  // between the ones scheduled first
+  EXPECT_EQ(this->runs[11], (Run_t{99, 110 * MS + 500}));
+}
+
+TEST_F(SchedulerTest, RestartWaitsForTheDelay) {
+  this->scheduler.restartAfter(2000);
+  Hal::Host::advance(1999 * MS);
+  EXPECT_EQ(Hal::Host::restarted(), -1);
+  Hal::Host::advance(1 * MS);
+  EXPECT_EQ(Hal::Host::restarted(), 2000 * MS);
+}
+
+TEST_F(SchedulerTest, RestartRightAwayWhenThePoolIsFull) {
+  for (int i = 0; i < SCHEDULER_MAX_JOBS; i++)
+    this->scheduler.scheduleAfter(60000, this->note(i));
+  Hal::Host::advance(10 * MS);
+  this->scheduler.restartAfter(2000);
+  EXPECT_EQ(Hal::Host::restarted(), 10 * MS);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "network/stream/streamFraming.hpp"
+
+TEST(StreamFraming, PartHeader) {
+  char buffer[StreamFraming::PART_HEADER_SIZE];
+  size_t len = StreamFraming::partHeader(buffer, sizeof(buffer), 1234, 5000001);
+  EXPECT_EQ(std::string(buffer, len),
+            "Content-Type: image/jpeg\r\n"
+            "Content-Length: 1234\r\n"
+            "X-Timestamp: 5.000001\r\n"
+            "\r\n");
+  EXPECT_EQ(buffer[len], '\0');
+}
+
+TEST(StreamFraming, HostTimestampAndSyncSeq) {
+  char buffer[StreamFraming::PART_HEADER_SIZE];
+  size_t len = StreamFraming::partHeader(buffer, sizeof(buffer), 10, 12,
+                                         1700000000123456, 42);
+  EXPECT_EQ(std::string(buffer, len),
+            "Content-Type: image/jpeg\r\n"
+            "Content-Length: 10\r\n"
+            "X-Timestamp: 0.000012\r\n"
+            "X-Host-Timestamp: 1700000000.123456\r\n"
+            "X-Sync-Seq: 42\r\n"
+            "\r\n");
+}
+
+TEST(StreamFraming, UnchangedHeader) {
+  char buffer[StreamFraming::PART_HEADER_SIZE];
+  size_t len = StreamFraming::unchangedHeader(buffer, sizeof(buffer), 3000000);
+  EXPECT_EQ(std::string(buffer, len),
+            std::string("Content-Type: ") + StreamFraming::UNCHANGED_TYPE +
+                "\r\n"
+                "Content-Length: 0\r\n"
+                "X-Timestamp: 3.000000\r\n"
+                "X-Unchanged: 1\r\n"
+                "\r\n");
+}
+
+TEST(StreamFraming, TheLargestHeaderFits) {
+  char buffer[StreamFraming::PART_HEADER_SIZE];
+  EXPECT_GT(StreamFraming::partHeader(buffer, sizeof(buffer), UINT32_MAX,
+                                      INT64_MAX, INT64_MAX, INT32_MAX),
+            0u);
+  EXPECT_GT(StreamFraming::unchangedHeader(buffer, sizeof(buffer), INT64_MAX,
+                                           INT64_MAX, INT32_MAX),
+            0u);
+}
+
+TEST(StreamFraming, TooSmallABufferWritesNothing) {
+  char buffer[StreamFraming::PART_HEADER_SIZE];
+  size_t len = StreamFraming::partHeader(buffer, sizeof(buffer), 1234, 5000001,
+                                         1700000000123456, 42);
+  ASSERT_GT(len, 0u);
+  // the header and the terminating zero
+  for (size_t size = 0; size <= len; size++) {
+    EXPECT_EQ(StreamFraming::partHeader(buffer, size, 1234, 5000001,
+                                        1700000000123456, 42),
+              0u)
+        << size;
+  }
+  EXPECT_EQ(StreamFraming::partHeader(buffer, len + 1, 1234, 5000001,
+                                      1700000000123456, 42),
+            len);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
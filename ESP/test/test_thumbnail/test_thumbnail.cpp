@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "hal/syntheticCamera.hpp"
+#include "vision/thumbnail.hpp"
+
+namespace {
+  uint32_t get16(const uint8_t* in) {
+    return in[0] | (in[1] << 8);
+  }
+
+  uint32_t get32(const uint8_t* in) {
+    return get16(in) | (get16(in + 2) << 16);
+  }
+
+  //! the start of a JPEG up to a start of frame segment of the given marker
+  std::vector<uint8_t> jpegHeader(uint8_t marker,
+                                  uint16_t width,
+                                  uint16_t height) {
+    return {0xff, 0xd8,
+            // APP0, a segment to skip
+            0xff, 0xe0, 0x00, 0x06, 'J', 'F', 'I', 'F',
+            // fill bytes before a marker are allowed
+            0xff, 0xff,
+            // start of frame: length, precision, height, width, components
+            0xff, marker, 0x00, 0x0b, 0x08, (uint8_t)(height >> 8),
+            (uint8_t)height, (uint8_t)(width >> 8), (uint8_t)width, 0x01,
+            0x01, 0x11, 0x00};
+  }
+
+  class ThumbnailTest : public ::testing::Test {
+   protected:
+    void SetUp() override { Hal::Host::reset(); }
+  };
+}  // namespace
+
+TEST_F(ThumbnailTest, JpegSizeReadsACameraFrame) {
+  Hal::SyntheticCamera::Config_t config = {
+      320, 240, 60, Hal::SyntheticCamera::Jitter_None, 0, 9000, 0, 1};
+  Hal::SyntheticCamera camera(config);
+  Hal::Frame_t frame;
+  ASSERT_TRUE(camera.acquire(frame));
+  uint16_t width = 0, height = 0;
+  EXPECT_TRUE(Thumbnail::jpegSize(frame.data, frame.len, width, height));
+  camera.release(frame);
+  EXPECT_EQ(width, 320);
+  EXPECT_EQ(height, 240);
+}
+
+TEST_F(ThumbnailTest, JpegSizeSkipsToTheStartOfFrame) {
+  uint16_t width = 0, height = 0;
+  // baseline and progressive
+  for (uint8_t marker : {0xc0, 0xc2}) {
+    std::vector<uint8_t> jpeg = jpegHeader(marker, 1600, 1200);
+    EXPECT_TRUE(Thumbnail::jpegSize(jpeg.data(), jpeg.size(), width, height));
+    EXPECT_EQ(width, 1600);
+    EXPECT_EQ(height, 1200);
+  }
+}
+
+TEST_F(ThumbnailTest, JpegSizeSaysNothingWithoutAStartOfFrame) {
+  uint16_t width = 0, height = 0;
+  // DHT shares the range of the start of frame markers
+  std::vector<uint8_t> tables = jpegHeader(0xc4, 320, 240);
+  EXPECT_FALSE(Thumbnail::jpegSize(tables.data(), tables.size(), width, height));
+
+  std::vector<uint8_t> jpeg = jpegHeader(0xc0, 320, 240);
+  // cut in the middle of the start of frame
+  EXPECT_FALSE(Thumbnail::jpegSize(jpeg.data(), jpeg.size() - 8, width, height));
+  // a size of 0
+  std::vector<uint8_t> empty = jpegHeader(0xc0, 0, 240);
+  EXPECT_FALSE(Thumbnail::jpegSize(empty.data(), empty.size(), width, height));
+  // not a JPEG
+  jpeg[1] = 0xd9;
+  EXPECT_FALSE(Thumbnail::jpegSize(jpeg.data(), jpeg.size(), width, height));
+  // the scan starts before any frame header
+  std::vector<uint8_t> scan = {0xff, 0xd8, 0xff, 0xda, 0x00, 0x08};
+  EXPECT_FALSE(Thumbnail::jpegSize(scan.data(), scan.size(), width, height));
+}
+
+TEST_F(ThumbnailTest, DecodeShiftKeepsEnoughPixels) {
+  EXPECT_EQ(Thumbnail::decodeShift(320, 240, 40, 30), 3);
+  EXPECT_EQ(Thumbnail::decodeShift(320, 240, 64, 48), 2);
+  EXPECT_EQ(Thumbnail::decodeShift(240, 240, 96, 96), 1);
+  EXPECT_EQ(Thumbnail::decodeShift(240, 240, 240, 240), 0);
+  // never more than an eighth
+  EXPECT_EQ(Thumbnail::decodeShift(1600, 1200, 16, 12), 3);
+  // the decoder rounds up, 100 / 8 comes out 13 wide
+  EXPECT_EQ(Thumbnail::decodeShift(100, 100, 13, 13), 3);
+  EXPECT_EQ(Thumbnail::decodeShift(100, 100, 14, 14), 2);
+}
+
+TEST_F(ThumbnailTest, FitKeepsTheAspect) {
+  uint16_t width, height;
+  Thumbnail::fit(320, 240, 64, width, height);
+  EXPECT_EQ(width, 64);
+  EXPECT_EQ(height, 48);
+  Thumbnail::fit(240, 320, 64, width, height);
+  EXPECT_EQ(width, 48);
+  EXPECT_EQ(height, 64);
+  // never larger than the frame, never empty
+  Thumbnail::fit(32, 24, 64, width, height);
+  EXPECT_EQ(width, 32);
+  EXPECT_EQ(height, 24);
+  Thumbnail::fit(1000, 2, 64, width, height);
+  EXPECT_EQ(height, 1);
+}
+
+TEST_F(ThumbnailTest, BoxFilterAveragesARamp) {
+  // every column its x, every 4 columns become one of their mean
+  std::vector<uint8_t> ramp(256 * 8);
+  for (size_t i = 0; i < ramp.size(); i++)
+    ramp[i] = i % 256;
+  std::vector<uint8_t> out(64 * 2);
+  Thumbnail::boxFilter(ramp.data(), 256, 8, out.data(), 64, 2);
+  for (uint16_t y = 0; y < 2; y++) {
+    for (uint16_t x = 0; x < 64; x++) {
+      SCOPED_TRACE(x);
+      // 4x + 1.5, rounded
+      EXPECT_EQ(out[y * 64 + x], 4 * x + 2);
+    }
+  }
+}
+
+TEST_F(ThumbnailTest, BoxFilterCoversUnevenBlocks) {
+  // a vertical ramp, 100 rows down to 30, the blocks 3 or 4 rows high
+  std::vector<uint8_t> ramp(10 * 100);
+  for (size_t i = 0; i < ramp.size(); i++)
+    ramp[i] = i / 10;
+  std::vector<uint8_t> out(5 * 30);
+  Thumbnail::boxFilter(ramp.data(), 10, 100, out.data(), 5, 30);
+  for (uint16_t y = 0; y < 30; y++) {
+    uint16_t top = y * 100 / 30, bottom = (y + 1) * 100 / 30;
+    // the mean of rows top to bottom - 1, halves rounded up
+    uint8_t mean = (top + bottom) / 2;
+    for (uint16_t x = 0; x < 5; x++)
+      EXPECT_EQ(out[y * 5 + x], mean) << y;
+  }
+}
+
+TEST_F(ThumbnailTest, BoxFilterLeavesTheSizeAlone) {
+  std::vector<uint8_t> in(16 * 16);
+  for (size_t i = 0; i < in.size(); i++)
+    in[i] = i * 7;
+  std::vector<uint8_t> out(in.size());
+  Thumbnail::boxFilter(in.data(), 16, 16, out.data(), 16, 16);
+  EXPECT_EQ(out, in);
+}
+
+TEST_F(ThumbnailTest, BmpHeaderDescribesAGrayImage) {
+  std::vector<uint8_t> header(Thumbnail::BMP_HEADER_SIZE);
+  // rows of 30 are padded to 32
+  Thumbnail::bmpHeader(header.data(), 30, 20);
+  EXPECT_EQ(header[0], 'B');
+  EXPECT_EQ(header[1], 'M');
+  EXPECT_EQ(get32(&header[2]), Thumbnail::BMP_HEADER_SIZE + 32 * 20);
+  EXPECT_EQ(get32(&header[10]), Thumbnail::BMP_HEADER_SIZE);
+  EXPECT_EQ(get32(&header[14]), 40u);
+  EXPECT_EQ(get32(&header[18]), 30u);
+  // negative, top row first
+  EXPECT_EQ((int32_t)get32(&header[22]), -20);
+  EXPECT_EQ(get16(&header[26]), 1u);
+  EXPECT_EQ(get16(&header[28]), 8u);
+  // uncompressed
+  EXPECT_EQ(get32(&header[30]), 0u);
+  EXPECT_EQ(get32(&header[34]), 32u * 20);
+  EXPECT_EQ(get32(&header[46]), 256u);
+  for (int level = 0; level < 256; level++) {
+    const uint8_t* entry = &header[54 + level * 4];
+    SCOPED_TRACE(level);
+    EXPECT_EQ(entry[0], level);
+    EXPECT_EQ(entry[1], level);
+    EXPECT_EQ(entry[2], level);
+    EXPECT_EQ(entry[3], 0);
+  }
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "io/Serial/udpPacketizer.hpp"
+
+using UdpPacketizer::PACKET_SIZE;
+
+namespace {
+  struct Received_t {
+    std::vector<UdpPacketizer::PacketHeader> headers;
+    std::vector<uint8_t> data;
+    //! the datagram that fails to send, -1 for none
+    int32_t failing = -1;
+  };
+
+  bool receive(void* ctx,
+               const UdpPacketizer::PacketHeader& header,
+               const uint8_t* payload) {
+    auto* received = static_cast<Received_t*>(ctx);
+    received->headers.push_back(header);
+    received->data.insert(received->data.end(), payload,
+                          payload + header.size);
+    return header.id != received->failing;
+  }
+
+  std::vector<uint8_t> frame(size_t len) {
+    std::vector<uint8_t> data(len);
+    for (size_t i = 0; i < len; i++)
+      data[i] = i * 7 + (i >> 8);
+    return data;
+  }
+}  // namespace
+
+TEST(UdpPacketizer, PacketCount) {
+  EXPECT_EQ(UdpPacketizer::packetCount(0), 1u);
+  EXPECT_EQ(UdpPacketizer::packetCount(1), 1u);
+  EXPECT_EQ(UdpPacketizer::packetCount(PACKET_SIZE - 1), 1u);
+  // a full last packet is followed by an empty one
+  EXPECT_EQ(UdpPacketizer::packetCount(PACKET_SIZE), 2u);
+  EXPECT_EQ(UdpPacketizer::packetCount(PACKET_SIZE + 1), 2u);
+  EXPECT_EQ(UdpPacketizer::packetCount(3 * PACKET_SIZE), 4u);
+}
+
+TEST(UdpPacketizer, HeaderIsWhatTheReceiverReads) {
+  EXPECT_EQ(sizeof(UdpPacketizer::PacketHeader), 16u);
+}
+
+TEST(UdpPacketizer, SplitsAndReassembles) {
+  for (size_t len : {(size_t)0, (size_t)1, PACKET_SIZE - 1, PACKET_SIZE,
+                     PACKET_SIZE + 1, (size_t)12345, 8 * PACKET_SIZE}) {
+    std::vector<uint8_t> data = frame(len);
+    Received_t received;
+    ASSERT_TRUE(UdpPacketizer::send(17, data.data(), len, receive, &received));
+
+    ASSERT_EQ(received.headers.size(), UdpPacketizer::packetCount(len)) << len;
+    for (size_t id = 0; id < received.headers.size(); id++) {
+      const auto& header = received.headers[id];
+      EXPECT_EQ(header.frameNum, 17);
+      EXPECT_EQ(header.id, (int32_t)id);
+      EXPECT_EQ(header.totalPackets, (int32_t)received.headers.size());
+      EXPECT_LE(header.size, (int32_t)PACKET_SIZE);
+    }
+    EXPECT_EQ(received.data, data) << len;
+  }
+}
+
+TEST(UdpPacketizer, SendsTheRestAfterAFailure) {
+  std::vector<uint8_t> data = frame(3 * PACKET_SIZE + 10);
+  Received_t received;
+  received.failing = 1;
+  EXPECT_FALSE(UdpPacketizer::send(3, data.data(), data.size(), receive,
+                                   &received));
+  EXPECT_EQ(received.headers.size(), 4u);
+  EXPECT_EQ(received.data, data);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+// Microbenchmarks of the portable modules, on the host. This is the program
+// of the native environment, build and run it with
+//
+//     pio run -e native
+//     .pio/build/native/program
+//     .pio/build/native/program --filter framing --min-ms 500
+//
+// Every case runs in rounds of doubling size until a round takes --min-ms,
+// the last round is reported. --filter runs only the cases whose name
+// contains it. Prints JSON, the nanoseconds per operation and how many ran.
+// Only the differences between runs on one machine mean anything, the ESP32
+// is a lot slower.
+
+// the tests link the same sources, with their own main
+#ifndef PIO_UNIT_TESTING
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <ArduinoJson.h>
+#include "data/CommandManager/CommandManager.hpp"
+#include "hal/hal.hpp"
+#include "io/LEDManager/LEDPattern.hpp"
+#include "io/Serial/udpPacketizer.hpp"
+#include "network/api/routeTable/apiRoutes.hpp"
+#include "network/stream/streamFraming.hpp"
+
+namespace {
+  struct Options_t {
+    std::string filter;
+    double minMs = 200;
+  };
+
+  //! keeps the compiler from dropping work whose result isn't used
+  volatile uint32_t sink;
+
+  bool first = true;
+
+  template <typename Operation>
+  void run(const Options_t& options, const char* name, Operation operation) {
+    if (!options.filter.empty() && !strstr(name, options.filter.c_str()))
+      return;
+    uint64_t iterations = 1;
+    double elapsedMs = 0;
+    while (true) {
+      auto start = std::chrono::steady_clock::now();
+      for (uint64_t i = 0; i < iterations; i++)
+        operation(i);
+      elapsedMs = std::chrono::duration<double, std::milli>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+      if (elapsedMs >= options.minMs || iterations >= (1ull << 40))
+        break;
+      iterations *= 2;
+    }
+    printf("%s    \"%s\": {\"ns_per_op\": %.2f, \"iterations\": %llu}",
+           first ? "" : ",\n", name, elapsedMs * 1e6 / iterations,
+           (unsigned long long)iterations);
+    first = false;
+  }
+
+  //! every route, and a command and a map that don't exist
+  std::vector<std::string> routeUrls() {
+    std::vector<std::string> urls;
+    for (const auto& route : ApiRoutes::list)
+      urls.push_back(std::string("/control/") + route.map + "/command/" +
+                     route.command);
+    urls.push_back("/control/builtin/command/nothing");
+    urls.push_back("/control/nothing/command/ping");
+    return urls;
+  }
+
+  bool discard(void* ctx,
+               const UdpPacketizer::PacketHeader& header,
+               const uint8_t* payload) {
+    *static_cast<uint32_t*>(ctx) += header.size + payload[0];
+    return true;
+  }
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options_t options;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool value = i + 1 < argc;
+    if (arg == "--filter" && value)
+      options.filter = argv[++i];
+    else if (arg == "--min-ms" && value)
+      options.minMs = atof(argv[++i]);
+    else {
+      fprintf(stderr, "usage: program [--filter NAME] [--min-ms MS]\n");
+      return 2;
+    }
+  }
+  Hal::Host::reset();
+  printf("{\n  \"benchmarks\": {\n");
+
+  char header[StreamFraming::PART_HEADER_SIZE];
+  run(options, "framing/part_header", [&](uint64_t i) {
+    sink = StreamFraming::partHeader(header, sizeof(header), 14000 + (i & 1023),
+                                     (int64_t)i * 16667);
+  });
+  run(options, "framing/part_header_synced", [&](uint64_t i) {
+    sink = StreamFraming::partHeader(header, sizeof(header), 14000 + (i & 1023),
+                                     (int64_t)i * 16667,
+                                     1700000000000000 + (int64_t)i * 16667, i);
+  });
+
+  // a typical 240x240 JPEG
+  std::vector<uint8_t> frame(14 * 1024);
+  for (size_t i = 0; i < frame.size(); i++)
+    frame[i] = i * 31;
+  run(options, "udp_packetizer/frame_14k", [&](uint64_t i) {
+    uint32_t total = 0;
+    UdpPacketizer::send(i, frame.data(), frame.size(), discard, &total);
+    sink = total;
+  });
+
+  LEDPattern::Player player;
+  run(options, "led_pattern/advance", [&](uint64_t i) {
+    bool level;
+    LEDStates_e state = (LEDStates_e)((i >> 4) % LEDPattern::timelineCount);
+    sink = player.advance(state, level) + level;
+  });
+
+  // what the API matched its urls with before the route table, a regex and
+  // a map of maps of strings
+  std::vector<std::string> urls = routeUrls();
+  run(options, "route_table/find", [&](uint64_t i) {
+    const std::string& url = urls[i % urls.size()];
+    RouteTable::Path_t path;
+    const RouteTable::Route_t<ApiRoutes::Command_e>* route = nullptr;
+    if (RouteTable::parse(Helpers::string_view(url.c_str(), url.size()),
+                          Helpers::string_view("/control"), path))
+      route = ApiRoutes::table.find(path.map, path.command);
+    sink = route ? route->handler : -1;
+  });
+
+  std::regex pattern("^\\/control\\/([a-zA-Z0-9]+)\\/command\\/([a-zA-Z0-9]+)$");
+  std::unordered_map<std::string, std::unordered_map<std::string, int>> routeMap;
+  for (const auto& route : ApiRoutes::list)
+    routeMap[route.map].emplace(route.command, route.handler);
+  run(options, "route_table/regex", [&](uint64_t i) {
+    const std::string& url = urls[i % urls.size()];
+    std::smatch match;
+    int handler = -1;
+    if (std::regex_match(url, match, pattern)) {
+      auto map = routeMap.find(match[1].str());
+      if (map != routeMap.end()) {
+        auto command = map->second.find(match[2].str());
+        if (command != map->second.end())
+          handler = command->second;
+      }
+    }
+    sink = handler;
+  });
+
+  ProjectConfig config("openiris", "openiristracker");
+  config.load();
+  CommandManager commands(&config);
+  run(options, "command_manager/ping", [&](uint64_t) {
+    CommandsPayload payload;
+    deserializeJson(payload.data, R"({"commands": [{"command": "ping"}]})");
+    commands.handleCommands(payload);
+    Hal::Host::consoleOutput().clear();
+  });
+
+  printf("\n  }\n}\n");
+  return 0;
+}
+
+#endif  // PIO_UNIT_TESTING
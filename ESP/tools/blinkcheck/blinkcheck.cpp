@@ -0,0 +1,260 @@
+// Scores OpennessEstimator against a recorded eye sequence, on the host. Build
+// and run it with
+//
+//     pio run -e blinkcheck
+//     .pio/build/blinkcheck/program sequence.csv
+//     .pio/build/blinkcheck/program --synthetic 1200
+//
+// sequence.csv has a line per frame, in order: the JPEG, relative to the CSV,
+// its timestamp in microseconds and optionally how far open the eye is, 0
+// closed to 1 open. A first line starting with "image" is skipped.
+//
+//     image,timestamp_us,openness
+//     0001.jpg,16667,1.0
+//     0002.jpg,33333,0.85
+//
+// The true blinks come from the labelled openness, through the same
+// thresholds the estimator uses, and count as found if the estimator reports
+// one starting within --match-ms. --synthetic checks against a sequence of the
+// synthetic camera instead, which blinks every --blink-every-ms, --write DIR
+// saves it as a labelled sequence. Prints JSON, exits with 1 if the mean
+// openness error is over --max-error, or precision or recall under
+// --min-recall.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "hal/hal.hpp"
+#include "hal/syntheticCamera.hpp"
+#include "vision/openness.hpp"
+
+namespace {
+  struct Label_t {
+    std::string image;
+    std::vector<uint8_t> jpeg;
+    int64_t timestampUs;
+    //! -1 when the label has none
+    float openness;
+  };
+
+  struct Options_t {
+    std::string labels;
+    size_t synthetic = 0;
+    uint32_t blinkEveryMs = 2000;
+    std::string write;
+    uint8_t scale = 2;
+    float matchMs = 100;
+    float maxError = 0.15f;
+    float minRecall = 0.9f;
+  };
+
+  bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+      return false;
+    data.assign(std::istreambuf_iterator<char>(in), {});
+    return true;
+  }
+
+  bool loadLabels(const std::string& path, std::vector<Label_t>& labels) {
+    std::ifstream in(path);
+    if (!in) {
+      fprintf(stderr, "Can't read %s\n", path.c_str());
+      return false;
+    }
+    size_t slash = path.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.empty() || line.rfind("image", 0) == 0)
+        continue;
+      std::vector<std::string> fields;
+      std::stringstream cells(line);
+      for (std::string cell; std::getline(cells, cell, ',');)
+        fields.push_back(cell);
+      if (fields.size() < 2) {
+        fprintf(stderr, "No timestamp for %s\n", fields[0].c_str());
+        return false;
+      }
+      Label_t label = {fields[0], {}, atoll(fields[1].c_str()), -1};
+      if (fields.size() >= 3 && !fields[2].empty())
+        label.openness = atof(fields[2].c_str());
+      if (!readFile(dir + label.image, label.jpeg)) {
+        fprintf(stderr, "Can't read %s\n", (dir + label.image).c_str());
+        return false;
+      }
+      labels.push_back(std::move(label));
+    }
+    return true;
+  }
+
+  void drawLabels(const Options_t& options, std::vector<Label_t>& labels) {
+    Hal::SyntheticCamera::Config_t config = {
+        320, 240, 60, Hal::SyntheticCamera::Jitter_Uniform, 2000, 9000, 1000, 1};
+    config.blinkEveryMs = options.blinkEveryMs;
+    Hal::SyntheticCamera camera(config);
+    for (size_t i = 0; i < options.synthetic; i++) {
+      Hal::Frame_t frame;
+      Hal::Host::advance(std::max<int64_t>(camera.nextFrameUs() - Hal::micros(), 0));
+      if (!camera.acquire(frame))
+        break;
+      char name[32];
+      snprintf(name, sizeof(name), "%04u.jpg", (unsigned)i);
+      labels.push_back({name, std::vector<uint8_t>(frame.data, frame.data + frame.len),
+                        frame.timestampUs, camera.lastOpenness()});
+      camera.release(frame);
+    }
+    if (options.write.empty())
+      return;
+    std::ofstream csv(options.write + "/sequence.csv");
+    csv << "image,timestamp_us,openness\n";
+    for (const Label_t& label : labels) {
+      std::ofstream(options.write + "/" + label.image, std::ios::binary)
+          .write((const char*)label.jpeg.data(), label.jpeg.size());
+      csv << label.image << ',' << label.timestampUs << ',' << label.openness << '\n';
+    }
+  }
+
+  //! the blinks in the labels, the way OpennessEstimator tells them
+  std::vector<int64_t> labelledBlinks(const std::vector<Label_t>& labels) {
+    OpennessEstimator::Config_t config;
+    std::vector<int64_t> starts;
+    bool closed = false;
+    int64_t closingUs = -1;
+    for (const Label_t& label : labels) {
+      if (label.openness < 0)
+        continue;
+      if (label.openness < config.openAbove && closingUs < 0)
+        closingUs = label.timestampUs;
+      if (label.openness < config.closeBelow) {
+        closed = true;
+      } else if (label.openness > config.openAbove) {
+        int64_t duration = label.timestampUs - closingUs;
+        if (closed && duration >= OpennessEstimator::BLINK_MIN_US &&
+            duration <= OpennessEstimator::BLINK_MAX_US)
+          starts.push_back(closingUs);
+        closed = false;
+        closingUs = -1;
+      }
+    }
+    return starts;
+  }
+
+  //! how many of found have one in truth within windowUs, each used once
+  size_t matched(const std::vector<int64_t>& found,
+                 std::vector<int64_t> truth,
+                 int64_t windowUs) {
+    size_t count = 0;
+    for (int64_t start : found) {
+      for (int64_t& candidate : truth) {
+        if (candidate >= 0 && llabs(candidate - start) <= windowUs) {
+          candidate = -1;
+          count++;
+          break;
+        }
+      }
+    }
+    return count;
+  }
+
+  float percentile(std::vector<float> values, float p) {
+    if (values.empty())
+      return 0;
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (size_t)(values.size() * p))];
+  }
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options_t options;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool value = i + 1 < argc;
+    if (arg == "--synthetic" && value)
+      options.synthetic = atoi(argv[++i]);
+    else if (arg == "--blink-every-ms" && value)
+      options.blinkEveryMs = atoi(argv[++i]);
+    else if (arg == "--write" && value)
+      options.write = argv[++i];
+    else if (arg == "--scale" && value)
+      options.scale = atoi(argv[++i]);
+    else if (arg == "--match-ms" && value)
+      options.matchMs = atof(argv[++i]);
+    else if (arg == "--max-error" && value)
+      options.maxError = atof(argv[++i]);
+    else if (arg == "--min-recall" && value)
+      options.minRecall = atof(argv[++i]);
+    else if (arg[0] != '-')
+      options.labels = arg;
+    else {
+      fprintf(stderr, "usage: blinkcheck [sequence.csv | --synthetic N [--blink-every-ms MS] "
+                      "[--write DIR]] [--scale 0-3] [--match-ms MS] [--max-error E] "
+                      "[--min-recall R]\n");
+      return 2;
+    }
+  }
+
+  std::vector<Label_t> labels;
+  if (options.synthetic)
+    drawLabels(options, labels);
+  else if (options.labels.empty() || !loadLabels(options.labels, labels))
+    return 2;
+
+  std::vector<uint8_t> luma(1 << 20);
+  OpennessEstimator estimator;
+  std::vector<float> errors, estimateUs;
+  std::vector<int64_t> found;
+  size_t undecodable = 0, unsure = 0;
+  for (const Label_t& label : labels) {
+    uint16_t width, height;
+    if (!Hal::jpegToLuma(label.jpeg.data(), label.jpeg.size(), options.scale,
+                         luma.data(), luma.size(), width, height) ||
+        !estimator.begin(height)) {
+      undecodable++;
+      continue;
+    }
+    OpennessEstimator::Result_t result;
+    auto start = std::chrono::steady_clock::now();
+    estimator.estimate(luma.data(), width, height, label.timestampUs, result);
+    estimateUs.push_back(std::chrono::duration<float, std::micro>(
+                             std::chrono::steady_clock::now() - start).count());
+
+    if (result.blinked)
+      found.push_back(estimator.lastBlink().startUs);
+    if (result.openness < 0)
+      unsure++;
+    else if (label.openness >= 0)
+      errors.push_back(fabsf(result.openness - label.openness));
+  }
+
+  std::vector<int64_t> truth = labelledBlinks(labels);
+  int64_t windowUs = options.matchMs * 1000;
+  float meanError = 0;
+  for (float error : errors)
+    meanError += error / errors.size();
+  float precision = found.empty() ? 1 : (float)matched(found, truth, windowUs) / found.size();
+  float recall = truth.empty() ? 1 : (float)matched(truth, found, windowUs) / truth.size();
+
+  printf("{\n  \"frames\": %zu,\n  \"scale\": %u,\n  \"undecodable\": %zu,\n",
+         labels.size(), options.scale, undecodable);
+  printf("  \"unsure\": %zu,\n", unsure);
+  printf("  \"openness_error\": {\"mean\": %.3f, \"p95\": %.3f},\n", meanError,
+         percentile(errors, 0.95f));
+  printf("  \"blinks\": {\"labelled\": %zu, \"found\": %zu, \"precision\": %.3f, "
+         "\"recall\": %.3f},\n",
+         truth.size(), found.size(), precision, recall);
+  printf("  \"estimate_us\": {\"p50\": %.2f, \"p95\": %.2f, \"max\": %.2f}\n",
+         percentile(estimateUs, 0.5f), percentile(estimateUs, 0.95f),
+         percentile(estimateUs, 1));
+  printf("}\n");
+
+  bool good = !undecodable && meanError <= options.maxError &&
+              precision >= options.minRecall && recall >= options.minRecall;
+  return good ? 0 : 1;
+}
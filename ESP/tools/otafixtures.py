@@ -0,0 +1,100 @@
+# Description: Generate the OTA images test/test_ota_writer feeds to the OTAWriter
+#
+# Run by hand, the output is checked in:
+#
+#     python tools/otafixtures.py
+
+import gzip
+import hashlib
+import os
+import struct
+import zlib
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(PROJECT_DIR, "test", "test_ota_writer", "otaFixtures.h")
+
+# the gzip header flags, RFC 1952
+FHCRC = 1 << 1
+FEXTRA = 1 << 2
+FNAME = 1 << 3
+FCOMMENT = 1 << 4
+
+
+def image(size):
+    """Looks enough like firmware to compress the way firmware does: an app
+    image header, then words from a small vocabulary in a fixed order"""
+    words = [struct.pack("<I", 0x40080000 + i * 0x3C) for i in range(64)]
+    words += [b"openiris", b"camera", b"stream", b"\x00" * 8, b"\xff" * 4]
+    data = bytearray(b"\xe9\x03\x02\x20" + struct.pack("<I", 0x40081234) + b"\xee" + b"\x00" * 15)
+    state = 12345
+    while len(data) < size:
+        # a fixed LCG, the same bytes on every machine and Python version
+        state = (state * 1103515245 + 12345) & 0x7FFFFFFF
+        data += words[(state >> 16) % len(words)]
+    return bytes(data[:size])
+
+
+def gzipAllFields(data):
+    """gzip with an extra field, a name, a comment and the header CRC"""
+    extra = b"OI" + struct.pack("<H", 6) + b"abcdef"
+    header = b"\x1f\x8b\x08" + bytes([FHCRC | FEXTRA | FNAME | FCOMMENT])
+    header += struct.pack("<I", 1700000000) + b"\x02\x03"
+    header += struct.pack("<H", len(extra)) + extra
+    header += b"firmware.bin\x00" + b"built for the OTAWriter test\x00"
+    header += struct.pack("<H", zlib.crc32(header) & 0xFFFF)
+    deflate = zlib.compressobj(9, zlib.DEFLATED, -zlib.MAX_WBITS)
+    body = deflate.compress(data) + deflate.flush()
+    return header + body + struct.pack("<II", zlib.crc32(data), len(data))
+
+
+def toArray(data):
+    lines = []
+    for i in range(0, len(data), 30):
+        lines.append(",".join(str(b) for b in data[i : i + 30]) + ",")
+    return "\n".join(lines)
+
+
+def render():
+    raw = image(12000)
+    gz = gzip.compress(raw, 9, mtime=0)
+    fields = gzipAllFields(raw)
+    assert gzip.decompress(fields) == raw
+    # cut in the middle of the deflate stream
+    truncated = gz[: len(gz) // 2]
+    wrong = raw[:-1] + bytes([raw[-1] ^ 0xFF])
+
+    arrays = [
+        ("OTA_FIXTURE_IMAGE", "the image as it lands in flash", raw),
+        ("OTA_FIXTURE_GZIP", "gzip -9, no optional header fields", gz),
+        ("OTA_FIXTURE_GZIP_FIELDS", "gzip with every optional header field", fields),
+        ("OTA_FIXTURE_GZIP_TRUNCATED", "the first half of OTA_FIXTURE_GZIP", truncated),
+    ]
+    digests = [
+        ("OTA_FIXTURE_IMAGE_SHA256", hashlib.sha256(raw).hexdigest()),
+        ("OTA_FIXTURE_IMAGE_MD5", hashlib.md5(raw).hexdigest()),
+        ("OTA_FIXTURE_GZIP_MD5", hashlib.md5(gz).hexdigest()),
+        ("OTA_FIXTURE_GZIP_FIELDS_MD5", hashlib.md5(fields).hexdigest()),
+        ("OTA_FIXTURE_GZIP_TRUNCATED_MD5", hashlib.md5(truncated).hexdigest()),
+        # of the image with the bits of its last byte flipped
+        ("OTA_FIXTURE_WRONG_SHA256", hashlib.sha256(wrong).hexdigest()),
+        ("OTA_FIXTURE_WRONG_MD5", hashlib.md5(wrong).hexdigest()),
+    ]
+
+    out = [
+        "// Generated by tools/otafixtures.py, do not edit.",
+        "#ifndef OTA_FIXTURES_H",
+        "#define OTA_FIXTURES_H",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    for name, comment, data in arrays:
+        out += ["//! " + comment, "const uint8_t %s[] = {" % name, toArray(data), "};", ""]
+    out += ['#define %s "%s"' % (name, digest) for name, digest in digests]
+    out += ["", "#endif  // OTA_FIXTURES_H"]
+    return "\n".join(out) + "\n"
+
+
+with open(OUTPUT, "w") as f:
+    f.write(render())
+print("Wrote " + OUTPUT)
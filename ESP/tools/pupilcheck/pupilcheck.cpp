@@ -0,0 +1,215 @@
+// Scores PupilFit against labelled eye images, on the host. Build and run it
+// with
+//
+//     pio run -e pupilcheck
+//     .pio/build/pupilcheck/program labels.csv
+//     .pio/build/pupilcheck/program --synthetic 500
+//
+// labels.csv has a line per image: the JPEG, relative to the CSV, and where
+// the pupil is in frame pixels, x,y and optionally the semi axes and the
+// angle in radians. No x means no pupil, a closed eye. A first line starting
+// with "image" is skipped.
+//
+//     image,x,y,major,minor,angle
+//     0001.jpg,121.5,98.0,22.1,20.4,0.3
+//     0002.jpg,,
+//
+// --synthetic checks against frames of the synthetic camera instead, which
+// knows where it drew the pupil, --write DIR saves those as a labelled set.
+// Prints JSON, exits with 1 if the 95th percentile of the centre error is
+// over --max-error-px or more than --max-missed of the pupils were missed.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "hal/hal.hpp"
+#include "hal/syntheticCamera.hpp"
+#include "vision/pupilFit.hpp"
+
+namespace {
+  struct Label_t {
+    std::string image;
+    std::vector<uint8_t> jpeg;
+    bool open;
+    float x, y;
+    //! 0 when the label has no axes
+    float radius;
+  };
+
+  struct Options_t {
+    std::string labels;
+    size_t synthetic = 0;
+    std::string write;
+    uint8_t scale = 2;
+    float minConfidence = 0.3f;
+    float maxErrorPx = 4;
+    float maxMissed = 0.05f;
+  };
+
+  bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+      return false;
+    data.assign(std::istreambuf_iterator<char>(in), {});
+    return true;
+  }
+
+  bool loadLabels(const std::string& path, std::vector<Label_t>& labels) {
+    std::ifstream in(path);
+    if (!in) {
+      fprintf(stderr, "Can't read %s\n", path.c_str());
+      return false;
+    }
+    size_t slash = path.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.empty() || line.rfind("image", 0) == 0)
+        continue;
+      std::vector<std::string> fields;
+      std::stringstream cells(line);
+      for (std::string cell; std::getline(cells, cell, ',');)
+        fields.push_back(cell);
+      Label_t label = {fields[0], {}, false, 0, 0, 0};
+      if (fields.size() >= 3 && !fields[1].empty()) {
+        label.open = true;
+        label.x = atof(fields[1].c_str());
+        label.y = atof(fields[2].c_str());
+        if (fields.size() >= 5)
+          label.radius = sqrtf(atof(fields[3].c_str()) * atof(fields[4].c_str()));
+      }
+      if (!readFile(dir + label.image, label.jpeg)) {
+        fprintf(stderr, "Can't read %s\n", (dir + label.image).c_str());
+        return false;
+      }
+      labels.push_back(std::move(label));
+    }
+    return true;
+  }
+
+  void drawLabels(const Options_t& options, std::vector<Label_t>& labels) {
+    Hal::SyntheticCamera camera(
+        {240, 240, 60, Hal::SyntheticCamera::Jitter_None, 0, 9000, 1000, 1});
+    for (size_t i = 0; i < options.synthetic; i++) {
+      Hal::Frame_t frame;
+      Hal::Host::advance(std::max<int64_t>(camera.nextFrameUs() - Hal::micros(), 0));
+      if (!camera.acquire(frame))
+        break;
+      Hal::SyntheticCamera::Pupil_t pupil = camera.lastPupil();
+      char name[32];
+      snprintf(name, sizeof(name), "%04u.jpg", (unsigned)i);
+      labels.push_back({name, std::vector<uint8_t>(frame.data, frame.data + frame.len),
+                        true, pupil.x, pupil.y, pupil.radius});
+      camera.release(frame);
+    }
+    if (options.write.empty())
+      return;
+    std::ofstream csv(options.write + "/labels.csv");
+    csv << "image,x,y,major,minor,angle\n";
+    for (const Label_t& label : labels) {
+      std::ofstream(options.write + "/" + label.image, std::ios::binary)
+          .write((const char*)label.jpeg.data(), label.jpeg.size());
+      csv << label.image << ',' << label.x << ',' << label.y << ',' << label.radius
+          << ',' << label.radius << ",0\n";
+    }
+  }
+
+  float percentile(std::vector<float> values, float p) {
+    if (values.empty())
+      return 0;
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (size_t)(values.size() * p))];
+  }
+
+  void printStats(const char* name, const std::vector<float>& values, bool last) {
+    printf("  \"%s\": {\"p50\": %.2f, \"p95\": %.2f, \"max\": %.2f}%s\n", name,
+           percentile(values, 0.5f), percentile(values, 0.95f),
+           percentile(values, 1), last ? "" : ",");
+  }
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options_t options;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool value = i + 1 < argc;
+    if (arg == "--synthetic" && value)
+      options.synthetic = atoi(argv[++i]);
+    else if (arg == "--write" && value)
+      options.write = argv[++i];
+    else if (arg == "--scale" && value)
+      options.scale = atoi(argv[++i]);
+    else if (arg == "--min-confidence" && value)
+      options.minConfidence = atof(argv[++i]);
+    else if (arg == "--max-error-px" && value)
+      options.maxErrorPx = atof(argv[++i]);
+    else if (arg == "--max-missed" && value)
+      options.maxMissed = atof(argv[++i]);
+    else if (arg[0] != '-')
+      options.labels = arg;
+    else {
+      fprintf(stderr, "usage: pupilcheck [labels.csv | --synthetic N [--write DIR]] [--scale 0-3] "
+                      "[--min-confidence C] [--max-error-px E] [--max-missed F]\n");
+      return 2;
+    }
+  }
+
+  std::vector<Label_t> labels;
+  if (options.synthetic)
+    drawLabels(options, labels);
+  else if (options.labels.empty() || !loadLabels(options.labels, labels))
+    return 2;
+
+  std::vector<uint8_t> luma(1 << 20);
+  PupilFit fit;
+  std::vector<float> centreErrors, radiusErrors, fitUs;
+  size_t open = 0, missed = 0, falseAlarms = 0, undecodable = 0;
+  for (const Label_t& label : labels) {
+    uint16_t width, height;
+    if (!Hal::jpegToLuma(label.jpeg.data(), label.jpeg.size(), options.scale,
+                         luma.data(), luma.size(), width, height) ||
+        !fit.begin(width, height)) {
+      undecodable++;
+      continue;
+    }
+    PupilFit::Pupil_t pupil;
+    auto start = std::chrono::steady_clock::now();
+    fit.fit(luma.data(), width, height, pupil);
+    fitUs.push_back(std::chrono::duration<float, std::micro>(
+                        std::chrono::steady_clock::now() - start).count());
+
+    bool found = pupil.confidence >= options.minConfidence;
+    open += label.open;
+    if (!label.open) {
+      falseAlarms += found;
+      continue;
+    }
+    if (!found) {
+      missed++;
+      continue;
+    }
+    float scale = 1 << options.scale;
+    centreErrors.push_back(hypotf(pupil.x * scale - label.x, pupil.y * scale - label.y));
+    if (label.radius > 0)
+      radiusErrors.push_back(fabsf(sqrtf(pupil.major * pupil.minor) * scale - label.radius));
+  }
+
+  printf("{\n  \"images\": %zu,\n  \"scale\": %u,\n  \"undecodable\": %zu,\n",
+         labels.size(), options.scale, undecodable);
+  printf("  \"missed\": %zu,\n  \"false_alarms\": %zu,\n", missed, falseAlarms);
+  printStats("centre_error_px", centreErrors, false);
+  printStats("radius_error_px", radiusErrors, false);
+  printStats("fit_us", fitUs, true);
+  printf("}\n");
+
+  bool good = !undecodable && percentile(centreErrors, 0.95f) <= options.maxErrorPx &&
+              missed <= options.maxMissed * open;
+  return good ? 0 : 1;
+}
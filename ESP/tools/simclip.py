@@ -0,0 +1,65 @@
+# Description: Embed a recorded clip for the synthetic camera of the simulator
+
+import glob
+import os
+
+try:
+    Import("env")
+    from colors import *
+
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+except NameError:
+    # run by hand, outside of PlatformIO
+    GREEN = RESET = ""
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE_DIR = os.path.join(PROJECT_DIR, "sim", "clip")
+OUTPUT = os.path.join(PROJECT_DIR, "lib", "src", "hal", "simClip.h")
+
+
+def toArray(data):
+    lines = []
+    for i in range(0, len(data), 30):
+        lines.append(",".join(str(b) for b in data[i : i + 30]) + ",")
+    return "\n".join(lines)
+
+
+def render(files):
+    out = [
+        "// Generated by tools/simclip.py from the JPEGs in sim/clip/, do not edit.",
+        "#ifndef SIM_CLIP_H",
+        "#define SIM_CLIP_H",
+        "",
+        '#include "syntheticCamera.hpp"',
+        "",
+    ]
+    for i, path in enumerate(files):
+        with open(path, "rb") as f:
+            out += ["const uint8_t SIM_CLIP_%d[] = {" % i, toArray(f.read()), "};", ""]
+    out.append("const Hal::SyntheticCamera::ClipFrame_t SIM_CLIP_FRAMES[] = {")
+    out += ["    {SIM_CLIP_%d, sizeof(SIM_CLIP_%d)}," % (i, i) for i in range(len(files))]
+    out += ["};", "#define SIM_CLIP_COUNT %d" % len(files), "", "#endif  // SIM_CLIP_H"]
+    return "\n".join(out) + "\n"
+
+
+def generate():
+    # in file name order, name them by frame number
+    files = sorted(glob.glob(os.path.join(SOURCE_DIR, "*.jpg")))
+    if not files:
+        # no clip, the camera draws its frames
+        if os.path.exists(OUTPUT):
+            os.remove(OUTPUT)
+        return
+    content = render(files)
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, "r") as f:
+            # leave the file alone if nothing changed, so it doesn't trigger
+            # a rebuild of everything including it
+            if f.read() == content:
+                return
+    with open(OUTPUT, "w") as f:
+        f.write(content)
+    print(GREEN + "Embedded %d clip frames into %s" % (len(files), OUTPUT) + RESET)
+
+
+generate()
@@ -0,0 +1,90 @@
+# Description: Precompress the web UI and embed it into the firmware
+
+import gzip
+import hashlib
+import os
+import sys
+
+try:
+    Import("env")
+    from colors import *
+
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+except NameError:
+    # run by hand, outside of PlatformIO
+    GREEN = RESET = ""
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE_DIR = os.path.join(PROJECT_DIR, "webui")
+OUTPUT = os.path.join(PROJECT_DIR, "lib", "src", "network", "api", "baseAPI", "webAssets.h")
+
+# (file in webui/, C identifier, url it is served at, content type)
+ASSETS = [
+    ("update.html", "WEB_ASSET_UPDATE", "/update", "text/html"),
+]
+
+
+def compress(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    # a fixed mtime keeps the output, and with it the ETag, reproducible
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def toArray(data):
+    lines = []
+    for i in range(0, len(data), 30):
+        lines.append(",".join(str(b) for b in data[i : i + 30]) + ",")
+    return "\n".join(lines)
+
+
+def render():
+    out = [
+        "// Generated by tools/webassets.py from the files in webui/, do not edit.",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset_t {",
+        "  const char* url;",
+        "  const char* contentType;",
+        "  //! gzip compressed",
+        "  const uint8_t* data;",
+        "  size_t size;",
+        "  //! quoted strong validator, a hash of the compressed bytes",
+        "  const char* etag;",
+        "};",
+        "",
+    ]
+    for file, name, url, contentType in ASSETS:
+        data = compress(os.path.join(SOURCE_DIR, file))
+        etag = hashlib.sha256(data).hexdigest()[:16]
+        out += [
+            "const uint8_t %s_DATA[] PROGMEM = {" % name,
+            toArray(data),
+            "};",
+            'const WebAsset_t %s = {"%s", "%s", %s_DATA, %d, "\\"%s\\""};'
+            % (name, url, contentType, name, len(data), etag),
+            "",
+        ]
+    out.append("#endif  // WEB_ASSETS_H")
+    return "\n".join(out) + "\n"
+
+
+def generate():
+    content = render()
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, "r") as f:
+            # leave the file alone if nothing changed, so it doesn't trigger
+            # a rebuild of everything including it
+            if f.read() == content:
+                return
+    with open(OUTPUT, "w") as f:
+        f.write(content)
+    sys.stdout.write(GREEN)
+    print("Web assets have been regenerated")
+    sys.stdout.write(RESET)
+
+
+generate()
@@ -0,0 +1,372 @@
+"""
+Stream benchmark, receives the MJPEG stream or the UDP frames of a tracker and
+reports how they arrived as JSON, so runs can be compared across commits.
+
+    # MJPEG stream, with the clock handshake for glass to glass latency
+    python bench.py http --host openiristracker.local --seconds 30
+
+    # UDP frames of a USB API build, sent to port 3333 of this machine
+    python bench.py udp --port 3333 --seconds 30 --loss 0.02 --bandwidth 8e6
+
+    # compare against an earlier run
+    python bench.py http --host 192.168.1.42 --out new.json --compare old.json
+
+Only the standard library is needed. --loss and --bandwidth shape what the
+receiver takes in. Over HTTP only the bandwidth applies: reading slower fills
+the TCP window and slows down the tracker, like a slow link would. Over UDP
+datagrams are dropped at random and queued behind the bandwidth, tail dropped
+once --queue bytes wait.
+
+Latency is the time from the sensor timestamp to the last byte of a frame
+arriving here, both on the tracker's clock via the offset measured on /clock.
+The UDP datagrams carry no timestamp, so UDP runs report no latency.
+
+On a tracker built with MOTION_ENABLED, "motion" has the frames it held back
+while the eye kept still and the JPEG bytes that saved, from /metrics before
+and after the run, for all clients together. Held frames don't count as
+skipped. Empty X-Unchanged parts, sent in their place with MOTION_MARKERS,
+count as "unchanged" and not as frames.
+"""
+
+import argparse
+import heapq
+import http.client
+import json
+import random
+import socket
+import struct
+import subprocess
+import sys
+import time
+
+BOUNDARY = b"--123456789000000000000987654321"
+UDP_HEADER = struct.Struct("<iiii")  # frameNum, id, size, totalPackets
+
+
+def nowUs():
+    return time.perf_counter_ns() // 1000
+
+
+def percentile(values, p):
+    if not values:
+        return None
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, max(0, int(round(p / 100 * (len(ordered) - 1)))))
+    return ordered[index]
+
+
+class Shaper:
+    """A link of limited bandwidth that loses datagrams at random"""
+
+    def __init__(self, loss, bandwidth, queueBytes, seed):
+        self.loss = loss
+        self.bandwidth = bandwidth
+        self.maxQueueUs = queueBytes * 8e6 / bandwidth if bandwidth else None
+        self.busyUntil = 0
+        self.random = random.Random(seed)
+        self.lost = 0
+        self.tailDropped = 0
+
+    def admit(self, size, now, lossy=True):
+        """When the bytes are through, None if they are dropped"""
+        if lossy and self.loss and self.random.random() < self.loss:
+            self.lost += 1
+            return None
+        if not self.bandwidth:
+            return now
+        start = max(now, self.busyUntil)
+        if start - now > self.maxQueueUs:
+            self.tailDropped += 1
+            return None
+        self.busyUntil = start + size * 8e6 / self.bandwidth
+        return self.busyUntil
+
+
+def syncClock(host, port, rounds):
+    """Offset of the tracker's clock to ours, from the fastest round trip"""
+    best = None
+    connection = http.client.HTTPConnection(host, port, timeout=5)
+    try:
+        for _ in range(rounds):
+            sent = nowUs()
+            connection.request("GET", "/clock")
+            deviceUs = json.loads(connection.getresponse().read())["us"]
+            received = nowUs()
+            rtt = received - sent
+            if best is None or rtt < best[1]:
+                best = (deviceUs - (sent + received) // 2, rtt)
+    finally:
+        connection.close()
+    return {"offset_us": best[0], "rtt_us": best[1]}
+
+
+def readMotion(host, port):
+    """Frames held back and bytes saved so far, None without motion gating"""
+    connection = http.client.HTTPConnection(host, port, timeout=5)
+    try:
+        connection.request("GET", "/metrics")
+        text = connection.getresponse().read().decode()
+    finally:
+        connection.close()
+    values = {}
+    for line in text.splitlines():
+        for name in ("openiris_motion_frames_held_total", "openiris_motion_saved_bytes_total"):
+            if line.startswith(name + "{") or line.startswith(name + " "):
+                values[name] = int(float(line.rsplit(" ", 1)[1]))
+    if len(values) < 2:
+        return None
+    return {"held": values["openiris_motion_frames_held_total"], "saved": values["openiris_motion_saved_bytes_total"]}
+
+
+def receiveHttp(args, shaper, frames):
+    sock = socket.create_connection((args.host, args.http_port), timeout=5)
+    sock.sendall(b"GET / HTTP/1.1\r\nHost: %s\r\n\r\n" % args.host.encode())
+    buffer = b""
+    end = time.monotonic() + args.seconds
+    headersDone = False
+    part = None  # (length, timestamp) of the part being read
+
+    while time.monotonic() < end:
+        chunk = sock.recv(1460)
+        if not chunk:
+            break
+        # reading no faster than the link pushes back on the sender
+        through = shaper.admit(len(chunk), nowUs(), lossy=False)
+        delay = through - nowUs()
+        if delay > 0:
+            time.sleep(delay / 1e6)
+        buffer += chunk
+
+        if not headersDone:
+            head, found, rest = buffer.partition(b"\r\n\r\n")
+            if not found:
+                continue
+            if not head.startswith(b"HTTP/1.1 200"):
+                raise RuntimeError(head.split(b"\r\n")[0].decode())
+            headersDone, buffer = True, rest
+
+        while True:
+            if part is None:
+                start = buffer.find(BOUNDARY)
+                if start < 0:
+                    break
+                head, found, rest = buffer[start + len(BOUNDARY) :].partition(b"\r\n\r\n")
+                if not found:
+                    break
+                fields = dict(
+                    line.split(b": ", 1) for line in head.split(b"\r\n") if b": " in line
+                )
+                seconds, _, micros = fields.get(b"X-Timestamp", b"0.0").partition(b".")
+                part = (
+                    int(fields[b"Content-Length"]),
+                    int(seconds) * 1000000 + int(micros),
+                    b"X-Unchanged" in fields,
+                )
+                buffer = rest
+            length, timestamp, unchanged = part
+            if len(buffer) < length:
+                break
+            if unchanged:
+                frames.append({"arrived": nowUs(), "size": 0, "timestamp": timestamp, "unchanged": True})
+            else:
+                frames.append({"arrived": nowUs(), "size": length, "timestamp": timestamp})
+            buffer, part = buffer[length:], None
+    sock.close()
+
+
+def receiveUdp(args, shaper, frames):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("0.0.0.0", args.port))
+    sock.settimeout(0.2)
+    # datagrams through the shaper, by when they are through
+    inFlight = []
+    pending = {}  # frameNum -> {"packets": set, "total", "size"}
+    seen = set()
+    incomplete = 0
+    end = time.monotonic() + args.seconds
+    counter = 0
+
+    def deliver(until):
+        nonlocal incomplete
+        while inFlight and inFlight[0][0] <= until:
+            through, _, data = heapq.heappop(inFlight)
+            frameNum, packetId, size, total = UDP_HEADER.unpack_from(data)
+            frame = pending.setdefault(frameNum, {"packets": set(), "total": total, "size": 0})
+            if packetId in frame["packets"]:
+                continue
+            frame["packets"].add(packetId)
+            frame["size"] += size
+            if len(frame["packets"]) == frame["total"]:
+                del pending[frameNum]
+                frames.append({"arrived": through, "size": frame["size"], "frame": frameNum})
+                # whatever is older and still missing parts won't get them
+                for stale in [n for n in pending if n < frameNum]:
+                    del pending[stale]
+                    incomplete += 1
+
+    while time.monotonic() < end:
+        try:
+            data, _ = sock.recvfrom(2048)
+        except socket.timeout:
+            deliver(nowUs())
+            continue
+        if len(data) < UDP_HEADER.size:
+            continue
+        seen.add(UDP_HEADER.unpack_from(data)[0])
+        through = shaper.admit(len(data) + 28, nowUs())
+        if through is not None:
+            counter += 1
+            heapq.heappush(inFlight, (through, counter, data))
+        deliver(nowUs())
+    deliver(float("inf"))
+    sock.close()
+
+    numbers = sorted(seen)
+    # frames the tracker numbered but not a single datagram of arrived
+    never = (numbers[-1] - numbers[0] + 1 - len(numbers)) if numbers else 0
+    return {"incomplete": incomplete + len(pending), "never_seen": never}
+
+
+def summarize(args, frames, clock, drops, shaper, motion):
+    # they only stand in for frames, but keep the sensor's timestamps going
+    parts = frames
+    frames = [f for f in parts if not f.get("unchanged")]
+    if len(frames) < 2:
+        raise RuntimeError("received %d frames, not enough to measure" % len(frames))
+    frames.sort(key=lambda f: f["arrived"])
+    seconds = (frames[-1]["arrived"] - frames[0]["arrived"]) / 1e6
+    intervals = [(b["arrived"] - a["arrived"]) / 1000 for a, b in zip(frames, frames[1:])]
+    # everything after the first frame arrived within the measured time
+    received = sum(f["size"] for f in frames[1:])
+
+    if args.transport == "http":
+        # the tracker skips frames nobody could take, they show as gaps
+        sensor = [(b["timestamp"] - a["timestamp"]) for a, b in zip(parts, parts[1:])]
+        usual = percentile(sensor, 50) or 1
+        skipped = sum(max(0, round(gap / usual) - 1) for gap in sensor)
+        if motion and len(parts) == len(frames):
+            skipped = max(0, skipped - motion["held_frames"])
+        drops = {"skipped": skipped}
+    drops["shaper_lost"] = shaper.lost
+    drops["shaper_tail_dropped"] = shaper.tailDropped
+
+    latency = None
+    if clock:
+        samples = [
+            (f["arrived"] + clock["offset_us"] - f["timestamp"]) / 1000 for f in frames
+        ]
+        latency = {
+            "p50_ms": percentile(samples, 50),
+            "p99_ms": percentile(samples, 99),
+            "max_ms": max(samples),
+        }
+
+    return {
+        "label": args.label,
+        "transport": args.transport,
+        "shaper": {"loss": args.loss, "bandwidth_bps": args.bandwidth, "queue_bytes": args.queue},
+        "seconds": round(seconds, 3),
+        "frames": len(frames),
+        "fps": round((len(frames) - 1) / seconds, 2),
+        "interval_ms": {
+            "p50": percentile(intervals, 50),
+            "p99": percentile(intervals, 99),
+            "max": max(intervals),
+        },
+        "bytes_per_second": round(received / seconds),
+        "mean_frame_bytes": round(sum(f["size"] for f in frames) / len(frames)),
+        "latency": latency,
+        "unchanged": len(parts) - len(frames),
+        "motion": motion,
+        "clock": clock,
+        "drops": drops,
+    }
+
+
+def compare(old, new):
+    """One line per number that both runs have, old -> new and the change"""
+    lines = []
+
+    def walk(a, b, path):
+        if isinstance(a, dict) and isinstance(b, dict):
+            for key in a:
+                if key in b:
+                    walk(a[key], b[key], path + [key])
+        elif isinstance(a, (int, float)) and isinstance(b, (int, float)) and not isinstance(a, bool):
+            change = "%+.1f%%" % ((b - a) / a * 100) if a else ""
+            lines.append("%-32s %12.3f -> %12.3f %s" % (".".join(path), a, b, change))
+
+    walk(old, new, [])
+    return "\n".join(lines)
+
+
+def gitLabel():
+    try:
+        return subprocess.check_output(
+            ["git", "describe", "--always", "--dirty"], stderr=subprocess.DEVNULL, text=True
+        ).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("transport", choices=["http", "udp"])
+    parser.add_argument("--host", help="the tracker, required for http")
+    parser.add_argument("--http-port", type=int, default=80)
+    parser.add_argument("--port", type=int, default=3333, help="where the UDP frames arrive")
+    parser.add_argument("--seconds", type=float, default=20)
+    parser.add_argument("--loss", type=float, default=0, help="share of datagrams lost, udp only")
+    parser.add_argument("--bandwidth", type=float, default=0, help="bits per second, 0 for unlimited")
+    parser.add_argument("--queue", type=int, default=64 * 1024, help="bytes the link queues, udp only")
+    parser.add_argument("--seed", type=int, default=1, help="for the random losses")
+    parser.add_argument("--clock-rounds", type=int, default=16)
+    parser.add_argument("--label", default=gitLabel(), help="defaults to git describe")
+    parser.add_argument("--out", help="write the JSON here instead of stdout")
+    parser.add_argument("--compare", help="an earlier result to print the changes against")
+    args = parser.parse_args()
+
+    shaper = Shaper(args.loss, args.bandwidth, args.queue, args.seed)
+    frames = []
+    clock = None
+    motion = None
+    if args.transport == "http":
+        if not args.host:
+            parser.error("http needs --host")
+        before = syncClock(args.host, args.http_port, args.clock_rounds)
+        motionBefore = readMotion(args.host, args.http_port)
+        receiveHttp(args, shaper, frames)
+        motionAfter = readMotion(args.host, args.http_port)
+        after = syncClock(args.host, args.http_port, args.clock_rounds)
+        # the clocks drift apart a little over a run, the middle is closest
+        clock = {
+            "offset_us": (before["offset_us"] + after["offset_us"]) // 2,
+            "rtt_us": min(before["rtt_us"], after["rtt_us"]),
+            "drift_us": after["offset_us"] - before["offset_us"],
+        }
+        drops = {}
+        if motionBefore and motionAfter:
+            saved = motionAfter["saved"] - motionBefore["saved"]
+            received = sum(f["size"] for f in frames)
+            motion = {
+                "held_frames": motionAfter["held"] - motionBefore["held"],
+                "saved_bytes": saved,
+                "saved_share": round(saved / (saved + received), 3) if saved + received else 0,
+            }
+    else:
+        drops = receiveUdp(args, shaper, frames)
+
+    result = summarize(args, frames, clock, drops, shaper, motion)
+    text = json.dumps(result, indent=2)
+    if args.out:
+        with open(args.out, "w") as f:
+            f.write(text + "\n")
+    else:
+        print(text)
+    if args.compare:
+        with open(args.compare) as f:
+            print(compare(json.load(f), result), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
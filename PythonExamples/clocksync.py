@@ -0,0 +1,283 @@
+"""
+Host side of the tracker clock sync. While this runs, the tracker keeps
+track of this machine's clock and stamps every stream frame with
+X-Host-Timestamp, microseconds since the Unix epoch on this machine, next to
+its own X-Timestamp.
+
+    # answer a tracker, prints how the sync is going every few seconds
+    python clocksync.py serve --host openiristracker.local
+
+    # both eyes, and have them take their frames together at 55 fps
+    python clocksync.py serve --host left.local right.local --sync-fps 55
+
+    # how far apart the eyes take the frames of the same slot, exits with 1 if
+    # it ends up over --max-skew-us
+    python clocksync.py skew --host left.local right.local
+
+    # check the estimator against a simulated drifting clock, exits with 1 if
+    # the error ends up over --max-error-us
+    python clocksync.py simulate --drift-ppm 40 --jitter-us 800
+
+Only the standard library is needed. The tracker asks for the time every
+half a second over UDP port 83. Every datagram is "OICS", a type byte, 3
+reserved, a sequence number and three timestamps, little endian. An announce
+(0) tells the tracker where to send its requests. A request (1) carries the
+tracker's send time t1. The answer (2) echoes t1 and adds when this machine
+received the request, t2, and when it answered, t3.
+
+A beacon (3) hands out frame slots: one every t2 microseconds from t1, on
+this machine's clock. The trackers stretch their frames until each starts on
+a slot, which needs a rate a little below what the camera does on its own,
+and stamp them with X-Sync-Seq, the slot number. Frames of the same slot
+were taken together, their X-Host-Timestamp tells how close.
+
+The estimator below mirrors ESP/lib/src/network/ClockSync/clockEstimator.cpp,
+simulate runs it on the same exchanges the tracker would see.
+"""
+
+import argparse
+import json
+import random
+import socket
+import struct
+import sys
+import threading
+import time
+import urllib.request
+
+PACKET = struct.Struct("<4sB3xIqqq")
+MAGIC = b"OICS"
+ANNOUNCE, REQUEST, RESPONSE, BEACON = 0, 1, 2, 3
+PORT = 83
+
+
+def hostUs():
+    return time.time_ns() // 1000
+
+
+class Estimator:
+    """Offset and drift from the exchanges with the quickest round trips"""
+
+    WINDOW = 64
+    MIN_SAMPLES = 4
+    STEP_US = 5000
+
+    def __init__(self):
+        self.reset()
+
+    def reset(self):
+        self.points = []
+        self.maxDelay = 0
+        self.minDelay = 0
+        self.origin = 0
+        self.base = 0.0
+        self.slope = 0.0
+
+    def synced(self):
+        return len(self.points) >= self.MIN_SAMPLES
+
+    def offsetUs(self, localUs):
+        return int(self.base + self.slope * (localUs - self.origin))
+
+    def toHost(self, localUs):
+        return localUs + self.offsetUs(localUs)
+
+    def add(self, t1, t2, t3, t4):
+        local = t1 + (t4 - t1) // 2
+        offset = ((t2 - t1) + (t3 - t4)) // 2
+        delay = max(0, (t4 - t1) - (t3 - t2))
+        if self.synced() and delay <= self.maxDelay:
+            if abs(offset - self.offsetUs(local)) > self.STEP_US:
+                self.reset()
+        self.points = (self.points + [(local, offset, delay)])[-self.WINDOW :]
+        self.fit()
+
+    def fit(self):
+        delays = sorted(p[2] for p in self.points)
+        quickest = min(len(delays), max(self.MIN_SAMPLES, len(delays) // 4))
+        self.maxDelay = delays[quickest - 1]
+        self.minDelay = delays[0]
+        kept = [p for p in self.points if p[2] <= self.maxDelay]
+        self.origin = self.points[-1][0]
+        meanX = sum(p[0] - self.origin for p in kept) / len(kept)
+        meanY = sum(p[1] for p in kept) / len(kept)
+        sxx = sum((p[0] - self.origin - meanX) ** 2 for p in kept)
+        sxy = sum((p[0] - self.origin - meanX) * (p[1] - meanY) for p in kept)
+        self.slope = sxy / sxx if sxx > 0 else 0.0
+        self.base = meanY - self.slope * meanX
+
+
+def serve(args):
+    addresses = [(socket.gethostbyname(host), PORT) for host in args.host]
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(0.5)
+    lastAnnounce = lastStatus = 0
+    # the slots start on a whole second, any time both eyes agree on would do
+    period = round(1e6 / args.sync_fps) if args.sync_fps else 0
+    epoch = hostUs() // 1000000 * 1000000
+    print("Answering %s, Ctrl+C to stop" % ", ".join("%s:%d" % a for a in addresses), file=sys.stderr)
+
+    while True:
+        now = time.monotonic()
+        # again and again, the tracker forgets when it restarts
+        if now - lastAnnounce > 1:
+            for address in addresses:
+                sock.sendto(PACKET.pack(MAGIC, ANNOUNCE, 0, 0, 0, 0), address)
+                if period:
+                    sock.sendto(PACKET.pack(MAGIC, BEACON, 0, epoch, period, 0), address)
+            lastAnnounce = now
+        if args.status and now - lastStatus > args.status:
+            lastStatus = now
+            for host in args.host:
+                try:
+                    url = "http://%s:%d/clock" % (host, args.http_port)
+                    with urllib.request.urlopen(url, timeout=2) as response:
+                        print(host, json.dumps(json.load(response)), file=sys.stderr)
+                except OSError as e:
+                    print("No status from %s: %s" % (host, e), file=sys.stderr)
+
+        try:
+            data, sender = sock.recvfrom(64)
+        except socket.timeout:
+            continue
+        received = hostUs()
+        if len(data) != PACKET.size:
+            continue
+        magic, kind, seq, t1, _, _ = PACKET.unpack(data)
+        if magic != MAGIC or kind != REQUEST:
+            continue
+        sock.sendto(PACKET.pack(MAGIC, RESPONSE, seq, t1, received, hostUs()), sender)
+
+
+def readSlots(host, port, seconds, slots):
+    """X-Host-Timestamp of every frame by X-Sync-Seq, for seconds"""
+    boundary = b"--123456789000000000000987654321\r\n"
+    sock = socket.create_connection((host, port), timeout=5)
+    sock.sendall(b"GET / HTTP/1.1\r\nHost: %s\r\n\r\n" % host.encode())
+    buffer = b""
+    end = time.monotonic() + seconds
+    while time.monotonic() < end:
+        chunk = sock.recv(4096)
+        if not chunk:
+            break
+        buffer += chunk
+        while True:
+            start = buffer.find(boundary)
+            if start < 0:
+                break
+            head, found, rest = buffer[start + len(boundary) :].partition(b"\r\n\r\n")
+            if not found:
+                break
+            fields = dict(line.split(b": ", 1) for line in head.split(b"\r\n") if b": " in line)
+            length = int(fields.get(b"Content-Length", 0))
+            if len(rest) < length:
+                break
+            if b"X-Sync-Seq" in fields and b"X-Host-Timestamp" in fields:
+                whole, _, micros = fields[b"X-Host-Timestamp"].partition(b".")
+                slots[int(fields[b"X-Sync-Seq"])] = int(whole) * 1000000 + int(micros)
+            buffer = rest[length:]
+    sock.close()
+
+
+def skew(args):
+    slots = [{}, {}]
+    readers = [
+        threading.Thread(target=readSlots, args=(host, args.http_port, args.seconds, found))
+        for host, found in zip(args.host, slots)
+    ]
+    for reader in readers:
+        reader.start()
+    for reader in readers:
+        reader.join()
+
+    paired = sorted(abs(slots[0][seq] - slots[1][seq]) for seq in slots[0].keys() & slots[1].keys())
+    if not paired:
+        print("No frames of the same slot, is serve --sync-fps running?", file=sys.stderr)
+        return 1
+    result = {
+        "frames": [len(found) for found in slots],
+        "paired": len(paired),
+        "skew_us": {
+            "p50": paired[len(paired) // 2],
+            "p99": paired[int(len(paired) * 0.99)],
+            "max": paired[-1],
+        },
+    }
+    print(json.dumps(result, indent=2))
+    return 0 if result["skew_us"]["p99"] <= args.max_skew_us else 1
+
+
+def simulate(args):
+    """Virtual time, the tracker's clock is the true one, ours drifts"""
+    rng = random.Random(args.seed)
+    estimator = Estimator()
+    hostOffset = 1_700_000_000_000_000
+
+    def host(trueUs):
+        return int(hostOffset + trueUs * (1 + args.drift_ppm * 1e-6))
+
+    errors = []
+    interval = 500_000
+    for i in range(int(args.seconds * 1e6 / interval)):
+        t = i * interval + 12345
+        up = args.base_delay_us + args.asymmetry_us + rng.expovariate(1 / args.jitter_us)
+        down = args.base_delay_us + rng.expovariate(1 / args.jitter_us)
+        if rng.random() < args.loss:
+            continue
+        estimator.add(t, host(t + up), host(t + up + 50), int(t + up + 50 + down))
+        # half a minute to settle, then every frame between two exchanges
+        if t > 30e6 and estimator.synced():
+            probe = t + interval // 2
+            errors.append(abs(estimator.toHost(probe) - host(probe)))
+
+    errors.sort()
+    result = {
+        "drift_ppm": args.drift_ppm,
+        "estimated_drift_ppm": round(estimator.slope * 1e6, 2),
+        "error_us": {
+            "p50": errors[len(errors) // 2],
+            "p99": errors[int(len(errors) * 0.99)],
+            "max": errors[-1],
+        },
+    }
+    print(json.dumps(result, indent=2))
+    return 0 if result["error_us"]["p99"] <= args.max_error_us else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    serveParser = commands.add_parser("serve", help="answer trackers")
+    serveParser.add_argument("--host", required=True, nargs="+", help="the trackers")
+    serveParser.add_argument("--http-port", type=int, default=80)
+    serveParser.add_argument("--status", type=float, default=5, help="seconds between status lines, 0 for none")
+    serveParser.add_argument("--sync-fps", type=float, default=0, help="hand out frame slots at this rate, 0 for none")
+
+    skewParser = commands.add_parser("skew", help="measure how far apart two eyes take their frames")
+    skewParser.add_argument("--host", required=True, nargs=2, help="the trackers of both eyes")
+    skewParser.add_argument("--http-port", type=int, default=80)
+    skewParser.add_argument("--seconds", type=float, default=30)
+    skewParser.add_argument("--max-skew-us", type=float, default=1000)
+
+    simulateParser = commands.add_parser("simulate", help="check the estimator against a drifting clock")
+    simulateParser.add_argument("--seconds", type=float, default=300)
+    simulateParser.add_argument("--drift-ppm", type=float, default=40)
+    simulateParser.add_argument("--base-delay-us", type=float, default=1500, help="one way, without queueing")
+    simulateParser.add_argument("--jitter-us", type=float, default=500, help="mean queueing, each way")
+    simulateParser.add_argument("--asymmetry-us", type=float, default=100, help="extra on the way to the host")
+    simulateParser.add_argument("--loss", type=float, default=0.02)
+    simulateParser.add_argument("--seed", type=int, default=1)
+    simulateParser.add_argument("--max-error-us", type=float, default=1000)
+
+    args = parser.parse_args()
+    if args.command == "serve":
+        serve(args)
+    elif args.command == "skew":
+        sys.exit(skew(args))
+    else:
+        sys.exit(simulate(args))
+
+
+if __name__ == "__main__":
+    main()
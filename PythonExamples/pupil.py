@@ -0,0 +1,92 @@
+"""
+Takes the pupil from a tracker built with VISION_ENABLED, instead of finding
+it in the frames. Prints a JSON line per frame:
+
+    python pupil.py --host openiristracker.local
+
+The tracker sends a 72 byte datagram for every frame to whoever asked on
+/vision in the last 10 seconds, this asks every few seconds. Little endian:
+"OIPU", the frame number, the frame slot shared with the other eye (-1
+without one, see clocksync.py), the frame's timestamp on the tracker's clock
+and on the host's (-1 while not synced), then the pupil ellipse in frame
+pixels as floats: centre x and y, the semi axes, the angle of the major one in
+radians clockwise from the x axis and a confidence, 0 for no pupil. Then how
+far open the eye is, 0 closed to 1 open (-1 if it couldn't tell), and the
+latest blink: how many there were since boot, when it started on the
+tracker's clock and how long it took in microseconds. The latest blink comes
+with every frame until the next, a new count means a new blink, which gets a
+line of its own.
+
+Only the standard library is needed.
+"""
+
+import argparse
+import json
+import socket
+import struct
+import sys
+import time
+import urllib.request
+
+PACKET = struct.Struct("<4sIiqq7fIqI")
+MAGIC = b"OIPU"
+
+
+def subscribe(args, port):
+    url = "http://%s:%d/vision?port=%d" % (args.host, args.http_port, port)
+    try:
+        with urllib.request.urlopen(url, timeout=2) as response:
+            response.read()
+    except OSError as e:
+        print("Could not subscribe: %s" % e, file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", required=True, help="the tracker")
+    parser.add_argument("--http-port", type=int, default=80)
+    parser.add_argument("--port", type=int, default=0, help="where to take the datagrams, any free one by default")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("", args.port))
+    sock.settimeout(0.5)
+    port = sock.getsockname()[1]
+    lastSubscribe = 0
+    blinks = None
+
+    while True:
+        # well within the lease
+        if time.monotonic() - lastSubscribe > 3:
+            subscribe(args, port)
+            lastSubscribe = time.monotonic()
+        try:
+            data = sock.recv(64)
+        except socket.timeout:
+            continue
+        if len(data) != PACKET.size:
+            continue
+        magic, frame, seq, timestamp, hostTimestamp, x, y, major, minor, angle, confidence, openness, count, blinkStart, blinkDuration = PACKET.unpack(data)
+        if magic != MAGIC:
+            continue
+        # the first packet only says how many there were before
+        if blinks is not None and count != blinks:
+            print(json.dumps({"blink": count, "start_us": blinkStart, "duration_us": blinkDuration}), flush=True)
+        blinks = count
+        print(json.dumps({
+            "frame": frame,
+            "sync_seq": seq,
+            "timestamp_us": timestamp,
+            "host_timestamp_us": hostTimestamp,
+            "x": round(x, 2),
+            "y": round(y, 2),
+            "major": round(major, 2),
+            "minor": round(minor, 2),
+            "angle": round(angle, 3),
+            "confidence": round(confidence, 2),
+            "openness": round(openness, 2),
+        }), flush=True)
+
+
+if __name__ == "__main__":
+    main()
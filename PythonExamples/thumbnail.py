@@ -0,0 +1,100 @@
+"""
+Takes the small grayscale thumbnails of a tracker built with
+THUMBNAIL_ENABLED, instead of the full frames. Prints a JSON line per
+thumbnail, and saves them as PGM images with --save:
+
+    python thumbnail.py --host openiristracker.local --save thumbs/
+
+For a quick look a browser does too, http://openiristracker.local/thumbnail
+is the latest one as a BMP.
+
+The tracker sends every thumbnail to whoever asked on /thumbnail?port=N in
+the last 10 seconds, this asks every few seconds. Each comes in datagrams of
+a few rows. Every datagram starts with a 36 byte header, little endian:
+"OITH", the thumbnail number, the frame slot shared with the other eye (-1
+without one, see clocksync.py), the frame's timestamp on the tracker's clock
+and on the host's (-1 while not synced), the width and height of the
+thumbnail, the first row in the datagram and how many rows. The rows follow,
+one byte per pixel. A thumbnail with a lost datagram is left out.
+
+Only the standard library is needed.
+"""
+
+import argparse
+import json
+import os
+import socket
+import struct
+import sys
+import time
+import urllib.request
+
+HEADER = struct.Struct("<4sIiqqHHHH")
+MAGIC = b"OITH"
+
+
+def subscribe(args, port):
+    url = "http://%s:%d/thumbnail?port=%d" % (args.host, args.http_port, port)
+    try:
+        with urllib.request.urlopen(url, timeout=2) as response:
+            response.read()
+    except OSError as e:
+        print("Could not subscribe: %s" % e, file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", required=True, help="the tracker")
+    parser.add_argument("--http-port", type=int, default=80)
+    parser.add_argument("--port", type=int, default=0, help="where to take the datagrams, any free one by default")
+    parser.add_argument("--save", help="write every thumbnail to this directory as a PGM")
+    args = parser.parse_args()
+
+    if args.save:
+        os.makedirs(args.save, exist_ok=True)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("", args.port))
+    sock.settimeout(0.5)
+    port = sock.getsockname()[1]
+    lastSubscribe = 0
+    current = None  # the number, the header fields and the rows so far
+
+    while True:
+        # well within the lease
+        if time.monotonic() - lastSubscribe > 3:
+            subscribe(args, port)
+            lastSubscribe = time.monotonic()
+        try:
+            data = sock.recv(2048)
+        except socket.timeout:
+            continue
+        if len(data) < HEADER.size:
+            continue
+        magic, number, seq, timestamp, hostTimestamp, width, height, firstRow, rows = HEADER.unpack_from(data)
+        pixels = data[HEADER.size :]
+        if magic != MAGIC or len(pixels) != width * rows:
+            continue
+        if current is None or current[0] != number:
+            current = (number, (seq, timestamp, hostTimestamp, width, height), {})
+        current[2][firstRow] = pixels
+        if sum(len(part) for part in current[2].values()) < width * height:
+            continue
+
+        image = b"".join(current[2][row] for row in sorted(current[2]))
+        current = None
+        print(json.dumps({
+            "thumbnail": number,
+            "sync_seq": seq,
+            "timestamp_us": timestamp,
+            "host_timestamp_us": hostTimestamp,
+            "width": width,
+            "height": height,
+            "mean": round(sum(image) / len(image), 1),
+        }), flush=True)
+        if args.save:
+            with open(os.path.join(args.save, "%08d.pgm" % number), "wb") as f:
+                f.write(b"P5\n%d %d\n255\n" % (width, height) + image)
+
+
+if __name__ == "__main__":
+    main()